@@ -25,6 +25,9 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
+#include "MCPCompileBatch.h"
+#include "MCPGraphPatch.h"
+#include "ScopedTransaction.h"
 
 FEpicUnrealMCPBlueprintCommands::FEpicUnrealMCPBlueprintCommands()
 {
@@ -60,6 +63,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCommand(const FSt
     {
         return HandleSetMeshMaterialColor(Params);
     }
+    else if (CommandType == TEXT("patch_blueprint_graph"))
+    {
+        return HandlePatchBlueprintGraph(Params);
+    }
     
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint command: %s"), *CommandType));
 }
@@ -220,7 +227,9 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleAddComponentToBlu
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown component type: %s"), *ComponentType));
     }
 
-    // Add the component to the blueprint
+    // Add the component to the blueprint, recorded for undo
+    Blueprint->Modify();
+    Blueprint->SimpleConstructionScript->Modify();
     USCS_Node* NewNode = Blueprint->SimpleConstructionScript->CreateNode(ComponentClass, *ComponentName);
     if (NewNode)
     {
@@ -245,8 +254,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleAddComponentToBlu
         // Add to root if no parent specified
         Blueprint->SimpleConstructionScript->AddNode(NewNode);
 
-        // Compile the blueprint
-        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        // Compile the blueprint, once at the end when this is part of a batch
+        FMCPCompileBatch::RequestCompile(Blueprint);
 
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
         ResultObj->SetStringField(TEXT("component_name"), ComponentName);
@@ -302,6 +311,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetPhysicsPropert
     }
 
     // Set physics properties
+    PrimComponent->Modify();
     if (Params->HasField(TEXT("simulate_physics")))
     {
         PrimComponent->SetSimulatePhysics(Params->GetBoolField(TEXT("simulate_physics")));
@@ -350,11 +360,12 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCompileBlueprint(
     }
 
     // Compile the blueprint
-    FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    FMCPCompileBatch::RequestCompile(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("name"), BlueprintName);
     ResultObj->SetBoolField(TEXT("compiled"), true);
+    ResultObj->SetBoolField(TEXT("deferred"), FMCPCompileBatch::IsBatching());
     return ResultObj;
 }
 
@@ -389,6 +400,9 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintAct
 
     UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Blueprint found, getting transform parameters"));
 
+    // Earlier commands in the same batch may have changed the class
+    FMCPCompileBatch::FlushCompile(Blueprint);
+
     // Get transform parameters
     FVector Location(0.0f, 0.0f, 0.0f);
     FRotator Rotation(0.0f, 0.0f, 0.0f);
@@ -653,4 +667,74 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialCo
     
     ResultObj->SetBoolField(TEXT("success"), true);
     return ResultObj;
-}
\ No newline at end of file
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandlePatchBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get required parameters
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* NodeDescs = nullptr;
+    const TArray<TSharedPtr<FJsonValue>>* EdgeDescs = nullptr;
+    const bool bHasNodes = Params->TryGetArrayField(TEXT("nodes"), NodeDescs);
+    const bool bHasEdges = Params->TryGetArrayField(TEXT("edges"), EdgeDescs);
+    if (!bHasNodes && !bHasEdges)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'nodes' or 'edges' parameter"));
+    }
+
+    // Find the blueprint
+    UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+    }
+
+    // The event graph unless another graph is named
+    FString GraphName;
+    UEdGraph* Graph = nullptr;
+    if (!Params->TryGetStringField(TEXT("graph"), GraphName) || GraphName.IsEmpty() || GraphName == TEXT("EventGraph"))
+    {
+        Graph = FEpicUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
+    }
+    else
+    {
+        TArray<UEdGraph*> Graphs;
+        Blueprint->GetAllGraphs(Graphs);
+        for (UEdGraph* Candidate : Graphs)
+        {
+            if (Candidate && Candidate->GetName() == GraphName)
+            {
+                Graph = Candidate;
+                break;
+            }
+        }
+    }
+    if (!Graph)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+
+    // The whole patch is one undo step
+    static const TArray<TSharedPtr<FJsonValue>> NoDescs;
+    TSharedPtr<FJsonObject> ResultObj;
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "PatchGraphTransaction", "MCP Graph Patch"));
+        ResultObj = FMCPGraphPatch(Blueprint, Graph).Apply(bHasNodes ? *NodeDescs : NoDescs, bHasEdges ? *EdgeDescs : NoDescs);
+    }
+
+    bool bCompile = false;
+    if (Params->TryGetBoolField(TEXT("compile"), bCompile) && bCompile)
+    {
+        FMCPCompileBatch::RequestCompile(Blueprint);
+    }
+
+    ResultObj->SetStringField(TEXT("blueprint_name"), BlueprintName);
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetBoolField(TEXT("compiled"), bCompile);
+    return ResultObj;
+}
@@ -1,4 +1,5 @@
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "MCPBlueprintCatalog.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
@@ -153,24 +154,20 @@ UBlueprint* FEpicUnrealMCPCommonUtils::FindBlueprint(const FString& BlueprintNam
 
 UBlueprint* FEpicUnrealMCPCommonUtils::FindBlueprintByName(const FString& BlueprintName)
 {
-    // The correct object path for a Blueprint asset is /Game/Path/AssetName.AssetName
-    FString ObjectPath = FString::Printf(TEXT("/Game/Blueprints/%s.%s"), *BlueprintName, *BlueprintName);
-
-    // First, try to load the object directly, as it's the fastest method.
-    UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *ObjectPath);
+    // The catalog knows every blueprint the asset registry does, by short name or by path
+    FMCPBlueprintCatalog& Catalog = FMCPBlueprintCatalog::Get();
+    UBlueprint* Blueprint = Catalog.FindBlueprint(BlueprintName);
     if (Blueprint)
     {
         return Blueprint;
     }
 
-    // If direct loading fails, try to find the asset using the Asset Registry.
-    // This is more robust for newly created assets.
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    FAssetData AssetData = AssetRegistryModule.Get().GetAssetByObjectPath(FSoftObjectPath(ObjectPath));
-
-    if (AssetData.IsValid())
+    // While the registry is still scanning, a blueprint it has not reached yet can still be loaded directly.
+    // The correct object path for a Blueprint asset is /Game/Path/AssetName.AssetName
+    if (Catalog.IsDiscovering())
     {
-        Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+        FString ObjectPath = FString::Printf(TEXT("/Game/Blueprints/%s.%s"), *BlueprintName, *BlueprintName);
+        Blueprint = LoadObject<UBlueprint>(nullptr, *ObjectPath);
         if (Blueprint)
         {
             return Blueprint;
@@ -22,8 +22,112 @@
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EditorAssetLibrary.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
+#include "MCPActorIndex.h"
+
+namespace
+{
+    // What get_actors_in_level reports per actor
+    enum class EActorFields : uint8
+    {
+        Default,    // name, class and transform, as it always was
+        Name,
+        Transform,
+        Detailed
+    };
+
+    constexpr int32 DefaultPageSize = 1000;
+    constexpr int32 MaxPageSize = 10000;
+
+    bool ParseActorFields(const TSharedPtr<FJsonObject>& Params, EActorFields& OutFields)
+    {
+        FString FieldsString;
+        OutFields = EActorFields::Default;
+        if (!Params.IsValid() || !Params->TryGetStringField(TEXT("fields"), FieldsString))
+        {
+            return true;
+        }
+
+        static const TMap<FString, EActorFields> FieldNames = {
+            { TEXT("default"), EActorFields::Default },
+            { TEXT("name"), EActorFields::Name },
+            { TEXT("transform"), EActorFields::Transform },
+            { TEXT("detailed"), EActorFields::Detailed }
+        };
+
+        const EActorFields* Fields = FieldNames.Find(FieldsString);
+        if (!Fields)
+        {
+            return false;
+        }
+        OutFields = *Fields;
+        return true;
+    }
+
+    int32 GetPageSize(const TSharedPtr<FJsonObject>& Params)
+    {
+        int32 Limit = DefaultPageSize;
+        if (Params.IsValid())
+        {
+            Params->TryGetNumberField(TEXT("limit"), Limit);
+        }
+        return FMath::Clamp(Limit, 1, MaxPageSize);
+    }
+
+    TSharedPtr<FJsonValue> ProjectActor(AActor* Actor, EActorFields Fields)
+    {
+        if (Fields == EActorFields::Default)
+        {
+            return FEpicUnrealMCPCommonUtils::ActorToJson(Actor);
+        }
+
+        TSharedPtr<FJsonObject> ActorObject;
+        if (Fields == EActorFields::Name)
+        {
+            ActorObject = MakeShared<FJsonObject>();
+            ActorObject->SetStringField(TEXT("name"), Actor->GetName());
+            return MakeShared<FJsonValueObject>(ActorObject);
+        }
+
+        ActorObject = FEpicUnrealMCPCommonUtils::ActorToJsonObject(Actor);
+        if (Fields == EActorFields::Transform)
+        {
+            ActorObject->RemoveField(TEXT("class"));
+        }
+        else
+        {
+            TArray<TSharedPtr<FJsonValue>> TagArray;
+            for (const FName& Tag : Actor->Tags)
+            {
+                TagArray.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+            }
+            ActorObject->SetStringField(TEXT("label"), Actor->GetActorLabel());
+            ActorObject->SetStringField(TEXT("folder"), Actor->GetFolderPath().ToString());
+            ActorObject->SetArrayField(TEXT("tags"), TagArray);
+            ActorObject->SetBoolField(TEXT("hidden"), Actor->IsHiddenEd());
+        }
+        return MakeShared<FJsonValueObject>(ActorObject);
+    }
+
+    TSharedPtr<FJsonObject> MakeActorPage(const TArray<AActor*>& Actors, EActorFields Fields, bool bMore)
+    {
+        TArray<TSharedPtr<FJsonValue>> ActorArray;
+        ActorArray.Reserve(Actors.Num());
+        for (AActor* Actor : Actors)
+        {
+            ActorArray.Add(ProjectActor(Actor, Fields));
+        }
+
+        // An empty cursor means this was the last page
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+        ResultObj->SetNumberField(TEXT("count"), Actors.Num());
+        ResultObj->SetStringField(TEXT("next_cursor"), (bMore && Actors.Num() > 0) ? Actors.Last()->GetName() : FString());
+        return ResultObj;
+    }
+}
 
 FEpicUnrealMCPEditorCommands::FEpicUnrealMCPEditorCommands()
+    : ActorIndex(MakeShared<FMCPActorIndex>())
 {
 }
 
@@ -61,6 +165,23 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FStrin
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
 {
+    EActorFields Fields;
+    if (!ParseActorFields(Params, Fields))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Unknown 'fields', expected name, transform, detailed or default"));
+    }
+
+    // A page in name order when a cursor or limit is given
+    if (Params.IsValid() && (Params->HasField(TEXT("cursor")) || Params->HasField(TEXT("limit"))))
+    {
+        FString Cursor;
+        Params->TryGetStringField(TEXT("cursor"), Cursor);
+
+        TArray<AActor*> Page;
+        const bool bMore = GetActorPage(GWorld, Cursor, GetPageSize(Params), Page);
+        return MakeActorPage(Page, Fields, bMore);
+    }
+
     TArray<AActor*> AllActors;
     UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
     
@@ -69,7 +190,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(con
     {
         if (Actor)
         {
-            ActorArray.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
+            ActorArray.Add(ProjectActor(Actor, Fields));
         }
     }
     
@@ -86,17 +207,56 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(con
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
     }
-    
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+
+    // Optional 'match' (contains, exact, prefix, glob) and 'by' (name, label, class, folder)
+    FString MatchString = TEXT("contains");
+    FString ByString = TEXT("name");
+    Params->TryGetStringField(TEXT("match"), MatchString);
+    Params->TryGetStringField(TEXT("by"), ByString);
+
+    static const TMap<FString, EMCPActorMatch> MatchNames = {
+        { TEXT("contains"), EMCPActorMatch::Contains },
+        { TEXT("exact"), EMCPActorMatch::Exact },
+        { TEXT("prefix"), EMCPActorMatch::Prefix },
+        { TEXT("glob"), EMCPActorMatch::Glob }
+    };
+    static const TMap<FString, EMCPActorKey> KeyNames = {
+        { TEXT("name"), EMCPActorKey::Name },
+        { TEXT("label"), EMCPActorKey::Label },
+        { TEXT("class"), EMCPActorKey::Class },
+        { TEXT("folder"), EMCPActorKey::Folder }
+    };
+
+    const EMCPActorMatch* Match = MatchNames.Find(MatchString);
+    if (!Match)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown match: %s"), *MatchString));
+    }
+    const EMCPActorKey* Key = KeyNames.Find(ByString);
+    if (!Key)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown key: %s"), *ByString));
+    }
+
+    TArray<AActor*> FoundActors;
+    if (FMCPActorIndex* Index = GetActorIndex(GWorld))
+    {
+        Index->Query(*Key, *Match, Pattern, FoundActors);
+    }
+    else
+    {
+        TArray<AActor*> AllActors;
+        UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+        FoundActors = AllActors.FilterByPredicate([Key = *Key, Match = *Match, &Pattern](const AActor* Actor)
+        {
+            return FMCPActorIndex::Matches(Actor, Key, Match, Pattern);
+        });
+    }
     
     TArray<TSharedPtr<FJsonValue>> MatchingActors;
-    for (AActor* Actor : AllActors)
+    for (AActor* Actor : FoundActors)
     {
-        if (Actor && Actor->GetName().Contains(Pattern))
-        {
-            MatchingActors.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
-        }
+        MatchingActors.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
     }
     
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -149,14 +309,9 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
     }
 
     // Check if an actor with this name already exists
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
-    for (AActor* Actor : AllActors)
+    if (FindActorByName(World, ActorName))
     {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
-        }
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
     }
 
     FActorSpawnParameters SpawnParams;
@@ -227,23 +382,18 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const TS
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
     }
 
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    for (AActor* Actor : AllActors)
+    if (AActor* Actor = FindActorByName(GWorld, ActorName))
     {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            // Store actor info before deletion for the response
-            TSharedPtr<FJsonObject> ActorInfo = FEpicUnrealMCPCommonUtils::ActorToJsonObject(Actor);
-            
-            // Delete the actor
-            Actor->Destroy();
-            
-            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-            ResultObj->SetObjectField(TEXT("deleted_actor"), ActorInfo);
-            return ResultObj;
-        }
+        // Store actor info before deletion for the response
+        TSharedPtr<FJsonObject> ActorInfo = FEpicUnrealMCPCommonUtils::ActorToJsonObject(Actor);
+        
+        // Delete the actor
+        Actor->Modify();
+        Actor->Destroy();
+        
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetObjectField(TEXT("deleted_actor"), ActorInfo);
+        return ResultObj;
     }
     
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
@@ -259,18 +409,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(co
     }
 
     // Find the actor
-    AActor* TargetActor = nullptr;
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
-    for (AActor* Actor : AllActors)
-    {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            TargetActor = Actor;
-            break;
-        }
-    }
+    AActor* TargetActor = FindActorByName(GWorld, ActorName);
 
     if (!TargetActor)
     {
@@ -293,7 +432,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(co
         NewTransform.SetScale3D(FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("scale")));
     }
 
-    // Set the new transform
+    // Set the new transform, recorded for undo
+    TargetActor->Modify();
     TargetActor->SetActorTransform(NewTransform);
 
     // Return updated actor info
@@ -306,3 +446,95 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnBlueprintActor(
     FEpicUnrealMCPBlueprintCommands BlueprintCommands;
     return BlueprintCommands.HandleCommand(TEXT("spawn_blueprint_actor"), Params);
 }
+
+TFunction<bool(TSharedPtr<FJsonObject>&)> FEpicUnrealMCPEditorCommands::CreateActorStream(const TSharedPtr<FJsonObject>& Params)
+{
+    EActorFields Fields;
+    if (!ParseActorFields(Params, Fields))
+    {
+        return [](TSharedPtr<FJsonObject>& OutChunk)
+        {
+            OutChunk = FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Unknown 'fields', expected name, transform, detailed or default"));
+            return false;
+        };
+    }
+
+    FString Cursor;
+    Params->TryGetStringField(TEXT("cursor"), Cursor);
+
+    // Each chunk carries on from the last actor of the one before, by name, so actors
+    // added or deleted while the stream runs do not shift the pages
+    return [this, Fields, Cursor, PageSize = GetPageSize(Params), World = TWeakObjectPtr<UWorld>(GWorld), ChunkIndex = 0](TSharedPtr<FJsonObject>& OutChunk) mutable
+    {
+        if (!World.IsValid())
+        {
+            OutChunk = FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("World was unloaded while streaming its actors"));
+            return false;
+        }
+
+        TArray<AActor*> Page;
+        const bool bMore = GetActorPage(World.Get(), Cursor, PageSize, Page);
+        OutChunk = MakeActorPage(Page, Fields, bMore);
+        OutChunk->SetNumberField(TEXT("chunk"), ChunkIndex++);
+        OutChunk->SetBoolField(TEXT("done"), !bMore);
+        Cursor = OutChunk->GetStringField(TEXT("next_cursor"));
+        return bMore;
+    };
+}
+
+FMCPActorIndex* FEpicUnrealMCPEditorCommands::GetActorIndex(UWorld* World)
+{
+    // Only the editor world is indexed, PIE worlds come and go too quickly to be worth it
+    if (!World || World->WorldType != EWorldType::Editor)
+    {
+        return nullptr;
+    }
+
+    ActorIndex->Bind(World);
+    return ActorIndex.Get();
+}
+
+AActor* FEpicUnrealMCPEditorCommands::FindActorByName(UWorld* World, const FString& ActorName)
+{
+    if (FMCPActorIndex* Index = GetActorIndex(World))
+    {
+        return Index->FindByName(ActorName);
+    }
+
+    TArray<AActor*> AllActors;
+    UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+    for (AActor* Actor : AllActors)
+    {
+        if (Actor && Actor->GetName() == ActorName)
+        {
+            return Actor;
+        }
+    }
+    return nullptr;
+}
+
+bool FEpicUnrealMCPEditorCommands::GetActorPage(UWorld* World, const FString& Cursor, int32 Limit, TArray<AActor*>& OutActors)
+{
+    if (FMCPActorIndex* Index = GetActorIndex(World))
+    {
+        return Index->GetPage(Cursor, Limit, OutActors);
+    }
+
+    // Worlds without an index sort everything for every page
+    TArray<AActor*> AllActors;
+    UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+    AllActors.Sort([](const AActor& A, const AActor& B)
+    {
+        return A.GetName().Compare(B.GetName(), ESearchCase::IgnoreCase) < 0;
+    });
+
+    int32 Start = 0;
+    while (Start < AllActors.Num() && !Cursor.IsEmpty() && AllActors[Start]->GetName().Compare(Cursor, ESearchCase::IgnoreCase) <= 0)
+    {
+        ++Start;
+    }
+
+    const int32 End = FMath::Min(Start + Limit, AllActors.Num());
+    OutActors.Append(AllActors.GetData() + Start, End - Start);
+    return End < AllActors.Num();
+}
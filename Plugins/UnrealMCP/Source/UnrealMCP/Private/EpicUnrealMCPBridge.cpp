@@ -54,11 +54,25 @@
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "MCPCommandDispatcher.h"
+#include "MCPCompileBatch.h"
+#include "MCPServerStats.h"
+#include "HAL/IConsoleManager.h"
+#include "ScopedTransaction.h"
+#include "Editor.h"
+#include "Editor/Transactor.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
 #define MCP_SERVER_PORT 55557
 
+static TAutoConsoleVariable<int32> CVarMCPAllowDebugCommands(
+    TEXT("UnrealMCP.AllowDebugCommands"),
+    0,
+    TEXT("1 to accept debug_sleep, used by the MCP benchmarks to stand in for slow commands."),
+    ECVF_Default
+);
+
 UEpicUnrealMCPBridge::UEpicUnrealMCPBridge()
 {
     EditorCommands = MakeShared<FEpicUnrealMCPEditorCommands>();
@@ -83,6 +97,17 @@ void UEpicUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
     Port = MCP_SERVER_PORT;
     FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
 
+    Dispatcher = MakeShared<FMCPCommandDispatcher, ESPMode::ThreadSafe>(
+        [this](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+        {
+            return ExecuteCommandOnGameThread(CommandType, Params);
+        },
+        [this](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+        {
+            return CreateResponseStream(CommandType, Params);
+        });
+    Dispatcher->Start();
+
     // Start the server automatically
     StartServer();
 }
@@ -92,6 +117,13 @@ void UEpicUnrealMCPBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Shutting down"));
     StopServer();
+
+    // After the server, so no connection is left to submit to it
+    if (Dispatcher.IsValid())
+    {
+        Dispatcher->Stop();
+        Dispatcher.Reset();
+    }
 }
 
 // Start the MCP server
@@ -132,7 +164,7 @@ void UEpicUnrealMCPBridge::StartServer()
     }
 
     // Start listening
-    if (!NewListenerSocket->Listen(5))
+    if (!NewListenerSocket->Listen(FMCPServerRunnable::ListenBacklog))
     {
         UE_LOG(LogTemp, Error, TEXT("EpicUnrealMCPBridge: Failed to start listening"));
         return;
@@ -191,99 +223,261 @@ void UEpicUnrealMCPBridge::StopServer()
     UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Server stopped"));
 }
 
-// Execute a command received from a client
+// Queue a command for the game thread, the response arrives through the request's OnComplete
+void UEpicUnrealMCPBridge::SubmitCommand(FMCPCommandRequest&& Request)
+{
+    if (!Dispatcher.IsValid())
+    {
+        if (Request.OnComplete)
+        {
+            Request.OnComplete(MakeErrorResponse(TEXT("Server stopped")));
+        }
+        return;
+    }
+
+    Dispatcher->Submit(MoveTemp(Request));
+}
+
+// Execute a command and wait for its response, for callers that are not on the game thread
 FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
-    UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Executing command: %s"), *CommandType);
-    
-    // Create a promise to wait for the result
-    TPromise<FString> Promise;
-    TFuture<FString> Future = Promise.GetFuture();
+    UE_LOG_MCP_SAMPLED(Verbose, TEXT("EpicUnrealMCPBridge: Executing command: %s"), *CommandType);
+
+    // Waiting for the game thread from the game thread would never return
+    if (IsInGameThread())
+    {
+        return SerializeResponse(ExecuteCommandOnGameThread(CommandType, Params));
+    }
+
+    TSharedRef<TPromise<FString>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<FString>, ESPMode::ThreadSafe>();
+    TFuture<FString> Future = Promise->GetFuture();
+
+    FMCPCommandRequest Request;
+    Request.CommandType = CommandType;
+    Request.Params = Params;
+    Request.OnComplete = [Promise](const TSharedRef<FJsonObject>& Response)
+    {
+        Promise->SetValue(SerializeResponse(Response));
+    };
+    SubmitCommand(MoveTemp(Request));
+
+    return Future.Get();
+}
+
+// Route a command to its handler, game thread only
+TSharedRef<FJsonObject> UEpicUnrealMCPBridge::ExecuteCommandOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    check(IsInGameThread());
+
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
     
-    // Queue execution on Game Thread
-    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+    try
     {
-        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+        TSharedPtr<FJsonObject> ResultJson;
+        
+        if (CommandType == TEXT("ping"))
+        {
+            ResultJson = MakeShareable(new FJsonObject);
+            ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+        }
+        // Editor Commands (including actor manipulation)
+        else if (CommandType == TEXT("get_actors_in_level") || 
+                 CommandType == TEXT("find_actors_by_name") ||
+                 CommandType == TEXT("spawn_actor") ||
+                 CommandType == TEXT("delete_actor") || 
+                 CommandType == TEXT("set_actor_transform") ||
+                 CommandType == TEXT("spawn_blueprint_actor"))
+        {
+            ResultJson = EditorCommands->HandleCommand(CommandType, Params);
+        }
+        // Blueprint Commands
+        else if (CommandType == TEXT("create_blueprint") || 
+                 CommandType == TEXT("add_component_to_blueprint") || 
+                 CommandType == TEXT("set_physics_properties") ||
+                 CommandType == TEXT("compile_blueprint") ||
+                 CommandType == TEXT("set_static_mesh_properties") ||
+                 CommandType == TEXT("set_mesh_material_color") ||
+                 CommandType == TEXT("patch_blueprint_graph"))
+        {
+            ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
+        }
+        // Several commands in one go
+        else if (CommandType == TEXT("batch"))
+        {
+            ResultJson = ExecuteBatch(Params);
+        }
+        // Stand-in slow command for the dispatch benchmark
+        else if (CommandType == TEXT("debug_sleep") && CVarMCPAllowDebugCommands.GetValueOnGameThread() != 0)
+        {
+            const double Milliseconds = Params.IsValid() && Params->HasField(TEXT("ms")) ? Params->GetNumberField(TEXT("ms")) : 0.0;
+            FPlatformProcess::Sleep(static_cast<float>(FMath::Clamp(Milliseconds, 0.0, 1000.0) / 1000.0));
+            ResultJson = MakeShareable(new FJsonObject);
+            ResultJson->SetNumberField(TEXT("ms"), Milliseconds);
+        }
+        else
+        {
+            return MakeErrorResponse(FString::Printf(TEXT("Unknown command: %s"), *CommandType));
+        }
+        
+        // Check if the result contains an error
+        bool bSuccess = true;
+        FString ErrorMessage;
         
-        try
+        if (ResultJson->HasField(TEXT("success")))
         {
-            TSharedPtr<FJsonObject> ResultJson;
-            
-            if (CommandType == TEXT("ping"))
+            bSuccess = ResultJson->GetBoolField(TEXT("success"));
+            if (!bSuccess && ResultJson->HasField(TEXT("error")))
             {
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+                ErrorMessage = ResultJson->GetStringField(TEXT("error"));
             }
-            // Editor Commands (including actor manipulation)
-            else if (CommandType == TEXT("get_actors_in_level") || 
-                     CommandType == TEXT("find_actors_by_name") ||
-                     CommandType == TEXT("spawn_actor") ||
-                     CommandType == TEXT("delete_actor") || 
-                     CommandType == TEXT("set_actor_transform") ||
-                     CommandType == TEXT("spawn_blueprint_actor"))
+        }
+        
+        if (bSuccess)
+        {
+            // Set success status and include the result
+            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+            ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+        }
+        else
+        {
+            // Set error status and include the error message
+            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+            ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+    }
+    
+    return ResponseJson;
+}
+
+// A chunk producer for commands asked to stream their response, unset for everything else
+FMCPChunkProducer UEpicUnrealMCPBridge::CreateResponseStream(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    bool bStream = false;
+    if (CommandType == TEXT("get_actors_in_level") && Params.IsValid() && Params->TryGetBoolField(TEXT("stream"), bStream) && bStream)
+    {
+        return EditorCommands->CreateActorStream(Params);
+    }
+    return nullptr;
+}
+
+// Steps in the undo buffer that can still be undone, undone ones waiting for a redo left out
+int32 UEpicUnrealMCPBridge::GetUndoableStepCount()
+{
+    return GEditor && GEditor->Trans ? GEditor->Trans->GetQueueLength() - GEditor->Trans->GetUndoCount() : 0;
+}
+
+// Run a list of commands in one game thread slice, as one undo step, compiling each touched blueprint once at the end.
+// With stop_on_error a failure undoes that step, so the entries before it are rolled back along with it
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::ExecuteBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    const TArray<TSharedPtr<FJsonValue>>* Commands = nullptr;
+    if (!Params.IsValid() || !Params->TryGetArrayField(TEXT("commands"), Commands))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'commands' parameter"));
+    }
+    if (Commands->Num() > MaxBatchCommands)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Batch of %d commands is over the limit of %d"), Commands->Num(), MaxBatchCommands));
+    }
+
+    bool bStopOnError = false;
+    Params->TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    TArray<TSharedPtr<FJsonValue>> Applied;
+    int32 NumFailed = 0;
+    bool bStopped = false;
+
+    // Compiles run after the transaction closes, so they are not recorded as part of the undo step
+    FMCPCompileBatch CompileBatch;
+    const int32 UndoStepsBefore = GetUndoableStepCount();
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "BatchTransaction", "MCP Batch"));
+
+        for (const TSharedPtr<FJsonValue>& Entry : *Commands)
+        {
+            const TSharedPtr<FJsonObject>* Command = nullptr;
+            FString SubCommandType;
+            TSharedPtr<FJsonObject> Response;
+
+            if (!Entry->TryGetObject(Command) || (!(*Command)->TryGetStringField(TEXT("command"), SubCommandType) && !(*Command)->TryGetStringField(TEXT("type"), SubCommandType)))
             {
-                ResultJson = EditorCommands->HandleCommand(CommandType, Params);
+                Response = MakeErrorResponse(TEXT("Batch entry missing 'command' field"));
             }
-            // Blueprint Commands
-            else if (CommandType == TEXT("create_blueprint") || 
-                     CommandType == TEXT("add_component_to_blueprint") || 
-                     CommandType == TEXT("set_physics_properties") ||
-                     CommandType == TEXT("compile_blueprint") ||
-                     CommandType == TEXT("set_static_mesh_properties") ||
-                     CommandType == TEXT("set_mesh_material_color"))
+            else if (SubCommandType == TEXT("batch"))
             {
-                ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
+                Response = MakeErrorResponse(TEXT("Batches cannot be nested"));
             }
-
             else
             {
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
-                
-                FString ResultString;
-                TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-                FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-                Promise.SetValue(ResultString);
-                return;
-            }
-            
-            // Check if the result contains an error
-            bool bSuccess = true;
-            FString ErrorMessage;
-            
-            if (ResultJson->HasField(TEXT("success")))
-            {
-                bSuccess = ResultJson->GetBoolField(TEXT("success"));
-                if (!bSuccess && ResultJson->HasField(TEXT("error")))
+                const TSharedPtr<FJsonObject>* SubParams = nullptr;
+                Response = ExecuteCommandOnGameThread(SubCommandType, (*Command)->TryGetObjectField(TEXT("params"), SubParams) ? *SubParams : MakeShared<FJsonObject>());
+
+                // Entries can carry their own id, to match results to them
+                const TSharedPtr<FJsonValue> EntryId = (*Command)->TryGetField(TEXT("id"));
+                if (EntryId.IsValid())
                 {
-                    ErrorMessage = ResultJson->GetStringField(TEXT("error"));
+                    Response->SetField(TEXT("id"), EntryId);
                 }
             }
-            
-            if (bSuccess)
+
+            if (Response->GetStringField(TEXT("status")) == TEXT("success"))
             {
-                // Set success status and include the result
-                ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+                Applied.Add(MakeShared<FJsonValueNumber>(Results.Num()));
             }
-            else
+            Results.Add(MakeShared<FJsonValueObject>(Response));
+            if (Response->GetStringField(TEXT("status")) != TEXT("success"))
             {
-                // Set error status and include the error message
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+                ++NumFailed;
+                if (bStopOnError)
+                {
+                    bStopped = true;
+                    break;
+                }
             }
         }
-        catch (const std::exception& e)
-        {
-            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-            ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
-        }
-        
-        FString ResultString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-        Promise.SetValue(ResultString);
-    });
-    
-    return Future.Get();
-}
\ No newline at end of file
+    }
+
+    // Cancelling the transaction would only drop its records and keep the edits, so the closed step is undone instead.
+    // A batch that recorded nothing adds no step, and the one on top is then someone else's
+    bool bRolledBack = false;
+    if (bStopped && GetUndoableStepCount() > UndoStepsBefore)
+    {
+        bRolledBack = GEditor->UndoTransaction();
+    }
+    const int32 NumCompiled = CompileBatch.Flush();
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("results"), Results);
+    ResultObj->SetNumberField(TEXT("executed"), Results.Num());
+    ResultObj->SetNumberField(TEXT("failed"), NumFailed);
+    ResultObj->SetNumberField(TEXT("compiled_blueprints"), NumCompiled);
+
+    // Indices of the entries that succeeded. When rolled back their edits are undone, except what never goes
+    // through the undo buffer, such as newly created assets, so callers know what may still be left
+    ResultObj->SetArrayField(TEXT("applied"), Applied);
+    ResultObj->SetBoolField(TEXT("rolled_back"), bRolledBack);
+    return ResultObj;
+}
+
+TSharedRef<FJsonObject> UEpicUnrealMCPBridge::MakeErrorResponse(const FString& Error)
+{
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+    ResponseJson->SetStringField(TEXT("error"), Error);
+    return ResponseJson;
+}
+
+// One line, so newline-delimited clients can split responses on newlines
+FString UEpicUnrealMCPBridge::SerializeResponse(const TSharedRef<FJsonObject>& Response)
+{
+    FString ResultString;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResultString);
+    FJsonSerializer::Serialize(Response, Writer);
+    return ResultString;
+}
@@ -1,5 +1,6 @@
 #include "EpicUnrealMCPModule.h"
 #include "EpicUnrealMCPBridge.h"
+#include "MCPBlueprintCatalog.h"
 #include "Modules/ModuleManager.h"
 #include "EditorSubsystem.h"
 #include "Editor.h"
@@ -13,6 +14,7 @@ void FEpicUnrealMCPModule::StartupModule()
 
 void FEpicUnrealMCPModule::ShutdownModule()
 {
+	FMCPBlueprintCatalog::Shutdown();
 	UE_LOG(LogTemp, Display, TEXT("Epic Unreal MCP Module has shut down"));
 }
 
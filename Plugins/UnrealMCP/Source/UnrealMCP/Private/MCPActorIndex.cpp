@@ -0,0 +1,438 @@
+#include "MCPActorIndex.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+
+namespace
+{
+    FName GetKeyName(const AActor* Actor, EMCPActorKey Key)
+    {
+        switch (Key)
+        {
+        case EMCPActorKey::Name:
+            return Actor->GetFName();
+        case EMCPActorKey::Label:
+        {
+            // Unlabelled actors show their object name, which is already filed under Name
+            const FString Label = Actor->GetActorLabel(false);
+            return (Label.IsEmpty() || Label.Len() >= NAME_SIZE) ? NAME_None : FName(*Label);
+        }
+        case EMCPActorKey::Class:
+            return Actor->GetClass()->GetFName();
+        case EMCPActorKey::Folder:
+            return Actor->GetFolderPath();
+        default:
+            return NAME_None;
+        }
+    }
+
+    /** First key not less than Prefix, keys are sorted case-insensitively */
+    int32 LowerBound(const TArray<TPair<FString, FName>>& SortedKeys, const FString& Prefix)
+    {
+        int32 Low = 0;
+        int32 High = SortedKeys.Num();
+        while (Low < High)
+        {
+            const int32 Middle = Low + (High - Low) / 2;
+            if (SortedKeys[Middle].Key.Compare(Prefix, ESearchCase::IgnoreCase) < 0)
+            {
+                Low = Middle + 1;
+            }
+            else
+            {
+                High = Middle;
+            }
+        }
+        return Low;
+    }
+
+    /** The part of a glob before its first wildcard, every match starts with it */
+    FString GetLiteralPrefix(const FString& Pattern)
+    {
+        int32 Index = 0;
+        while (Index < Pattern.Len() && Pattern[Index] != TEXT('*') && Pattern[Index] != TEXT('?'))
+        {
+            ++Index;
+        }
+        return Pattern.Left(Index);
+    }
+
+    bool MatchesString(const FString& Value, EMCPActorMatch Match, const FString& Pattern)
+    {
+        switch (Match)
+        {
+        case EMCPActorMatch::Exact:
+            return Value.Equals(Pattern, ESearchCase::IgnoreCase);
+        case EMCPActorMatch::Prefix:
+            return Value.StartsWith(Pattern, ESearchCase::IgnoreCase);
+        case EMCPActorMatch::Glob:
+            return Value.MatchesWildcard(Pattern, ESearchCase::IgnoreCase);
+        case EMCPActorMatch::Contains:
+            return Value.Contains(Pattern, ESearchCase::IgnoreCase);
+        default:
+            return false;
+        }
+    }
+}
+
+void FMCPActorIndex::FKeyTable::Add(FName Key, FObjectKey Actor)
+{
+    if (Key.IsNone())
+    {
+        return;
+    }
+
+    TSet<FObjectKey>& Bucket = Buckets.FindOrAdd(Key);
+    bSortedDirty |= Bucket.Num() == 0;
+    Bucket.Add(Actor);
+}
+
+void FMCPActorIndex::FKeyTable::Remove(FName Key, FObjectKey Actor)
+{
+    TSet<FObjectKey>* Bucket = Key.IsNone() ? nullptr : Buckets.Find(Key);
+    if (!Bucket)
+    {
+        return;
+    }
+
+    Bucket->Remove(Actor);
+    if (Bucket->Num() == 0)
+    {
+        Buckets.Remove(Key);
+        bSortedDirty = true;
+    }
+}
+
+void FMCPActorIndex::FKeyTable::Reset()
+{
+    Buckets.Reset();
+    SortedKeys.Reset();
+    bSortedDirty = true;
+}
+
+const TArray<TPair<FString, FName>>& FMCPActorIndex::FKeyTable::GetSortedKeys()
+{
+    // Only rebuilt when a key appears or disappears, and only once a query needs it
+    if (bSortedDirty)
+    {
+        SortedKeys.Reset(Buckets.Num());
+        for (const TPair<FName, TSet<FObjectKey>>& Pair : Buckets)
+        {
+            SortedKeys.Emplace(Pair.Key.ToString(), Pair.Key);
+        }
+        SortedKeys.Sort([](const TPair<FString, FName>& A, const TPair<FString, FName>& B)
+        {
+            return A.Key.Compare(B.Key, ESearchCase::IgnoreCase) < 0;
+        });
+        bSortedDirty = false;
+    }
+    return SortedKeys;
+}
+
+FMCPActorIndex::FMCPActorIndex()
+{
+}
+
+FMCPActorIndex::~FMCPActorIndex()
+{
+    Unbind();
+}
+
+void FMCPActorIndex::Bind(UWorld* InWorld)
+{
+    if (World.Get() == InWorld && InWorld)
+    {
+        return;
+    }
+
+    Unbind();
+    if (!InWorld)
+    {
+        return;
+    }
+
+    World = InWorld;
+    bNeedsRebuild = true;
+
+    if (GEngine)
+    {
+        ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPActorIndex::OnActorAdded);
+        ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPActorIndex::OnActorDeleted);
+        ActorFolderHandle = GEngine->OnLevelActorFolderChanged().AddRaw(this, &FMCPActorIndex::OnActorFolderChanged);
+        ActorListHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FMCPActorIndex::OnActorListChanged);
+    }
+    ActorLabelHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPActorIndex::OnActorLabelChanged);
+    WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FMCPActorIndex::OnWorldCleanup);
+}
+
+void FMCPActorIndex::Unbind()
+{
+    // The handles are only set while bound
+    if (ActorLabelHandle.IsValid())
+    {
+        if (GEngine)
+        {
+            GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+            GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+            GEngine->OnLevelActorFolderChanged().Remove(ActorFolderHandle);
+            GEngine->OnLevelActorListChanged().Remove(ActorListHandle);
+        }
+        FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelHandle);
+        FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+        ActorLabelHandle.Reset();
+    }
+
+    World.Reset();
+    Entries.Reset();
+    for (FKeyTable& Table : Tables)
+    {
+        Table.Reset();
+    }
+    bNeedsRebuild = true;
+}
+
+int32 FMCPActorIndex::Num()
+{
+    RebuildIfNeeded();
+    return Entries.Num();
+}
+
+AActor* FMCPActorIndex::FindByName(const FString& Name)
+{
+    RebuildIfNeeded();
+
+    const TSet<FObjectKey>* Bucket = Tables[static_cast<int32>(EMCPActorKey::Name)].Buckets.Find(MakeKey(Name));
+    if (Bucket)
+    {
+        for (const FObjectKey& ActorKey : *Bucket)
+        {
+            const FEntry* Entry = Entries.Find(ActorKey);
+            AActor* Actor = Entry ? Entry->Actor.Get() : nullptr;
+            if (IsValid(Actor))
+            {
+                return Actor;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void FMCPActorIndex::Query(EMCPActorKey Key, EMCPActorMatch Match, const FString& Pattern, TArray<AActor*>& OutActors)
+{
+    RebuildIfNeeded();
+    FKeyTable& Table = Tables[static_cast<int32>(Key)];
+
+    if (Match == EMCPActorMatch::Exact)
+    {
+        CollectBucket(Table, MakeKey(Pattern), OutActors);
+        return;
+    }
+
+    // Every match starts with the literal prefix, so only that run of sorted keys is visited
+    const FString GlobPattern = Match == EMCPActorMatch::Contains ? FString::Printf(TEXT("*%s*"), *Pattern) : Pattern;
+    const FString Prefix = Match == EMCPActorMatch::Prefix ? Pattern : GetLiteralPrefix(GlobPattern);
+
+    const TArray<TPair<FString, FName>>& SortedKeys = Table.GetSortedKeys();
+    for (int32 Index = LowerBound(SortedKeys, Prefix); Index < SortedKeys.Num(); ++Index)
+    {
+        const FString& KeyString = SortedKeys[Index].Key;
+        if (!KeyString.StartsWith(Prefix, ESearchCase::IgnoreCase))
+        {
+            break;
+        }
+
+        if (Match == EMCPActorMatch::Prefix || KeyString.MatchesWildcard(GlobPattern, ESearchCase::IgnoreCase))
+        {
+            CollectBucket(Table, SortedKeys[Index].Value, OutActors);
+        }
+    }
+}
+
+bool FMCPActorIndex::GetPage(const FString& AfterName, int32 Limit, TArray<AActor*>& OutActors)
+{
+    RebuildIfNeeded();
+    FKeyTable& Table = Tables[static_cast<int32>(EMCPActorKey::Name)];
+    const TArray<TPair<FString, FName>>& SortedKeys = Table.GetSortedKeys();
+
+    int32 Index = LowerBound(SortedKeys, AfterName);
+    if (Index < SortedKeys.Num() && !AfterName.IsEmpty() && SortedKeys[Index].Key.Equals(AfterName, ESearchCase::IgnoreCase))
+    {
+        ++Index;
+    }
+
+    // Whole buckets only, so a name shared across sublevels is never split between pages
+    const int32 StartNum = OutActors.Num();
+    for (; Index < SortedKeys.Num() && OutActors.Num() - StartNum < Limit; ++Index)
+    {
+        CollectBucket(Table, SortedKeys[Index].Value, OutActors);
+    }
+    return Index < SortedKeys.Num();
+}
+
+bool FMCPActorIndex::Matches(const AActor* Actor, EMCPActorKey Key, EMCPActorMatch Match, const FString& Pattern)
+{
+    return Actor && MatchesString(GetKeyString(Actor, Key), Match, Pattern);
+}
+
+FString FMCPActorIndex::GetKeyString(const AActor* Actor, EMCPActorKey Key)
+{
+    const FName KeyName = GetKeyName(Actor, Key);
+    return KeyName.IsNone() ? FString() : KeyName.ToString();
+}
+
+void FMCPActorIndex::RebuildIfNeeded()
+{
+    UWorld* BoundWorld = World.Get();
+    if (!bNeedsRebuild || !BoundWorld)
+    {
+        return;
+    }
+
+    Entries.Reset();
+    for (FKeyTable& Table : Tables)
+    {
+        Table.Reset();
+    }
+
+    for (TActorIterator<AActor> It(BoundWorld); It; ++It)
+    {
+        AddActor(*It);
+    }
+    bNeedsRebuild = false;
+
+    UE_LOG(LogTemp, Verbose, TEXT("MCPActorIndex: Indexed %d actors in %s"), Entries.Num(), *BoundWorld->GetName());
+}
+
+void FMCPActorIndex::AddActor(AActor* Actor)
+{
+    const FObjectKey ActorKey(Actor);
+    if (Entries.Contains(ActorKey))
+    {
+        RefileActor(Actor);
+        return;
+    }
+
+    FEntry& Entry = Entries.Add(ActorKey);
+    Entry.Actor = Actor;
+    for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+    {
+        Entry.Keys[KeyIndex] = GetKeyName(Actor, static_cast<EMCPActorKey>(KeyIndex));
+        Tables[KeyIndex].Add(Entry.Keys[KeyIndex], ActorKey);
+    }
+}
+
+void FMCPActorIndex::RemoveActor(const AActor* Actor)
+{
+    const FObjectKey ActorKey(Actor);
+    FEntry Entry;
+    if (!Entries.RemoveAndCopyValue(ActorKey, Entry))
+    {
+        return;
+    }
+
+    for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+    {
+        Tables[KeyIndex].Remove(Entry.Keys[KeyIndex], ActorKey);
+    }
+}
+
+void FMCPActorIndex::RefileActor(const AActor* Actor)
+{
+    const FObjectKey ActorKey(Actor);
+    FEntry* Entry = Entries.Find(ActorKey);
+    if (!Entry)
+    {
+        return;
+    }
+
+    for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+    {
+        const FName NewKey = GetKeyName(Actor, static_cast<EMCPActorKey>(KeyIndex));
+        if (NewKey != Entry->Keys[KeyIndex])
+        {
+            Tables[KeyIndex].Remove(Entry->Keys[KeyIndex], ActorKey);
+            Tables[KeyIndex].Add(NewKey, ActorKey);
+            Entry->Keys[KeyIndex] = NewKey;
+        }
+    }
+}
+
+bool FMCPActorIndex::IsInWorld(const AActor* Actor) const
+{
+    return Actor && World.IsValid() && Actor->GetWorld() == World.Get();
+}
+
+void FMCPActorIndex::CollectBucket(const FKeyTable& Table, FName Key, TArray<AActor*>& OutActors) const
+{
+    const TSet<FObjectKey>* Bucket = Key.IsNone() ? nullptr : Table.Buckets.Find(Key);
+    if (!Bucket)
+    {
+        return;
+    }
+
+    for (const FObjectKey& ActorKey : *Bucket)
+    {
+        const FEntry* Entry = Entries.Find(ActorKey);
+        AActor* Actor = Entry ? Entry->Actor.Get() : nullptr;
+        if (IsValid(Actor))
+        {
+            OutActors.Add(Actor);
+        }
+    }
+}
+
+void FMCPActorIndex::OnActorAdded(AActor* Actor)
+{
+    // Before the first query everything is picked up by the rebuild anyway
+    if (!bNeedsRebuild && IsInWorld(Actor))
+    {
+        AddActor(Actor);
+    }
+}
+
+void FMCPActorIndex::OnActorDeleted(AActor* Actor)
+{
+    if (!bNeedsRebuild)
+    {
+        RemoveActor(Actor);
+    }
+}
+
+void FMCPActorIndex::OnActorLabelChanged(AActor* Actor)
+{
+    // Renaming in the outliner can rename the object too, so every key is checked
+    if (!bNeedsRebuild && IsInWorld(Actor))
+    {
+        RefileActor(Actor);
+    }
+}
+
+void FMCPActorIndex::OnActorFolderChanged(const AActor* Actor, FName OldPath)
+{
+    if (!bNeedsRebuild && IsInWorld(Actor))
+    {
+        RefileActor(Actor);
+    }
+}
+
+void FMCPActorIndex::OnActorListChanged()
+{
+    // Broadcast for bulk changes such as streaming levels coming and going
+    bNeedsRebuild = true;
+}
+
+void FMCPActorIndex::OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+{
+    if (InWorld == World.Get())
+    {
+        Unbind();
+    }
+}
+
+FName FMCPActorIndex::MakeKey(const FString& Value)
+{
+    // Find only, a lookup for a name nobody has must not add it to the name table
+    return (Value.IsEmpty() || Value.Len() >= NAME_SIZE) ? NAME_None : FName(*Value, FNAME_Find);
+}
@@ -0,0 +1,147 @@
+#include "MCPActorIndex.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+/**
+ * Actor index against the linear scan the editor commands used to do, over a throwaway
+ * world of bare stand-in actors. The actors are spawned after the index is bound, so the
+ * index is built entirely from the level actor events. Only timed, that both paths agree
+ * is checked by the UnrealMCP.ActorIndex automation tests.
+ */
+namespace MCPActorIndexBench
+{
+    // Scans are slow enough that a sample of them is plenty
+    constexpr int32 MaxScanLookups = 100;
+    constexpr int32 ActorsPerFolder = 100;
+
+    FName MakeActorName(int32 ActorIndex)
+    {
+        return FName(TEXT("MCPBenchActor"), ActorIndex + 1);
+    }
+
+    AActor* ScanByName(UWorld* World, const FString& ActorName)
+    {
+        // What HandleDeleteActor and HandleSetActorTransform did before the index
+        TArray<AActor*> AllActors;
+        UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+        for (AActor* Actor : AllActors)
+        {
+            if (Actor && Actor->GetName() == ActorName)
+            {
+                return Actor;
+            }
+        }
+        return nullptr;
+    }
+
+    int32 ScanQuery(UWorld* World, EMCPActorKey Key, EMCPActorMatch Match, const FString& Pattern)
+    {
+        TArray<AActor*> AllActors;
+        UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+        return AllActors.FilterByPredicate([Key, Match, &Pattern](const AActor* Actor)
+        {
+            return FMCPActorIndex::Matches(Actor, Key, Match, Pattern);
+        }).Num();
+    }
+
+    /** Time the same query both ways */
+    void CompareQuery(FMCPActorIndex& Index, UWorld* World, const TCHAR* Label, EMCPActorKey Key, EMCPActorMatch Match, const FString& Pattern)
+    {
+        TArray<AActor*> Found;
+        const double IndexStart = FPlatformTime::Seconds();
+        Index.Query(Key, Match, Pattern, Found);
+        const double IndexMs = (FPlatformTime::Seconds() - IndexStart) * 1000.0;
+
+        const double ScanStart = FPlatformTime::Seconds();
+        const int32 ScanCount = ScanQuery(World, Key, Match, Pattern);
+        const double ScanMs = (FPlatformTime::Seconds() - ScanStart) * 1000.0;
+
+        UE_LOG(LogTemp, Warning, TEXT("  %-28s '%s': index %d in %.3f ms, scan %d in %.3f ms (%.0fx)"),
+            Label, *Pattern, Found.Num(), IndexMs, ScanCount, ScanMs, IndexMs > 0.0 ? ScanMs / IndexMs : 0.0);
+    }
+
+    void Run(int32 NumActors, int32 NumLookups)
+    {
+        UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, TEXT("MCPActorIndexBench"));
+        FMCPActorIndex Index;
+        Index.Bind(World);
+        const int32 NumBaseActors = Index.Num();
+
+        const double SpawnStart = FPlatformTime::Seconds();
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags |= RF_Transient;
+        for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+        {
+            SpawnParams.Name = MakeActorName(ActorIndex);
+            AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+            if (Actor && ActorIndex % ActorsPerFolder == 0)
+            {
+                Actor->SetFolderPath(*FString::Printf(TEXT("Bench/Group_%d"), ActorIndex / ActorsPerFolder));
+            }
+        }
+        const double SpawnSeconds = FPlatformTime::Seconds() - SpawnStart;
+
+        FRandomStream Random(NumActors);
+        TArray<FString> Names;
+        for (int32 LookupIndex = 0; LookupIndex < NumLookups; ++LookupIndex)
+        {
+            Names.Add(MakeActorName(Random.RandHelper(NumActors)).ToString());
+        }
+
+        const double IndexStart = FPlatformTime::Seconds();
+        TArray<AActor*> IndexFound;
+        for (const FString& Name : Names)
+        {
+            IndexFound.Add(Index.FindByName(Name));
+        }
+        const double IndexUs = (FPlatformTime::Seconds() - IndexStart) * 1000000.0 / FMath::Max(NumLookups, 1);
+
+        const int32 NumScans = FMath::Min(NumLookups, MaxScanLookups);
+        const double ScanStart = FPlatformTime::Seconds();
+        for (int32 LookupIndex = 0; LookupIndex < NumScans; ++LookupIndex)
+        {
+            ScanByName(World, Names[LookupIndex]);
+        }
+        const double ScanUs = (FPlatformTime::Seconds() - ScanStart) * 1000000.0 / FMath::Max(NumScans, 1);
+
+        UE_LOG(LogTemp, Warning, TEXT("=== MCP ACTOR INDEX BENCHMARK (%d stand-in actors, %d lookups) ==="), NumActors, NumLookups);
+        UE_LOG(LogTemp, Warning, TEXT("  Spawned and indexed from events in %.2f s, index holds %d (%d stand-ins + %d world actors)"),
+            SpawnSeconds, Index.Num(), Index.Num() - NumBaseActors, NumBaseActors);
+        UE_LOG(LogTemp, Warning, TEXT("  By name: index %.3f us/lookup, scan %.1f us/lookup over %d lookups (%.0fx)"),
+            IndexUs, ScanUs, NumScans, IndexUs > 0.0 ? ScanUs / IndexUs : 0.0);
+
+        CompareQuery(Index, World, TEXT("Name prefix"), EMCPActorKey::Name, EMCPActorMatch::Prefix, TEXT("MCPBenchActor_123"));
+        CompareQuery(Index, World, TEXT("Name glob"), EMCPActorKey::Name, EMCPActorMatch::Glob, TEXT("MCPBenchActor_4?7*"));
+        CompareQuery(Index, World, TEXT("Name contains (old default)"), EMCPActorKey::Name, EMCPActorMatch::Contains, TEXT("999"));
+        CompareQuery(Index, World, TEXT("Folder"), EMCPActorKey::Folder, EMCPActorMatch::Exact, TEXT("Bench/Group_7"));
+        CompareQuery(Index, World, TEXT("Class"), EMCPActorKey::Class, EMCPActorMatch::Exact, TEXT("Actor"));
+
+        Index.Unbind();
+        World->DestroyWorld(false);
+        World->MarkAsGarbage();
+    }
+
+    void RunCommand(const TArray<FString>& Args)
+    {
+        if (!GEditor)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealMCP.Bench.ActorIndex needs the editor"));
+            return;
+        }
+
+        const int32 NumActors = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 50000;
+        const int32 NumLookups = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 1000;
+        Run(NumActors, NumLookups);
+    }
+}
+
+static FAutoConsoleCommand MCPActorIndexBenchCommand(
+    TEXT("UnrealMCP.Bench.ActorIndex"),
+    TEXT("Spawn stand-in actors into a throwaway world and compare actor index lookups with a full scan. Usage: UnrealMCP.Bench.ActorIndex (Actors=50000) (Lookups=1000)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MCPActorIndexBench::RunCommand)
+);
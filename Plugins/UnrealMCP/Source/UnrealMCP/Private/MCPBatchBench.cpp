@@ -0,0 +1,171 @@
+#include "EpicUnrealMCPBridge.h"
+#include "MCPCompileBatch.h"
+#include "Editor.h"
+#include "EditorAssetLibrary.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * The same edits sent as individual commands and as one batch: transform edits spread
+ * over a set of stand-in actors, with component additions to a blueprint mixed in. Each
+ * pass gets its own blueprint so both start from the same state. Runs in process on the
+ * game thread, so the times are execution and compiles only, without socket round trips.
+ * Everything the benchmark creates is deleted again at the end. Compiles, undo and rollback
+ * are checked by the UnrealMCP.Batch automation tests, this only times.
+ */
+namespace MCPBatchBench
+{
+    constexpr int32 MaxStandInActors = 100;
+
+    struct FCommand
+    {
+        FString Type;
+        TSharedPtr<FJsonObject> Params;
+    };
+
+    TArray<TSharedPtr<FJsonValue>> MakeVector(double X, double Y, double Z)
+    {
+        return { MakeShared<FJsonValueNumber>(X), MakeShared<FJsonValueNumber>(Y), MakeShared<FJsonValueNumber>(Z) };
+    }
+
+    TArray<FCommand> MakeCommands(const TArray<FString>& ActorNames, const FString& BlueprintName, int32 NumTransforms, int32 NumComponents)
+    {
+        TArray<FCommand> Commands;
+        const int32 ComponentEvery = FMath::Max(NumTransforms / FMath::Max(NumComponents, 1), 1);
+        int32 ComponentsAdded = 0;
+
+        for (int32 Index = 0; Index < NumTransforms || ComponentsAdded < NumComponents; ++Index)
+        {
+            if (Index < NumTransforms)
+            {
+                FCommand& Transform = Commands.AddDefaulted_GetRef();
+                Transform.Type = TEXT("set_actor_transform");
+                Transform.Params = MakeShared<FJsonObject>();
+                Transform.Params->SetStringField(TEXT("name"), ActorNames[Index % ActorNames.Num()]);
+                Transform.Params->SetArrayField(TEXT("location"), MakeVector(Index * 10.0, (Index % 7) * 10.0, 0.0));
+            }
+
+            if (ComponentsAdded < NumComponents && (Index % ComponentEvery == 0 || Index >= NumTransforms))
+            {
+                FCommand& Component = Commands.AddDefaulted_GetRef();
+                Component.Type = TEXT("add_component_to_blueprint");
+                Component.Params = MakeShared<FJsonObject>();
+                Component.Params->SetStringField(TEXT("blueprint_name"), BlueprintName);
+                Component.Params->SetStringField(TEXT("component_type"), TEXT("StaticMeshComponent"));
+                Component.Params->SetStringField(TEXT("component_name"), FString::Printf(TEXT("BenchMesh_%d"), ComponentsAdded++));
+                Component.Params->SetArrayField(TEXT("location"), MakeVector(0.0, 0.0, ComponentsAdded * 10.0));
+            }
+        }
+        return Commands;
+    }
+
+    bool Succeeded(const TSharedRef<FJsonObject>& Response)
+    {
+        return Response->GetStringField(TEXT("status")) == TEXT("success");
+    }
+
+    void Run(UEpicUnrealMCPBridge* Bridge, int32 NumTransforms, int32 NumComponents)
+    {
+        // Unique per run, so a run that was interrupted cannot collide with the next
+        const FString RunId = FString::Printf(TEXT("%08X"), FPlatformTime::Cycles());
+        const FString IndividualBlueprint = FString::Printf(TEXT("MCPBenchBatchA_%s"), *RunId);
+        const FString BatchBlueprint = FString::Printf(TEXT("MCPBenchBatchB_%s"), *RunId);
+
+        int32 SetupFailures = 0;
+        for (const FString& BlueprintName : { IndividualBlueprint, BatchBlueprint })
+        {
+            TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+            Params->SetStringField(TEXT("name"), BlueprintName);
+            SetupFailures += Succeeded(Bridge->ExecuteCommandOnGameThread(TEXT("create_blueprint"), Params)) ? 0 : 1;
+        }
+
+        TArray<FString> ActorNames;
+        for (int32 Index = 0; Index < FMath::Min(NumTransforms, MaxStandInActors); ++Index)
+        {
+            const FString ActorName = FString::Printf(TEXT("MCPBenchBatch_%s_%d"), *RunId, Index);
+            TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+            Params->SetStringField(TEXT("type"), TEXT("StaticMeshActor"));
+            Params->SetStringField(TEXT("name"), ActorName);
+            SetupFailures += Succeeded(Bridge->ExecuteCommandOnGameThread(TEXT("spawn_actor"), Params)) ? 0 : 1;
+            ActorNames.Add(ActorName);
+        }
+
+        // One command at a time, each add_component_to_blueprint compiling as it always did
+        const TArray<FCommand> IndividualCommands = MakeCommands(ActorNames, IndividualBlueprint, NumTransforms, NumComponents);
+        int32 IndividualFailures = 0;
+        const int32 IndividualCompilesBefore = FMCPCompileBatch::GetNumCompiles();
+        const double IndividualStart = FPlatformTime::Seconds();
+        for (const FCommand& Command : IndividualCommands)
+        {
+            IndividualFailures += Succeeded(Bridge->ExecuteCommandOnGameThread(Command.Type, Command.Params)) ? 0 : 1;
+        }
+        const double IndividualMs = (FPlatformTime::Seconds() - IndividualStart) * 1000.0;
+        const int32 IndividualCompiles = FMCPCompileBatch::GetNumCompiles() - IndividualCompilesBefore;
+
+        // The same edits as one batch
+        TArray<TSharedPtr<FJsonValue>> Entries;
+        for (const FCommand& Command : MakeCommands(ActorNames, BatchBlueprint, NumTransforms, NumComponents))
+        {
+            TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+            Entry->SetStringField(TEXT("command"), Command.Type);
+            Entry->SetObjectField(TEXT("params"), Command.Params);
+            Entries.Add(MakeShared<FJsonValueObject>(Entry));
+        }
+        TSharedPtr<FJsonObject> BatchParams = MakeShared<FJsonObject>();
+        BatchParams->SetArrayField(TEXT("commands"), Entries);
+
+        const int32 BatchCompilesBefore = FMCPCompileBatch::GetNumCompiles();
+        const double BatchStart = FPlatformTime::Seconds();
+        const TSharedRef<FJsonObject> BatchResponse = Bridge->ExecuteCommandOnGameThread(TEXT("batch"), BatchParams);
+        const double BatchMs = (FPlatformTime::Seconds() - BatchStart) * 1000.0;
+        const int32 BatchCompiles = FMCPCompileBatch::GetNumCompiles() - BatchCompilesBefore;
+
+        const TSharedPtr<FJsonObject>* BatchResult = nullptr;
+        const int32 BatchFailures = BatchResponse->TryGetObjectField(TEXT("result"), BatchResult)
+            ? static_cast<int32>((*BatchResult)->GetNumberField(TEXT("failed"))) : Entries.Num();
+
+        if (SetupFailures > 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealMCP.Bench.Batch: %d setup commands failed, the times below are not comparable"), SetupFailures);
+        }
+        UE_LOG(LogTemp, Warning, TEXT("=== MCP BATCH BENCHMARK (%d transform edits over %d actors, %d component adds) ==="),
+            NumTransforms, ActorNames.Num(), NumComponents);
+        UE_LOG(LogTemp, Warning, TEXT("  Individual: %d commands in %.1f ms, %d compiles, %d failed"),
+            IndividualCommands.Num(), IndividualMs, IndividualCompiles, IndividualFailures);
+        UE_LOG(LogTemp, Warning, TEXT("  Batch:      %d commands in %.1f ms, %d compiles, %d failed (%.1fx)"),
+            Entries.Num(), BatchMs, BatchCompiles, BatchFailures, BatchMs > 0.0 ? IndividualMs / BatchMs : 0.0);
+
+        for (const FString& ActorName : ActorNames)
+        {
+            TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+            Params->SetStringField(TEXT("name"), ActorName);
+            Bridge->ExecuteCommandOnGameThread(TEXT("delete_actor"), Params);
+        }
+        for (const FString& BlueprintName : { IndividualBlueprint, BatchBlueprint })
+        {
+            UEditorAssetLibrary::DeleteAsset(TEXT("/Game/Blueprints/") + BlueprintName);
+        }
+    }
+
+    void RunCommand(const TArray<FString>& Args)
+    {
+        UEpicUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UEpicUnrealMCPBridge>() : nullptr;
+        if (!Bridge)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealMCP.Bench.Batch needs the MCP bridge"));
+            return;
+        }
+
+        const int32 NumTransforms = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+        const int32 NumComponents = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 0) : 50;
+        Run(Bridge, NumTransforms, NumComponents);
+    }
+}
+
+static FAutoConsoleCommand MCPBatchBenchCommand(
+    TEXT("UnrealMCP.Bench.Batch"),
+    TEXT("Apply transform edits and blueprint component adds as individual commands and as one batch, and compare time and compiles. Usage: UnrealMCP.Bench.Batch (Transforms=1000) (Components=50)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MCPBatchBench::RunCommand)
+);
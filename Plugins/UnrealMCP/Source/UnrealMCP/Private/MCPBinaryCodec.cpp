@@ -0,0 +1,467 @@
+#include "MCPBinaryCodec.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "Vector ext payloads are copied straight out of the buffer");
+
+namespace
+{
+    // Integers past this do not survive the double a JSON number is held in
+    constexpr double MaxExactInteger = 9007199254740992.0;
+
+    void WriteBigEndian(TArray<uint8>& Out, uint64 Value, int32 NumBytes)
+    {
+        for (int32 Shift = (NumBytes - 1) * 8; Shift >= 0; Shift -= 8)
+        {
+            Out.Add(uint8(Value >> Shift));
+        }
+    }
+
+    void WriteString(TArray<uint8>& Out, const FString& Value)
+    {
+        FTCHARToUTF8 Utf8(*Value);
+        const uint32 Length = Utf8.Length();
+        if (Length < 32)
+        {
+            Out.Add(uint8(0xa0 | Length));
+        }
+        else if (Length <= 0xff)
+        {
+            Out.Add(0xd9);
+            WriteBigEndian(Out, Length, 1);
+        }
+        else if (Length <= 0xffff)
+        {
+            Out.Add(0xda);
+            WriteBigEndian(Out, Length, 2);
+        }
+        else
+        {
+            Out.Add(0xdb);
+            WriteBigEndian(Out, Length, 4);
+        }
+        Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Length);
+    }
+
+    /** Arrays and maps: a fix marker with the count in the low nibble, or a 16 or 32 bit count */
+    void WriteContainerHeader(TArray<uint8>& Out, uint32 Count, uint8 FixMarker, uint8 Marker16)
+    {
+        if (Count < 16)
+        {
+            Out.Add(uint8(FixMarker | Count));
+        }
+        else if (Count <= 0xffff)
+        {
+            Out.Add(Marker16);
+            WriteBigEndian(Out, Count, 2);
+        }
+        else
+        {
+            Out.Add(Marker16 + 1);
+            WriteBigEndian(Out, Count, 4);
+        }
+    }
+
+    void WriteNumber(TArray<uint8>& Out, double Value)
+    {
+        if (FMath::Abs(Value) < MaxExactInteger && Value == FMath::FloorToDouble(Value))
+        {
+            const int64 Integer = int64(Value);
+            if (Integer >= 0 && Integer < 128)
+            {
+                Out.Add(uint8(Integer));
+            }
+            else if (Integer < 0 && Integer >= -32)
+            {
+                Out.Add(uint8(int8(Integer)));
+            }
+            else if (Integer > 0)
+            {
+                // uint8, uint16, uint32, uint64
+                const int32 Width = Integer <= 0xff ? 0 : Integer <= 0xffff ? 1 : Integer <= 0xffffffffLL ? 2 : 3;
+                Out.Add(uint8(0xcc + Width));
+                WriteBigEndian(Out, uint64(Integer), 1 << Width);
+            }
+            else
+            {
+                // int8, int16, int32, int64
+                const int32 Width = Integer >= MIN_int8 ? 0 : Integer >= MIN_int16 ? 1 : Integer >= MIN_int32 ? 2 : 3;
+                Out.Add(uint8(0xd0 + Width));
+                WriteBigEndian(Out, uint64(Integer), 1 << Width);
+            }
+            return;
+        }
+
+        const float Single = float(Value);
+        if (double(Single) == Value)
+        {
+            uint32 Bits;
+            FMemory::Memcpy(&Bits, &Single, sizeof(Bits));
+            Out.Add(0xca);
+            WriteBigEndian(Out, Bits, sizeof(Bits));
+        }
+        else
+        {
+            uint64 Bits;
+            FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+            Out.Add(0xcb);
+            WriteBigEndian(Out, Bits, sizeof(Bits));
+        }
+    }
+
+    bool IsVector3(const TArray<TSharedPtr<FJsonValue>>& Array)
+    {
+        return Array.Num() == 3
+            && Array[0].IsValid() && Array[0]->Type == EJson::Number
+            && Array[1].IsValid() && Array[1]->Type == EJson::Number
+            && Array[2].IsValid() && Array[2]->Type == EJson::Number;
+    }
+
+    void WriteVector3(TArray<uint8>& Out, const TArray<TSharedPtr<FJsonValue>>& Array)
+    {
+        const double Doubles[3] = { Array[0]->AsNumber(), Array[1]->AsNumber(), Array[2]->AsNumber() };
+        const float Floats[3] = { float(Doubles[0]), float(Doubles[1]), float(Doubles[2]) };
+
+        // ext8: marker, payload length, type, payload
+        Out.Add(0xc7);
+        if (Floats[0] == Doubles[0] && Floats[1] == Doubles[1] && Floats[2] == Doubles[2])
+        {
+            Out.Add(uint8(sizeof(Floats)));
+            Out.Add(uint8(FMCPBinaryCodec::Vector3FloatExt));
+            Out.Append(reinterpret_cast<const uint8*>(Floats), sizeof(Floats));
+        }
+        else
+        {
+            Out.Add(uint8(sizeof(Doubles)));
+            Out.Add(uint8(FMCPBinaryCodec::Vector3DoubleExt));
+            Out.Append(reinterpret_cast<const uint8*>(Doubles), sizeof(Doubles));
+        }
+    }
+
+    void WriteObject(TArray<uint8>& Out, const FJsonObject& Object);
+
+    void WriteValue(TArray<uint8>& Out, const TSharedPtr<FJsonValue>& Value)
+    {
+        if (!Value.IsValid())
+        {
+            Out.Add(0xc0);
+            return;
+        }
+
+        switch (Value->Type)
+        {
+        case EJson::String:
+            WriteString(Out, Value->AsString());
+            break;
+        case EJson::Number:
+            WriteNumber(Out, Value->AsNumber());
+            break;
+        case EJson::Boolean:
+            Out.Add(Value->AsBool() ? 0xc3 : 0xc2);
+            break;
+        case EJson::Array:
+        {
+            const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+            if (IsVector3(Array))
+            {
+                WriteVector3(Out, Array);
+                break;
+            }
+
+            WriteContainerHeader(Out, Array.Num(), 0x90, 0xdc);
+            for (const TSharedPtr<FJsonValue>& Element : Array)
+            {
+                WriteValue(Out, Element);
+            }
+            break;
+        }
+        case EJson::Object:
+        {
+            const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+            if (Object.IsValid())
+            {
+                WriteObject(Out, *Object);
+            }
+            else
+            {
+                Out.Add(0xc0);
+            }
+            break;
+        }
+        default:
+            Out.Add(0xc0);
+            break;
+        }
+    }
+
+    void WriteObject(TArray<uint8>& Out, const FJsonObject& Object)
+    {
+        WriteContainerHeader(Out, Object.Values.Num(), 0x80, 0xde);
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object.Values)
+        {
+            WriteString(Out, Field.Key);
+            WriteValue(Out, Field.Value);
+        }
+    }
+
+    /** Reads one message, every read is bounds checked and any failure returns nullptr */
+    struct FReader
+    {
+        const uint8* Data;
+        int32 NumBytes;
+        int32 Offset = 0;
+
+        bool Has(uint64 Count) const
+        {
+            return Count <= uint64(NumBytes - Offset);
+        }
+
+        bool ReadBigEndian(int32 Count, uint64& OutValue)
+        {
+            if (!Has(Count))
+            {
+                return false;
+            }
+
+            OutValue = 0;
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                OutValue = (OutValue << 8) | Data[Offset++];
+            }
+            return true;
+        }
+
+        bool ReadString(uint64 Length, FString& OutString)
+        {
+            if (!Has(Length))
+            {
+                return false;
+            }
+
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Offset), int32(Length));
+            OutString = FString(Converted.Length(), Converted.Get());
+            Offset += int32(Length);
+            return true;
+        }
+
+        bool ReadKey(FString& OutKey)
+        {
+            if (!Has(1))
+            {
+                return false;
+            }
+
+            const uint8 Marker = Data[Offset++];
+            uint64 Length = Marker & 0x1f;
+            if ((Marker >= 0xa0 && Marker <= 0xbf) || (Marker >= 0xd9 && Marker <= 0xdb && ReadBigEndian(1 << (Marker - 0xd9), Length)))
+            {
+                return ReadString(Length, OutKey);
+            }
+            return false;
+        }
+
+        TSharedPtr<FJsonValue> ReadStringValue(uint64 Length)
+        {
+            FString String;
+            return ReadString(Length, String) ? MakeShared<FJsonValueString>(MoveTemp(String)) : nullptr;
+        }
+
+        TSharedPtr<FJsonValue> ReadArray(uint64 Count, int32 Depth)
+        {
+            // Every element takes at least a byte, so a bogus count fails here rather than in an allocation
+            if (!Has(Count))
+            {
+                return nullptr;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> Array;
+            Array.Reserve(int32(Count));
+            for (uint64 Index = 0; Index < Count; ++Index)
+            {
+                TSharedPtr<FJsonValue> Element = ReadValue(Depth + 1);
+                if (!Element.IsValid())
+                {
+                    return nullptr;
+                }
+                Array.Add(MoveTemp(Element));
+            }
+            return MakeShared<FJsonValueArray>(MoveTemp(Array));
+        }
+
+        TSharedPtr<FJsonValue> ReadMap(uint64 Count, int32 Depth)
+        {
+            if (!Has(Count * 2))
+            {
+                return nullptr;
+            }
+
+            TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+            Object->Values.Reserve(int32(Count));
+            for (uint64 Index = 0; Index < Count; ++Index)
+            {
+                FString Key;
+                if (!ReadKey(Key))
+                {
+                    return nullptr;
+                }
+
+                TSharedPtr<FJsonValue> Value = ReadValue(Depth + 1);
+                if (!Value.IsValid())
+                {
+                    return nullptr;
+                }
+                Object->Values.Add(MoveTemp(Key), MoveTemp(Value));
+            }
+            return MakeShared<FJsonValueObject>(Object);
+        }
+
+        TSharedPtr<FJsonValue> ReadExt(uint64 Length)
+        {
+            if (!Has(Length + 1))
+            {
+                return nullptr;
+            }
+
+            const int8 Type = int8(Data[Offset++]);
+            double Values[3];
+            if (Type == FMCPBinaryCodec::Vector3FloatExt && Length == sizeof(float) * 3)
+            {
+                float Floats[3];
+                FMemory::Memcpy(Floats, Data + Offset, sizeof(Floats));
+                Values[0] = Floats[0];
+                Values[1] = Floats[1];
+                Values[2] = Floats[2];
+            }
+            else if (Type == FMCPBinaryCodec::Vector3DoubleExt && Length == sizeof(Values))
+            {
+                FMemory::Memcpy(Values, Data + Offset, sizeof(Values));
+            }
+            else
+            {
+                return nullptr;
+            }
+            Offset += int32(Length);
+
+            return MakeShared<FJsonValueArray>(TArray<TSharedPtr<FJsonValue>>{
+                MakeShared<FJsonValueNumber>(Values[0]), MakeShared<FJsonValueNumber>(Values[1]), MakeShared<FJsonValueNumber>(Values[2]) });
+        }
+
+        TSharedPtr<FJsonValue> ReadValue(int32 Depth)
+        {
+            if (!Has(1) || Depth > FMCPBinaryCodec::MaxDepth)
+            {
+                return nullptr;
+            }
+
+            const uint8 Marker = Data[Offset++];
+            if (Marker <= 0x7f)
+            {
+                return MakeShared<FJsonValueNumber>(Marker);
+            }
+            if (Marker >= 0xe0)
+            {
+                return MakeShared<FJsonValueNumber>(int8(Marker));
+            }
+            if (Marker <= 0x8f)
+            {
+                return ReadMap(Marker & 0x0f, Depth);
+            }
+            if (Marker <= 0x9f)
+            {
+                return ReadArray(Marker & 0x0f, Depth);
+            }
+            if (Marker <= 0xbf)
+            {
+                return ReadStringValue(Marker & 0x1f);
+            }
+
+            uint64 Value = 0;
+            switch (Marker)
+            {
+            case 0xc0:
+                return MakeShared<FJsonValueNull>();
+            case 0xc2:
+            case 0xc3:
+                return MakeShared<FJsonValueBoolean>(Marker == 0xc3);
+            case 0xc7:
+                return ReadBigEndian(1, Value) ? ReadExt(Value) : nullptr;
+            case 0xca:
+            {
+                if (!ReadBigEndian(4, Value))
+                {
+                    return nullptr;
+                }
+                const uint32 Bits = uint32(Value);
+                float Single;
+                FMemory::Memcpy(&Single, &Bits, sizeof(Single));
+                return MakeShared<FJsonValueNumber>(Single);
+            }
+            case 0xcb:
+            {
+                if (!ReadBigEndian(8, Value))
+                {
+                    return nullptr;
+                }
+                double Double;
+                FMemory::Memcpy(&Double, &Value, sizeof(Double));
+                return MakeShared<FJsonValueNumber>(Double);
+            }
+            case 0xcc:
+            case 0xcd:
+            case 0xce:
+            case 0xcf:
+                return ReadBigEndian(1 << (Marker - 0xcc), Value) ? MakeShared<FJsonValueNumber>(double(Value)) : nullptr;
+            case 0xd0:
+            case 0xd1:
+            case 0xd2:
+            case 0xd3:
+            {
+                const int32 Bits = 8 << (Marker - 0xd0);
+                if (!ReadBigEndian(Bits / 8, Value))
+                {
+                    return nullptr;
+                }
+                // Sign extend from the encoded width
+                const int64 Signed = Bits == 64 ? int64(Value) : (int64(Value << (64 - Bits)) >> (64 - Bits));
+                return MakeShared<FJsonValueNumber>(double(Signed));
+            }
+            case 0xd9:
+            case 0xda:
+            case 0xdb:
+                return ReadBigEndian(1 << (Marker - 0xd9), Value) ? ReadStringValue(Value) : nullptr;
+            case 0xdc:
+            case 0xdd:
+                return ReadBigEndian(2 << (Marker - 0xdc), Value) ? ReadArray(Value, Depth) : nullptr;
+            case 0xde:
+            case 0xdf:
+                return ReadBigEndian(2 << (Marker - 0xde), Value) ? ReadMap(Value, Depth) : nullptr;
+            default:
+                // bin, the other ext sizes and timestamps are not part of the command schema
+                return nullptr;
+            }
+        }
+    };
+}
+
+void FMCPBinaryCodec::Encode(const TSharedRef<FJsonObject>& Object, TArray<uint8>& OutBytes)
+{
+    WriteObject(OutBytes, *Object);
+}
+
+TSharedPtr<FJsonObject> FMCPBinaryCodec::Decode(const uint8* Data, int32 NumBytes)
+{
+    if (NumBytes <= 0 || !IsMapMarker(Data[0]))
+    {
+        return nullptr;
+    }
+
+    FReader Reader{ Data, NumBytes };
+    const TSharedPtr<FJsonValue> Value = Reader.ReadValue(0);
+
+    // Trailing bytes mean the length prefix and the payload disagree
+    if (!Value.IsValid() || Reader.Offset != NumBytes)
+    {
+        return nullptr;
+    }
+    return Value->AsObject();
+}
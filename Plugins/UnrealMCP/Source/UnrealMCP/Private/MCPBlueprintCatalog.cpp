@@ -0,0 +1,241 @@
+#include "MCPBlueprintCatalog.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+
+static TAutoConsoleVariable<int32> CVarMCPBlueprintCacheSize(
+    TEXT("UnrealMCP.BlueprintCacheSize"),
+    256,
+    TEXT("Recently used blueprints the MCP blueprint catalog remembers. Read when the catalog is created."),
+    ECVF_Default
+);
+
+namespace
+{
+    TUniquePtr<FMCPBlueprintCatalog> EditorCatalog;
+
+    // Where blueprints created over MCP go, and where name lookups looked before the catalog
+    const TCHAR* const DefaultBlueprintFolder = TEXT("/Game/Blueprints/");
+}
+
+FMCPBlueprintCatalog& FMCPBlueprintCatalog::Get()
+{
+    check(IsInGameThread());
+    if (!EditorCatalog.IsValid())
+    {
+        EditorCatalog = MakeUnique<FMCPBlueprintCatalog>(CVarMCPBlueprintCacheSize.GetValueOnGameThread());
+        EditorCatalog->BindToAssetRegistry();
+    }
+    return *EditorCatalog;
+}
+
+void FMCPBlueprintCatalog::Shutdown()
+{
+    EditorCatalog.Reset();
+}
+
+FMCPBlueprintCatalog::FMCPBlueprintCatalog(int32 InCacheSize)
+    : Loaded(FMath::Max(InCacheSize, 1))
+    , Loader([](const FSoftObjectPath& Path) { return LoadObject<UBlueprint>(nullptr, *Path.ToString()); })
+{
+}
+
+FMCPBlueprintCatalog::~FMCPBlueprintCatalog()
+{
+    Unbind();
+}
+
+void FMCPBlueprintCatalog::BindToAssetRegistry()
+{
+    if (bBound)
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+    // What the registry has found so far, the events bring in the rest while it is still scanning
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), Assets, true);
+    Paths.Reserve(Assets.Num());
+    for (const FAssetData& Asset : Assets)
+    {
+        AddAsset(Asset.AssetName, Asset.GetSoftObjectPath());
+    }
+
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FMCPBlueprintCatalog::OnAssetAdded);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FMCPBlueprintCatalog::OnAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FMCPBlueprintCatalog::OnAssetRenamed);
+    bBound = true;
+
+    UE_LOG(LogTemp, Verbose, TEXT("MCPBlueprintCatalog: %d blueprints from the asset registry"), Assets.Num());
+}
+
+void FMCPBlueprintCatalog::Unbind()
+{
+    if (!bBound)
+    {
+        return;
+    }
+    bBound = false;
+
+    if (FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry")))
+    {
+        IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+}
+
+bool FMCPBlueprintCatalog::IsDiscovering() const
+{
+    return bBound && FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().IsLoadingAssets();
+}
+
+void FMCPBlueprintCatalog::AddAsset(FName AssetName, const FSoftObjectPath& Path)
+{
+    Paths.FindOrAdd(AssetName).AddUnique(Path);
+
+    // A new blueprint of the same name may be the one the name resolves to now
+    Loaded.Remove(AssetName);
+}
+
+void FMCPBlueprintCatalog::RemoveAsset(FName AssetName, const FSoftObjectPath& Path)
+{
+    TArray<FSoftObjectPath, TInlineAllocator<1>>* Entries = Paths.Find(AssetName);
+    if (!Entries)
+    {
+        return;
+    }
+
+    Entries->RemoveSingle(Path);
+    if (Entries->Num() == 0)
+    {
+        Paths.Remove(AssetName);
+    }
+    Loaded.Remove(AssetName);
+}
+
+UBlueprint* FMCPBlueprintCatalog::FindBlueprint(const FString& Name)
+{
+    // A path, /Game/Folder/BP_Name or /Game/Folder/BP_Name.BP_Name
+    if (Name.Contains(TEXT("/")))
+    {
+        const FString ObjectPath = Name.Contains(TEXT(".")) ? Name : Name + TEXT(".") + FPackageName::GetShortName(Name);
+        return Load(FSoftObjectPath(ObjectPath));
+    }
+
+    // A name that was never made into an FName cannot be a blueprint's
+    const FName AssetName(*Name, FNAME_Find);
+    if (AssetName.IsNone())
+    {
+        return nullptr;
+    }
+
+    if (const TWeakObjectPtr<UBlueprint>* Cached = Loaded.FindAndTouch(AssetName))
+    {
+        if (UBlueprint* Blueprint = Cached->Get())
+        {
+            ++NumHits;
+            return Blueprint;
+        }
+    }
+
+    const FSoftObjectPath* Path = Resolve(AssetName);
+    if (!Path)
+    {
+        return nullptr;
+    }
+
+    UBlueprint* Blueprint = Load(*Path);
+    if (Blueprint)
+    {
+        Loaded.Add(AssetName, Blueprint);
+    }
+    return Blueprint;
+}
+
+UClass* FMCPBlueprintCatalog::FindGeneratedClass(const FString& Name)
+{
+    UBlueprint* Blueprint = FindBlueprint(Name);
+    return Blueprint ? Blueprint->GeneratedClass.Get() : nullptr;
+}
+
+bool FMCPBlueprintCatalog::GetPath(const FString& Name, FSoftObjectPath& OutPath) const
+{
+    const FName AssetName(*Name, FNAME_Find);
+    const FSoftObjectPath* Path = AssetName.IsNone() ? nullptr : Resolve(AssetName);
+    if (Path)
+    {
+        OutPath = *Path;
+    }
+    return Path != nullptr;
+}
+
+const FSoftObjectPath* FMCPBlueprintCatalog::Resolve(FName AssetName) const
+{
+    const TArray<FSoftObjectPath, TInlineAllocator<1>>* Entries = Paths.Find(AssetName);
+    if (!Entries || Entries->Num() == 0)
+    {
+        return nullptr;
+    }
+
+    if (Entries->Num() > 1)
+    {
+        const FString PreferredPackage = DefaultBlueprintFolder + AssetName.ToString();
+        for (const FSoftObjectPath& Path : *Entries)
+        {
+            if (Path.GetLongPackageName().Equals(PreferredPackage, ESearchCase::IgnoreCase))
+            {
+                return &Path;
+            }
+        }
+    }
+    return &(*Entries)[0];
+}
+
+UBlueprint* FMCPBlueprintCatalog::Load(const FSoftObjectPath& Path)
+{
+    if (UBlueprint* InMemory = Cast<UBlueprint>(Path.ResolveObject()))
+    {
+        return InMemory;
+    }
+
+    ++NumLoads;
+    return Loader(Path);
+}
+
+bool FMCPBlueprintCatalog::IsBlueprint(const FAssetData& AssetData)
+{
+    return AssetData.IsInstanceOf(UBlueprint::StaticClass());
+}
+
+void FMCPBlueprintCatalog::OnAssetAdded(const FAssetData& AssetData)
+{
+    if (IsBlueprint(AssetData))
+    {
+        AddAsset(AssetData.AssetName, AssetData.GetSoftObjectPath());
+    }
+}
+
+void FMCPBlueprintCatalog::OnAssetRemoved(const FAssetData& AssetData)
+{
+    if (IsBlueprint(AssetData))
+    {
+        RemoveAsset(AssetData.AssetName, AssetData.GetSoftObjectPath());
+    }
+}
+
+void FMCPBlueprintCatalog::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (IsBlueprint(AssetData))
+    {
+        const FSoftObjectPath OldPath(OldObjectPath);
+        RemoveAsset(FName(*OldPath.GetAssetName()), OldPath);
+        AddAsset(AssetData.AssetName, AssetData.GetSoftObjectPath());
+    }
+}
@@ -0,0 +1,136 @@
+#include "MCPBlueprintCatalog.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "UObject/Package.h"
+
+/**
+ * Name lookups against a catalog of synthetic blueprints, the size of a large project's
+ * registry. The catalog is a standalone one, not bound to the registry, with a loader that
+ * counts loads and hands out transient blueprints, so the times are the index and the LRU
+ * alone. That lookups find what loading everything would, that every miss is one load and
+ * that removes and renames are followed is checked by the UnrealMCP.BlueprintCatalog
+ * automation tests, this only times.
+ */
+namespace MCPBlueprintCatalogBench
+{
+    struct FPassResult
+    {
+        double Ms = 0.0;
+        int32 Loads = 0;
+        int32 Hits = 0;
+        int32 Missing = 0;
+    };
+
+    FString MakeName(int32 Index)
+    {
+        return FString::Printf(TEXT("BP_Synthetic_%d"), Index);
+    }
+
+    FSoftObjectPath MakePath(int32 Index, const FString& Name)
+    {
+        return FSoftObjectPath(FString::Printf(TEXT("/Game/Synthetic/Group_%d/%s.%s"), Index % 64, *Name, *Name));
+    }
+
+    FPassResult RunPass(FMCPBlueprintCatalog& Catalog, const TArray<FString>& Names)
+    {
+        const int32 LoadsBefore = Catalog.GetNumLoads();
+        const int32 HitsBefore = Catalog.GetNumHits();
+
+        FPassResult Result;
+        const double Start = FPlatformTime::Seconds();
+        for (const FString& Name : Names)
+        {
+            Result.Missing += Catalog.FindBlueprint(Name) ? 0 : 1;
+        }
+        Result.Ms = (FPlatformTime::Seconds() - Start) * 1000.0;
+        Result.Loads = Catalog.GetNumLoads() - LoadsBefore;
+        Result.Hits = Catalog.GetNumHits() - HitsBefore;
+        return Result;
+    }
+
+    void LogPass(const TCHAR* Label, const FPassResult& Result, int32 NumLookups)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("  %-9s %.3f us/lookup, %d loads, %d hits (%.1f%% hit rate), %d missing"),
+            Label, Result.Ms * 1000.0 / FMath::Max(NumLookups, 1), Result.Loads, Result.Hits,
+            100.0 * Result.Hits / FMath::Max(NumLookups, 1), Result.Missing);
+    }
+
+    void Run(int32 NumEntries, int32 NumLookups, int32 CacheSize)
+    {
+        FMCPBlueprintCatalog Catalog(CacheSize);
+
+        // One transient blueprint per path, made on its first load and handed out again after evictions
+        TMap<FSoftObjectPath, UBlueprint*> Pool;
+        Catalog.SetLoader([&Pool](const FSoftObjectPath& Path)
+        {
+            UBlueprint*& Blueprint = Pool.FindOrAdd(Path);
+            if (!Blueprint)
+            {
+                Blueprint = NewObject<UBlueprint>(GetTransientPackage(), NAME_None, RF_Transient);
+            }
+            return Blueprint;
+        });
+
+        TArray<FString> Names;
+        Names.Reserve(NumEntries);
+        for (int32 Index = 0; Index < NumEntries; ++Index)
+        {
+            Names.Add(MakeName(Index));
+        }
+
+        const double FillStart = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < NumEntries; ++Index)
+        {
+            Catalog.AddAsset(FName(*Names[Index]), MakePath(Index, Names[Index]));
+        }
+        const double FillMs = (FPlatformTime::Seconds() - FillStart) * 1000.0;
+
+        // An agent works on a handful of blueprints at a time: most lookups go to a small hot set
+        const int32 HotSetSize = FMath::Min(200, NumEntries);
+        FRandomStream Random(NumEntries);
+        TArray<FString> Skewed;
+        TArray<FString> Uniform;
+        Skewed.Reserve(NumLookups);
+        Uniform.Reserve(NumLookups);
+        for (int32 Index = 0; Index < NumLookups; ++Index)
+        {
+            Skewed.Add(Names[Random.FRand() < 0.8f ? Random.RandHelper(HotSetSize) : Random.RandHelper(NumEntries)]);
+            Uniform.Add(Names[Random.RandHelper(NumEntries)]);
+        }
+
+        // The index alone, no blueprint touched
+        FSoftObjectPath Path;
+        int32 PathsFound = 0;
+        const double PathStart = FPlatformTime::Seconds();
+        for (const FString& Name : Uniform)
+        {
+            PathsFound += Catalog.GetPath(Name, Path) ? 1 : 0;
+        }
+        const double PathMs = (FPlatformTime::Seconds() - PathStart) * 1000.0;
+
+        const FPassResult SkewedResult = RunPass(Catalog, Skewed);
+        const FPassResult UniformResult = RunPass(Catalog, Uniform);
+
+        UE_LOG(LogTemp, Warning, TEXT("=== MCP BLUEPRINT CATALOG BENCHMARK (%d blueprints, %d lookups, LRU of %d) ==="), NumEntries, NumLookups, CacheSize);
+        UE_LOG(LogTemp, Warning, TEXT("  Fill:     %.1f ms (%.3f us/entry), %d distinct names"), FillMs, FillMs * 1000.0 / FMath::Max(NumEntries, 1), Catalog.Num());
+        UE_LOG(LogTemp, Warning, TEXT("  Path:     %.3f us/lookup, %d found"), PathMs * 1000.0 / FMath::Max(NumLookups, 1), PathsFound);
+        LogPass(TEXT("Hot set:"), SkewedResult, NumLookups);
+        LogPass(TEXT("Uniform:"), UniformResult, NumLookups);
+    }
+
+    void RunCommand(const TArray<FString>& Args)
+    {
+        const int32 NumEntries = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 20000;
+        const int32 NumLookups = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 100000;
+        const int32 CacheSize = Args.Num() > 2 ? FMath::Max(FCString::Atoi(*Args[2]), 1) : 256;
+        Run(NumEntries, NumLookups, CacheSize);
+    }
+}
+
+static FAutoConsoleCommand MCPBlueprintCatalogBenchCommand(
+    TEXT("UnrealMCP.Bench.BlueprintCatalog"),
+    TEXT("Look blueprints up by name in a catalog of synthetic registry entries, and report lookup time, loads and LRU hits. Usage: UnrealMCP.Bench.BlueprintCatalog (Entries=20000) (Lookups=100000) (CacheSize=256)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MCPBlueprintCatalogBench::RunCommand)
+);
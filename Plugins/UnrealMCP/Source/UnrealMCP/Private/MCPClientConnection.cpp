@@ -0,0 +1,418 @@
+#include "MCPClientConnection.h"
+#include "EpicUnrealMCPBridge.h"
+#include "MCPCommandDispatcher.h"
+#include "MCPBinaryCodec.h"
+#include "MCPServerStats.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/Event.h"
+#include "Misc/ScopeLock.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+
+namespace
+{
+    constexpr int32 ReceiveChunkBytes = 64 * 1024;
+
+    // Only bounds how long Stop takes to be noticed, data wakes the wait immediately
+    const FTimespan ReadinessWait = FTimespan::FromMilliseconds(100);
+
+    // While commands are in flight, a response that only partly fit the socket is picked up this soon
+    const FTimespan InFlightWait = FTimespan::FromMilliseconds(10);
+
+    // A client whose responses have not moved for this long is dropped
+    constexpr double OutboundStallSeconds = 30.0;
+
+    const TCHAR* const EncodingJson = TEXT("json");
+    const TCHAR* const EncodingMessagePack = TEXT("msgpack");
+
+    /**
+     * Answer a negotiate command: the first of the client's 'encodings' the server speaks, JSON
+     * if it lists none. Messages are recognized by their first bytes, so this only tells the
+     * client what it may send; each response still goes back in its request's encoding.
+     */
+    TSharedRef<FJsonObject> MakeNegotiateResponse(const TSharedPtr<FJsonObject>& Params)
+    {
+        FString Encoding = EncodingJson;
+        const TArray<TSharedPtr<FJsonValue>>* Offered = nullptr;
+        if (Params->TryGetArrayField(TEXT("encodings"), Offered))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *Offered)
+            {
+                FString Name;
+                if (Value.IsValid() && Value->TryGetString(Name) && (Name == EncodingMessagePack || Name == EncodingJson))
+                {
+                    Encoding = Name;
+                    break;
+                }
+            }
+        }
+
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("encoding"), Encoding);
+        Result->SetArrayField(TEXT("encodings"), { MakeShared<FJsonValueString>(EncodingMessagePack), MakeShared<FJsonValueString>(EncodingJson) });
+
+        TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+        Response->SetStringField(TEXT("status"), TEXT("success"));
+        Response->SetObjectField(TEXT("result"), Result);
+        return Response;
+    }
+}
+
+FMCPClientConnection::FMCPClientConnection(UEpicUnrealMCPBridge* InBridge, FSocket* InSocket, int32 InClientId)
+    : Bridge(InBridge)
+    , Socket(InSocket)
+    , ClientId(InClientId)
+    , NumInFlight(0)
+    , bRunning(true)
+    , bFinished(false)
+    , bSendFailed(false)
+{
+    ReceiveBuffer.SetNumUninitialized(ReceiveChunkBytes);
+    ResponseEvent = FPlatformProcess::GetSynchEventFromPool(false);
+
+    Socket->SetNonBlocking(true);
+    Socket->SetNoDelay(true);
+    int32 SocketBufferSize = 65536;  // 64KB buffer
+    Socket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
+    Socket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
+}
+
+FMCPClientConnection::~FMCPClientConnection()
+{
+    Shutdown();
+
+    if (Socket)
+    {
+        Socket->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+        Socket = nullptr;
+    }
+
+    FPlatformProcess::ReturnSynchEventToPool(ResponseEvent);
+    ResponseEvent = nullptr;
+}
+
+bool FMCPClientConnection::Start()
+{
+    Thread = FRunnableThread::Create(this, *FString::Printf(TEXT("UnrealMCPClient%d"), ClientId), 0, TPri_Normal);
+    return Thread != nullptr;
+}
+
+void FMCPClientConnection::Shutdown()
+{
+    if (Thread)
+    {
+        Stop();
+        Thread->WaitForCompletion();
+        delete Thread;
+        Thread = nullptr;
+    }
+}
+
+void FMCPClientConnection::Stop()
+{
+    bRunning = false;
+    ResponseEvent->Trigger();
+}
+
+uint32 FMCPClientConnection::Run()
+{
+    UE_LOG(LogMCPServer, Display, TEXT("MCPServerRunnable: Client %d connected"), ClientId);
+
+    while (bRunning && !bSendFailed)
+    {
+        bool bOutboundFull = false;
+        bool bHasOutbound = false;
+        {
+            FScopeLock Lock(&OutboundLock);
+            bOutboundFull = IsOutboundFull();
+            bHasOutbound = HasOutbound();
+
+            if (bHasOutbound && FPlatformTime::Seconds() - LastSendSeconds > OutboundStallSeconds)
+            {
+                UE_LOG(LogMCPServer, Warning, TEXT("MCPServerRunnable: Client %d is not reading its responses, disconnecting"), ClientId);
+                break;
+            }
+        }
+
+        // Submit what is buffered before reading more, the framer is the inbound queue.
+        // Too many commands in flight or a full outbound queue pause this until the client catches up.
+        FMCPMessage Message;
+        while (bRunning && !bOutboundFull && NumInFlight.Load() < MaxInFlight && Framer.Next(Message))
+        {
+            ProcessMessage(Message);
+        }
+
+        if (Framer.HasError())
+        {
+            UE_LOG(LogMCPServer, Warning, TEXT("MCPServerRunnable: Client %d sent a message over %d bytes, disconnecting"),
+                ClientId, FMCPMessageFramer::DefaultMaxMessageBytes);
+            PostResponse(UEpicUnrealMCPBridge::MakeErrorResponse(TEXT("Message too large")), EMCPFraming::Json);
+            break;
+        }
+
+        if (!bRunning)
+        {
+            break;
+        }
+
+        // At the in-flight limit the socket is left alone until a response comes back
+        if (NumInFlight.Load() >= MaxInFlight)
+        {
+            ResponseEvent->Wait(ReadinessWait);
+            continue;
+        }
+
+        // Sleep until there is something to read, or until queued responses can go out
+        const ESocketWaitConditions::Type WaitFor = bOutboundFull ? ESocketWaitConditions::WaitForWrite
+            : bHasOutbound ? ESocketWaitConditions::WaitForReadOrWrite : ESocketWaitConditions::WaitForRead;
+        const bool bReady = Socket->Wait(WaitFor, NumInFlight.Load() > 0 ? InFlightWait : ReadinessWait);
+
+        {
+            FScopeLock Lock(&OutboundLock);
+            if (!FlushOutbound())
+            {
+                break;
+            }
+        }
+
+        if (bReady && !bOutboundFull && !ReceivePending())
+        {
+            break;
+        }
+    }
+
+    UE_LOG(LogMCPServer, Display, TEXT("MCPServerRunnable: Client %d disconnected"), ClientId);
+    bFinished = true;
+    return 0;
+}
+
+bool FMCPClientConnection::ReceivePending()
+{
+    // One chunk per wakeup, so the framer never holds more than a message in progress and a chunk
+    int32 BytesRead = 0;
+    if (Socket->Recv(ReceiveBuffer.GetData(), ReceiveBuffer.Num(), BytesRead))
+    {
+        if (BytesRead == 0)
+        {
+            return false;
+        }
+
+        Framer.Append(ReceiveBuffer.GetData(), BytesRead);
+        return true;
+    }
+
+    const ESocketErrors LastError = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+    if (LastError == SE_EWOULDBLOCK || LastError == SE_EINTR)
+    {
+        return true;
+    }
+
+    UE_LOG(LogMCPServer, Verbose, TEXT("MCPServerRunnable: Client %d read error %d"), ClientId, (int32)LastError);
+    return false;
+}
+
+void FMCPClientConnection::ProcessMessage(const FMCPMessage& Message)
+{
+    TSharedPtr<FJsonObject> JsonMessage;
+    if (Message.Framing == EMCPFraming::MessagePack)
+    {
+        UE_LOG_MCP_SAMPLED(Verbose, TEXT("MCPServerRunnable: Client %d received %d bytes of MessagePack"), ClientId, Message.Bytes.Num());
+
+        JsonMessage = FMCPBinaryCodec::Decode(Message.Bytes.GetData(), Message.Bytes.Num());
+        if (!JsonMessage.IsValid())
+        {
+            UE_LOG_MCP_LIMITED(Warning, TEXT("MCPServerRunnable: Client %d sent a malformed MessagePack message"), ClientId);
+            PostResponse(UEpicUnrealMCPBridge::MakeErrorResponse(TEXT("Failed to decode message as MessagePack")), Message.Framing);
+            return;
+        }
+    }
+    else
+    {
+        UE_LOG_MCP_SAMPLED(Verbose, TEXT("MCPServerRunnable: Client %d received: %s"), ClientId, *Message.Text);
+
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message.Text);
+        if (!FJsonSerializer::Deserialize(Reader, JsonMessage) || !JsonMessage.IsValid())
+        {
+            UE_LOG_MCP_LIMITED(Warning, TEXT("MCPServerRunnable: Client %d sent a message that is not a JSON object"), ClientId);
+            PostResponse(UEpicUnrealMCPBridge::MakeErrorResponse(TEXT("Failed to parse message as JSON")), Message.Framing);
+            return;
+        }
+    }
+
+    FMCPCommandRequest Request;
+    Request.RequestId = JsonMessage->TryGetField(TEXT("id"));
+
+    // Clients send either 'command' (MCP protocol) or 'type'
+    if (!JsonMessage->TryGetStringField(TEXT("command"), Request.CommandType) && !JsonMessage->TryGetStringField(TEXT("type"), Request.CommandType))
+    {
+        UE_LOG_MCP_LIMITED(Warning, TEXT("MCPServerRunnable: Client %d message missing 'command' field"), ClientId);
+        TSharedRef<FJsonObject> Response = UEpicUnrealMCPBridge::MakeErrorResponse(TEXT("Message missing 'command' field"));
+        if (Request.RequestId.IsValid())
+        {
+            Response->SetField(TEXT("id"), Request.RequestId);
+        }
+        PostResponse(Response, Message.Framing);
+        return;
+    }
+
+    // Parameters are optional in MCP protocol
+    const TSharedPtr<FJsonObject>* ParamsObject = nullptr;
+    Request.Params = JsonMessage->TryGetObjectField(TEXT("params"), ParamsObject) ? *ParamsObject : MakeShared<FJsonObject>();
+
+    // Part of the protocol rather than a command, so it never waits for the game thread
+    if (Request.CommandType == TEXT("negotiate"))
+    {
+        TSharedRef<FJsonObject> Response = MakeNegotiateResponse(Request.Params);
+        if (Request.RequestId.IsValid())
+        {
+            Response->SetField(TEXT("id"), Request.RequestId);
+        }
+        PostResponse(Response, Message.Framing);
+        return;
+    }
+
+    // The connection may be gone by the time a slow command finishes
+    TWeakPtr<FMCPClientConnection, ESPMode::ThreadSafe> WeakThis = AsShared();
+    const EMCPFraming Framing = Message.Framing;
+    Request.OnComplete = [WeakThis, Framing, CommandType = Request.CommandType](const TSharedRef<FJsonObject>& Response)
+    {
+        TSharedPtr<FMCPClientConnection, ESPMode::ThreadSafe> Connection = WeakThis.Pin();
+        if (Connection.IsValid() && !Connection->IsFinished())
+        {
+            --Connection->NumInFlight;
+            Connection->PostResponse(Response, Framing, CommandType);
+        }
+    };
+    Request.OnChunk = [WeakThis, Framing, CommandType = Request.CommandType](const TSharedRef<FJsonObject>& Chunk)
+    {
+        TSharedPtr<FMCPClientConnection, ESPMode::ThreadSafe> Connection = WeakThis.Pin();
+        if (!Connection.IsValid() || Connection->IsFinished())
+        {
+            return EMCPChunkResult::Closed;
+        }
+        {
+            // The stream waits on this chunk until the socket drains, so a slow reader holds back the producer
+            FScopeLock Lock(&Connection->OutboundLock);
+            if (Connection->IsOutboundFull())
+            {
+                return EMCPChunkResult::NotYet;
+            }
+        }
+        Connection->PostResponse(Chunk, Framing, CommandType);
+        return EMCPChunkResult::Accepted;
+    };
+
+    ++NumInFlight;
+    Bridge->SubmitCommand(MoveTemp(Request));
+}
+
+void FMCPClientConnection::PostResponse(const TSharedRef<FJsonObject>& Response, EMCPFraming Framing, const FString& CommandType)
+{
+    // Serialized by whichever thread finished the command, outside the lock
+    const double SerializeStart = FPlatformTime::Seconds();
+    FString Text;
+    TArray<uint8> Payload;
+    if (Framing == EMCPFraming::MessagePack)
+    {
+        FMCPBinaryCodec::Encode(Response, Payload);
+    }
+    else
+    {
+        Text = UEpicUnrealMCPBridge::SerializeResponse(Response);
+    }
+
+    if (!CommandType.IsEmpty())
+    {
+        FMCPServerStats::Get().RecordSerialize(CommandType, FPlatformTime::Seconds() - SerializeStart);
+    }
+
+    // The reader only takes a zero first byte as a length prefix, so larger answers cannot be framed that way
+    if (Framing != EMCPFraming::Json)
+    {
+        const int32 PayloadBytes = Framing == EMCPFraming::MessagePack ? Payload.Num() : FPlatformString::ConvertedLength<UTF8CHAR>(*Text, Text.Len());
+        if (PayloadBytes > FMCPMessageFramer::MaxPrefixedPayloadBytes)
+        {
+            UE_LOG_MCP_LIMITED(Warning, TEXT("MCPServerRunnable: Client %d response of %d bytes is too large to length prefix"), ClientId, PayloadBytes);
+            TSharedRef<FJsonObject> Error = UEpicUnrealMCPBridge::MakeErrorResponse(FString::Printf(
+                TEXT("Response of %d bytes is over the %d bytes a length prefix carries, stream it or send the request as plain JSON"),
+                PayloadBytes, FMCPMessageFramer::MaxPrefixedPayloadBytes));
+            if (TSharedPtr<FJsonValue> RequestId = Response->TryGetField(TEXT("id")))
+            {
+                Error->SetField(TEXT("id"), RequestId);
+            }
+            PostResponse(Error, Framing);
+            return;
+        }
+    }
+
+    if (Framing == EMCPFraming::MessagePack)
+    {
+        UE_LOG_MCP_SAMPLED(Verbose, TEXT("MCPServerRunnable: Client %d response: %d bytes of MessagePack"), ClientId, Payload.Num());
+    }
+    else
+    {
+        UE_LOG_MCP_SAMPLED(Verbose, TEXT("MCPServerRunnable: Client %d response: %s"), ClientId, *Text);
+    }
+
+    {
+        FScopeLock Lock(&OutboundLock);
+
+        // Reuse the buffer once everything queued has gone out
+        if (!HasOutbound())
+        {
+            Outbound.Reset();
+            OutboundOffset = 0;
+            LastSendSeconds = FPlatformTime::Seconds();
+        }
+
+        if (Framing == EMCPFraming::MessagePack)
+        {
+            FMCPMessageFramer::FrameBinary(Payload, Outbound);
+        }
+        else
+        {
+            FMCPMessageFramer::Frame(Text, Framing, Outbound);
+        }
+        if (!FlushOutbound())
+        {
+            bSendFailed = true;
+        }
+    }
+
+    ResponseEvent->Trigger();
+}
+
+bool FMCPClientConnection::FlushOutbound()
+{
+    while (HasOutbound())
+    {
+        int32 BytesSent = 0;
+        if (!Socket->Send(Outbound.GetData() + OutboundOffset, Outbound.Num() - OutboundOffset, BytesSent))
+        {
+            const ESocketErrors LastError = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+            if (LastError == SE_EWOULDBLOCK || LastError == SE_EINTR)
+            {
+                // The rest goes out when the wait reports the socket writable
+                return true;
+            }
+
+            UE_LOG(LogMCPServer, Warning, TEXT("MCPServerRunnable: Failed to send response to client %d, error %d"), ClientId, (int32)LastError);
+            return false;
+        }
+
+        if (BytesSent == 0)
+        {
+            return true;
+        }
+        OutboundOffset += BytesSent;
+        LastSendSeconds = FPlatformTime::Seconds();
+    }
+
+    return true;
+}
@@ -0,0 +1,183 @@
+#include "MCPBinaryCodec.h"
+#include "MCPMessageFramer.h"
+#include "EpicUnrealMCPBridge.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+
+/**
+ * JSON against MessagePack for bulk set_actor_transform traffic: the requests and the
+ * responses the handler sends back, encoded and framed for the wire, then unframed,
+ * decoded and read the way the handler reads them. No sockets and no game thread work,
+ * so the times are the encodings alone. That MessagePack decodes to exactly what was
+ * encoded is checked by the UnrealMCP.Codec automation tests, this only times.
+ */
+namespace MCPCodecBench
+{
+    struct FPassResult
+    {
+        int64 Bytes = 0;
+        double EncodeMs = 0.0;
+        double DecodeMs = 0.0;
+        int32 Decoded = 0;
+        int32 Failures = 0;
+
+        /** Sum of every transform component read back, so the reads are not optimized away */
+        double Checksum = 0.0;
+    };
+
+    TArray<TSharedPtr<FJsonValue>> MakeVector(const FVector& Vector)
+    {
+        return { MakeShared<FJsonValueNumber>(Vector.X), MakeShared<FJsonValueNumber>(Vector.Y), MakeShared<FJsonValueNumber>(Vector.Z) };
+    }
+
+    TSharedRef<FJsonObject> MakeTransform(const FString& ActorName, const FVector& Location, const FVector& Rotation, const FVector& Scale)
+    {
+        TSharedRef<FJsonObject> Transform = MakeShared<FJsonObject>();
+        Transform->SetStringField(TEXT("name"), ActorName);
+        Transform->SetArrayField(TEXT("location"), MakeVector(Location));
+        Transform->SetArrayField(TEXT("rotation"), MakeVector(Rotation));
+        Transform->SetArrayField(TEXT("scale"), MakeVector(Scale));
+        return Transform;
+    }
+
+    /** A request and its response per edit, in the order a client would see them */
+    TArray<TSharedRef<FJsonObject>> MakeMessages(int32 NumEdits)
+    {
+        FRandomStream Random(NumEdits);
+        TArray<TSharedRef<FJsonObject>> Messages;
+        Messages.Reserve(NumEdits * 2);
+
+        for (int32 Index = 0; Index < NumEdits; ++Index)
+        {
+            const FString ActorName = FString::Printf(TEXT("StaticMeshActor_%d"), Index % 5000);
+
+            // Requests carry grid snapped locations and whole degrees, as placed by a tool
+            const FVector Location(Random.RandRange(-5000, 5000) * 10.0, Random.RandRange(-5000, 5000) * 10.0, Random.RandRange(0, 200) * 10.0);
+            const FVector Rotation(0.0, Random.RandRange(0, 359), 0.0);
+            const FVector Scale(Random.RandRange(1, 4) * 0.5);
+
+            TSharedRef<FJsonObject> Request = MakeShared<FJsonObject>();
+            Request->SetStringField(TEXT("command"), TEXT("set_actor_transform"));
+            Request->SetNumberField(TEXT("id"), Index);
+            Request->SetObjectField(TEXT("params"), MakeTransform(ActorName, Location, Rotation, Scale));
+            Messages.Add(Request);
+
+            // Responses carry the actor's transform after the engine's math, which is rarely round
+            const FRotator Applied = FRotator(Rotation.X, Rotation.Y, Rotation.Z).Quaternion().Rotator();
+            TSharedRef<FJsonObject> Result = MakeTransform(ActorName, Location + FVector(Random.FRandRange(-0.5, 0.5)),
+                FVector(Applied.Pitch, Applied.Yaw, Applied.Roll), Scale);
+            Result->SetStringField(TEXT("class"), TEXT("StaticMeshActor"));
+
+            TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+            Response->SetStringField(TEXT("status"), TEXT("success"));
+            Response->SetNumberField(TEXT("id"), Index);
+            Response->SetObjectField(TEXT("result"), Result);
+            Messages.Add(Response);
+        }
+        return Messages;
+    }
+
+    /** Read the transform the way HandleSetActorTransform does, false if it is not there */
+    bool ReadTransform(const TSharedPtr<FJsonObject>& Message, double& InOutChecksum)
+    {
+        const TSharedPtr<FJsonObject>* Transform = nullptr;
+        if (!Message.IsValid() || (!Message->TryGetObjectField(TEXT("params"), Transform) && !Message->TryGetObjectField(TEXT("result"), Transform)))
+        {
+            return false;
+        }
+
+        const FVector Location = FEpicUnrealMCPCommonUtils::GetVectorFromJson(*Transform, TEXT("location"));
+        const FRotator Rotation = FEpicUnrealMCPCommonUtils::GetRotatorFromJson(*Transform, TEXT("rotation"));
+        const FVector Scale = FEpicUnrealMCPCommonUtils::GetVectorFromJson(*Transform, TEXT("scale"));
+        InOutChecksum += Location.X + Location.Y + Location.Z + Rotation.Pitch + Rotation.Yaw + Rotation.Roll + Scale.X + Scale.Y + Scale.Z;
+        return true;
+    }
+
+    FPassResult RunPass(const TArray<TSharedRef<FJsonObject>>& Messages, EMCPFraming Framing)
+    {
+        FPassResult Result;
+        TArray<uint8> Wire;
+        TArray<uint8> Payload;
+
+        const double EncodeStart = FPlatformTime::Seconds();
+        for (const TSharedRef<FJsonObject>& Message : Messages)
+        {
+            if (Framing == EMCPFraming::MessagePack)
+            {
+                Payload.Reset();
+                FMCPBinaryCodec::Encode(Message, Payload);
+                FMCPMessageFramer::FrameBinary(Payload, Wire);
+            }
+            else
+            {
+                FMCPMessageFramer::Frame(UEpicUnrealMCPBridge::SerializeResponse(Message), Framing, Wire);
+            }
+        }
+        Result.EncodeMs = (FPlatformTime::Seconds() - EncodeStart) * 1000.0;
+        Result.Bytes = Wire.Num();
+
+        const double DecodeStart = FPlatformTime::Seconds();
+        FMCPMessageFramer Framer;
+        Framer.Append(Wire.GetData(), Wire.Num());
+        FMCPMessage Message;
+        while (Framer.Next(Message))
+        {
+            TSharedPtr<FJsonObject> Decoded;
+            if (Message.Framing == EMCPFraming::MessagePack)
+            {
+                Decoded = FMCPBinaryCodec::Decode(Message.Bytes.GetData(), Message.Bytes.Num());
+            }
+            else
+            {
+                TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message.Text);
+                FJsonSerializer::Deserialize(Reader, Decoded);
+            }
+
+            ++Result.Decoded;
+            Result.Failures += (Message.Framing == Framing && ReadTransform(Decoded, Result.Checksum)) ? 0 : 1;
+        }
+        Result.DecodeMs = (FPlatformTime::Seconds() - DecodeStart) * 1000.0;
+        return Result;
+    }
+
+    void LogPass(const TCHAR* Label, const FPassResult& Result, int32 NumMessages)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("  %-12s %lld bytes (%.1f per message), encode %.1f ms (%.0f k msg/s), decode %.1f ms (%.0f k msg/s), %d failed"),
+            Label, Result.Bytes, double(Result.Bytes) / FMath::Max(NumMessages, 1),
+            Result.EncodeMs, Result.EncodeMs > 0.0 ? NumMessages / Result.EncodeMs : 0.0,
+            Result.DecodeMs, Result.DecodeMs > 0.0 ? NumMessages / Result.DecodeMs : 0.0, Result.Failures);
+    }
+
+    void Run(int32 NumEdits)
+    {
+        const TArray<TSharedRef<FJsonObject>> Messages = MakeMessages(NumEdits);
+        const FPassResult Json = RunPass(Messages, EMCPFraming::LengthPrefixed);
+        const FPassResult Binary = RunPass(Messages, EMCPFraming::MessagePack);
+
+        UE_LOG(LogTemp, Warning, TEXT("=== MCP CODEC BENCHMARK (%d set_actor_transform requests and responses) ==="), NumEdits);
+        LogPass(TEXT("JSON:"), Json, Messages.Num());
+        LogPass(TEXT("MessagePack:"), Binary, Messages.Num());
+        UE_LOG(LogTemp, Warning, TEXT("  MessagePack is %.0f%% of the JSON bytes, encodes %.1fx and decodes %.1fx as fast"),
+            Json.Bytes > 0 ? 100.0 * Binary.Bytes / Json.Bytes : 0.0,
+            Binary.EncodeMs > 0.0 ? Json.EncodeMs / Binary.EncodeMs : 0.0,
+            Binary.DecodeMs > 0.0 ? Json.DecodeMs / Binary.DecodeMs : 0.0);
+    }
+
+    void RunCommand(const TArray<FString>& Args)
+    {
+        const int32 NumEdits = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 50000;
+        Run(NumEdits);
+    }
+}
+
+static FAutoConsoleCommand MCPCodecBenchCommand(
+    TEXT("UnrealMCP.Bench.Codec"),
+    TEXT("Encode, frame and decode set_actor_transform requests and responses as JSON and as MessagePack, and compare time and bytes. Usage: UnrealMCP.Bench.Codec (Edits=50000)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MCPCodecBench::RunCommand)
+);
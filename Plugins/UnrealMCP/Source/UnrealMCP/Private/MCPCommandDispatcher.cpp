@@ -0,0 +1,368 @@
+#include "MCPCommandDispatcher.h"
+#include "MCPServerStats.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/CoreDelegates.h"
+
+static TAutoConsoleVariable<float> CVarMCPFrameBudgetMs(
+    TEXT("UnrealMCP.FrameBudgetMs"),
+    4.0f,
+    TEXT("Game thread time per frame spent running queued MCP commands. At least one command runs each frame."),
+    ECVF_Default
+);
+
+namespace
+{
+    TSharedRef<FJsonObject> MakeSuccess(const TSharedPtr<FJsonObject>& Result)
+    {
+        TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+        Response->SetStringField(TEXT("status"), TEXT("success"));
+        Response->SetObjectField(TEXT("result"), Result);
+        return Response;
+    }
+
+    TSharedRef<FJsonObject> MakeError(const FString& Error)
+    {
+        TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+        Response->SetStringField(TEXT("status"), TEXT("error"));
+        Response->SetStringField(TEXT("error"), Error);
+        return Response;
+    }
+
+    /** Results report failure the way the command handlers do, with success false */
+    TSharedRef<FJsonObject> MakeResponse(const TSharedPtr<FJsonObject>& Result)
+    {
+        bool bSuccess = true;
+        if (Result.IsValid() && Result->TryGetBoolField(TEXT("success"), bSuccess) && !bSuccess)
+        {
+            return MakeError(Result->GetStringField(TEXT("error")));
+        }
+        return MakeSuccess(Result);
+    }
+
+    bool IsReadOnly(const FString& CommandType)
+    {
+        return CommandType == TEXT("ping") || CommandType == TEXT("get_actors_in_level") || CommandType == TEXT("find_actors_by_name")
+            || CommandType == TEXT("debug_sleep");
+    }
+}
+
+FMCPCommandDispatcher::FMCPCommandDispatcher(FExecuteFunction InExecute, FStreamFunction InStream)
+    : Execute(MoveTemp(InExecute))
+    , Stream(MoveTemp(InStream))
+    , NumQueued(0)
+    , NumWritesQueued(0)
+    , bRunning(false)
+{
+}
+
+FMCPCommandDispatcher::~FMCPCommandDispatcher()
+{
+    Stop();
+}
+
+void FMCPCommandDispatcher::Start()
+{
+    check(IsInGameThread());
+    if (bRunning)
+    {
+        return;
+    }
+    bRunning = true;
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPCommandDispatcher::Tick));
+
+    if (GEngine)
+    {
+        ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPCommandDispatcher::OnActorChanged);
+        ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPCommandDispatcher::OnActorChanged);
+        ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPCommandDispatcher::OnActorChanged);
+    }
+    ActorLabelHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPCommandDispatcher::OnActorChanged);
+    MapChangedHandle = FEditorDelegates::MapChange.AddLambda([this](uint32) { MarkActorsChanged(); });
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMCPCommandDispatcher::MarkActorsChanged);
+}
+
+void FMCPCommandDispatcher::Stop()
+{
+    {
+        FScopeLock Lock(&SubmitLock);
+        if (!bRunning)
+        {
+            return;
+        }
+        bRunning = false;
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+        GEngine->OnActorMoved().Remove(ActorMovedHandle);
+    }
+    FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelHandle);
+    FEditorDelegates::MapChange.Remove(MapChangedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+
+    for (FActiveStream& ActiveStream : Streams)
+    {
+        Complete(ActiveStream.Request, MakeError(TEXT("Server stopped")));
+    }
+    Streams.Empty();
+
+    FMCPCommandRequest Request;
+    while (Queue.Dequeue(Request))
+    {
+        --NumQueued;
+        if (!IsReadOnly(Request.CommandType))
+        {
+            --NumWritesQueued;
+        }
+        Complete(Request, MakeError(TEXT("Server stopped")));
+    }
+}
+
+void FMCPCommandDispatcher::Submit(FMCPCommandRequest&& Request)
+{
+    Request.SubmitSeconds = FPlatformTime::Seconds();
+
+    if (TryAnswerImmediately(Request))
+    {
+        return;
+    }
+
+    // Answered outside the lock, completing can run the submitter's send
+    FString Refusal;
+    {
+        FScopeLock Lock(&SubmitLock);
+        if (!bRunning)
+        {
+            Refusal = TEXT("Server stopped");
+        }
+        // Bounded, so a flood of commands is refused rather than queued behind a slow one forever
+        else if (NumQueued.IncrementExchange() >= MaxQueuedCommands)
+        {
+            --NumQueued;
+            Refusal = FString::Printf(TEXT("Server busy, %d commands queued"), MaxQueuedCommands);
+        }
+        else
+        {
+            // Counted before it is queued, so a listing submitted after it cannot be answered from the cache
+            if (!IsReadOnly(Request.CommandType))
+            {
+                ++NumWritesQueued;
+                MarkActorsChanged();
+            }
+            Queue.Enqueue(MoveTemp(Request));
+            return;
+        }
+    }
+
+    Complete(Request, MakeError(Refusal));
+}
+
+bool FMCPCommandDispatcher::TryAnswerImmediately(FMCPCommandRequest& Request)
+{
+    if (Request.CommandType == TEXT("ping"))
+    {
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("message"), TEXT("pong"));
+        Complete(Request, MakeSuccess(Result));
+        return true;
+    }
+
+    // Answered here so the stats are readable while the game thread is busy
+    if (Request.CommandType == TEXT("server_stats"))
+    {
+        const bool bReset = Request.Params.IsValid() && Request.Params->HasTypedField<EJson::Boolean>(TEXT("reset"))
+            && Request.Params->GetBoolField(TEXT("reset"));
+        TSharedRef<FJsonObject> Result = FMCPServerStats::Get().ToJson();
+        Result->SetNumberField(TEXT("queued"), NumQueued.Load());
+        if (bReset)
+        {
+            FMCPServerStats::Get().Reset();
+        }
+        Complete(Request, MakeSuccess(Result));
+        return true;
+    }
+
+    // Only the unfiltered listing is cached, and it may predate a write still waiting in the queue
+    if (Request.CommandType == TEXT("get_actors_in_level") && (!Request.Params.IsValid() || Request.Params->Values.Num() == 0)
+        && NumWritesQueued.Load() == 0)
+    {
+        TSharedPtr<FJsonObject> Snapshot;
+        {
+            FScopeLock Lock(&SnapshotLock);
+            Snapshot = ActorsSnapshot;
+        }
+
+        if (Snapshot.IsValid())
+        {
+            Complete(Request, MakeSuccess(Snapshot));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FMCPCommandDispatcher::Tick(float DeltaTime)
+{
+    const double Deadline = FPlatformTime::Seconds() + CVarMCPFrameBudgetMs.GetValueOnGameThread() / 1000.0;
+
+    FMCPCommandRequest Request;
+    do
+    {
+        if (!Queue.Dequeue(Request))
+        {
+            break;
+        }
+        --NumQueued;
+        FMCPServerStats::Get().RecordQueueWait(Request.CommandType, FPlatformTime::Seconds() - Request.SubmitSeconds);
+
+        // Commands that change the level make the cached listing stale before they run. Only this
+        // thread caches a listing, and not before this command has run, so it stops counting as waiting
+        if (!IsReadOnly(Request.CommandType))
+        {
+            MarkActorsChanged();
+            --NumWritesQueued;
+        }
+
+        // Streamed answers start below, with the other streams
+        if (Request.OnChunk && Stream)
+        {
+            FMCPChunkProducer Produce = Stream(Request.CommandType, Request.Params);
+            if (Produce)
+            {
+                FActiveStream& ActiveStream = Streams.AddDefaulted_GetRef();
+                ActiveStream.Request = MoveTemp(Request);
+                ActiveStream.Produce = MoveTemp(Produce);
+                continue;
+            }
+        }
+
+        const double ExecuteStart = FPlatformTime::Seconds();
+        TSharedRef<FJsonObject> Response = Execute(Request.CommandType, Request.Params);
+        FMCPServerStats::Get().RecordExecute(Request.CommandType, FPlatformTime::Seconds() - ExecuteStart);
+
+        // A fresh unfiltered listing becomes the cached one
+        if (Request.CommandType == TEXT("get_actors_in_level") && (!Request.Params.IsValid() || Request.Params->Values.Num() == 0))
+        {
+            const TSharedPtr<FJsonObject>* Result = nullptr;
+            if (Response->TryGetObjectField(TEXT("result"), Result))
+            {
+                FScopeLock Lock(&SnapshotLock);
+                ActorsSnapshot = *Result;
+            }
+        }
+
+        Complete(Request, Response);
+    }
+    while (FPlatformTime::Seconds() < Deadline);
+
+    TickStreams();
+    return true;
+}
+
+void FMCPCommandDispatcher::TickStreams()
+{
+    for (int32 Index = 0; Index < Streams.Num(); ++Index)
+    {
+        FActiveStream& ActiveStream = Streams[Index];
+        if (ActiveStream.State->bCancelled)
+        {
+            Streams.RemoveAt(Index--);
+            continue;
+        }
+        if (ActiveStream.State->bChunkPending)
+        {
+            continue;
+        }
+        if (ActiveStream.State->bChunkAccepted)
+        {
+            ActiveStream.HeldChunk.Reset();
+        }
+
+        // The reader has not taken the last chunk yet, offer it again rather than making another
+        if (ActiveStream.HeldChunk.IsValid())
+        {
+            SendChunk(ActiveStream, ActiveStream.HeldChunk.ToSharedRef());
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> Chunk;
+        const double ProduceStart = FPlatformTime::Seconds();
+        const bool bMore = ActiveStream.Produce(Chunk);
+        ActiveStream.ExecuteSeconds += FPlatformTime::Seconds() - ProduceStart;
+        TSharedRef<FJsonObject> Response = MakeResponse(Chunk);
+        if (ActiveStream.Request.RequestId.IsValid())
+        {
+            Response->SetField(TEXT("id"), ActiveStream.Request.RequestId);
+        }
+
+        if (!bMore || Response->GetStringField(TEXT("status")) != TEXT("success"))
+        {
+            FMCPServerStats::Get().RecordExecute(ActiveStream.Request.CommandType, ActiveStream.ExecuteSeconds);
+            Complete(ActiveStream.Request, Response);
+            Streams.RemoveAt(Index--);
+            continue;
+        }
+
+        ActiveStream.HeldChunk = Response;
+        SendChunk(ActiveStream, Response);
+    }
+}
+
+void FMCPCommandDispatcher::SendChunk(FActiveStream& ActiveStream, const TSharedRef<FJsonObject>& Chunk)
+{
+    // Serialized and sent on a worker, the flags hold back the next chunk until this one is accepted
+    ActiveStream.State->bChunkPending = true;
+    ActiveStream.State->bChunkAccepted = false;
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [OnChunk = ActiveStream.Request.OnChunk, State = ActiveStream.State, Chunk]()
+    {
+        const EMCPChunkResult Result = OnChunk(Chunk);
+        State->bCancelled = Result == EMCPChunkResult::Closed;
+        State->bChunkAccepted = Result == EMCPChunkResult::Accepted;
+        State->bChunkPending = false;
+    });
+}
+
+void FMCPCommandDispatcher::Complete(FMCPCommandRequest& Request, const TSharedRef<FJsonObject>& Response)
+{
+    FMCPServerStats::Get().RecordCompleted(Request.CommandType, Response->GetStringField(TEXT("status")) == TEXT("success"));
+
+    if (Request.RequestId.IsValid())
+    {
+        Response->SetField(TEXT("id"), Request.RequestId);
+    }
+
+    if (!Request.OnComplete)
+    {
+        return;
+    }
+
+    // Serializing and sending stay off the game thread
+    if (IsInGameThread())
+    {
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [OnComplete = MoveTemp(Request.OnComplete), Response]()
+        {
+            OnComplete(Response);
+        });
+    }
+    else
+    {
+        Request.OnComplete(Response);
+    }
+}
+
+void FMCPCommandDispatcher::MarkActorsChanged()
+{
+    FScopeLock Lock(&SnapshotLock);
+    ActorsSnapshot.Reset();
+}
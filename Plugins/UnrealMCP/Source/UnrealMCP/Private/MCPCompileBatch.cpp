@@ -0,0 +1,68 @@
+#include "MCPCompileBatch.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/KismetEditorUtilities.h"
+
+int32 FMCPCompileBatch::Depth = 0;
+int32 FMCPCompileBatch::NumCompiles = 0;
+TArray<TWeakObjectPtr<UBlueprint>> FMCPCompileBatch::Pending;
+
+FMCPCompileBatch::FMCPCompileBatch()
+{
+    check(IsInGameThread());
+    ++Depth;
+}
+
+FMCPCompileBatch::~FMCPCompileBatch()
+{
+    // Nested batches leave their compiles to the outermost one
+    if (Depth == 1)
+    {
+        Flush();
+    }
+    --Depth;
+}
+
+void FMCPCompileBatch::RequestCompile(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    if (IsBatching())
+    {
+        Pending.AddUnique(Blueprint);
+        return;
+    }
+
+    Compile(Blueprint);
+}
+
+void FMCPCompileBatch::FlushCompile(UBlueprint* Blueprint)
+{
+    if (Blueprint && Pending.Remove(Blueprint) > 0)
+    {
+        Compile(Blueprint);
+    }
+}
+
+int32 FMCPCompileBatch::Flush()
+{
+    // In the order they were first asked for
+    TArray<TWeakObjectPtr<UBlueprint>> ToCompile = MoveTemp(Pending);
+    for (const TWeakObjectPtr<UBlueprint>& Blueprint : ToCompile)
+    {
+        if (Blueprint.IsValid())
+        {
+            Compile(Blueprint.Get());
+            ++NumCompiled;
+        }
+    }
+    return NumCompiled;
+}
+
+void FMCPCompileBatch::Compile(UBlueprint* Blueprint)
+{
+    FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    ++NumCompiles;
+}
@@ -0,0 +1,407 @@
+#include "MCPGraphPatch.h"
+#include "MCPBlueprintCatalog.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphSchema.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_Event.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "K2Node_InputAction.h"
+#include "K2Node_Self.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+    // Up to date with variables and functions added since the last compile
+    UClass* GetBlueprintClass(UBlueprint* Blueprint)
+    {
+        return Blueprint->SkeletonGeneratedClass ? Blueprint->SkeletonGeneratedClass.Get() : Blueprint->GeneratedClass.Get();
+    }
+}
+
+FMCPGraphPatch::FMCPGraphPatch(UBlueprint* InBlueprint, UEdGraph* InGraph)
+    : Blueprint(InBlueprint)
+    , Graph(InGraph)
+{
+}
+
+TSharedPtr<FJsonObject> FMCPGraphPatch::Apply(const TArray<TSharedPtr<FJsonValue>>& NodeDescs, const TArray<TSharedPtr<FJsonValue>>& EdgeDescs)
+{
+    static const TMap<FString, FMakeNodeFunction> NodeMakers = {
+        { TEXT("event"), &FMCPGraphPatch::MakeEventNode },
+        { TEXT("function"), &FMCPGraphPatch::MakeFunctionNode },
+        { TEXT("variable_get"), &FMCPGraphPatch::MakeVariableGetNode },
+        { TEXT("variable_set"), &FMCPGraphPatch::MakeVariableSetNode },
+        { TEXT("input_action"), &FMCPGraphPatch::MakeInputActionNode },
+        { TEXT("self"), &FMCPGraphPatch::MakeSelfNode },
+    };
+
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    auto AddError = [&Errors](const FString& Error)
+    {
+        Errors.Add(MakeShared<FJsonValueString>(Error));
+    };
+
+    // One pass over what is there already, for edges to existing nodes and events that can only be placed once
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node)
+        {
+            ExistingByGuid.Add(Node->NodeGuid, Node);
+            if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+            {
+                Events.Add(EventNode->EventReference.GetMemberName(), EventNode);
+            }
+        }
+    }
+
+    Blueprint->Modify();
+    Graph->Modify();
+
+    TSharedPtr<FJsonObject> NodeGuids = MakeShared<FJsonObject>();
+    Nodes.Reserve(NodeDescs.Num());
+    Created.Reserve(NodeDescs.Num());
+
+    for (int32 Index = 0; Index < NodeDescs.Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* Desc = nullptr;
+        FString Id;
+        FString Type;
+        if (!NodeDescs[Index]->TryGetObject(Desc) || !(*Desc)->TryGetStringField(TEXT("id"), Id) || !(*Desc)->TryGetStringField(TEXT("type"), Type))
+        {
+            AddError(FString::Printf(TEXT("nodes[%d]: missing 'id' or 'type'"), Index));
+            continue;
+        }
+        if (Nodes.Contains(Id))
+        {
+            AddError(FString::Printf(TEXT("nodes[%d]: duplicate id '%s'"), Index, *Id));
+            continue;
+        }
+
+        const FMakeNodeFunction* MakeNode = NodeMakers.Find(Type);
+        if (!MakeNode)
+        {
+            AddError(FString::Printf(TEXT("nodes[%d] (%s): unknown node type '%s'"), Index, *Id, *Type));
+            continue;
+        }
+
+        FString Name;
+        (*Desc)->TryGetStringField(TEXT("name"), Name);
+
+        // An event can only be in the graph once, so one that is there already is used as it is
+        UK2Node_Event** ExistingEvent = Type == TEXT("event") ? Events.Find(FName(*Name)) : nullptr;
+        if (ExistingEvent)
+        {
+            FPatchNode& PatchNode = Nodes.Add(Id);
+            PatchNode.Node = *ExistingEvent;
+            MapPins(PatchNode);
+            NodeGuids->SetStringField(Id, PatchNode.Node->NodeGuid.ToString());
+            continue;
+        }
+
+        FString Error;
+        UEdGraphNode* Node = (this->**MakeNode)(**Desc, Name, Error);
+        if (!Node)
+        {
+            AddError(FString::Printf(TEXT("nodes[%d] (%s): %s"), Index, *Id, *Error));
+            continue;
+        }
+
+        const FPatchNode& PatchNode = Place(Node, Id, FEpicUnrealMCPCommonUtils::GetVector2DFromJson(*Desc, TEXT("position")));
+        NodeGuids->SetStringField(Id, PatchNode.Node->NodeGuid.ToString());
+    }
+
+    int32 NumConnected = 0;
+    for (int32 Index = 0; Index < EdgeDescs.Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* Desc = nullptr;
+        FString SourceId;
+        FString TargetId;
+        if (!EdgeDescs[Index]->TryGetObject(Desc) || !(*Desc)->TryGetStringField(TEXT("source"), SourceId) || !(*Desc)->TryGetStringField(TEXT("target"), TargetId))
+        {
+            AddError(FString::Printf(TEXT("edges[%d]: missing 'source' or 'target'"), Index));
+            continue;
+        }
+
+        // Execution flow by default, then into execute
+        FString SourcePinName = UEdGraphSchema_K2::PN_Then.ToString();
+        FString TargetPinName = UEdGraphSchema_K2::PN_Execute.ToString();
+        (*Desc)->TryGetStringField(TEXT("source_pin"), SourcePinName);
+        (*Desc)->TryGetStringField(TEXT("target_pin"), TargetPinName);
+
+        // Each pin is found before the next node, finding an existing node may grow the map the other is in
+        const FPatchNode* Source = FindNode(SourceId);
+        UEdGraphPin* SourcePin = Source ? FindPin(*Source, SourcePinName, EGPD_Output) : nullptr;
+        const FPatchNode* Target = FindNode(TargetId);
+        UEdGraphPin* TargetPin = Target ? FindPin(*Target, TargetPinName, EGPD_Input) : nullptr;
+
+        FString Error;
+        if (!Source || !Target)
+        {
+            Error = FString::Printf(TEXT("no node '%s'"), Source ? *TargetId : *SourceId);
+        }
+        else if (!SourcePin || !TargetPin)
+        {
+            Error = SourcePin ? FString::Printf(TEXT("no input pin '%s' on '%s'"), *TargetPinName, *TargetId)
+                : FString::Printf(TEXT("no output pin '%s' on '%s'"), *SourcePinName, *SourceId);
+        }
+        else if (Connect(SourcePin, TargetPin, Error))
+        {
+            ++NumConnected;
+            continue;
+        }
+        AddError(FString::Printf(TEXT("edges[%d] (%s.%s -> %s.%s): %s"), Index, *SourceId, *SourcePinName, *TargetId, *TargetPinName, *Error));
+    }
+
+    // The graph and the blueprint hear about it once, however many nodes and links went in
+    if (Created.Num() > 0 || NumConnected > 0)
+    {
+        Graph->NotifyGraphChanged();
+        if (bStructural)
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+        }
+        else
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetObjectField(TEXT("nodes"), NodeGuids);
+    ResultObj->SetNumberField(TEXT("created"), Created.Num());
+    ResultObj->SetNumberField(TEXT("connected"), NumConnected);
+    ResultObj->SetNumberField(TEXT("failed"), Errors.Num());
+    ResultObj->SetArrayField(TEXT("errors"), Errors);
+    return ResultObj;
+}
+
+UEdGraphNode* FMCPGraphPatch::MakeEventNode(const FJsonObject& Desc, const FString& Name, FString& OutError)
+{
+    UClass* BlueprintClass = GetBlueprintClass(Blueprint);
+    UFunction* EventFunction = BlueprintClass ? BlueprintClass->FindFunctionByName(FName(*Name)) : nullptr;
+    if (!EventFunction)
+    {
+        OutError = FString::Printf(TEXT("no event named '%s'"), *Name);
+        return nullptr;
+    }
+    if (!EventFunction->HasAnyFunctionFlags(FUNC_BlueprintEvent))
+    {
+        OutError = FString::Printf(TEXT("'%s' is a function, not an event a blueprint can implement"), *Name);
+        return nullptr;
+    }
+
+    UK2Node_Event* EventNode = NewObject<UK2Node_Event>(Graph);
+    EventNode->EventReference.SetExternalMember(EventFunction->GetFName(), EventFunction->GetOwnerClass());
+    EventNode->bOverrideFunction = true;
+    return EventNode;
+}
+
+UEdGraphNode* FMCPGraphPatch::MakeFunctionNode(const FJsonObject& Desc, const FString& Name, FString& OutError)
+{
+    FString Target;
+    Desc.TryGetStringField(TEXT("target"), Target);
+
+    UClass* Class = Target.IsEmpty() ? GetBlueprintClass(Blueprint) : FindClass(Target);
+    if (!Class)
+    {
+        OutError = FString::Printf(TEXT("no class named '%s'"), *Target);
+        return nullptr;
+    }
+
+    UFunction* Function = Class->FindFunctionByName(FName(*Name));
+    if (!Function)
+    {
+        OutError = FString::Printf(TEXT("no function named '%s' on %s"), *Name, *Class->GetName());
+        return nullptr;
+    }
+
+    UK2Node_CallFunction* FunctionNode = NewObject<UK2Node_CallFunction>(Graph);
+    FunctionNode->SetFromFunction(Function);
+    return FunctionNode;
+}
+
+UEdGraphNode* FMCPGraphPatch::MakeVariableGetNode(const FJsonObject& Desc, const FString& Name, FString& OutError)
+{
+    FProperty* Property = FindFProperty<FProperty>(GetBlueprintClass(Blueprint), FName(*Name));
+    if (!Property)
+    {
+        OutError = FString::Printf(TEXT("no variable named '%s'"), *Name);
+        return nullptr;
+    }
+
+    UK2Node_VariableGet* VariableGetNode = NewObject<UK2Node_VariableGet>(Graph);
+    VariableGetNode->VariableReference.SetFromField<FProperty>(Property, true);
+    return VariableGetNode;
+}
+
+UEdGraphNode* FMCPGraphPatch::MakeVariableSetNode(const FJsonObject& Desc, const FString& Name, FString& OutError)
+{
+    FProperty* Property = FindFProperty<FProperty>(GetBlueprintClass(Blueprint), FName(*Name));
+    if (!Property)
+    {
+        OutError = FString::Printf(TEXT("no variable named '%s'"), *Name);
+        return nullptr;
+    }
+
+    UK2Node_VariableSet* VariableSetNode = NewObject<UK2Node_VariableSet>(Graph);
+    VariableSetNode->VariableReference.SetFromField<FProperty>(Property, true);
+    return VariableSetNode;
+}
+
+UEdGraphNode* FMCPGraphPatch::MakeInputActionNode(const FJsonObject& Desc, const FString& Name, FString& OutError)
+{
+    if (Name.IsEmpty())
+    {
+        OutError = TEXT("missing input action 'name'");
+        return nullptr;
+    }
+
+    UK2Node_InputAction* InputActionNode = NewObject<UK2Node_InputAction>(Graph);
+    InputActionNode->InputActionName = FName(*Name);
+    return InputActionNode;
+}
+
+UEdGraphNode* FMCPGraphPatch::MakeSelfNode(const FJsonObject& Desc, const FString& Name, FString& OutError)
+{
+    return NewObject<UK2Node_Self>(Graph);
+}
+
+FMCPGraphPatch::FPatchNode& FMCPGraphPatch::Place(UEdGraphNode* Node, const FString& Id, const FVector2D& Position)
+{
+    // What UEdGraph::AddNode does, less the graph changed notification it sends per node
+    Node->SetFlags(RF_Transactional);
+    Node->NodePosX = Position.X;
+    Node->NodePosY = Position.Y;
+    Graph->Nodes.Add(Node);
+    Node->CreateNewGuid();
+    Node->PostPlacedNewNode();
+    Node->AllocateDefaultPins();
+    Created.Add(Node);
+
+    if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+    {
+        Events.Add(EventNode->EventReference.GetMemberName(), EventNode);
+        bStructural = true;
+    }
+
+    FPatchNode& PatchNode = Nodes.Add(Id);
+    PatchNode.Node = Node;
+    MapPins(PatchNode);
+    return PatchNode;
+}
+
+void FMCPGraphPatch::MapPins(FPatchNode& PatchNode)
+{
+    for (UEdGraphPin* Pin : PatchNode.Node->Pins)
+    {
+        // The first pin of a name wins, as a scan in pin order would find it
+        (Pin->Direction == EGPD_Input ? PatchNode.Inputs : PatchNode.Outputs).FindOrAdd(Pin->PinName, Pin);
+    }
+}
+
+FMCPGraphPatch::FPatchNode* FMCPGraphPatch::FindNode(const FString& Id)
+{
+    if (FPatchNode* PatchNode = Nodes.Find(Id))
+    {
+        return PatchNode;
+    }
+
+    FGuid Guid;
+    if (!FGuid::Parse(Id, Guid))
+    {
+        return nullptr;
+    }
+    if (FPatchNode* PatchNode = ExistingNodes.Find(Guid))
+    {
+        return PatchNode;
+    }
+
+    UEdGraphNode** Node = ExistingByGuid.Find(Guid);
+    if (!Node)
+    {
+        return nullptr;
+    }
+    FPatchNode& PatchNode = ExistingNodes.Add(Guid);
+    PatchNode.Node = *Node;
+    MapPins(PatchNode);
+    return &PatchNode;
+}
+
+UEdGraphPin* FMCPGraphPatch::FindPin(const FPatchNode& PatchNode, const FString& PinName, EEdGraphPinDirection Direction)
+{
+    // FNames compare case-insensitively, like FindPin's fallback
+    const TMap<FName, UEdGraphPin*>& Pins = Direction == EGPD_Input ? PatchNode.Inputs : PatchNode.Outputs;
+    const FName Key(*PinName, FNAME_Find);
+    if (UEdGraphPin* const* Pin = Key.IsNone() ? nullptr : Pins.Find(Key))
+    {
+        return *Pin;
+    }
+
+    if (Direction == EGPD_Output && Cast<UK2Node_VariableGet>(PatchNode.Node))
+    {
+        for (const TPair<FName, UEdGraphPin*>& Pin : Pins)
+        {
+            if (Pin.Value->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+            {
+                return Pin.Value;
+            }
+        }
+    }
+    return nullptr;
+}
+
+bool FMCPGraphPatch::Connect(UEdGraphPin* SourcePin, UEdGraphPin* TargetPin, FString& OutError)
+{
+    const FPinConnectionResponse Response = Graph->GetSchema()->CanCreateConnection(SourcePin, TargetPin);
+    switch (Response.Response)
+    {
+    case CONNECT_RESPONSE_MAKE:
+        break;
+    case CONNECT_RESPONSE_BREAK_OTHERS_A:
+        SourcePin->BreakAllPinLinks();
+        break;
+    case CONNECT_RESPONSE_BREAK_OTHERS_B:
+        TargetPin->BreakAllPinLinks();
+        break;
+    case CONNECT_RESPONSE_BREAK_OTHERS_AB:
+        SourcePin->BreakAllPinLinks();
+        TargetPin->BreakAllPinLinks();
+        break;
+    default:
+        OutError = Response.Message.IsEmpty() ? TEXT("the pins cannot be linked directly") : Response.Message.ToString();
+        return false;
+    }
+
+    SourcePin->MakeLinkTo(TargetPin);
+    return true;
+}
+
+UClass* FMCPGraphPatch::FindClass(const FString& ClassName)
+{
+    if (UClass** Found = Classes.Find(ClassName))
+    {
+        return *Found;
+    }
+
+    // A path, a native class with or without its prefix, or a blueprint
+    UClass* Class = ClassName.Contains(TEXT(".")) ? FindObject<UClass>(nullptr, *ClassName)
+        : FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
+    if (!Class && ClassName.Len() > 1 && (ClassName[0] == TEXT('U') || ClassName[0] == TEXT('A')))
+    {
+        Class = FindFirstObject<UClass>(*ClassName.RightChop(1), EFindFirstObjectOptions::NativeFirst);
+    }
+    if (!Class)
+    {
+        Class = FMCPBlueprintCatalog::Get().FindGeneratedClass(ClassName);
+    }
+
+    Classes.Add(ClassName, Class);
+    return Class;
+}
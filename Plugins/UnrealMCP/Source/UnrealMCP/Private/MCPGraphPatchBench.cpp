@@ -0,0 +1,192 @@
+#include "EpicUnrealMCPBridge.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Editor.h"
+#include "EditorAssetLibrary.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "Kismet/KismetStringLibrary.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * The same event graph built node by node with the common utils helpers, as handlers build
+ * graphs today, and as one patch_blueprint_graph command: BeginPlay into a chain of
+ * PrintString calls, each fed by its own IntToString. Each way gets its own blueprint and both
+ * are deleted at the end. That both end up with the same nodes and links is checked by the
+ * UnrealMCP.GraphPatch automation tests, this only times them.
+ * Runs in process on the game thread, so the patch's time includes reading its JSON but no
+ * socket round trips, which the node by node path would pay once per node on top.
+ */
+namespace MCPGraphPatchBench
+{
+    struct FGraphCounts
+    {
+        int32 Nodes = 0;
+        int32 Links = 0;
+    };
+
+    FGraphCounts Count(UEdGraph* Graph)
+    {
+        FGraphCounts Counts;
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            ++Counts.Nodes;
+            for (UEdGraphPin* Pin : Node->Pins)
+            {
+                Counts.Links += Pin->Direction == EGPD_Output ? Pin->LinkedTo.Num() : 0;
+            }
+        }
+        return Counts;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> MakePosition(int32 X, int32 Y)
+    {
+        return { MakeShared<FJsonValueNumber>(X), MakeShared<FJsonValueNumber>(Y) };
+    }
+
+    TSharedPtr<FJsonValue> MakeNode(const FString& Id, const FString& Type, const FString& Name, const FString& Target, int32 X, int32 Y)
+    {
+        TSharedPtr<FJsonObject> Node = MakeShared<FJsonObject>();
+        Node->SetStringField(TEXT("id"), Id);
+        Node->SetStringField(TEXT("type"), Type);
+        Node->SetStringField(TEXT("name"), Name);
+        if (!Target.IsEmpty())
+        {
+            Node->SetStringField(TEXT("target"), Target);
+        }
+        Node->SetArrayField(TEXT("position"), MakePosition(X, Y));
+        return MakeShared<FJsonValueObject>(Node);
+    }
+
+    TSharedPtr<FJsonValue> MakeEdge(const FString& Source, const FString& SourcePin, const FString& Target, const FString& TargetPin)
+    {
+        TSharedPtr<FJsonObject> Edge = MakeShared<FJsonObject>();
+        Edge->SetStringField(TEXT("source"), Source);
+        Edge->SetStringField(TEXT("source_pin"), SourcePin);
+        Edge->SetStringField(TEXT("target"), Target);
+        Edge->SetStringField(TEXT("target_pin"), TargetPin);
+        return MakeShared<FJsonValueObject>(Edge);
+    }
+
+    bool Succeeded(const TSharedRef<FJsonObject>& Response)
+    {
+        return Response->GetStringField(TEXT("status")) == TEXT("success");
+    }
+
+    void Run(UEpicUnrealMCPBridge* Bridge, int32 NumPrints)
+    {
+        // Unique per run, so a run that was interrupted cannot collide with the next
+        const FString RunId = FString::Printf(TEXT("%08X"), FPlatformTime::Cycles());
+        const FString PerNodeBlueprint = FString::Printf(TEXT("MCPBenchGraphA_%s"), *RunId);
+        const FString PatchBlueprint = FString::Printf(TEXT("MCPBenchGraphB_%s"), *RunId);
+
+        int32 SetupFailures = 0;
+        for (const FString& BlueprintName : { PerNodeBlueprint, PatchBlueprint })
+        {
+            TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+            Params->SetStringField(TEXT("name"), BlueprintName);
+            SetupFailures += Succeeded(Bridge->ExecuteCommandOnGameThread(TEXT("create_blueprint"), Params)) ? 0 : 1;
+        }
+
+        UBlueprint* PerNode = FEpicUnrealMCPCommonUtils::FindBlueprint(PerNodeBlueprint);
+        UBlueprint* Patched = FEpicUnrealMCPCommonUtils::FindBlueprint(PatchBlueprint);
+        UFunction* PrintString = UKismetSystemLibrary::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, PrintString));
+        UFunction* IntToString = UKismetStringLibrary::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UKismetStringLibrary, Conv_IntToString));
+        if (SetupFailures > 0 || !PerNode || !Patched || !PrintString || !IntToString)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealMCP.Bench.GraphPatch could not set up its blueprints"));
+            return;
+        }
+
+        // Node by node, every pin found by scanning
+        UEdGraph* PerNodeGraph = FEpicUnrealMCPCommonUtils::FindOrCreateEventGraph(PerNode);
+        const FGraphCounts PerNodeBefore = Count(PerNodeGraph);
+        int32 PerNodeFailures = 0;
+        const double PerNodeStart = FPlatformTime::Seconds();
+        UEdGraphNode* Previous = FEpicUnrealMCPCommonUtils::CreateEventNode(PerNodeGraph, TEXT("ReceiveBeginPlay"), FVector2D(0.0, 0.0));
+        for (int32 Index = 0; Index < NumPrints && Previous; ++Index)
+        {
+            UEdGraphNode* Convert = FEpicUnrealMCPCommonUtils::CreateFunctionCallNode(PerNodeGraph, IntToString, FVector2D(300.0 * (Index + 1), 200.0));
+            UEdGraphNode* Print = FEpicUnrealMCPCommonUtils::CreateFunctionCallNode(PerNodeGraph, PrintString, FVector2D(300.0 * (Index + 1), 0.0));
+            PerNodeFailures += FEpicUnrealMCPCommonUtils::ConnectGraphNodes(PerNodeGraph, Previous, TEXT("then"), Print, TEXT("execute")) ? 0 : 1;
+            PerNodeFailures += FEpicUnrealMCPCommonUtils::ConnectGraphNodes(PerNodeGraph, Convert, TEXT("ReturnValue"), Print, TEXT("InString")) ? 0 : 1;
+            Previous = Print;
+        }
+        const double PerNodeMs = (FPlatformTime::Seconds() - PerNodeStart) * 1000.0;
+        PerNodeFailures += Previous ? 0 : 1;
+
+        // The same graph as one patch
+        TArray<TSharedPtr<FJsonValue>> Nodes;
+        TArray<TSharedPtr<FJsonValue>> Edges;
+        Nodes.Add(MakeNode(TEXT("begin"), TEXT("event"), TEXT("ReceiveBeginPlay"), FString(), 0, 0));
+        FString PreviousId = TEXT("begin");
+        for (int32 Index = 0; Index < NumPrints; ++Index)
+        {
+            const FString ConvertId = FString::Printf(TEXT("convert_%d"), Index);
+            const FString PrintId = FString::Printf(TEXT("print_%d"), Index);
+            Nodes.Add(MakeNode(ConvertId, TEXT("function"), TEXT("Conv_IntToString"), TEXT("KismetStringLibrary"), 300 * (Index + 1), 200));
+            Nodes.Add(MakeNode(PrintId, TEXT("function"), TEXT("PrintString"), TEXT("KismetSystemLibrary"), 300 * (Index + 1), 0));
+            Edges.Add(MakeEdge(PreviousId, TEXT("then"), PrintId, TEXT("execute")));
+            Edges.Add(MakeEdge(ConvertId, TEXT("ReturnValue"), PrintId, TEXT("InString")));
+            PreviousId = PrintId;
+        }
+        TSharedPtr<FJsonObject> PatchParams = MakeShared<FJsonObject>();
+        PatchParams->SetStringField(TEXT("blueprint_name"), PatchBlueprint);
+        PatchParams->SetArrayField(TEXT("nodes"), Nodes);
+        PatchParams->SetArrayField(TEXT("edges"), Edges);
+
+        UEdGraph* PatchGraph = FEpicUnrealMCPCommonUtils::FindOrCreateEventGraph(Patched);
+        const FGraphCounts PatchBefore = Count(PatchGraph);
+        const double PatchStart = FPlatformTime::Seconds();
+        const TSharedRef<FJsonObject> PatchResponse = Bridge->ExecuteCommandOnGameThread(TEXT("patch_blueprint_graph"), PatchParams);
+        const double PatchMs = (FPlatformTime::Seconds() - PatchStart) * 1000.0;
+
+        const TSharedPtr<FJsonObject>* PatchResult = nullptr;
+        const int32 PatchFailures = Succeeded(PatchResponse) && PatchResponse->TryGetObjectField(TEXT("result"), PatchResult)
+            ? static_cast<int32>((*PatchResult)->GetNumberField(TEXT("failed"))) : Nodes.Num() + Edges.Num();
+
+        const FGraphCounts PerNodeAfter = Count(PerNodeGraph);
+        const FGraphCounts PatchAfter = Count(PatchGraph);
+        const int32 PerNodeAdded = PerNodeAfter.Nodes - PerNodeBefore.Nodes;
+        const int32 PatchAdded = PatchAfter.Nodes - PatchBefore.Nodes;
+        const int32 PerNodeLinked = PerNodeAfter.Links - PerNodeBefore.Links;
+        const int32 PatchLinked = PatchAfter.Links - PatchBefore.Links;
+
+        UE_LOG(LogTemp, Warning, TEXT("=== MCP GRAPH PATCH BENCHMARK (%d nodes, %d links) ==="), Nodes.Num(), Edges.Num());
+        UE_LOG(LogTemp, Warning, TEXT("  Node by node: %.1f ms, %d nodes added, %d links, %d failed"), PerNodeMs, PerNodeAdded, PerNodeLinked, PerNodeFailures);
+        UE_LOG(LogTemp, Warning, TEXT("  Patch:        %.1f ms, %d nodes added, %d links, %d failed (%.1fx)"),
+            PatchMs, PatchAdded, PatchLinked, PatchFailures, PatchMs > 0.0 ? PerNodeMs / PatchMs : 0.0);
+
+        for (const FString& BlueprintName : { PerNodeBlueprint, PatchBlueprint })
+        {
+            UEditorAssetLibrary::DeleteAsset(TEXT("/Game/Blueprints/") + BlueprintName);
+        }
+    }
+
+    void RunCommand(const TArray<FString>& Args)
+    {
+        UEpicUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UEpicUnrealMCPBridge>() : nullptr;
+        if (!Bridge)
+        {
+            UE_LOG(LogTemp, Error, TEXT("UnrealMCP.Bench.GraphPatch needs the MCP bridge"));
+            return;
+        }
+
+        // The event plus a PrintString and its IntToString per step
+        const int32 NumNodes = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 3) : 500;
+        Run(Bridge, (NumNodes - 1) / 2);
+    }
+}
+
+static FAutoConsoleCommand MCPGraphPatchBenchCommand(
+    TEXT("UnrealMCP.Bench.GraphPatch"),
+    TEXT("Build the same event graph node by node and as one patch_blueprint_graph command, and compare time and results. Usage: UnrealMCP.Bench.GraphPatch (Nodes=500)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MCPGraphPatchBench::RunCommand)
+);
@@ -0,0 +1,711 @@
+#include "EpicUnrealMCPBridge.h"
+#include "MCPMessageFramer.h"
+#include "Editor.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Async/Async.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+
+/**
+ * Loopback stress tests for the MCP server: many clients pipelining commands over real
+ * sockets, with both framings, messages split across sends and messages far larger than
+ * one read. Responses are matched to requests by id, since they may come back in any order.
+ * Runs on background threads, the game thread has to stay free to run the commands.
+ */
+namespace MCPLoopbackBench
+{
+    // Commands in flight per client
+    constexpr int32 PipelineDepth = 8;
+
+    // Every so often a message much larger than one socket read
+    constexpr int32 LargeMessageInterval = 64;
+    constexpr int32 LargePaddingBytes = 96 * 1024;
+
+    const FTimespan ResponseTimeout = FTimespan::FromSeconds(30);
+
+    /** Every SlowEvery-th command is a debug_sleep of SlowMs on the game thread, the rest are pings */
+    struct FCommandMix
+    {
+        int32 SlowEvery = 0;
+        int32 SlowMs = 0;
+
+        bool IsSlow(int32 CommandIndex) const { return SlowEvery > 0 && CommandIndex % SlowEvery == SlowEvery - 1; }
+    };
+
+    struct FClientResult
+    {
+        bool bConnected = false;
+        int32 Sent = 0;
+        int32 Received = 0;
+        int32 Malformed = 0;
+        TArray<float> FastLatencyMs;
+        TArray<float> SlowLatencyMs;
+    };
+
+    float Percentile(TArray<float> Samples, float Fraction)
+    {
+        if (Samples.Num() == 0) return 0.0f;
+
+        Samples.Sort();
+        const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * Samples.Num()) - 1, 0, Samples.Num() - 1);
+        return Samples[Index];
+    }
+
+    FString MakeCommand(int32 CommandIndex, bool bSlow, int32 SlowMs, int32 PaddingBytes)
+    {
+        TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+        if (bSlow)
+        {
+            Params->SetNumberField(TEXT("ms"), SlowMs);
+        }
+        else
+        {
+            Params->SetStringField(TEXT("padding"), FString::ChrN(PaddingBytes, TEXT('x')));
+        }
+
+        TSharedRef<FJsonObject> Message = MakeShared<FJsonObject>();
+        Message->SetNumberField(TEXT("id"), CommandIndex);
+        Message->SetStringField(TEXT("command"), bSlow ? TEXT("debug_sleep") : TEXT("ping"));
+        Message->SetObjectField(TEXT("params"), Params);
+
+        FString Text;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Text);
+        FJsonSerializer::Serialize(Message, Writer);
+        return Text;
+    }
+
+    /** The id of a well formed response, INDEX_NONE if it is not one */
+    int32 ParseResponse(const FString& Response, bool bSlow)
+    {
+        TSharedPtr<FJsonObject> Json;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response);
+        if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
+        {
+            return INDEX_NONE;
+        }
+
+        int32 Id = INDEX_NONE;
+        const TSharedPtr<FJsonObject>* Result = nullptr;
+        if (!Json->TryGetNumberField(TEXT("id"), Id) || Json->GetStringField(TEXT("status")) != TEXT("success")
+            || !Json->TryGetObjectField(TEXT("result"), Result))
+        {
+            return INDEX_NONE;
+        }
+
+        return (bSlow || (*Result)->GetStringField(TEXT("message")) == TEXT("pong")) ? Id : INDEX_NONE;
+    }
+
+    int32 PeekId(const FString& Response)
+    {
+        // Enough to find the request, ParseResponse does the real check
+        TSharedPtr<FJsonObject> Json;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response);
+        int32 Id = INDEX_NONE;
+        return FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid() && Json->TryGetNumberField(TEXT("id"), Id) ? Id : INDEX_NONE;
+    }
+
+    bool SendAll(FSocket* Socket, const uint8* Data, int32 NumBytes)
+    {
+        while (NumBytes > 0)
+        {
+            int32 BytesSent = 0;
+            if (!Socket->Send(Data, NumBytes, BytesSent))
+            {
+                return false;
+            }
+            Data += BytesSent;
+            NumBytes -= BytesSent;
+        }
+        return true;
+    }
+
+    FClientResult RunClient(const FIPv4Endpoint& Endpoint, int32 ClientIndex, int32 NumCommands, const FCommandMix& Mix)
+    {
+        FClientResult Result;
+        ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+        FSocket* Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("MCPBenchClient"), false);
+        if (!Socket || !Socket->Connect(*Endpoint.ToInternetAddr()))
+        {
+            if (Socket)
+            {
+                SocketSubsystem->DestroySocket(Socket);
+            }
+            return Result;
+        }
+        Result.bConnected = true;
+        Socket->SetNoDelay(true);
+
+        // Odd clients use length prefixes, even clients JSON with and without newlines
+        const EMCPFraming Framing = (ClientIndex % 2) ? EMCPFraming::LengthPrefixed : EMCPFraming::Json;
+        FRandomStream Random(ClientIndex + 1);
+        FMCPMessageFramer Framer;
+        TArray<uint8> SendBytes;
+        TArray<uint8> ReceiveBuffer;
+        ReceiveBuffer.SetNumUninitialized(64 * 1024);
+
+        // Send time of each command in flight, by id
+        TMap<int32, double> InFlight;
+
+        while (Result.Received < NumCommands)
+        {
+            // Keep the pipeline full
+            bool bSendFailed = false;
+            while (InFlight.Num() < PipelineDepth && Result.Sent < NumCommands && !bSendFailed)
+            {
+                const int32 CommandIndex = Result.Sent++;
+                const int32 Padding = (CommandIndex % LargeMessageInterval == LargeMessageInterval - 1) ? LargePaddingBytes : Random.RandRange(0, 256);
+
+                SendBytes.Reset();
+                FMCPMessageFramer::Frame(MakeCommand(CommandIndex, Mix.IsSlow(CommandIndex), Mix.SlowMs, Padding), Framing, SendBytes);
+                if (Framing == EMCPFraming::Json && CommandIndex % 3 == 0)
+                {
+                    SendBytes.Pop(EAllowShrinking::No);
+                }
+
+                // Random cuts, so messages straddle sends
+                InFlight.Add(CommandIndex, FPlatformTime::Seconds());
+                for (int32 Offset = 0; Offset < SendBytes.Num() && !bSendFailed;)
+                {
+                    const int32 Piece = FMath::Min(Random.RandRange(1, 8192), SendBytes.Num() - Offset);
+                    bSendFailed = !SendAll(Socket, SendBytes.GetData() + Offset, Piece);
+                    Offset += Piece;
+                }
+            }
+            if (bSendFailed)
+            {
+                break;
+            }
+
+            FMCPMessage Response;
+            if (Framer.Next(Response))
+            {
+                Result.Received++;
+
+                const int32 Id = PeekId(Response.Text);
+                double SendSeconds = 0.0;
+                if (Id == INDEX_NONE || !InFlight.RemoveAndCopyValue(Id, SendSeconds))
+                {
+                    Result.Malformed++;
+                    continue;
+                }
+
+                const bool bSlow = Mix.IsSlow(Id);
+                const float LatencyMs = static_cast<float>((FPlatformTime::Seconds() - SendSeconds) * 1000.0);
+                (bSlow ? Result.SlowLatencyMs : Result.FastLatencyMs).Add(LatencyMs);
+                Result.Malformed += (Response.Framing == Framing && ParseResponse(Response.Text, bSlow) == Id) ? 0 : 1;
+                continue;
+            }
+
+            int32 BytesRead = 0;
+            if (!Socket->Wait(ESocketWaitConditions::WaitForRead, ResponseTimeout)
+                || !Socket->Recv(ReceiveBuffer.GetData(), ReceiveBuffer.Num(), BytesRead) || BytesRead == 0)
+            {
+                break;
+            }
+            Framer.Append(ReceiveBuffer.GetData(), BytesRead);
+        }
+
+        Socket->Close();
+        SocketSubsystem->DestroySocket(Socket);
+        return Result;
+    }
+
+    /** Run the clients to completion and sum up their results */
+    FClientResult RunClients(const FIPv4Endpoint& Endpoint, int32 NumClients, int32 NumCommands, const FCommandMix& Mix, int32& OutConnected, double& OutSeconds)
+    {
+        const double StartSeconds = FPlatformTime::Seconds();
+
+        TArray<TFuture<FClientResult>> Futures;
+        for (int32 ClientIndex = 0; ClientIndex < NumClients; ++ClientIndex)
+        {
+            // Spread the commands, the first clients take the remainder
+            const int32 ClientCommands = NumCommands / NumClients + (ClientIndex < NumCommands % NumClients ? 1 : 0);
+            Futures.Add(Async(EAsyncExecution::Thread, [Endpoint, ClientIndex, ClientCommands, Mix]()
+            {
+                return RunClient(Endpoint, ClientIndex, ClientCommands, Mix);
+            }));
+        }
+
+        FClientResult Total;
+        OutConnected = 0;
+        for (TFuture<FClientResult>& Future : Futures)
+        {
+            const FClientResult& Result = Future.Get();
+            OutConnected += Result.bConnected ? 1 : 0;
+            Total.Sent += Result.Sent;
+            Total.Received += Result.Received;
+            Total.Malformed += Result.Malformed;
+            Total.FastLatencyMs.Append(Result.FastLatencyMs);
+            Total.SlowLatencyMs.Append(Result.SlowLatencyMs);
+        }
+
+        OutSeconds = FPlatformTime::Seconds() - StartSeconds;
+        return Total;
+    }
+
+    void Run(const FIPv4Endpoint& Endpoint, int32 NumClients, int32 NumCommands)
+    {
+        int32 Connected = 0;
+        double Seconds = 0.0;
+        const FClientResult Total = RunClients(Endpoint, NumClients, NumCommands, FCommandMix(), Connected, Seconds);
+
+        UE_LOG(LogTemp, Warning, TEXT("=== MCP LOOPBACK BENCHMARK (%d clients, %d commands, pipeline depth %d) ==="), NumClients, NumCommands, PipelineDepth);
+        UE_LOG(LogTemp, Warning, TEXT("  Connected %d/%d, sent %d, received %d, malformed or mismatched %d"), Connected, NumClients, Total.Sent, Total.Received, Total.Malformed);
+        UE_LOG(LogTemp, Warning, TEXT("  %.2f s, %.0f commands/s"), Seconds, Seconds > 0.0 ? Total.Received / Seconds : 0.0);
+        UE_LOG(LogTemp, Warning, TEXT("  Latency p50 %.3f ms, p99 %.3f ms, max %.3f ms"),
+            Percentile(Total.FastLatencyMs, 0.5f), Percentile(Total.FastLatencyMs, 0.99f), Percentile(Total.FastLatencyMs, 1.0f));
+        UE_LOG(LogTemp, Warning, TEXT("  %s"), (Connected == NumClients && Total.Received == NumCommands && Total.Malformed == 0) ? TEXT("PASSED") : TEXT("FAILED"));
+    }
+
+    void RunDispatch(const FIPv4Endpoint& Endpoint, int32 NumClients, int32 NumCommands, const FCommandMix& Mix)
+    {
+        int32 Connected = 0;
+        double Seconds = 0.0;
+        const FClientResult Total = RunClients(Endpoint, NumClients, NumCommands, Mix, Connected, Seconds);
+
+        // A fast command that waited behind a slow one would take at least the slow command's time
+        const float FastP99 = Percentile(Total.FastLatencyMs, 0.99f);
+        const bool bBounded = FastP99 < Mix.SlowMs;
+
+        UE_LOG(LogTemp, Warning, TEXT("=== MCP DISPATCH BENCHMARK (%d clients, %d commands, 1 in %d sleeps %d ms on the game thread) ==="),
+            NumClients, NumCommands, Mix.SlowEvery, Mix.SlowMs);
+        UE_LOG(LogTemp, Warning, TEXT("  Connected %d/%d, sent %d, received %d, malformed or mismatched %d, %.2f s"),
+            Connected, NumClients, Total.Sent, Total.Received, Total.Malformed, Seconds);
+        UE_LOG(LogTemp, Warning, TEXT("  Fast (ping):        %d, p50 %.3f ms, p99 %.3f ms, max %.3f ms"), Total.FastLatencyMs.Num(),
+            Percentile(Total.FastLatencyMs, 0.5f), FastP99, Percentile(Total.FastLatencyMs, 1.0f));
+        UE_LOG(LogTemp, Warning, TEXT("  Slow (debug_sleep): %d, p50 %.3f ms, p99 %.3f ms, max %.3f ms"), Total.SlowLatencyMs.Num(),
+            Percentile(Total.SlowLatencyMs, 0.5f), Percentile(Total.SlowLatencyMs, 0.99f), Percentile(Total.SlowLatencyMs, 1.0f));
+        UE_LOG(LogTemp, Warning, TEXT("  Fast p99 %s the slow command time: %s"), bBounded ? TEXT("under") : TEXT("NOT under"),
+            (bBounded && Connected == NumClients && Total.Received == NumCommands && Total.Malformed == 0) ? TEXT("PASSED") : TEXT("FAILED"));
+
+        // debug_sleep goes back to being refused
+        AsyncTask(ENamedThreads::GameThread, []()
+        {
+            IConsoleManager::Get().FindConsoleVariable(TEXT("UnrealMCP.AllowDebugCommands"))->Set(0);
+        });
+    }
+
+    /** Highest process memory seen while it runs, sampled from its own thread */
+    class FPeakMemorySampler
+    {
+    public:
+        FPeakMemorySampler()
+            : Baseline(FPlatformMemory::GetStats().UsedPhysical)
+            , Peak(Baseline)
+        {
+            Sampler = Async(EAsyncExecution::Thread, [this]()
+            {
+                while (!bDone)
+                {
+                    Peak = FMath::Max(Peak.Load(), static_cast<uint64>(FPlatformMemory::GetStats().UsedPhysical));
+                    FPlatformProcess::Sleep(0.002f);
+                }
+            });
+        }
+
+        /** Growth over the starting point in MB */
+        double Finish()
+        {
+            bDone = true;
+            Sampler.Wait();
+            return (Peak.Load() - Baseline) / (1024.0 * 1024.0);
+        }
+
+    private:
+        const uint64 Baseline;
+        TAtomic<uint64> Peak;
+        FThreadSafeBool bDone;
+        TFuture<void> Sampler;
+    };
+
+    struct FQueryResult
+    {
+        bool bComplete = false;
+        int32 Messages = 0;
+        int32 Actors = 0;
+        int64 Bytes = 0;
+        double FirstByteMs = 0.0;
+        double FirstMessageMs = 0.0;
+        double TotalMs = 0.0;
+        double PeakMemoryMB = 0.0;
+    };
+
+    /** Send one get_actors_in_level and read its answer, in one message or as a stream of chunks */
+    FQueryResult RunQuery(const FIPv4Endpoint& Endpoint, const TSharedRef<FJsonObject>& Params)
+    {
+        FQueryResult Result;
+        ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+        FSocket* Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("MCPBenchQuery"), false);
+        if (!Socket || !Socket->Connect(*Endpoint.ToInternetAddr()))
+        {
+            if (Socket)
+            {
+                SocketSubsystem->DestroySocket(Socket);
+            }
+            return Result;
+        }
+
+        TSharedRef<FJsonObject> Message = MakeShared<FJsonObject>();
+        Message->SetNumberField(TEXT("id"), 1);
+        Message->SetStringField(TEXT("command"), TEXT("get_actors_in_level"));
+        Message->SetObjectField(TEXT("params"), Params);
+        FString Text;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Text);
+        FJsonSerializer::Serialize(Message, Writer);
+
+        // Plain JSON, a length prefix cannot carry the whole level in one message past 16MB
+        TArray<uint8> SendBytes;
+        FMCPMessageFramer::Frame(Text, EMCPFraming::Json, SendBytes);
+
+        // Large enough for the whole level in one message
+        FMCPMessageFramer Framer(1024 * 1024 * 1024);
+        TArray<uint8> ReceiveBuffer;
+        ReceiveBuffer.SetNumUninitialized(256 * 1024);
+
+        FPeakMemorySampler Memory;
+        const double StartSeconds = FPlatformTime::Seconds();
+        bool bDone = !SendAll(Socket, SendBytes.GetData(), SendBytes.Num());
+        while (!bDone)
+        {
+            FMCPMessage Response;
+            if (Framer.Next(Response))
+            {
+                if (Result.Messages++ == 0)
+                {
+                    Result.FirstMessageMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+                }
+
+                TSharedPtr<FJsonObject> Json;
+                TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Text);
+                const TSharedPtr<FJsonObject>* Page = nullptr;
+                if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid() || !Json->TryGetObjectField(TEXT("result"), Page))
+                {
+                    break;
+                }
+
+                // Unstreamed answers have no 'done', they are complete in one message
+                bool bLastChunk = true;
+                (*Page)->TryGetBoolField(TEXT("done"), bLastChunk);
+                Result.Actors += (*Page)->GetArrayField(TEXT("actors")).Num();
+                Result.bComplete = bDone = bLastChunk;
+                continue;
+            }
+
+            int32 BytesRead = 0;
+            if (!Socket->Wait(ESocketWaitConditions::WaitForRead, ResponseTimeout)
+                || !Socket->Recv(ReceiveBuffer.GetData(), ReceiveBuffer.Num(), BytesRead) || BytesRead == 0)
+            {
+                break;
+            }
+            if (Result.Bytes == 0)
+            {
+                Result.FirstByteMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+            }
+            Result.Bytes += BytesRead;
+            Framer.Append(ReceiveBuffer.GetData(), BytesRead);
+        }
+        Result.TotalMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+        Result.PeakMemoryMB = Memory.Finish();
+
+        Socket->Close();
+        SocketSubsystem->DestroySocket(Socket);
+        return Result;
+    }
+
+    void LogQuery(const TCHAR* Label, const FQueryResult& Result)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("  %-10s %d actors in %d messages, %.1f MB, first byte %.1f ms, first message %.1f ms, total %.1f ms, peak memory +%.1f MB"),
+            Label, Result.Actors, Result.Messages, Result.Bytes / (1024.0 * 1024.0), Result.FirstByteMs, Result.FirstMessageMs, Result.TotalMs, Result.PeakMemoryMB);
+    }
+
+    void RunQueries(const FIPv4Endpoint& Endpoint, int32 NumActors, int32 PageSize, TArray<TWeakObjectPtr<AActor>> StandIns)
+    {
+        // The whole level in one message, as get_actors_in_level always answered
+        const FQueryResult Whole = RunQuery(Endpoint, MakeShared<FJsonObject>());
+
+        TSharedRef<FJsonObject> StreamParams = MakeShared<FJsonObject>();
+        StreamParams->SetBoolField(TEXT("stream"), true);
+        StreamParams->SetNumberField(TEXT("limit"), PageSize);
+        const FQueryResult Streamed = RunQuery(Endpoint, StreamParams);
+
+        TSharedRef<FJsonObject> NameParams = MakeShared<FJsonObject>();
+        NameParams->SetBoolField(TEXT("stream"), true);
+        NameParams->SetNumberField(TEXT("limit"), PageSize);
+        NameParams->SetStringField(TEXT("fields"), TEXT("name"));
+        const FQueryResult Names = RunQuery(Endpoint, NameParams);
+
+        UE_LOG(LogTemp, Warning, TEXT("=== MCP QUERY BENCHMARK (%d stand-in actors, %d per chunk) ==="), NumActors, PageSize);
+        LogQuery(TEXT("Whole:"), Whole);
+        LogQuery(TEXT("Streamed:"), Streamed);
+        LogQuery(TEXT("Names:"), Names);
+        UE_LOG(LogTemp, Warning, TEXT("  %s"), (Whole.bComplete && Streamed.bComplete && Names.bComplete
+            && Whole.Actors == Streamed.Actors && Whole.Actors == Names.Actors && Whole.Actors >= NumActors) ? TEXT("PASSED") : TEXT("FAILED"));
+
+        AsyncTask(ENamedThreads::GameThread, [StandIns = MoveTemp(StandIns)]()
+        {
+            for (const TWeakObjectPtr<AActor>& Actor : StandIns)
+            {
+                if (Actor.IsValid())
+                {
+                    Actor->GetWorld()->DestroyActor(Actor.Get());
+                }
+            }
+        });
+    }
+
+    /** Send one command on its own connection and wait for the response, nullptr if none came */
+    TSharedPtr<FJsonObject> RunSingle(const FIPv4Endpoint& Endpoint, const FString& CommandType, const TSharedRef<FJsonObject>& Params)
+    {
+        ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+        FSocket* Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("MCPBenchSingle"), false);
+        if (!Socket || !Socket->Connect(*Endpoint.ToInternetAddr()))
+        {
+            if (Socket)
+            {
+                SocketSubsystem->DestroySocket(Socket);
+            }
+            return nullptr;
+        }
+
+        TSharedRef<FJsonObject> Message = MakeShared<FJsonObject>();
+        Message->SetNumberField(TEXT("id"), 1);
+        Message->SetStringField(TEXT("command"), CommandType);
+        Message->SetObjectField(TEXT("params"), Params);
+        FString Text;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Text);
+        FJsonSerializer::Serialize(Message, Writer);
+
+        TArray<uint8> SendBytes;
+        FMCPMessageFramer::Frame(Text, EMCPFraming::LengthPrefixed, SendBytes);
+
+        FMCPMessageFramer Framer;
+        TArray<uint8> ReceiveBuffer;
+        ReceiveBuffer.SetNumUninitialized(64 * 1024);
+
+        TSharedPtr<FJsonObject> Response;
+        FMCPMessage Received;
+        bool bFailed = !SendAll(Socket, SendBytes.GetData(), SendBytes.Num());
+        while (!bFailed && !Framer.Next(Received))
+        {
+            int32 BytesRead = 0;
+            bFailed = !Socket->Wait(ESocketWaitConditions::WaitForRead, ResponseTimeout)
+                || !Socket->Recv(ReceiveBuffer.GetData(), ReceiveBuffer.Num(), BytesRead) || BytesRead == 0;
+            Framer.Append(ReceiveBuffer.GetData(), BytesRead);
+        }
+        if (!bFailed)
+        {
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Received.Text);
+            FJsonSerializer::Deserialize(Reader, Response);
+        }
+
+        Socket->Close();
+        SocketSubsystem->DestroySocket(Socket);
+        return Response;
+    }
+
+    /** One command's histograms out of a server_stats response */
+    const FJsonObject* FindCommandStats(const TSharedPtr<FJsonObject>& Response, const TCHAR* CommandType)
+    {
+        const TSharedPtr<FJsonObject>* Result = nullptr;
+        const TSharedPtr<FJsonObject>* Commands = nullptr;
+        const TSharedPtr<FJsonObject>* Stats = nullptr;
+        return Response.IsValid() && Response->TryGetObjectField(TEXT("result"), Result) && (*Result)->TryGetObjectField(TEXT("commands"), Commands)
+            && (*Commands)->TryGetObjectField(CommandType, Stats) ? Stats->Get() : nullptr;
+    }
+
+    double GetStat(const FJsonObject* CommandStats, const TCHAR* Histogram, const TCHAR* Field)
+    {
+        const TSharedPtr<FJsonObject>* Values = nullptr;
+        return CommandStats && CommandStats->TryGetObjectField(Histogram, Values) ? (*Values)->GetNumberField(Field) : -1.0;
+    }
+
+    void RunStats(const FIPv4Endpoint& Endpoint, int32 NumClients, int32 NumCommands, const FCommandMix& Mix)
+    {
+        TSharedRef<FJsonObject> ResetParams = MakeShared<FJsonObject>();
+        ResetParams->SetBoolField(TEXT("reset"), true);
+        const bool bReset = RunSingle(Endpoint, TEXT("server_stats"), ResetParams).IsValid();
+
+        int32 Connected = 0;
+        double Seconds = 0.0;
+        const FClientResult Total = RunClients(Endpoint, NumClients, NumCommands, Mix, Connected, Seconds);
+        const TSharedPtr<FJsonObject> Stats = RunSingle(Endpoint, TEXT("server_stats"), MakeShared<FJsonObject>());
+
+        const FJsonObject* Sleep = FindCommandStats(Stats, TEXT("debug_sleep"));
+        const FJsonObject* Ping = FindCommandStats(Stats, TEXT("ping"));
+        const double SleepCount = Sleep ? Sleep->GetNumberField(TEXT("count")) : -1.0;
+        const double PingCount = Ping ? Ping->GetNumberField(TEXT("count")) : -1.0;
+        const double ExecuteP50 = GetStat(Sleep, TEXT("execute_ms"), TEXT("p50"));
+        const double ExecuteP99 = GetStat(Sleep, TEXT("execute_ms"), TEXT("p99"));
+        const double QueueP50 = GetStat(Sleep, TEXT("queue_wait_ms"), TEXT("p50"));
+        const double SerializeCount = GetStat(Sleep, TEXT("serialize_ms"), TEXT("count"));
+        const float ClientP50 = Percentile(Total.SlowLatencyMs, 0.5f);
+
+        // The sleep itself, give or take the histogram's precision and the scheduler overshooting it
+        const bool bExecuteMatches = ExecuteP50 >= Mix.SlowMs * 0.97 && ExecuteP99 <= Mix.SlowMs * 1.25 + 5.0;
+
+        // Time on the server cannot be more than the client waited for the answer
+        const bool bWithinRoundTrip = QueueP50 >= 0.0 && QueueP50 + ExecuteP50 <= ClientP50 * 1.05 + 1.0;
+
+        // Every command counted, pings answered without the game thread have no execution samples
+        const bool bCounted = SleepCount == Total.SlowLatencyMs.Num() && PingCount == Total.FastLatencyMs.Num()
+            && SerializeCount == SleepCount && GetStat(Ping, TEXT("execute_ms"), TEXT("count")) == 0.0;
+
+        UE_LOG(LogTemp, Warning, TEXT("=== MCP STATS TEST (%d clients, %d commands, 1 in %d sleeps %d ms on the game thread) ==="),
+            NumClients, NumCommands, Mix.SlowEvery, Mix.SlowMs);
+        UE_LOG(LogTemp, Warning, TEXT("  Connected %d/%d, received %d, malformed or mismatched %d, %.2f s"),
+            Connected, NumClients, Total.Received, Total.Malformed, Seconds);
+        UE_LOG(LogTemp, Warning, TEXT("  debug_sleep: counted %.0f of %d, execute p50 %.2f ms p99 %.2f ms, queue wait p50 %.2f ms, client p50 %.2f ms"),
+            SleepCount, Total.SlowLatencyMs.Num(), ExecuteP50, ExecuteP99, QueueP50, ClientP50);
+        UE_LOG(LogTemp, Warning, TEXT("  ping: counted %.0f of %d"), PingCount, Total.FastLatencyMs.Num());
+        UE_LOG(LogTemp, Warning, TEXT("  Execution %s the injected delay, server time %s the round trip, counts %s"),
+            bExecuteMatches ? TEXT("matches") : TEXT("DOES NOT match"), bWithinRoundTrip ? TEXT("within") : TEXT("NOT within"),
+            bCounted ? TEXT("agree") : TEXT("DISAGREE"));
+        UE_LOG(LogTemp, Warning, TEXT("  %s"), (bReset && bExecuteMatches && bWithinRoundTrip && bCounted && Connected == NumClients
+            && Total.Received == NumCommands && Total.Malformed == 0) ? TEXT("PASSED") : TEXT("FAILED"));
+
+        AsyncTask(ENamedThreads::GameThread, []()
+        {
+            IConsoleManager::Get().FindConsoleVariable(TEXT("UnrealMCP.AllowDebugCommands"))->Set(0);
+        });
+    }
+
+    UEpicUnrealMCPBridge* GetRunningBridge(const TCHAR* CommandName)
+    {
+        UEpicUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UEpicUnrealMCPBridge>() : nullptr;
+        if (!Bridge || !Bridge->IsRunning())
+        {
+            UE_LOG(LogTemp, Error, TEXT("%s needs the MCP server running"), CommandName);
+            return nullptr;
+        }
+        return Bridge;
+    }
+
+    void RunCommand(const TArray<FString>& Args)
+    {
+        UEpicUnrealMCPBridge* Bridge = GetRunningBridge(TEXT("UnrealMCP.Bench.Loopback"));
+        if (!Bridge)
+        {
+            return;
+        }
+
+        const int32 NumClients = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 32) : 16;
+        const int32 NumCommands = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 10000;
+        const FIPv4Endpoint Endpoint(FIPv4Address(127, 0, 0, 1), Bridge->GetPort());
+
+        // Off the game thread, which has to stay free to run the commands
+        Async(EAsyncExecution::Thread, [Endpoint, NumClients, NumCommands]()
+        {
+            Run(Endpoint, NumClients, NumCommands);
+        });
+    }
+
+    void RunDispatchCommand(const TArray<FString>& Args)
+    {
+        UEpicUnrealMCPBridge* Bridge = GetRunningBridge(TEXT("UnrealMCP.Bench.Dispatch"));
+        if (!Bridge)
+        {
+            return;
+        }
+
+        const int32 NumClients = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 32) : 8;
+        const int32 NumCommands = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 2000;
+        FCommandMix Mix;
+        Mix.SlowEvery = Args.Num() > 2 ? FMath::Max(FCString::Atoi(*Args[2]), 1) : 10;
+        Mix.SlowMs = Args.Num() > 3 ? FMath::Clamp(FCString::Atoi(*Args[3]), 1, 1000) : 50;
+        const FIPv4Endpoint Endpoint(FIPv4Address(127, 0, 0, 1), Bridge->GetPort());
+
+        IConsoleManager::Get().FindConsoleVariable(TEXT("UnrealMCP.AllowDebugCommands"))->Set(1);
+        Async(EAsyncExecution::Thread, [Endpoint, NumClients, NumCommands, Mix]()
+        {
+            RunDispatch(Endpoint, NumClients, NumCommands, Mix);
+        });
+    }
+
+    void RunStatsCommand(const TArray<FString>& Args)
+    {
+        UEpicUnrealMCPBridge* Bridge = GetRunningBridge(TEXT("UnrealMCP.Bench.Stats"));
+        if (!Bridge)
+        {
+            return;
+        }
+
+        const int32 NumClients = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 32) : 4;
+        const int32 NumCommands = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 400;
+        FCommandMix Mix;
+        Mix.SlowEvery = Args.Num() > 2 ? FMath::Max(FCString::Atoi(*Args[2]), 1) : 4;
+        Mix.SlowMs = Args.Num() > 3 ? FMath::Clamp(FCString::Atoi(*Args[3]), 1, 1000) : 20;
+        const FIPv4Endpoint Endpoint(FIPv4Address(127, 0, 0, 1), Bridge->GetPort());
+
+        IConsoleManager::Get().FindConsoleVariable(TEXT("UnrealMCP.AllowDebugCommands"))->Set(1);
+        Async(EAsyncExecution::Thread, [Endpoint, NumClients, NumCommands, Mix]()
+        {
+            RunStats(Endpoint, NumClients, NumCommands, Mix);
+        });
+    }
+
+    void RunQueryCommand(const TArray<FString>& Args)
+    {
+        UEpicUnrealMCPBridge* Bridge = GetRunningBridge(TEXT("UnrealMCP.Bench.Query"));
+        UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+        if (!Bridge || !World)
+        {
+            return;
+        }
+
+        const int32 NumActors = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+        const int32 PageSize = Args.Num() > 1 ? FMath::Clamp(FCString::Atoi(*Args[1]), 1, 10000) : 1000;
+        const FIPv4Endpoint Endpoint(FIPv4Address(127, 0, 0, 1), Bridge->GetPort());
+
+        // Transient, so they are never saved with the level, and destroyed again afterwards
+        TArray<TWeakObjectPtr<AActor>> StandIns;
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags |= RF_Transient;
+        SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+        for (int32 Index = 0; Index < NumActors; ++Index)
+        {
+            SpawnParams.Name = FName(TEXT("MCPBenchQuery"), Index + 1);
+            StandIns.Add(World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(FVector(Index, 0.0, 0.0)), SpawnParams));
+        }
+
+        Async(EAsyncExecution::Thread, [Endpoint, NumActors, PageSize, StandIns = MoveTemp(StandIns)]() mutable
+        {
+            RunQueries(Endpoint, NumActors, PageSize, MoveTemp(StandIns));
+        });
+    }
+}
+
+static FAutoConsoleCommand MCPLoopbackBenchCommand(
+    TEXT("UnrealMCP.Bench.Loopback"),
+    TEXT("Connect clients to the MCP server over loopback and pipeline ping commands with mixed framing and sizes. Usage: UnrealMCP.Bench.Loopback (Clients=16) (Commands=10000)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MCPLoopbackBench::RunCommand)
+);
+
+static FAutoConsoleCommand MCPQueryBenchCommand(
+    TEXT("UnrealMCP.Bench.Query"),
+    TEXT("Fill the editor level with stand-in actors and read them back whole and as streamed chunks. Usage: UnrealMCP.Bench.Query (Actors=100000) (PageSize=1000)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MCPLoopbackBench::RunQueryCommand)
+);
+
+static FAutoConsoleCommand MCPDispatchBenchCommand(
+    TEXT("UnrealMCP.Bench.Dispatch"),
+    TEXT("Mix slow game thread commands into pipelined pings and check the pings are not held up by them. Usage: UnrealMCP.Bench.Dispatch (Clients=8) (Commands=2000) (SlowEvery=10) (SlowMs=50)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MCPLoopbackBench::RunDispatchCommand)
+);
+
+static FAutoConsoleCommand MCPStatsBenchCommand(
+    TEXT("UnrealMCP.Bench.Stats"),
+    TEXT("Reset the server stats, run pings mixed with debug_sleep over loopback, and check server_stats reports the injected delays. Usage: UnrealMCP.Bench.Stats (Clients=4) (Commands=400) (SlowEvery=4) (SlowMs=20)"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&MCPLoopbackBench::RunStatsCommand)
+);
@@ -0,0 +1,203 @@
+#include "MCPMessageFramer.h"
+#include "MCPBinaryCodec.h"
+
+namespace
+{
+    constexpr int32 LengthPrefixBytes = 4;
+
+    bool IsJsonWhitespace(uint8 Byte)
+    {
+        return Byte == ' ' || Byte == '\t' || Byte == '\r' || Byte == '\n';
+    }
+
+    void WriteLengthPrefix(int32 Length, TArray<uint8>& OutBytes)
+    {
+        checkf(Length <= FMCPMessageFramer::MaxPrefixedPayloadBytes, TEXT("A %d byte payload would be read back as JSON"), Length);
+        OutBytes.Add(uint8(Length >> 24));
+        OutBytes.Add(uint8(Length >> 16));
+        OutBytes.Add(uint8(Length >> 8));
+        OutBytes.Add(uint8(Length));
+    }
+}
+
+FMCPMessageFramer::FMCPMessageFramer(int32 InMaxMessageBytes)
+    : MaxMessageBytes(InMaxMessageBytes)
+{
+}
+
+void FMCPMessageFramer::Append(const uint8* Data, int32 NumBytes)
+{
+    // Drop handed out messages before growing, so a long lived connection keeps one buffer
+    if (ReadOffset > 0 && ReadOffset >= Buffer.Num() / 2)
+    {
+        const int32 Shift = ReadOffset;
+        Buffer.RemoveAt(0, Shift, EAllowShrinking::No);
+        ReadOffset -= Shift;
+        ScanOffset -= Shift;
+    }
+
+    Buffer.Append(Data, NumBytes);
+}
+
+bool FMCPMessageFramer::Next(FMCPMessage& OutMessage)
+{
+    if (bError)
+    {
+        return false;
+    }
+
+    // Whitespace between messages, including the newline after a JSON document
+    if (ScanOffset == ReadOffset)
+    {
+        while (ReadOffset < Buffer.Num() && IsJsonWhitespace(Buffer[ReadOffset]))
+        {
+            ++ReadOffset;
+        }
+        ScanOffset = ReadOffset;
+    }
+
+    if (ReadOffset >= Buffer.Num())
+    {
+        return false;
+    }
+
+    const uint8 First = Buffer[ReadOffset];
+
+    if (First == 0)
+    {
+        if (GetBufferedBytes() < LengthPrefixBytes)
+        {
+            return false;
+        }
+
+        const uint32 Length = (uint32(Buffer[ReadOffset]) << 24) | (uint32(Buffer[ReadOffset + 1]) << 16)
+            | (uint32(Buffer[ReadOffset + 2]) << 8) | uint32(Buffer[ReadOffset + 3]);
+        if (Length > uint32(MaxMessageBytes))
+        {
+            bError = true;
+            return false;
+        }
+
+        if (GetBufferedBytes() < LengthPrefixBytes + int32(Length))
+        {
+            return false;
+        }
+
+        const bool bBinary = Length > 0 && FMCPBinaryCodec::IsMapMarker(Buffer[ReadOffset + LengthPrefixBytes]);
+        Consume(ReadOffset + LengthPrefixBytes + int32(Length), bBinary ? EMCPFraming::MessagePack : EMCPFraming::LengthPrefixed,
+            LengthPrefixBytes, OutMessage);
+        return true;
+    }
+
+    if (First != '{' && First != '[')
+    {
+        // Not JSON, hand the line out so it gets a parse error back
+        for (; ScanOffset < Buffer.Num(); ++ScanOffset)
+        {
+            if (Buffer[ScanOffset] == '\n')
+            {
+                Consume(ScanOffset, EMCPFraming::Json, 0, OutMessage);
+                return true;
+            }
+        }
+
+        if (ScanOffset - ReadOffset > MaxMessageBytes)
+        {
+            bError = true;
+        }
+        return false;
+    }
+
+    for (; ScanOffset < Buffer.Num(); ++ScanOffset)
+    {
+        const uint8 Byte = Buffer[ScanOffset];
+        if (bInString)
+        {
+            if (bEscaped)
+            {
+                bEscaped = false;
+            }
+            else if (Byte == '\\')
+            {
+                bEscaped = true;
+            }
+            else if (Byte == '"')
+            {
+                bInString = false;
+            }
+            continue;
+        }
+
+        if (Byte == '"')
+        {
+            bInString = true;
+        }
+        else if (Byte == '{' || Byte == '[')
+        {
+            ++Depth;
+        }
+        else if ((Byte == '}' || Byte == ']') && --Depth == 0)
+        {
+            Consume(ScanOffset + 1, EMCPFraming::Json, 0, OutMessage);
+            return true;
+        }
+    }
+
+    if (ScanOffset - ReadOffset > MaxMessageBytes)
+    {
+        bError = true;
+    }
+    return false;
+}
+
+void FMCPMessageFramer::Frame(const FString& Text, EMCPFraming Framing, TArray<uint8>& OutBytes)
+{
+    FTCHARToUTF8 Utf8(*Text);
+    const int32 Length = Utf8.Length();
+
+    if (Framing != EMCPFraming::Json)
+    {
+        WriteLengthPrefix(Length, OutBytes);
+        OutBytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Length);
+    }
+    else
+    {
+        OutBytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Length);
+        OutBytes.Add('\n');
+    }
+}
+
+void FMCPMessageFramer::FrameBinary(const TArray<uint8>& Payload, TArray<uint8>& OutBytes)
+{
+    WriteLengthPrefix(Payload.Num(), OutBytes);
+    OutBytes.Append(Payload);
+}
+
+void FMCPMessageFramer::Consume(int32 EndOffset, EMCPFraming Framing, int32 HeaderBytes, FMCPMessage& OutMessage)
+{
+    const int32 Start = ReadOffset + HeaderBytes;
+    if (Framing == EMCPFraming::MessagePack)
+    {
+        OutMessage.Text.Reset();
+        OutMessage.Bytes.Reset();
+        OutMessage.Bytes.Append(Buffer.GetData() + Start, EndOffset - Start);
+    }
+    else
+    {
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Buffer.GetData() + Start), EndOffset - Start);
+        OutMessage.Text = FString(Converted.Length(), Converted.Get());
+        OutMessage.Bytes.Reset();
+    }
+    OutMessage.Framing = Framing;
+
+    ReadOffset = EndOffset;
+    ResetScan();
+}
+
+void FMCPMessageFramer::ResetScan()
+{
+    ScanOffset = ReadOffset;
+    Depth = 0;
+    bInString = false;
+    bEscaped = false;
+}
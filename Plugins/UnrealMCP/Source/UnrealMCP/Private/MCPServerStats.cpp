@@ -0,0 +1,254 @@
+#include "MCPServerStats.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+DEFINE_LOG_CATEGORY(LogMCPServer);
+
+static TAutoConsoleVariable<int32> CVarMCPLogSampleEvery(
+    TEXT("UnrealMCP.LogSampleEvery"),
+    10,
+    TEXT("Per message MCP traces log one message in this many. 1 logs every message."),
+    ECVF_Default
+);
+
+static TAutoConsoleVariable<int32> CVarMCPLogMaxPerSecond(
+    TEXT("UnrealMCP.LogMaxPerSecond"),
+    20,
+    TEXT("Most lines a second any one per message MCP log statement writes. 0 for no limit."),
+    ECVF_Default
+);
+
+void FMCPLatencyHistogram::Record(double Seconds)
+{
+    const uint64 Micros = FMath::Min(uint64(FMath::Max(Seconds, 0.0) * 1000000.0 + 0.5), (uint64(1) << MaxValueBits) - 1);
+    ++Counts[GetBucket(Micros)];
+    ++Count;
+    TotalMicros += Micros;
+    MaxMicros = FMath::Max(MaxMicros, Micros);
+}
+
+void FMCPLatencyHistogram::Reset()
+{
+    FMemory::Memzero(Counts);
+    Count = 0;
+    TotalMicros = 0;
+    MaxMicros = 0;
+}
+
+double FMCPLatencyHistogram::GetPercentileMs(double Percentile) const
+{
+    if (Count == 0)
+    {
+        return 0.0;
+    }
+
+    const int64 Rank = FMath::Max<int64>(FMath::CeilToInt64(FMath::Clamp(Percentile, 0.0, 100.0) / 100.0 * Count), 1);
+    int64 Seen = 0;
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        Seen += Counts[Bucket];
+        if (Seen >= Rank)
+        {
+            return FMath::Min(GetBucketMidpoint(Bucket), MaxMicros) / 1000.0;
+        }
+    }
+    return GetMaxMs();
+}
+
+TSharedRef<FJsonObject> FMCPLatencyHistogram::ToJson() const
+{
+    TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+    Json->SetNumberField(TEXT("count"), Count);
+    Json->SetNumberField(TEXT("mean"), GetMeanMs());
+    Json->SetNumberField(TEXT("p50"), GetPercentileMs(50.0));
+    Json->SetNumberField(TEXT("p90"), GetPercentileMs(90.0));
+    Json->SetNumberField(TEXT("p99"), GetPercentileMs(99.0));
+    Json->SetNumberField(TEXT("p999"), GetPercentileMs(99.9));
+    Json->SetNumberField(TEXT("max"), GetMaxMs());
+    return Json;
+}
+
+int32 FMCPLatencyHistogram::GetBucket(uint64 Micros)
+{
+    if (Micros < SubBucketCount)
+    {
+        return int32(Micros);
+    }
+
+    // The top SubBucketBits bits of the value pick the sub-bucket within its power of two
+    const int32 Shift = int32(FMath::FloorLog2_64(Micros)) - (SubBucketBits - 1);
+    return SubBucketCount + (Shift - 1) * SubBucketHalf + int32(Micros >> Shift) - SubBucketHalf;
+}
+
+uint64 FMCPLatencyHistogram::GetBucketMidpoint(int32 Bucket)
+{
+    if (Bucket < SubBucketCount)
+    {
+        return Bucket;
+    }
+
+    const int32 Index = Bucket - SubBucketCount;
+    const int32 Shift = Index / SubBucketHalf + 1;
+    const uint64 Lower = uint64(Index % SubBucketHalf + SubBucketHalf) << Shift;
+    return Lower + (uint64(1) << Shift) / 2;
+}
+
+FMCPServerStats::FMCPServerStats()
+    : StartSeconds(FPlatformTime::Seconds())
+{
+}
+
+FMCPServerStats& FMCPServerStats::Get()
+{
+    static FMCPServerStats Stats;
+    return Stats;
+}
+
+FMCPServerStats::FCommandStats& FMCPServerStats::FindOrAdd(const FString& CommandType)
+{
+    TUniquePtr<FCommandStats>& Stats = Commands.FindOrAdd(CommandType);
+    if (!Stats)
+    {
+        Stats = MakeUnique<FCommandStats>();
+    }
+    return *Stats;
+}
+
+void FMCPServerStats::RecordQueueWait(const FString& CommandType, double Seconds)
+{
+    FScopeLock ScopeLock(&Lock);
+    FCommandStats& Stats = FindOrAdd(CommandType);
+    Stats.QueueWait.Record(Seconds);
+    Total.QueueWait.Record(Seconds);
+}
+
+void FMCPServerStats::RecordExecute(const FString& CommandType, double Seconds)
+{
+    FScopeLock ScopeLock(&Lock);
+    FCommandStats& Stats = FindOrAdd(CommandType);
+    Stats.Execute.Record(Seconds);
+    Total.Execute.Record(Seconds);
+}
+
+void FMCPServerStats::RecordSerialize(const FString& CommandType, double Seconds)
+{
+    FScopeLock ScopeLock(&Lock);
+    FCommandStats& Stats = FindOrAdd(CommandType);
+    Stats.Serialize.Record(Seconds);
+    Total.Serialize.Record(Seconds);
+}
+
+void FMCPServerStats::RecordCompleted(const FString& CommandType, bool bSucceeded)
+{
+    FScopeLock ScopeLock(&Lock);
+    FCommandStats& Stats = FindOrAdd(CommandType);
+    ++Stats.Count;
+    ++Total.Count;
+    Stats.Errors += bSucceeded ? 0 : 1;
+    Total.Errors += bSucceeded ? 0 : 1;
+}
+
+void FMCPServerStats::Reset()
+{
+    FScopeLock ScopeLock(&Lock);
+    Commands.Reset();
+    Total = FCommandStats();
+    StartSeconds = FPlatformTime::Seconds();
+}
+
+TSharedRef<FJsonObject> FMCPServerStats::StatsToJson(const FCommandStats& Stats)
+{
+    TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+    Json->SetNumberField(TEXT("count"), Stats.Count);
+    Json->SetNumberField(TEXT("errors"), Stats.Errors);
+    Json->SetObjectField(TEXT("queue_wait_ms"), Stats.QueueWait.ToJson());
+    Json->SetObjectField(TEXT("execute_ms"), Stats.Execute.ToJson());
+    Json->SetObjectField(TEXT("serialize_ms"), Stats.Serialize.ToJson());
+    return Json;
+}
+
+TSharedRef<FJsonObject> FMCPServerStats::ToJson() const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    TSharedPtr<FJsonObject> CommandsJson = MakeShared<FJsonObject>();
+    for (const TPair<FString, TUniquePtr<FCommandStats>>& Command : Commands)
+    {
+        CommandsJson->SetObjectField(Command.Key, StatsToJson(*Command.Value));
+    }
+
+    TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+    Json->SetNumberField(TEXT("seconds"), FPlatformTime::Seconds() - StartSeconds);
+    Json->SetObjectField(TEXT("total"), StatsToJson(Total));
+    Json->SetObjectField(TEXT("commands"), CommandsJson);
+    return Json;
+}
+
+void FMCPServerStats::LogSummary() const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    TArray<TPair<FString, const FCommandStats*>> Sorted;
+    for (const TPair<FString, TUniquePtr<FCommandStats>>& Command : Commands)
+    {
+        Sorted.Emplace(Command.Key, Command.Value.Get());
+    }
+    Sorted.Sort([](const TPair<FString, const FCommandStats*>& A, const TPair<FString, const FCommandStats*>& B)
+    {
+        return A.Value->Execute.GetPercentileMs(99.0) > B.Value->Execute.GetPercentileMs(99.0);
+    });
+
+    UE_LOG(LogMCPServer, Display, TEXT("=== MCP SERVER STATS (%d commands, %d errors) ==="), int32(Total.Count), int32(Total.Errors));
+    UE_LOG(LogMCPServer, Display, TEXT("  %-28s %8s %6s | %-17s | %-26s | %-17s"), TEXT("Command"), TEXT("Count"), TEXT("Errors"),
+        TEXT("Queue p50/p99 ms"), TEXT("Execute p50/p99/max ms"), TEXT("Serialize p50/p99"));
+    for (const TPair<FString, const FCommandStats*>& Command : Sorted)
+    {
+        const FCommandStats& Stats = *Command.Value;
+        UE_LOG(LogMCPServer, Display, TEXT("  %-28s %8lld %6lld | %8.2f %8.2f | %8.2f %8.2f %8.2f | %8.3f %8.3f"),
+            *Command.Key, Stats.Count, Stats.Errors,
+            Stats.QueueWait.GetPercentileMs(50.0), Stats.QueueWait.GetPercentileMs(99.0),
+            Stats.Execute.GetPercentileMs(50.0), Stats.Execute.GetPercentileMs(99.0), Stats.Execute.GetMaxMs(),
+            Stats.Serialize.GetPercentileMs(50.0), Stats.Serialize.GetPercentileMs(99.0));
+    }
+}
+
+bool FMCPLogSampler::ShouldLog(bool bSample)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    if (bSample && NumCalls++ % uint64(FMath::Max(CVarMCPLogSampleEvery.GetValueOnAnyThread(), 1)) != 0)
+    {
+        return false;
+    }
+
+    const int32 MaxPerSecond = CVarMCPLogMaxPerSecond.GetValueOnAnyThread();
+    if (MaxPerSecond <= 0)
+    {
+        return true;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if (Now - WindowStart >= 1.0)
+    {
+        WindowStart = Now;
+        NumInWindow = 0;
+    }
+    return ++NumInWindow <= MaxPerSecond;
+}
+
+static FAutoConsoleCommand MCPStatsCommand(
+    TEXT("UnrealMCP.Stats"),
+    TEXT("Log per command MCP counts and queue, execution and serialization latency. Usage: UnrealMCP.Stats (reset)"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        FMCPServerStats::Get().LogSummary();
+        if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+        {
+            FMCPServerStats::Get().Reset();
+            UE_LOG(LogMCPServer, Display, TEXT("  Reset"));
+        }
+    })
+);
@@ -0,0 +1,190 @@
+#include "Misc/AutomationTest.h"
+#include "MCPActorIndex.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Kismet/GameplayStatics.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 TestNumActors = 2000;
+    constexpr int32 TestActorsPerFolder = 100;
+
+    FName MakeActorName(int32 ActorIndex)
+    {
+        return FName(TEXT("MCPTestActor"), ActorIndex + 1);
+    }
+
+    /** Every actor of the world the key matches, the way the editor commands scanned before the index */
+    TSet<AActor*> Scan(UWorld* World, EMCPActorKey Key, EMCPActorMatch Match, const FString& Pattern)
+    {
+        TArray<AActor*> AllActors;
+        UGameplayStatics::GetAllActorsOfClass(World, AActor::StaticClass(), AllActors);
+        TSet<AActor*> Found;
+        for (AActor* Actor : AllActors)
+        {
+            if (FMCPActorIndex::Matches(Actor, Key, Match, Pattern))
+            {
+                Found.Add(Actor);
+            }
+        }
+        return Found;
+    }
+
+    /** Throwaway editor world of bare stand-in actors, spawned after the index is bound so it is built from events */
+    struct FTestIndexWorld
+    {
+        UWorld* World = nullptr;
+        FMCPActorIndex Index;
+        TArray<AActor*> Actors;
+
+        FTestIndexWorld()
+        {
+            World = UWorld::CreateWorld(EWorldType::Editor, false, TEXT("MCPActorIndexTest"));
+            Index.Bind(World);
+            Index.Num();
+
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.ObjectFlags |= RF_Transient;
+            for (int32 ActorIndex = 0; ActorIndex < TestNumActors; ++ActorIndex)
+            {
+                SpawnParams.Name = MakeActorName(ActorIndex);
+                AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+                if (Actor && ActorIndex % TestActorsPerFolder == 0)
+                {
+                    Actor->SetFolderPath(*FString::Printf(TEXT("Test/Group_%d"), ActorIndex / TestActorsPerFolder));
+                }
+                Actors.Add(Actor);
+            }
+        }
+
+        ~FTestIndexWorld()
+        {
+            Index.Unbind();
+            World->DestroyWorld(false);
+            World->MarkAsGarbage();
+        }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPActorIndexMatchesScanTest, "UnrealMCP.ActorIndex.MatchesScan",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPActorIndexMatchesScanTest::RunTest(const FString& Parameters)
+{
+    FTestIndexWorld Test;
+    if (!TestFalse(TEXT("Stand-ins spawned"), Test.Actors.Contains(nullptr))) return false;
+
+    TArray<AActor*> AllActors;
+    UGameplayStatics::GetAllActorsOfClass(Test.World, AActor::StaticClass(), AllActors);
+    TestEqual(TEXT("Index holds every actor"), Test.Index.Num(), AllActors.Num());
+
+    // Every name, and one that is not there
+    int32 NameMismatches = 0;
+    for (AActor* Actor : AllActors)
+    {
+        NameMismatches += Test.Index.FindByName(Actor->GetName()) == Actor ? 0 : 1;
+    }
+    TestEqual(TEXT("Lookups by name that disagree with the scan"), NameMismatches, 0);
+    TestNull(TEXT("Unknown name"), Test.Index.FindByName(TEXT("MCPTestActor_NotThere")));
+
+    struct FQueryCase
+    {
+        EMCPActorKey Key;
+        EMCPActorMatch Match;
+        const TCHAR* Pattern;
+    };
+    const FQueryCase Cases[] = {
+        { EMCPActorKey::Name, EMCPActorMatch::Exact, TEXT("mcptestactor_42") },
+        { EMCPActorKey::Name, EMCPActorMatch::Prefix, TEXT("MCPTestActor_12") },
+        { EMCPActorKey::Name, EMCPActorMatch::Glob, TEXT("MCPTestActor_4?7*") },
+        { EMCPActorKey::Name, EMCPActorMatch::Glob, TEXT("*99") },
+        { EMCPActorKey::Name, EMCPActorMatch::Contains, TEXT("999") },
+        { EMCPActorKey::Label, EMCPActorMatch::Prefix, TEXT("MCPTestActor") },
+        { EMCPActorKey::Folder, EMCPActorMatch::Exact, TEXT("Test/Group_7") },
+        { EMCPActorKey::Folder, EMCPActorMatch::Prefix, TEXT("Test/") },
+        { EMCPActorKey::Class, EMCPActorMatch::Exact, TEXT("Actor") },
+    };
+    for (const FQueryCase& Case : Cases)
+    {
+        TArray<AActor*> Found;
+        Test.Index.Query(Case.Key, Case.Match, Case.Pattern, Found);
+        const TSet<AActor*> Expected = Scan(Test.World, Case.Key, Case.Match, Case.Pattern);
+        TestTrue(FString::Printf(TEXT("Query '%s' key %d match %d finds what the scan does"), Case.Pattern, static_cast<int32>(Case.Key), static_cast<int32>(Case.Match)),
+            Found.Num() == Expected.Num() && TSet<AActor*>(Found).Includes(Expected));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPActorIndexFollowsEditsTest, "UnrealMCP.ActorIndex.FollowsEdits",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPActorIndexFollowsEditsTest::RunTest(const FString& Parameters)
+{
+    FTestIndexWorld Test;
+    if (!TestFalse(TEXT("Stand-ins spawned"), Test.Actors.Contains(nullptr))) return false;
+    const int32 NumBefore = Test.Index.Num();
+
+    AActor* Relabelled = Test.Actors[0];
+    Relabelled->SetActorLabel(TEXT("MCPTestRelabelled"));
+    TArray<AActor*> Labelled;
+    Test.Index.Query(EMCPActorKey::Label, EMCPActorMatch::Exact, TEXT("MCPTestRelabelled"), Labelled);
+    TestTrue(TEXT("New label found"), Labelled.Num() == 1 && Labelled[0] == Relabelled);
+
+    AActor* Moved = Test.Actors[1];
+    Moved->SetFolderPath(TEXT("Test/Moved"));
+    TArray<AActor*> InFolder;
+    Test.Index.Query(EMCPActorKey::Folder, EMCPActorMatch::Exact, TEXT("Test/Moved"), InFolder);
+    TestTrue(TEXT("New folder found"), InFolder.Num() == 1 && InFolder[0] == Moved);
+
+    const FString DeletedName = Test.Actors[2]->GetName();
+    Test.World->DestroyActor(Test.Actors[2]);
+    TestNull(TEXT("Deleted actor gone"), Test.Index.FindByName(DeletedName));
+    TestEqual(TEXT("One fewer actor"), Test.Index.Num(), NumBefore - 1);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPActorIndexPagesTest, "UnrealMCP.ActorIndex.PagesCoverEveryActorOnce",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPActorIndexPagesTest::RunTest(const FString& Parameters)
+{
+    FTestIndexWorld Test;
+    if (!TestFalse(TEXT("Stand-ins spawned"), Test.Actors.Contains(nullptr))) return false;
+
+    // Page through with a deletion in the middle, the name cursor has to survive it
+    TSet<AActor*> Seen;
+    TArray<FString> Names;
+    FString After;
+    bool bMore = true;
+    for (int32 Page = 0; bMore && Page < TestNumActors; ++Page)
+    {
+        TArray<AActor*> Actors;
+        bMore = Test.Index.GetPage(After, 64, Actors);
+        for (AActor* Actor : Actors)
+        {
+            TestFalse(TEXT("Actor seen once"), Seen.Contains(Actor));
+            Seen.Add(Actor);
+            Names.Add(Actor->GetName());
+        }
+        if (Actors.Num() > 0)
+        {
+            After = Actors.Last()->GetName();
+        }
+        if (Page == 3)
+        {
+            Test.World->DestroyActor(Test.Actors.Last());
+        }
+    }
+
+    TArray<FString> Sorted = Names;
+    Sorted.Sort();
+    TestTrue(TEXT("Pages in name order"), Sorted == Names);
+    TestEqual(TEXT("Every remaining actor paged"), Seen.Num(), Test.Index.Num());
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
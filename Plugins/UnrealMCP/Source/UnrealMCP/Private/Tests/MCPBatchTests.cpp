@@ -0,0 +1,274 @@
+#include "Misc/AutomationTest.h"
+#include "EpicUnrealMCPBridge.h"
+#include "MCPCompileBatch.h"
+#include "Editor.h"
+#include "Editor/Transactor.h"
+#include "EditorAssetLibrary.h"
+#include "EngineUtils.h"
+#include "ScopedTransaction.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 TestNumActors = 5;
+
+    bool Succeeded(const TSharedRef<FJsonObject>& Response)
+    {
+        return Response->GetStringField(TEXT("status")) == TEXT("success");
+    }
+
+    /** Steps that can still be undone, as ExecuteBatch counts them */
+    int32 GetUndoableStepCount()
+    {
+        return GEditor->Trans ? GEditor->Trans->GetQueueLength() - GEditor->Trans->GetUndoCount() : 0;
+    }
+
+    TSharedPtr<FJsonValue> MakeEntry(const FString& Command, const TSharedPtr<FJsonObject>& Params)
+    {
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("command"), Command);
+        Entry->SetObjectField(TEXT("params"), Params);
+        return MakeShared<FJsonValueObject>(Entry);
+    }
+
+    TSharedPtr<FJsonValue> MakeMove(const FString& ActorName, const FVector& Location)
+    {
+        TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+        Params->SetStringField(TEXT("name"), ActorName);
+        TArray<TSharedPtr<FJsonValue>> Vector;
+        Vector.Add(MakeShared<FJsonValueNumber>(Location.X));
+        Vector.Add(MakeShared<FJsonValueNumber>(Location.Y));
+        Vector.Add(MakeShared<FJsonValueNumber>(Location.Z));
+        Params->SetArrayField(TEXT("location"), Vector);
+        return MakeEntry(TEXT("set_actor_transform"), Params);
+    }
+
+    /** An entry that always fails */
+    TSharedPtr<FJsonValue> MakeFailure()
+    {
+        return MakeEntry(TEXT("no_such_command"), MakeShared<FJsonObject>());
+    }
+
+    TSharedPtr<FJsonObject> RunBatch(UEpicUnrealMCPBridge* Bridge, const TArray<TSharedPtr<FJsonValue>>& Entries, bool bStopOnError)
+    {
+        TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+        Params->SetArrayField(TEXT("commands"), Entries);
+        Params->SetBoolField(TEXT("stop_on_error"), bStopOnError);
+        const TSharedRef<FJsonObject> Response = Bridge->ExecuteCommandOnGameThread(TEXT("batch"), Params);
+        const TSharedPtr<FJsonObject>* Result = nullptr;
+        return Succeeded(Response) && Response->TryGetObjectField(TEXT("result"), Result) ? *Result : nullptr;
+    }
+
+    /** Stand-in actors and a blueprint in the editor level, removed when the test ends however it ends */
+    struct FTestScene
+    {
+        UEpicUnrealMCPBridge* Bridge = nullptr;
+        TArray<FString> ActorNames;
+        TArray<AActor*> Actors;
+        FString BlueprintName;
+
+        explicit FTestScene(UEpicUnrealMCPBridge* InBridge)
+            : Bridge(InBridge)
+        {
+            const FString RunId = FString::Printf(TEXT("%08X"), FPlatformTime::Cycles());
+            for (int32 Index = 0; Index < TestNumActors; ++Index)
+            {
+                const FString ActorName = FString::Printf(TEXT("MCPTestBatch_%s_%d"), *RunId, Index);
+                TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+                Params->SetStringField(TEXT("type"), TEXT("StaticMeshActor"));
+                Params->SetStringField(TEXT("name"), ActorName);
+                if (Succeeded(Bridge->ExecuteCommandOnGameThread(TEXT("spawn_actor"), Params)))
+                {
+                    ActorNames.Add(ActorName);
+                }
+            }
+            for (TActorIterator<AActor> It(GEditor->GetEditorWorldContext().World()); It; ++It)
+            {
+                if (ActorNames.Contains(It->GetName()))
+                {
+                    Actors.Add(*It);
+                }
+            }
+
+            TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+            Params->SetStringField(TEXT("name"), FString::Printf(TEXT("MCPTestBatch_%s"), *RunId));
+            if (Succeeded(Bridge->ExecuteCommandOnGameThread(TEXT("create_blueprint"), Params)))
+            {
+                BlueprintName = Params->GetStringField(TEXT("name"));
+            }
+        }
+
+        bool IsReady() const
+        {
+            return Actors.Num() == TestNumActors && !BlueprintName.IsEmpty();
+        }
+
+        TArray<FVector> GetLocations() const
+        {
+            TArray<FVector> Locations;
+            for (const AActor* Actor : Actors)
+            {
+                Locations.Add(Actor->GetActorLocation());
+            }
+            return Locations;
+        }
+
+        ~FTestScene()
+        {
+            for (const FString& ActorName : ActorNames)
+            {
+                TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+                Params->SetStringField(TEXT("name"), ActorName);
+                Bridge->ExecuteCommandOnGameThread(TEXT("delete_actor"), Params);
+            }
+            if (!BlueprintName.IsEmpty())
+            {
+                UEditorAssetLibrary::DeleteAsset(TEXT("/Game/Blueprints/") + BlueprintName);
+            }
+        }
+    };
+
+    UEpicUnrealMCPBridge* GetBridge()
+    {
+        return GEditor ? GEditor->GetEditorSubsystem<UEpicUnrealMCPBridge>() : nullptr;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBatchCompilesOnceTest, "UnrealMCP.Batch.CompilesEachBlueprintOnce",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPBatchCompilesOnceTest::RunTest(const FString& Parameters)
+{
+    UEpicUnrealMCPBridge* Bridge = GetBridge();
+    if (!TestNotNull(TEXT("MCP bridge"), Bridge)) return false;
+    FTestScene Scene(Bridge);
+    if (!TestTrue(TEXT("Scene set up"), Scene.IsReady())) return false;
+
+    // Component adds to one blueprint mixed in with transform edits
+    TArray<TSharedPtr<FJsonValue>> Entries;
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        Entries.Add(MakeMove(Scene.ActorNames[Index % Scene.ActorNames.Num()], FVector(Index * 10.0, 0.0, 0.0)));
+
+        TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+        Params->SetStringField(TEXT("blueprint_name"), Scene.BlueprintName);
+        Params->SetStringField(TEXT("component_type"), TEXT("StaticMeshComponent"));
+        Params->SetStringField(TEXT("component_name"), FString::Printf(TEXT("TestMesh_%d"), Index));
+        Entries.Add(MakeEntry(TEXT("add_component_to_blueprint"), Params));
+    }
+
+    const int32 CompilesBefore = FMCPCompileBatch::GetNumCompiles();
+    const TSharedPtr<FJsonObject> Result = RunBatch(Bridge, Entries, false);
+    if (!TestNotNull(TEXT("Batch result"), Result.Get())) return false;
+
+    TestEqual(TEXT("Failed entries"), static_cast<int32>(Result->GetNumberField(TEXT("failed"))), 0);
+    TestEqual(TEXT("Compiles"), FMCPCompileBatch::GetNumCompiles() - CompilesBefore, 1);
+    TestEqual(TEXT("Compiled blueprints"), static_cast<int32>(Result->GetNumberField(TEXT("compiled_blueprints"))), 1);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBatchOneUndoStepTest, "UnrealMCP.Batch.UndoesAsOneStep",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPBatchOneUndoStepTest::RunTest(const FString& Parameters)
+{
+    UEpicUnrealMCPBridge* Bridge = GetBridge();
+    if (!TestNotNull(TEXT("MCP bridge"), Bridge)) return false;
+    FTestScene Scene(Bridge);
+    if (!TestTrue(TEXT("Scene set up"), Scene.IsReady())) return false;
+
+    const TArray<FVector> Before = Scene.GetLocations();
+    const int32 StepsBefore = GetUndoableStepCount();
+
+    TArray<TSharedPtr<FJsonValue>> Entries;
+    for (int32 Index = 0; Index < Scene.ActorNames.Num(); ++Index)
+    {
+        Entries.Add(MakeMove(Scene.ActorNames[Index], FVector(1000.0 + Index * 100.0, 500.0, 0.0)));
+    }
+    const TSharedPtr<FJsonObject> Result = RunBatch(Bridge, Entries, false);
+    if (!TestNotNull(TEXT("Batch result"), Result.Get())) return false;
+
+    TestEqual(TEXT("Failed entries"), static_cast<int32>(Result->GetNumberField(TEXT("failed"))), 0);
+    TestFalse(TEXT("Not rolled back"), Result->GetBoolField(TEXT("rolled_back")));
+    TestTrue(TEXT("Actors moved"), Scene.GetLocations() != Before);
+    TestEqual(TEXT("One undo step"), GetUndoableStepCount() - StepsBefore, 1);
+
+    TestTrue(TEXT("Undo ran"), GEditor->UndoTransaction());
+    TestTrue(TEXT("One undo puts every actor back"), Scene.GetLocations() == Before);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBatchStopRollsBackTest, "UnrealMCP.Batch.StopOnErrorRollsBack",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPBatchStopRollsBackTest::RunTest(const FString& Parameters)
+{
+    UEpicUnrealMCPBridge* Bridge = GetBridge();
+    if (!TestNotNull(TEXT("MCP bridge"), Bridge)) return false;
+    FTestScene Scene(Bridge);
+    if (!TestTrue(TEXT("Scene set up"), Scene.IsReady())) return false;
+
+    const TArray<FVector> Before = Scene.GetLocations();
+    const int32 StepsBefore = GetUndoableStepCount();
+
+    // Moves, then a failure, then a move that must never run
+    TArray<TSharedPtr<FJsonValue>> Entries;
+    Entries.Add(MakeMove(Scene.ActorNames[0], FVector(2000.0, 0.0, 0.0)));
+    Entries.Add(MakeMove(Scene.ActorNames[1], FVector(2100.0, 0.0, 0.0)));
+    Entries.Add(MakeFailure());
+    Entries.Add(MakeMove(Scene.ActorNames[2], FVector(2200.0, 0.0, 0.0)));
+    const TSharedPtr<FJsonObject> Result = RunBatch(Bridge, Entries, true);
+    if (!TestNotNull(TEXT("Batch result"), Result.Get())) return false;
+
+    TestEqual(TEXT("Executed up to the failure"), static_cast<int32>(Result->GetNumberField(TEXT("executed"))), 3);
+    TestEqual(TEXT("Applied before the failure"), Result->GetArrayField(TEXT("applied")).Num(), 2);
+    TestTrue(TEXT("Rolled back"), Result->GetBoolField(TEXT("rolled_back")));
+    TestTrue(TEXT("Every actor back where it was"), Scene.GetLocations() == Before);
+    TestEqual(TEXT("No undo step left behind"), GetUndoableStepCount(), StepsBefore);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBatchStopRecordedNothingTest, "UnrealMCP.Batch.StopWithNothingRecordedKeepsEarlierStep",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPBatchStopRecordedNothingTest::RunTest(const FString& Parameters)
+{
+    UEpicUnrealMCPBridge* Bridge = GetBridge();
+    if (!TestNotNull(TEXT("MCP bridge"), Bridge)) return false;
+    FTestScene Scene(Bridge);
+    if (!TestTrue(TEXT("Scene set up"), Scene.IsReady())) return false;
+
+    // Someone else's edit on top of the undo buffer
+    AActor* Moved = Scene.Actors[0];
+    const FVector Original = Moved->GetActorLocation();
+    const FVector Edited = Original + FVector(0.0, 0.0, 300.0);
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "BatchTestEdit", "MCP Batch Test Edit"));
+        Moved->Modify();
+        Moved->SetActorLocation(Edited);
+    }
+    const int32 StepsBefore = GetUndoableStepCount();
+
+    // Fails first, so the batch records nothing before it stops
+    TArray<TSharedPtr<FJsonValue>> Entries;
+    Entries.Add(MakeFailure());
+    Entries.Add(MakeMove(Scene.ActorNames[1], FVector(3000.0, 0.0, 0.0)));
+    const TSharedPtr<FJsonObject> Result = RunBatch(Bridge, Entries, true);
+    if (!TestNotNull(TEXT("Batch result"), Result.Get())) return false;
+
+    TestEqual(TEXT("Nothing applied"), Result->GetArrayField(TEXT("applied")).Num(), 0);
+    TestFalse(TEXT("Nothing to roll back"), Result->GetBoolField(TEXT("rolled_back")));
+    TestTrue(TEXT("The earlier edit stays"), Moved->GetActorLocation().Equals(Edited));
+    TestEqual(TEXT("The earlier step is still on the buffer"), GetUndoableStepCount(), StepsBefore);
+
+    TestTrue(TEXT("Undo ran"), GEditor->UndoTransaction());
+    TestTrue(TEXT("The earlier step is what undo reverts"), Moved->GetActorLocation().Equals(Original));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
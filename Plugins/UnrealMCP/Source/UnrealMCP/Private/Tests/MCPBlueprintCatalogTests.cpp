@@ -0,0 +1,186 @@
+#include "Misc/AutomationTest.h"
+#include "MCPBlueprintCatalog.h"
+#include "Engine/Blueprint.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 TestNumEntries = 500;
+
+    FString MakeName(int32 Index)
+    {
+        return FString::Printf(TEXT("BP_TestCatalog_%d"), Index);
+    }
+
+    FSoftObjectPath MakePath(const FString& Folder, const FString& Name)
+    {
+        return FSoftObjectPath(FString::Printf(TEXT("%s/%s.%s"), *Folder, *Name, *Name));
+    }
+
+    /** Stands in for the loader and the asset registry: one transient blueprint per path, made on first load */
+    struct FTestCatalog
+    {
+        FMCPBlueprintCatalog Catalog;
+        TMap<FSoftObjectPath, UBlueprint*> Pool;
+
+        explicit FTestCatalog(int32 CacheSize)
+            : Catalog(CacheSize)
+        {
+            Catalog.SetLoader([this](const FSoftObjectPath& Path)
+            {
+                return LoadForTest(Path);
+            });
+        }
+
+        UBlueprint* LoadForTest(const FSoftObjectPath& Path)
+        {
+            UBlueprint*& Blueprint = Pool.FindOrAdd(Path);
+            if (!Blueprint)
+            {
+                Blueprint = NewObject<UBlueprint>(GetTransientPackage(), NAME_None, RF_Transient);
+            }
+            return Blueprint;
+        }
+
+        void Add(const FString& Name, const FSoftObjectPath& Path)
+        {
+            Catalog.AddAsset(FName(*Name), Path);
+        }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBlueprintCatalogMatchesLoadAllTest, "UnrealMCP.BlueprintCatalog.MatchesLoadAll",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPBlueprintCatalogMatchesLoadAllTest::RunTest(const FString& Parameters)
+{
+    FTestCatalog Test(64);
+
+    // What loading every blueprint up front and picking by name would find, with /Game/Blueprints winning a shared name
+    TMap<FString, FSoftObjectPath> Expected;
+    for (int32 Index = 0; Index < TestNumEntries; ++Index)
+    {
+        const FString Name = MakeName(Index);
+        const FSoftObjectPath Elsewhere = MakePath(FString::Printf(TEXT("/Game/Test/Group_%d"), Index % 16), Name);
+        Test.Add(Name, Elsewhere);
+        Expected.Add(Name, Elsewhere);
+
+        // Every fifth name is also under /Game/Blueprints, added after the other so order is not what picks it
+        if (Index % 5 == 0)
+        {
+            const FSoftObjectPath Preferred = MakePath(TEXT("/Game/Blueprints"), Name);
+            Test.Add(Name, Preferred);
+            Expected.Add(Name, Preferred);
+        }
+    }
+    TestEqual(TEXT("Distinct names"), Test.Catalog.Num(), TestNumEntries);
+
+    int32 Mismatches = 0;
+    for (const TPair<FString, FSoftObjectPath>& Pair : Expected)
+    {
+        UBlueprint* Reference = Test.LoadForTest(Pair.Value);
+        Mismatches += Test.Catalog.FindBlueprint(Pair.Key) == Reference ? 0 : 1;
+        Mismatches += Test.Catalog.FindBlueprint(Pair.Key.ToLower()) == Reference ? 0 : 1;
+
+        FSoftObjectPath Path;
+        Mismatches += Test.Catalog.GetPath(Pair.Key, Path) && Path == Pair.Value ? 0 : 1;
+    }
+    TestEqual(TEXT("Lookups that differ from loading everything"), Mismatches, 0);
+
+    // A path goes straight to the loader, short or full
+    const FSoftObjectPath Direct = MakePath(TEXT("/Game/Test/Group_3"), MakeName(3));
+    TestTrue(TEXT("Object path"), Test.Catalog.FindBlueprint(Direct.ToString()) == Test.LoadForTest(Direct));
+    TestTrue(TEXT("Package path"), Test.Catalog.FindBlueprint(Direct.GetLongPackageName()) == Test.LoadForTest(Direct));
+
+    TestNull(TEXT("Unknown name"), Test.Catalog.FindBlueprint(TEXT("BP_TestCatalog_NeverAdded")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBlueprintCatalogLruTest, "UnrealMCP.BlueprintCatalog.LruLoadsOncePerMiss",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPBlueprintCatalogLruTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 CacheSize = 8;
+    FTestCatalog Test(CacheSize);
+    for (int32 Index = 0; Index < CacheSize * 2; ++Index)
+    {
+        Test.Add(MakeName(Index), MakePath(TEXT("/Game/Test"), MakeName(Index)));
+    }
+
+    // Filling the cache loads each once, going over it again is all hits
+    for (int32 Index = 0; Index < CacheSize; ++Index)
+    {
+        Test.Catalog.FindBlueprint(MakeName(Index));
+    }
+    TestEqual(TEXT("Loads to fill"), Test.Catalog.GetNumLoads(), CacheSize);
+    for (int32 Index = 0; Index < CacheSize; ++Index)
+    {
+        Test.Catalog.FindBlueprint(MakeName(Index));
+    }
+    TestEqual(TEXT("No loads once cached"), Test.Catalog.GetNumLoads(), CacheSize);
+    TestEqual(TEXT("Hits once cached"), Test.Catalog.GetNumHits(), CacheSize);
+
+    // Touch the oldest, then one more name evicts the next oldest instead
+    Test.Catalog.FindBlueprint(MakeName(0));
+    Test.Catalog.FindBlueprint(MakeName(CacheSize));
+    const int32 LoadsAfterEvict = Test.Catalog.GetNumLoads();
+    TestEqual(TEXT("New name loaded"), LoadsAfterEvict, CacheSize + 1);
+    Test.Catalog.FindBlueprint(MakeName(0));
+    TestEqual(TEXT("Touched entry kept"), Test.Catalog.GetNumLoads(), LoadsAfterEvict);
+    Test.Catalog.FindBlueprint(MakeName(1));
+    TestEqual(TEXT("Least recently used evicted"), Test.Catalog.GetNumLoads(), LoadsAfterEvict + 1);
+
+    // Every lookup is a hit or exactly one load
+    const int32 NumLookups = CacheSize * 2 + 4;
+    TestEqual(TEXT("Hits and loads add up"), Test.Catalog.GetNumHits() + Test.Catalog.GetNumLoads(), NumLookups);
+
+    // The cache is weak, a blueprint that went away is loaded again rather than handed out
+    const FSoftObjectPath GonePath = MakePath(TEXT("/Game/Test"), MakeName(0));
+    UBlueprint* Gone = Test.Pool.FindChecked(GonePath);
+    Gone->MarkAsGarbage();
+    Test.Pool.Remove(GonePath);
+    const int32 LoadsBeforeGone = Test.Catalog.GetNumLoads();
+    UBlueprint* Reloaded = Test.Catalog.FindBlueprint(MakeName(0));
+    TestTrue(TEXT("Gone blueprint not handed out"), Reloaded && Reloaded != Gone);
+    TestEqual(TEXT("Gone blueprint loaded again"), Test.Catalog.GetNumLoads(), LoadsBeforeGone + 1);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBlueprintCatalogFollowsChangesTest, "UnrealMCP.BlueprintCatalog.FollowsRemoveAndRename",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPBlueprintCatalogFollowsChangesTest::RunTest(const FString& Parameters)
+{
+    FTestCatalog Test(16);
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        Test.Add(MakeName(Index), MakePath(TEXT("/Game/Test"), MakeName(Index)));
+        Test.Catalog.FindBlueprint(MakeName(Index));
+    }
+
+    // Removed while cached
+    Test.Catalog.RemoveAsset(FName(*MakeName(0)), MakePath(TEXT("/Game/Test"), MakeName(0)));
+    TestNull(TEXT("Removed blueprint not found"), Test.Catalog.FindBlueprint(MakeName(0)));
+
+    // Renamed while cached, as the registry's rename event does it
+    const FString NewName = MakeName(1) + TEXT("_Renamed");
+    Test.Catalog.RemoveAsset(FName(*MakeName(1)), MakePath(TEXT("/Game/Test"), MakeName(1)));
+    Test.Add(NewName, MakePath(TEXT("/Game/Test"), NewName));
+    TestNull(TEXT("Old name gone"), Test.Catalog.FindBlueprint(MakeName(1)));
+    TestTrue(TEXT("New name found"), Test.Catalog.FindBlueprint(NewName) == Test.LoadForTest(MakePath(TEXT("/Game/Test"), NewName)));
+
+    // One of two copies removed, the other is still found
+    const FSoftObjectPath Preferred = MakePath(TEXT("/Game/Blueprints"), MakeName(2));
+    Test.Add(MakeName(2), Preferred);
+    Test.Catalog.RemoveAsset(FName(*MakeName(2)), Preferred);
+    TestTrue(TEXT("Remaining copy found"), Test.Catalog.FindBlueprint(MakeName(2)) == Test.LoadForTest(MakePath(TEXT("/Game/Test"), MakeName(2))));
+
+    TestEqual(TEXT("Distinct names"), Test.Catalog.Num(), 3);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,266 @@
+#include "Misc/AutomationTest.h"
+#include "MCPBinaryCodec.h"
+#include "MCPMessageFramer.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Largest integer a double holds exactly, where the encoder switches from integers to floats
+    constexpr double MaxExactInteger = 9007199254740992.0;
+
+    bool ValuesEqual(const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B);
+
+    bool ObjectsEqual(const FJsonObject& A, const FJsonObject& B)
+    {
+        if (A.Values.Num() != B.Values.Num())
+        {
+            return false;
+        }
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : A.Values)
+        {
+            const TSharedPtr<FJsonValue>* Other = B.Values.Find(Field.Key);
+            if (!Other || !ValuesEqual(Field.Value, *Other))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Exact comparison, numbers included, an unset value and null count as the same */
+    bool ValuesEqual(const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+    {
+        const EJson TypeA = A.IsValid() ? A->Type : EJson::Null;
+        const EJson TypeB = B.IsValid() ? B->Type : EJson::Null;
+        if (TypeA != TypeB)
+        {
+            return false;
+        }
+
+        switch (TypeA)
+        {
+        case EJson::Null:
+            return true;
+        case EJson::String:
+            return A->AsString().Equals(B->AsString(), ESearchCase::CaseSensitive);
+        case EJson::Number:
+            return A->AsNumber() == B->AsNumber();
+        case EJson::Boolean:
+            return A->AsBool() == B->AsBool();
+        case EJson::Array:
+        {
+            const TArray<TSharedPtr<FJsonValue>>& ArrayA = A->AsArray();
+            const TArray<TSharedPtr<FJsonValue>>& ArrayB = B->AsArray();
+            if (ArrayA.Num() != ArrayB.Num())
+            {
+                return false;
+            }
+            for (int32 Index = 0; Index < ArrayA.Num(); ++Index)
+            {
+                if (!ValuesEqual(ArrayA[Index], ArrayB[Index]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case EJson::Object:
+            return ObjectsEqual(*A->AsObject(), *B->AsObject());
+        default:
+            return false;
+        }
+    }
+
+    TSharedRef<FJsonValueArray> MakeNumbers(std::initializer_list<double> Values)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        for (double Value : Values)
+        {
+            Array.Add(MakeShared<FJsonValueNumber>(Value));
+        }
+        return MakeShared<FJsonValueArray>(Array);
+    }
+
+    /** Numbers on either side of every width the encoder picks */
+    const double EdgeNumbers[] = {
+        0.0, 1.0, 127.0, 128.0, 255.0, 256.0, 65535.0, 65536.0, 4294967295.0, 4294967296.0,
+        -1.0, -32.0, -33.0, -128.0, -129.0, -32768.0, -32769.0, -2147483648.0, -2147483649.0,
+        MaxExactInteger - 1.0, -(MaxExactInteger - 1.0), MaxExactInteger, -MaxExactInteger, MaxExactInteger * 2.0,
+        0.5, -0.25, 0.1, 1.0 / 3.0, 3.4028234663852886e38, 1e300, -1e-300, 4.9406564584124654e-324
+    };
+
+    /** A request shaped like real traffic plus every kind of value */
+    TSharedRef<FJsonObject> MakeEverything()
+    {
+        TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+        Params->SetStringField(TEXT("name"), TEXT("StaticMeshActor_12"));
+        Params->SetField(TEXT("location"), MakeNumbers({ 100.0, -250.0, 30.0 }));
+        Params->SetField(TEXT("rotation"), MakeNumbers({ 0.0, 0.1, 359.99999999 }));
+        Params->SetField(TEXT("scale"), MakeNumbers({ 0.5, 0.5, 0.5 }));
+        Params->SetField(TEXT("pair"), MakeNumbers({ 1.0, 2.0 }));
+        Params->SetField(TEXT("four"), MakeNumbers({ 1.0, 2.0, 3.0, 4.0 }));
+
+        TArray<TSharedPtr<FJsonValue>> Mixed;
+        Mixed.Add(MakeShared<FJsonValueString>(TEXT("x")));
+        Mixed.Add(MakeShared<FJsonValueNumber>(1.0));
+        Mixed.Add(MakeShared<FJsonValueBoolean>(true));
+        Params->SetArrayField(TEXT("mixed_three"), Mixed);
+        Params->SetArrayField(TEXT("empty_array"), TArray<TSharedPtr<FJsonValue>>());
+        Params->SetObjectField(TEXT("empty_object"), MakeShared<FJsonObject>());
+
+        Params->SetStringField(TEXT("empty"), FString());
+        Params->SetStringField(TEXT("unicode"), TEXT("Résumé 日本"));
+        Params->SetStringField(TEXT("str8"), FString::ChrN(40, TEXT('a')));
+        Params->SetStringField(TEXT("str16"), FString::ChrN(300, TEXT('b')));
+        Params->SetStringField(TEXT("str32"), FString::ChrN(70000, TEXT('c')));
+        Params->SetBoolField(TEXT("yes"), true);
+        Params->SetBoolField(TEXT("no"), false);
+        Params->SetField(TEXT("nothing"), MakeShared<FJsonValueNull>());
+
+        TArray<TSharedPtr<FJsonValue>> Long;
+        for (int32 Index = 0; Index < 70000; ++Index)
+        {
+            Long.Add(MakeShared<FJsonValueNumber>(Index));
+        }
+        Params->SetArrayField(TEXT("array32"), Long);
+
+        TSharedRef<FJsonObject> Wide = MakeShared<FJsonObject>();
+        for (int32 Index = 0; Index < 20; ++Index)
+        {
+            Wide->SetNumberField(FString::Printf(TEXT("field_%d"), Index), Index);
+        }
+        Params->SetObjectField(TEXT("map16"), Wide);
+
+        TSharedRef<FJsonObject> Message = MakeShared<FJsonObject>();
+        Message->SetStringField(TEXT("command"), TEXT("set_actor_transform"));
+        Message->SetNumberField(TEXT("id"), 42);
+        Message->SetObjectField(TEXT("params"), Params);
+        return Message;
+    }
+
+    TSharedPtr<FJsonObject> RoundTrip(const TSharedRef<FJsonObject>& Object)
+    {
+        TArray<uint8> Bytes;
+        FMCPBinaryCodec::Encode(Object, Bytes);
+        return FMCPBinaryCodec::Decode(Bytes.GetData(), Bytes.Num());
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPCodecRoundTripTest, "UnrealMCP.Codec.RoundTripsEveryValue",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPCodecRoundTripTest::RunTest(const FString& Parameters)
+{
+    const TSharedRef<FJsonObject> Message = MakeEverything();
+    const TSharedPtr<FJsonObject> Decoded = RoundTrip(Message);
+    if (!TestTrue(TEXT("Decoded"), Decoded.IsValid())) return false;
+    TestTrue(TEXT("Decodes to the same object"), ObjectsEqual(*Message, *Decoded));
+
+    // Through the framer a byte at a time, as a slow socket would hand it over
+    TArray<uint8> Payload;
+    FMCPBinaryCodec::Encode(Message, Payload);
+    TArray<uint8> Wire;
+    FMCPMessageFramer::FrameBinary(Payload, Wire);
+    FMCPMessageFramer Framer;
+    FMCPMessage Framed;
+    bool bFramed = false;
+    for (int32 Index = 0; Index < Wire.Num() && !bFramed; ++Index)
+    {
+        Framer.Append(&Wire[Index], 1);
+        bFramed = Framer.Next(Framed);
+    }
+    TestTrue(TEXT("Framed message handed out once complete"), bFramed);
+    TestTrue(TEXT("Framed as MessagePack"), Framed.Framing == EMCPFraming::MessagePack);
+    const TSharedPtr<FJsonObject> Unframed = FMCPBinaryCodec::Decode(Framed.Bytes.GetData(), Framed.Bytes.Num());
+    TestTrue(TEXT("Unframed decodes to the same object"), Unframed.IsValid() && ObjectsEqual(*Message, *Unframed));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPCodecNumbersTest, "UnrealMCP.Codec.NumbersExact",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPCodecNumbersTest::RunTest(const FString& Parameters)
+{
+    for (double Value : EdgeNumbers)
+    {
+        TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+        Object->SetNumberField(TEXT("n"), Value);
+        const TSharedPtr<FJsonObject> Decoded = RoundTrip(Object);
+        double Back = 0.0;
+        TestTrue(FString::Printf(TEXT("%.17g round trips exactly"), Value),
+            Decoded.IsValid() && Decoded->TryGetNumberField(TEXT("n"), Back) && Back == Value);
+
+        // Also as a vector component, where the float and double ext types split
+        TSharedRef<FJsonObject> Vector = MakeShared<FJsonObject>();
+        Vector->SetField(TEXT("v"), MakeNumbers({ Value, 1.0, -Value }));
+        const TSharedPtr<FJsonObject> DecodedVector = RoundTrip(Vector);
+        TestTrue(FString::Printf(TEXT("%.17g in a vector round trips exactly"), Value),
+            DecodedVector.IsValid() && ObjectsEqual(*Vector, *DecodedVector));
+    }
+
+    // Size of the number alone after a one field map header and the one byte key
+    struct FWidthCase
+    {
+        double Value;
+        int32 Bytes;
+    };
+    const FWidthCase Widths[] = {
+        { 0.0, 1 }, { 127.0, 1 }, { 128.0, 2 }, { 255.0, 2 }, { 256.0, 3 }, { 65536.0, 5 }, { 4294967296.0, 9 },
+        { -32.0, 1 }, { -33.0, 2 }, { -129.0, 3 }, { -32769.0, 5 }, { -2147483649.0, 9 },
+        { MaxExactInteger - 1.0, 9 }, { MaxExactInteger, 5 }, { 0.5, 5 }, { 0.1, 9 }
+    };
+    for (const FWidthCase& Width : Widths)
+    {
+        TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+        Object->SetNumberField(TEXT("n"), Width.Value);
+        TArray<uint8> Bytes;
+        FMCPBinaryCodec::Encode(Object, Bytes);
+        TestEqual(FString::Printf(TEXT("%.17g encoded size"), Width.Value), Bytes.Num() - 3, Width.Bytes);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPCodecRejectsBadInputTest, "UnrealMCP.Codec.RejectsBadInput",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPCodecRejectsBadInputTest::RunTest(const FString& Parameters)
+{
+    TSharedRef<FJsonObject> Message = MakeShared<FJsonObject>();
+    Message->SetStringField(TEXT("command"), TEXT("set_actor_transform"));
+    Message->SetField(TEXT("location"), MakeNumbers({ 1.0, 2.0, 3.0 }));
+    Message->SetNumberField(TEXT("id"), 1e100);
+    TArray<uint8> Bytes;
+    FMCPBinaryCodec::Encode(Message, Bytes);
+
+    int32 TruncatedDecoded = 0;
+    for (int32 NumBytes = 0; NumBytes < Bytes.Num(); ++NumBytes)
+    {
+        TruncatedDecoded += FMCPBinaryCodec::Decode(Bytes.GetData(), NumBytes).IsValid() ? 1 : 0;
+    }
+    TestEqual(TEXT("Truncated messages decoded"), TruncatedDecoded, 0);
+
+    // A bare array is not a message
+    const uint8 Array[] = { 0x92, 0x01, 0x02 };
+    TestFalse(TEXT("Array rejected"), FMCPBinaryCodec::Decode(Array, UE_ARRAY_COUNT(Array)).IsValid());
+
+    // Nesting past MaxDepth
+    TArray<uint8> Deep;
+    Deep.Add(0x81);
+    Deep.Add(0xa1);
+    Deep.Add('d');
+    for (int32 Level = 0; Level < FMCPBinaryCodec::MaxDepth + 8; ++Level)
+    {
+        Deep.Add(0x91);
+    }
+    Deep.Add(0xc0);
+    TestFalse(TEXT("Nesting past the limit rejected"), FMCPBinaryCodec::Decode(Deep.GetData(), Deep.Num()).IsValid());
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
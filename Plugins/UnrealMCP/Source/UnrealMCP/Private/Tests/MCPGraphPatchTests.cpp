@@ -0,0 +1,227 @@
+#include "Misc/AutomationTest.h"
+#include "EpicUnrealMCPBridge.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Editor.h"
+#include "EditorAssetLibrary.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "Kismet/KismetStringLibrary.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "HAL/PlatformTime.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 TestNumPrints = 12;
+
+    TSharedPtr<FJsonValue> MakeNode(const FString& Id, const FString& Type, const FString& Name, const FString& Target, int32 X, int32 Y)
+    {
+        TSharedPtr<FJsonObject> Node = MakeShared<FJsonObject>();
+        Node->SetStringField(TEXT("id"), Id);
+        Node->SetStringField(TEXT("type"), Type);
+        Node->SetStringField(TEXT("name"), Name);
+        if (!Target.IsEmpty())
+        {
+            Node->SetStringField(TEXT("target"), Target);
+        }
+        TArray<TSharedPtr<FJsonValue>> Position;
+        Position.Add(MakeShared<FJsonValueNumber>(X));
+        Position.Add(MakeShared<FJsonValueNumber>(Y));
+        Node->SetArrayField(TEXT("position"), Position);
+        return MakeShared<FJsonValueObject>(Node);
+    }
+
+    TSharedPtr<FJsonValue> MakeEdge(const FString& Source, const FString& SourcePin, const FString& Target, const FString& TargetPin)
+    {
+        TSharedPtr<FJsonObject> Edge = MakeShared<FJsonObject>();
+        Edge->SetStringField(TEXT("source"), Source);
+        Edge->SetStringField(TEXT("source_pin"), SourcePin);
+        Edge->SetStringField(TEXT("target"), Target);
+        Edge->SetStringField(TEXT("target_pin"), TargetPin);
+        return MakeShared<FJsonValueObject>(Edge);
+    }
+
+    /** The event or function a node stands for, so two graphs can be compared without guids */
+    FString NodeKey(const UEdGraphNode* Node)
+    {
+        if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+        {
+            return FString::Printf(TEXT("Event %s"), *EventNode->GetFunctionName().ToString());
+        }
+        if (const UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(Node))
+        {
+            return FString::Printf(TEXT("Call %s"), *FunctionNode->FunctionReference.GetMemberName().ToString());
+        }
+        return Node->GetClass()->GetName();
+    }
+
+    /** Every node and every link of a graph as sorted text */
+    void Describe(const UEdGraph* Graph, TArray<FString>& OutNodes, TArray<FString>& OutLinks)
+    {
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            OutNodes.Add(NodeKey(Node));
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                if (Pin->Direction != EGPD_Output) continue;
+                for (const UEdGraphPin* Linked : Pin->LinkedTo)
+                {
+                    OutLinks.Add(FString::Printf(TEXT("%s.%s -> %s.%s"), *NodeKey(Node), *Pin->PinName.ToString(),
+                        *NodeKey(Linked->GetOwningNode()), *Linked->PinName.ToString()));
+                }
+            }
+        }
+        OutNodes.Sort();
+        OutLinks.Sort();
+    }
+
+    bool Succeeded(const TSharedRef<FJsonObject>& Response)
+    {
+        return Response->GetStringField(TEXT("status")) == TEXT("success");
+    }
+
+    /** Blueprints made for one test, deleted when it ends however it ends */
+    struct FTestBlueprints
+    {
+        TArray<FString> Names;
+
+        UBlueprint* Create(UEpicUnrealMCPBridge* Bridge, const FString& Prefix)
+        {
+            const FString Name = FString::Printf(TEXT("%s_%08X"), *Prefix, FPlatformTime::Cycles());
+            TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+            Params->SetStringField(TEXT("name"), Name);
+            if (!Succeeded(Bridge->ExecuteCommandOnGameThread(TEXT("create_blueprint"), Params)))
+            {
+                return nullptr;
+            }
+            Names.Add(Name);
+            return FEpicUnrealMCPCommonUtils::FindBlueprint(Name);
+        }
+
+        ~FTestBlueprints()
+        {
+            for (const FString& Name : Names)
+            {
+                UEditorAssetLibrary::DeleteAsset(TEXT("/Game/Blueprints/") + Name);
+            }
+        }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPGraphPatchMatchesPerNodeTest, "UnrealMCP.GraphPatch.MatchesPerNode",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPGraphPatchMatchesPerNodeTest::RunTest(const FString& Parameters)
+{
+    UEpicUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UEpicUnrealMCPBridge>() : nullptr;
+    if (!TestNotNull(TEXT("MCP bridge"), Bridge)) return false;
+
+    FTestBlueprints Blueprints;
+    UBlueprint* PerNode = Blueprints.Create(Bridge, TEXT("MCPTestGraphA"));
+    UBlueprint* Patched = Blueprints.Create(Bridge, TEXT("MCPTestGraphB"));
+    UFunction* PrintString = UKismetSystemLibrary::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, PrintString));
+    UFunction* IntToString = UKismetStringLibrary::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UKismetStringLibrary, Conv_IntToString));
+    if (!TestNotNull(TEXT("Node by node blueprint"), PerNode) || !TestNotNull(TEXT("Patched blueprint"), Patched)) return false;
+
+    // BeginPlay into a chain of PrintString calls, each fed by its own IntToString, node by node
+    UEdGraph* PerNodeGraph = FEpicUnrealMCPCommonUtils::FindOrCreateEventGraph(PerNode);
+    UEdGraphNode* Previous = FEpicUnrealMCPCommonUtils::CreateEventNode(PerNodeGraph, TEXT("ReceiveBeginPlay"), FVector2D(0.0, 0.0));
+    for (int32 Index = 0; Index < TestNumPrints && Previous; ++Index)
+    {
+        UEdGraphNode* Convert = FEpicUnrealMCPCommonUtils::CreateFunctionCallNode(PerNodeGraph, IntToString, FVector2D(300.0 * (Index + 1), 200.0));
+        UEdGraphNode* Print = FEpicUnrealMCPCommonUtils::CreateFunctionCallNode(PerNodeGraph, PrintString, FVector2D(300.0 * (Index + 1), 0.0));
+        TestTrue(TEXT("Node by node exec link"), FEpicUnrealMCPCommonUtils::ConnectGraphNodes(PerNodeGraph, Previous, TEXT("then"), Print, TEXT("execute")));
+        TestTrue(TEXT("Node by node value link"), FEpicUnrealMCPCommonUtils::ConnectGraphNodes(PerNodeGraph, Convert, TEXT("ReturnValue"), Print, TEXT("InString")));
+        Previous = Print;
+    }
+    if (!TestNotNull(TEXT("Node by node chain built"), Previous)) return false;
+
+    // The same graph as one patch
+    TArray<TSharedPtr<FJsonValue>> Nodes;
+    TArray<TSharedPtr<FJsonValue>> Edges;
+    Nodes.Add(MakeNode(TEXT("begin"), TEXT("event"), TEXT("ReceiveBeginPlay"), FString(), 0, 0));
+    FString PreviousId = TEXT("begin");
+    for (int32 Index = 0; Index < TestNumPrints; ++Index)
+    {
+        const FString ConvertId = FString::Printf(TEXT("convert_%d"), Index);
+        const FString PrintId = FString::Printf(TEXT("print_%d"), Index);
+        Nodes.Add(MakeNode(ConvertId, TEXT("function"), TEXT("Conv_IntToString"), TEXT("KismetStringLibrary"), 300 * (Index + 1), 200));
+        Nodes.Add(MakeNode(PrintId, TEXT("function"), TEXT("PrintString"), TEXT("KismetSystemLibrary"), 300 * (Index + 1), 0));
+        Edges.Add(MakeEdge(PreviousId, TEXT("then"), PrintId, TEXT("execute")));
+        Edges.Add(MakeEdge(ConvertId, TEXT("ReturnValue"), PrintId, TEXT("InString")));
+        PreviousId = PrintId;
+    }
+    TSharedPtr<FJsonObject> PatchParams = MakeShared<FJsonObject>();
+    PatchParams->SetStringField(TEXT("blueprint_name"), Patched->GetName());
+    PatchParams->SetArrayField(TEXT("nodes"), Nodes);
+    PatchParams->SetArrayField(TEXT("edges"), Edges);
+
+    const TSharedRef<FJsonObject> Response = Bridge->ExecuteCommandOnGameThread(TEXT("patch_blueprint_graph"), PatchParams);
+    const TSharedPtr<FJsonObject>* Result = nullptr;
+    if (!TestTrue(TEXT("Patch succeeded"), Succeeded(Response) && Response->TryGetObjectField(TEXT("result"), Result))) return false;
+    TestEqual(TEXT("Patch failures"), static_cast<int32>((*Result)->GetNumberField(TEXT("failed"))), 0);
+    TestEqual(TEXT("Patch links"), static_cast<int32>((*Result)->GetNumberField(TEXT("connected"))), Edges.Num());
+
+    // The event may already be in a new blueprint's graph, both ways reuse it then
+    TArray<FString> PerNodeNodes, PerNodeLinks, PatchNodes, PatchLinks;
+    Describe(PerNodeGraph, PerNodeNodes, PerNodeLinks);
+    Describe(FEpicUnrealMCPCommonUtils::FindOrCreateEventGraph(Patched), PatchNodes, PatchLinks);
+    TestTrue(TEXT("Same nodes both ways"), PerNodeNodes == PatchNodes);
+    TestTrue(TEXT("Same links both ways"), PerNodeLinks == PatchLinks);
+    TestEqual(TEXT("Every edge linked"), PatchLinks.Num(), Edges.Num());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPGraphPatchRejectsNonEventTest, "UnrealMCP.GraphPatch.RejectsNonEventAsEvent",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMCPGraphPatchRejectsNonEventTest::RunTest(const FString& Parameters)
+{
+    UEpicUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UEpicUnrealMCPBridge>() : nullptr;
+    if (!TestNotNull(TEXT("MCP bridge"), Bridge)) return false;
+
+    FTestBlueprints Blueprints;
+    UBlueprint* Blueprint = Blueprints.Create(Bridge, TEXT("MCPTestGraphEvent"));
+    if (!TestNotNull(TEXT("Blueprint"), Blueprint)) return false;
+
+    UEdGraph* Graph = FEpicUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
+
+    // K2_DestroyActor is callable but not an event, ReceiveTick is an event
+    TSharedPtr<FJsonObject> PatchParams = MakeShared<FJsonObject>();
+    PatchParams->SetStringField(TEXT("blueprint_name"), Blueprint->GetName());
+    TArray<TSharedPtr<FJsonValue>> Nodes;
+    Nodes.Add(MakeNode(TEXT("destroy"), TEXT("event"), TEXT("K2_DestroyActor"), FString(), 0, 0));
+    Nodes.Add(MakeNode(TEXT("tick"), TEXT("event"), TEXT("ReceiveTick"), FString(), 0, 300));
+    PatchParams->SetArrayField(TEXT("nodes"), Nodes);
+    PatchParams->SetArrayField(TEXT("edges"), TArray<TSharedPtr<FJsonValue>>());
+
+    const TSharedRef<FJsonObject> Response = Bridge->ExecuteCommandOnGameThread(TEXT("patch_blueprint_graph"), PatchParams);
+    const TSharedPtr<FJsonObject>* Result = nullptr;
+    if (!TestTrue(TEXT("Patch ran"), Succeeded(Response) && Response->TryGetObjectField(TEXT("result"), Result))) return false;
+    TestEqual(TEXT("Only the function failed"), static_cast<int32>((*Result)->GetNumberField(TEXT("failed"))), 1);
+
+    int32 DestroyEvents = 0;
+    int32 TickEvents = 0;
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+        {
+            DestroyEvents += EventNode->GetFunctionName() == TEXT("K2_DestroyActor") ? 1 : 0;
+            TickEvents += EventNode->GetFunctionName() == TEXT("ReceiveTick") ? 1 : 0;
+        }
+    }
+    TestEqual(TEXT("No event node for a plain function"), DestroyEvents, 0);
+    TestEqual(TEXT("The real event is in the graph once"), TickEvents, 1);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -23,6 +23,7 @@ private:
     TSharedPtr<FJsonObject> HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetStaticMeshProperties(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetMeshMaterialColor(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandlePatchBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
 
 
 }; 
\ No newline at end of file
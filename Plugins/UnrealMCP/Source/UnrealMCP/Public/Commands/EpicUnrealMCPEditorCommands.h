@@ -3,6 +3,10 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class AActor;
+class UWorld;
+class FMCPActorIndex;
+
 /**
  * Handler class for Editor-related MCP commands
  * Handles viewport control, actor manipulation, and level management
@@ -15,6 +19,9 @@ public:
     // Handle editor commands
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    // get_actors_in_level a page per call, returning false with the last page
+    TFunction<bool(TSharedPtr<FJsonObject>&)> CreateActorStream(const TSharedPtr<FJsonObject>& Params);
+
 private:
     // Actor manipulation commands
     TSharedPtr<FJsonObject> HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params);
@@ -25,4 +32,13 @@ private:
 
     // Blueprint actor spawning
     TSharedPtr<FJsonObject> HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params);
+
+    // Actor lookup, through the index for the editor world and by scanning any other world (PIE)
+    FMCPActorIndex* GetActorIndex(UWorld* World);
+    AActor* FindActorByName(UWorld* World, const FString& ActorName);
+
+    // Up to Limit actors in name order after the one named Cursor, true if more follow
+    bool GetActorPage(UWorld* World, const FString& Cursor, int32 Limit, TArray<AActor*>& OutActors);
+
+    TSharedPtr<FMCPActorIndex> ActorIndex;
 }; 
\ No newline at end of file
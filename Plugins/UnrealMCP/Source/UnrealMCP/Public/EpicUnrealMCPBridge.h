@@ -10,6 +10,7 @@
 #include "Interfaces/IPv4/IPv4Endpoint.h"
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
+#include "MCPCommandDispatcher.h"
 #include "EpicUnrealMCPBridge.generated.h"
 
 class FMCPServerRunnable;
@@ -17,8 +18,8 @@ class FMCPServerRunnable;
 /**
  * Editor subsystem for MCP Bridge
  * Handles communication between external tools and the Unreal Editor
- * through a TCP socket connection. Commands are received as JSON and
- * routed to appropriate command handlers.
+ * through a TCP socket connection. Commands are received as JSON, queued
+ * for the game thread by the dispatcher and routed to appropriate command handlers.
  */
 UCLASS()
 class UNREALMCP_API UEpicUnrealMCPBridge : public UEditorSubsystem
@@ -37,11 +38,23 @@ public:
 	void StartServer();
 	void StopServer();
 	bool IsRunning() const { return bIsRunning; }
+	uint16 GetPort() const { return Port; }
 
 	// Command execution
+	void SubmitCommand(FMCPCommandRequest&& Request);
 	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	TSharedRef<FJsonObject> ExecuteCommandOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+	static TSharedRef<FJsonObject> MakeErrorResponse(const FString& Error);
+	static FString SerializeResponse(const TSharedRef<FJsonObject>& Response);
+
+	static constexpr int32 MaxBatchCommands = 10000;
 
 private:
+	TSharedPtr<FJsonObject> ExecuteBatch(const TSharedPtr<FJsonObject>& Params);
+	static int32 GetUndoableStepCount();
+	FMCPChunkProducer CreateResponseStream(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
 	// Server state
 	bool bIsRunning;
 	TSharedPtr<FSocket> ListenerSocket;
@@ -52,6 +65,9 @@ private:
 	FIPv4Address ServerAddress;
 	uint16 Port;
 
+	// Runs submitted commands on the game thread
+	TSharedPtr<FMCPCommandDispatcher, ESPMode::ThreadSafe> Dispatcher;
+
 	// Command handler instances
 	TSharedPtr<FEpicUnrealMCPEditorCommands> EditorCommands;
 	TSharedPtr<FEpicUnrealMCPBlueprintCommands> BlueprintCommands;
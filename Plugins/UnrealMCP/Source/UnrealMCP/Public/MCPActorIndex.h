@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class UWorld;
+
+/** What an actor is looked up by */
+enum class EMCPActorKey : uint8
+{
+	Name,
+	Label,
+	Class,
+	Folder,
+	Count
+};
+
+/** How the pattern is matched, all case-insensitive */
+enum class EMCPActorMatch : uint8
+{
+	Exact,
+	Prefix,
+	Glob,
+	Contains
+};
+
+/**
+ * Index of one editor world's actors by object name, label, class name and outliner folder.
+ *
+ * Built with one pass over the world on first use, then kept current from the level actor
+ * added/deleted, label and folder events instead of being rescanned per command. Exact
+ * lookups are a hash lookup. Prefix and glob queries binary search a sorted list of the
+ * distinct keys, so only keys that can match are visited and actors are never scanned.
+ * Game thread only.
+ */
+class UNREALMCP_API FMCPActorIndex
+{
+public:
+	FMCPActorIndex();
+	~FMCPActorIndex();
+
+	/** Follow this world from now on, indexed lazily on the next query */
+	void Bind(UWorld* InWorld);
+	void Unbind();
+
+	UWorld* GetWorld() const { return World.Get(); }
+
+	/** Number of actors indexed, rebuilding first if needed */
+	int32 Num();
+
+	/** Exact object name, nullptr if there is none */
+	AActor* FindByName(const FString& Name);
+
+	/** Every live actor whose key matches the pattern; Glob takes * and ? */
+	void Query(EMCPActorKey Key, EMCPActorMatch Match, const FString& Pattern, TArray<AActor*>& OutActors);
+
+	/**
+	 * Up to Limit actors in name order, starting after the actor named AfterName (from the
+	 * start if empty). A cursor by name stays valid while actors come and go. True if more follow.
+	 */
+	bool GetPage(const FString& AfterName, int32 Limit, TArray<AActor*>& OutActors);
+
+	/** The same test Query applies, for callers scanning a world the index is not bound to */
+	static bool Matches(const AActor* Actor, EMCPActorKey Key, EMCPActorMatch Match, const FString& Pattern);
+
+	static FString GetKeyString(const AActor* Actor, EMCPActorKey Key);
+
+private:
+	static constexpr int32 NumKeys = static_cast<int32>(EMCPActorKey::Count);
+
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+
+		/** Keys the actor is filed under, to unfile it after it changes */
+		FName Keys[NumKeys];
+	};
+
+	/** Actors by one key, with a sorted list of the distinct keys for prefix and glob queries */
+	struct FKeyTable
+	{
+		TMap<FName, TSet<FObjectKey>> Buckets;
+		TArray<TPair<FString, FName>> SortedKeys;
+		bool bSortedDirty = true;
+
+		void Add(FName Key, FObjectKey Actor);
+		void Remove(FName Key, FObjectKey Actor);
+		void Reset();
+		const TArray<TPair<FString, FName>>& GetSortedKeys();
+	};
+
+	void RebuildIfNeeded();
+	void AddActor(AActor* Actor);
+	void RemoveActor(const AActor* Actor);
+	void RefileActor(const AActor* Actor);
+	bool IsInWorld(const AActor* Actor) const;
+
+	void CollectBucket(const FKeyTable& Table, FName Key, TArray<AActor*>& OutActors) const;
+
+	void OnActorAdded(AActor* Actor);
+	void OnActorDeleted(AActor* Actor);
+	void OnActorLabelChanged(AActor* Actor);
+	void OnActorFolderChanged(const AActor* Actor, FName OldPath);
+	void OnActorListChanged();
+	void OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources);
+
+	static FName MakeKey(const FString& Value);
+
+	TWeakObjectPtr<UWorld> World;
+	TMap<FObjectKey, FEntry> Entries;
+	FKeyTable Tables[NumKeys];
+	bool bNeedsRebuild = true;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorLabelHandle;
+	FDelegateHandle ActorFolderHandle;
+	FDelegateHandle ActorListHandle;
+	FDelegateHandle WorldCleanupHandle;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/**
+ * MessagePack encoding of the same command and response objects the JSON protocol carries.
+ *
+ * Values map one to one: objects, arrays, strings, bools and null, with numbers written as
+ * the smallest integer or as float32/float64, whichever holds them exactly. Three number
+ * arrays (every location, rotation and scale) are written as one ext value holding three
+ * little-endian floats, so the decoder copies them out of the buffer in one go instead of
+ * reading three tagged numbers. They decode back to the same [x, y, z] arrays, so handlers
+ * cannot tell which encoding a command arrived in.
+ *
+ * Stateless and thread safe.
+ */
+class UNREALMCP_API FMCPBinaryCodec
+{
+public:
+	/** Ext types for three number arrays */
+	static constexpr int8 Vector3FloatExt = 1;
+	static constexpr int8 Vector3DoubleExt = 2;
+
+	/** Nesting deeper than this fails to decode, so a hostile message cannot exhaust the stack */
+	static constexpr int32 MaxDepth = 64;
+
+	/** Append Object as a MessagePack map */
+	static void Encode(const TSharedRef<FJsonObject>& Object, TArray<uint8>& OutBytes);
+
+	/** Decode a MessagePack map, nullptr if the bytes are malformed, truncated or not a map */
+	static TSharedPtr<FJsonObject> Decode(const uint8* Data, int32 NumBytes);
+
+	/** Whether a payload starting with this byte is a MessagePack map rather than JSON text */
+	static bool IsMapMarker(uint8 FirstByte)
+	{
+		return (FirstByte >= 0x80 && FirstByte <= 0x8f) || FirstByte == 0xde || FirstByte == 0xdf;
+	}
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/WeakObjectPtr.h"
+
+struct FAssetData;
+class UBlueprint;
+
+/**
+ * Every blueprint asset in the project by short name, from the asset registry.
+ *
+ * Filled with one registry query when bound, then kept current from the registry's added,
+ * removed and renamed events, so a lookup is a hash lookup instead of guessing paths and
+ * trying loads. Names are case-insensitive; when several folders hold a blueprint of the
+ * same name, the one under /Game/Blueprints wins, as the old path guess found it.
+ *
+ * Blueprints are loaded on first lookup. The most recently used ones are remembered in an
+ * LRU of UnrealMCP.BlueprintCacheSize entries, which answers repeat lookups without the
+ * registry or the loader. The LRU holds weak pointers, so it never keeps a deleted
+ * blueprint alive or shows up as a referencer when one is deleted. Game thread only.
+ */
+class UNREALMCP_API FMCPBlueprintCatalog
+{
+public:
+	/** Loads one blueprint, LoadObject unless a test replaces it */
+	using FLoadFunction = TFunction<UBlueprint*(const FSoftObjectPath& Path)>;
+
+	/** The editor's catalog, bound to the asset registry on first use */
+	static FMCPBlueprintCatalog& Get();
+
+	/** Release the editor's catalog, before the asset registry goes away */
+	static void Shutdown();
+
+	explicit FMCPBlueprintCatalog(int32 InCacheSize);
+	~FMCPBlueprintCatalog();
+
+	/** Take in every blueprint the registry knows of and follow its events from now on */
+	void BindToAssetRegistry();
+	void Unbind();
+
+	/** Add or remove one entry, what the registry events do */
+	void AddAsset(FName AssetName, const FSoftObjectPath& Path);
+	void RemoveAsset(FName AssetName, const FSoftObjectPath& Path);
+
+	/** A short name, or a package or object path. Loads it if needed, nullptr if there is none */
+	UBlueprint* FindBlueprint(const FString& Name);
+
+	/** The class the blueprint generates, nullptr if there is no such blueprint or it never compiled */
+	UClass* FindGeneratedClass(const FString& Name);
+
+	/** Where the blueprint of this short name lives, without loading it */
+	bool GetPath(const FString& Name, FSoftObjectPath& OutPath) const;
+
+	/** Distinct short names */
+	int32 Num() const { return Paths.Num(); }
+
+	/** Whether the registry may still be discovering assets, so a miss is not conclusive */
+	bool IsDiscovering() const;
+
+	int32 GetNumLoads() const { return NumLoads; }
+	int32 GetNumHits() const { return NumHits; }
+	void SetLoader(FLoadFunction InLoader) { Loader = MoveTemp(InLoader); }
+
+private:
+	static bool IsBlueprint(const FAssetData& AssetData);
+
+	/** The entry a short name resolves to, nullptr if there is none */
+	const FSoftObjectPath* Resolve(FName AssetName) const;
+
+	/** In memory already, or through the loader */
+	UBlueprint* Load(const FSoftObjectPath& Path);
+
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	/** Every path per short name, usually one */
+	TMap<FName, TArray<FSoftObjectPath, TInlineAllocator<1>>> Paths;
+
+	/** Recently used blueprints by short name */
+	TLruCache<FName, TWeakObjectPtr<UBlueprint>> Loaded;
+
+	FLoadFunction Loader;
+	int32 NumLoads = 0;
+	int32 NumHits = 0;
+	bool bBound = false;
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+};
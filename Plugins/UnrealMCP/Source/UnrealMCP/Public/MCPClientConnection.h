@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/CriticalSection.h"
+#include "MCPMessageFramer.h"
+
+class FSocket;
+class FRunnableThread;
+class FEvent;
+class FJsonObject;
+class UEpicUnrealMCPBridge;
+
+/**
+ * One connected MCP client, served on its own thread.
+ *
+ * The thread sleeps in a readiness wait on the socket until bytes arrive or queued
+ * responses can be written, so clients never wait on each other. Incoming bytes go
+ * through an FMCPMessageFramer a chunk at a time, and only once the buffered messages
+ * are handled. Messages are JSON or, length prefixed, MessagePack (FMCPBinaryCodec); a
+ * 'negotiate' command tells a client which encodings it may use and is answered here.
+ *
+ * Commands are submitted to the bridge's dispatcher without waiting for them, up to
+ * MaxInFlight per client. Responses arrive on worker threads in completion order and
+ * are sent from there, tagged with the request's id; a streamed response is several
+ * messages with the same id. They queue in a byte buffer; once
+ * it holds MaxOutboundBytes no more messages are handled until the client reads, and a
+ * client whose responses stop moving altogether is disconnected.
+ */
+class FMCPClientConnection : public FRunnable, public TSharedFromThis<FMCPClientConnection, ESPMode::ThreadSafe>
+{
+public:
+	/** Takes ownership of the accepted socket */
+	FMCPClientConnection(UEpicUnrealMCPBridge* InBridge, FSocket* InSocket, int32 InClientId);
+	virtual ~FMCPClientConnection();
+
+	bool Start();
+
+	/** Stop the thread and wait for it */
+	void Shutdown();
+
+	bool IsFinished() const { return bFinished; }
+	int32 GetClientId() const { return ClientId; }
+
+	// FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	static constexpr int32 MaxOutboundBytes = 8 * 1024 * 1024;
+	static constexpr int32 MaxInFlight = 64;
+
+private:
+	void ProcessMessage(const FMCPMessage& Message);
+
+	/** Recv the next chunk the socket has, false once the client is gone */
+	bool ReceivePending();
+
+	/** Any thread, queue a response and send what the socket takes. CommandType, if set, gets the serialization time */
+	void PostResponse(const TSharedRef<FJsonObject>& Response, EMCPFraming Framing, const FString& CommandType = FString());
+
+	/** Send as much of the queued responses as the socket takes without blocking, caller holds OutboundLock */
+	bool FlushOutbound();
+
+	bool HasOutbound() const { return OutboundOffset < Outbound.Num(); }
+	bool IsOutboundFull() const { return Outbound.Num() - OutboundOffset >= MaxOutboundBytes; }
+
+	UEpicUnrealMCPBridge* Bridge;
+	FSocket* Socket;
+	FRunnableThread* Thread = nullptr;
+	int32 ClientId;
+
+	FMCPMessageFramer Framer;
+	TArray<uint8> ReceiveBuffer;
+
+	/** Guards the outbound queue and sending, responses are posted from worker threads */
+	FCriticalSection OutboundLock;
+	TArray<uint8> Outbound;
+	int32 OutboundOffset = 0;
+	double LastSendSeconds = 0.0;
+
+	/** Commands submitted and not answered yet */
+	TAtomic<int32> NumInFlight;
+
+	/** Wakes the thread when a response arrives while it waits for in-flight commands */
+	FEvent* ResponseEvent = nullptr;
+
+	FThreadSafeBool bRunning;
+	FThreadSafeBool bFinished;
+	FThreadSafeBool bSendFailed;
+};
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/ThreadSafeBool.h"
+
+class AActor;
+
+/** Makes a streamed response one chunk per call, game thread only. Returns false with the last chunk */
+using FMCPChunkProducer = TFunction<bool(TSharedPtr<FJsonObject>& OutChunk)>;
+
+/** What became of a streamed chunk handed to a submitter */
+enum class EMCPChunkResult : uint8
+{
+	/** Queued for sending, the next one may be made */
+	Accepted,
+
+	/** Not taken because the reader is behind, offer the same chunk again later */
+	NotYet,
+
+	/** Nobody is left to read the stream, stop it */
+	Closed
+};
+
+/**
+ * One command on its way to the game thread
+ */
+struct FMCPCommandRequest
+{
+	FString CommandType;
+	TSharedPtr<FJsonObject> Params;
+
+	/** Client supplied id, echoed in the response so out of order responses can be matched */
+	TSharedPtr<FJsonValue> RequestId;
+
+	/** Receives the response on a worker thread, or on the submitting thread for cached answers */
+	TFunction<void(const TSharedRef<FJsonObject>& Response)> OnComplete;
+
+	/**
+	 * Set by submitters that can take a response in several messages. Commands that stream
+	 * pass every chunk but the last here, in order, and the last one to OnComplete.
+	 * NotYet holds the stream on this chunk until it is accepted, Closed stops it.
+	 */
+	TFunction<EMCPChunkResult(const TSharedRef<FJsonObject>& Chunk)> OnChunk;
+
+	/** Set by Submit, for the queue wait in FMCPServerStats */
+	double SubmitSeconds = 0.0;
+};
+
+/**
+ * Runs MCP commands on the game thread without blocking the threads that submit them.
+ *
+ * Connections submit requests and go straight back to reading their socket. Requests
+ * wait in a bounded queue that the game thread drains from a core ticker, up to a time
+ * budget per frame, so a burst of commands cannot stall the editor and a slow command
+ * only delays the commands queued behind it, not other clients' reads and cached answers.
+ * Completions are handed to a worker thread, which serializes and sends the response,
+ * so responses go out in completion order rather than request order.
+ *
+ * ping and server_stats are answered on the submitting thread, and get_actors_in_level
+ * is answered from the last result while nothing in the level has changed since and no
+ * command that could change it is waiting, so a client reads its own writes. Every
+ * command is counted and timed in FMCPServerStats.
+ *
+ * Commands the stream function takes on are answered a chunk at a time instead, one chunk
+ * per stream per frame. The next chunk is only made once the connection has accepted the
+ * previous one, which it does not while its outbound buffer is full, so a stream holds one
+ * chunk in memory however large the whole answer and however slowly the client reads.
+ */
+class UNREALMCP_API FMCPCommandDispatcher
+{
+public:
+	using FExecuteFunction = TFunction<TSharedRef<FJsonObject>(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)>;
+
+	/** A producer for commands to stream, unset for commands that are executed as usual */
+	using FStreamFunction = TFunction<FMCPChunkProducer(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)>;
+
+	explicit FMCPCommandDispatcher(FExecuteFunction InExecute, FStreamFunction InStream = nullptr);
+	~FMCPCommandDispatcher();
+
+	/** Game thread, starts draining the queue and watching the level */
+	void Start();
+
+	/** Game thread, answers everything still queued with an error, and everything submitted after */
+	void Stop();
+
+	/** Any thread. Every request is answered exactly once, even when it races Stop */
+	void Submit(FMCPCommandRequest&& Request);
+
+	int32 GetNumQueued() const { return NumQueued.Load(); }
+
+	static constexpr int32 MaxQueuedCommands = 1024;
+
+private:
+	bool Tick(float DeltaTime);
+
+	/** Answer without the game thread if possible */
+	bool TryAnswerImmediately(FMCPCommandRequest& Request);
+
+	/** Make the next chunk of every stream whose previous chunk has been accepted */
+	void TickStreams();
+
+	void Complete(FMCPCommandRequest& Request, const TSharedRef<FJsonObject>& Response);
+
+	void MarkActorsChanged();
+	void OnActorChanged(AActor* Actor) { MarkActorsChanged(); }
+
+	FExecuteFunction Execute;
+	FStreamFunction Stream;
+
+	struct FActiveStream
+	{
+		FMCPCommandRequest Request;
+		FMCPChunkProducer Produce;
+
+		/** Game thread time spent making chunks so far */
+		double ExecuteSeconds = 0.0;
+
+		/** The last chunk made, kept until the connection accepts it */
+		TSharedPtr<FJsonObject> HeldChunk;
+
+		/** Shared with the worker passing a chunk on */
+		struct FState
+		{
+			FThreadSafeBool bChunkPending;
+			FThreadSafeBool bChunkAccepted;
+			FThreadSafeBool bCancelled;
+		};
+		TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+	};
+	TArray<FActiveStream> Streams;
+
+	/** Offer a stream's chunk to its submitter on a worker */
+	void SendChunk(FActiveStream& ActiveStream, const TSharedRef<FJsonObject>& Chunk);
+
+	TQueue<FMCPCommandRequest, EQueueMode::Mpsc> Queue;
+	TAtomic<int32> NumQueued;
+
+	/** Queued commands that are not read-only, the cached listing is not answered from while any are waiting */
+	TAtomic<int32> NumWritesQueued;
+
+	TAtomic<bool> bRunning;
+
+	/** Held by Submit from checking bRunning to enqueueing and by Stop to clear it, so nothing is queued after the last drain */
+	FCriticalSection SubmitLock;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle ActorLabelHandle;
+	FDelegateHandle MapChangedHandle;
+	FDelegateHandle UndoRedoHandle;
+
+	/** Last get_actors_in_level result, valid until an actor changes */
+	FCriticalSection SnapshotLock;
+	TSharedPtr<FJsonObject> ActorsSnapshot;
+};
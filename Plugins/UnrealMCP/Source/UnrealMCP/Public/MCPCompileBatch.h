@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UBlueprint;
+
+/**
+ * Defers blueprint compiles while a batch of MCP commands runs.
+ *
+ * Outside a batch RequestCompile compiles straight away, as the commands always did.
+ * While one of these is alive compiles are only recorded, once per blueprint, and run
+ * when the outermost batch ends, so fifty components added to one blueprint cost one
+ * compile instead of fifty. Game thread only.
+ */
+class UNREALMCP_API FMCPCompileBatch
+{
+public:
+	FMCPCompileBatch();
+	~FMCPCompileBatch();
+
+	/** Compile now, or at the end of the batch if one is open */
+	static void RequestCompile(UBlueprint* Blueprint);
+
+	/** Run a deferred compile early, for commands that need the blueprint's class up to date */
+	static void FlushCompile(UBlueprint* Blueprint);
+
+	static bool IsBatching() { return Depth > 0; }
+
+	/** Compiles actually run since startup */
+	static int32 GetNumCompiles() { return NumCompiles; }
+
+	/** Compiles run by this batch when it ended, set by the destructor's flush */
+	int32 GetNumCompiled() const { return NumCompiled; }
+
+	/** Run the deferred compiles without closing the batch */
+	int32 Flush();
+
+private:
+	static void Compile(UBlueprint* Blueprint);
+
+	static int32 Depth;
+	static int32 NumCompiles;
+	static TArray<TWeakObjectPtr<UBlueprint>> Pending;
+
+	int32 NumCompiled = 0;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraphPin.h"
+
+class FJsonObject;
+class FJsonValue;
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UK2Node_Event;
+
+/**
+ * Applies a whole set of nodes and links to one blueprint graph, what patch_blueprint_graph runs.
+ *
+ * Nodes are described by type (event, function, variable_get, variable_set, input_action or
+ * self), a name, an id local to the patch and a position; edges by source and target id and pin
+ * name, where an id may also be the guid of a node already in the graph. Nodes are put in the
+ * graph directly instead of through UEdGraph::AddNode, and each node's pins are mapped by name
+ * once, so no pin is found by scanning. The graph is told about the change once at the end and
+ * the blueprint is marked modified once. Entries that fail are reported and skipped, the rest
+ * still go in. Game thread only.
+ */
+class UNREALMCP_API FMCPGraphPatch
+{
+public:
+    FMCPGraphPatch(UBlueprint* InBlueprint, UEdGraph* InGraph);
+
+    /** Create the nodes, then make the links. Returns the patch ids and guids of the nodes, counts and errors */
+    TSharedPtr<FJsonObject> Apply(const TArray<TSharedPtr<FJsonValue>>& NodeDescs, const TArray<TSharedPtr<FJsonValue>>& EdgeDescs);
+
+private:
+    /** A node the patch created or refers to, with its pins by name */
+    struct FPatchNode
+    {
+        UEdGraphNode* Node = nullptr;
+        TMap<FName, UEdGraphPin*> Inputs;
+        TMap<FName, UEdGraphPin*> Outputs;
+    };
+
+    using FMakeNodeFunction = UEdGraphNode* (FMCPGraphPatch::*)(const FJsonObject& Desc, const FString& Name, FString& OutError);
+
+    UEdGraphNode* MakeEventNode(const FJsonObject& Desc, const FString& Name, FString& OutError);
+    UEdGraphNode* MakeFunctionNode(const FJsonObject& Desc, const FString& Name, FString& OutError);
+    UEdGraphNode* MakeVariableGetNode(const FJsonObject& Desc, const FString& Name, FString& OutError);
+    UEdGraphNode* MakeVariableSetNode(const FJsonObject& Desc, const FString& Name, FString& OutError);
+    UEdGraphNode* MakeInputActionNode(const FJsonObject& Desc, const FString& Name, FString& OutError);
+    UEdGraphNode* MakeSelfNode(const FJsonObject& Desc, const FString& Name, FString& OutError);
+
+    /** Into the graph without notifying it, then pins allocated and mapped */
+    FPatchNode& Place(UEdGraphNode* Node, const FString& Id, const FVector2D& Position);
+
+    static void MapPins(FPatchNode& PatchNode);
+
+    /** A node of this patch by id, or one already in the graph by guid */
+    FPatchNode* FindNode(const FString& Id);
+
+    /** By name in the given direction, or a variable getter's value for any output name as FindPin does */
+    static UEdGraphPin* FindPin(const FPatchNode& PatchNode, const FString& PinName, EEdGraphPinDirection Direction);
+
+    /** Link two pins if the schema allows it, breaking the links it says have to go */
+    bool Connect(UEdGraphPin* SourcePin, UEdGraphPin* TargetPin, FString& OutError);
+
+    UClass* FindClass(const FString& ClassName);
+
+    UBlueprint* Blueprint;
+    UEdGraph* Graph;
+
+    TMap<FString, FPatchNode> Nodes;
+
+    /** What was in the graph before the patch, from one pass over it. Pins are mapped on first use */
+    TMap<FGuid, UEdGraphNode*> ExistingByGuid;
+    TMap<FGuid, FPatchNode> ExistingNodes;
+    TMap<FName, UK2Node_Event*> Events;
+
+    TMap<FString, UClass*> Classes;
+    TArray<UEdGraphNode*> Created;
+    bool bStructural = false;
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * How a message was delimited on the wire. Responses go back the way the request came.
+ */
+enum class EMCPFraming : uint8
+{
+	/** A bare JSON document, optionally followed by a newline */
+	Json,
+	/** A 4 byte big-endian length, then that many bytes of UTF-8 JSON */
+	LengthPrefixed,
+	/** A 4 byte big-endian length, then that many bytes of MessagePack, see FMCPBinaryCodec */
+	MessagePack
+};
+
+struct FMCPMessage
+{
+	/** The JSON text, empty for MessagePack */
+	FString Text;
+
+	/** The MessagePack payload, empty for JSON */
+	TArray<uint8> Bytes;
+
+	EMCPFraming Framing = EMCPFraming::Json;
+};
+
+/**
+ * Splits a TCP byte stream into MCP messages.
+ *
+ * Bytes are appended as they arrive, in pieces of any size, and Next hands out each
+ * message once all of it is buffered. Both framings can be mixed on one stream:
+ * a message starting with a zero byte is length prefixed (a prefix under 16MB always
+ * starts with one, so nothing longer is sent prefixed) and is MessagePack if its payload starts with a map marker, JSON if
+ * it starts with a brace. Anything else is a JSON document found by matching its braces,
+ * so clients that send newline-delimited JSON and clients that send one bare document
+ * per write both work. Text that is not JSON is returned a line at a time, so the
+ * caller can answer it with a parse error instead of dropping the connection.
+ *
+ * The scan resumes where the previous call stopped, so a large message arriving in
+ * many reads is only scanned once.
+ */
+class UNREALMCP_API FMCPMessageFramer
+{
+public:
+	static constexpr int32 DefaultMaxMessageBytes = 16 * 1024 * 1024;
+
+	/** Longest payload a length prefix can carry, a longer one does not start with the zero byte Next looks for */
+	static constexpr int32 MaxPrefixedPayloadBytes = 16 * 1024 * 1024 - 1;
+
+	explicit FMCPMessageFramer(int32 InMaxMessageBytes = DefaultMaxMessageBytes);
+
+	void Append(const uint8* Data, int32 NumBytes);
+
+	/** Take the next complete message, false if more bytes are needed or the stream is broken */
+	bool Next(FMCPMessage& OutMessage);
+
+	/** A message went over the size limit, the stream cannot be resynchronized */
+	bool HasError() const { return bError; }
+
+	/** Bytes received but not yet handed out */
+	int32 GetBufferedBytes() const { return Buffer.Num() - ReadOffset; }
+
+	/** Append a message to an outgoing byte buffer, prefixed payloads must fit MaxPrefixedPayloadBytes */
+	static void Frame(const FString& Text, EMCPFraming Framing, TArray<uint8>& OutBytes);
+
+	/** Append an encoded MessagePack message to an outgoing byte buffer, at most MaxPrefixedPayloadBytes */
+	static void FrameBinary(const TArray<uint8>& Payload, TArray<uint8>& OutBytes);
+
+private:
+	void Consume(int32 EndOffset, EMCPFraming Framing, int32 HeaderBytes, FMCPMessage& OutMessage);
+	void ResetScan();
+
+	TArray<uint8> Buffer;
+
+	/** Start of the message being assembled */
+	int32 ReadOffset = 0;
+
+	/** Where the JSON scan of that message stopped */
+	int32 ScanOffset = 0;
+	int32 Depth = 0;
+	bool bInString = false;
+	bool bEscaped = false;
+
+	int32 MaxMessageBytes;
+	bool bError = false;
+};
@@ -2,13 +2,16 @@
 
 #include "CoreMinimal.h"
 #include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
 #include "Sockets.h"
 #include "Interfaces/IPv4/IPv4Address.h"
 
 class UEpicUnrealMCPBridge;
+class FMCPClientConnection;
 
 /**
  * Runnable class for the MCP server thread
+ * Waits on the listener for connections and hands each client to its own FMCPClientConnection
  */
 class FMCPServerRunnable : public FRunnable
 {
@@ -22,13 +25,20 @@ public:
 	virtual void Stop() override;
 	virtual void Exit() override;
 
+	static constexpr int32 MaxClients = 32;
+	static constexpr int32 ListenBacklog = MaxClients;
+
 protected:
-	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
-	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
+	void AcceptClient();
+
+	/** Delete connections whose client has gone */
+	void ReapClients();
 
 private:
 	UEpicUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
-	TSharedPtr<FSocket> ClientSocket;
-	bool bRunning;
-}; 
\ No newline at end of file
+	/** Shared, responses finishing on worker threads hold on to their connection weakly */
+	TArray<TSharedPtr<FMCPClientConnection, ESPMode::ThreadSafe>> Clients;
+	int32 NextClientId;
+	FThreadSafeBool bRunning;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+class FJsonObject;
+
+UNREALMCP_API DECLARE_LOG_CATEGORY_EXTERN(LogMCPServer, Log, All);
+
+/**
+ * Latency histogram in the HDR style: linear sub-buckets within each power of two of
+ * microseconds, so every recorded value is kept to within about 3% from a microsecond
+ * up to hours, in fixed memory and with a constant time record. Not thread safe.
+ */
+class UNREALMCP_API FMCPLatencyHistogram
+{
+public:
+	FMCPLatencyHistogram() { Reset(); }
+
+	void Record(double Seconds);
+	void Reset();
+
+	int64 GetCount() const { return Count; }
+	double GetMeanMs() const { return Count > 0 ? double(TotalMicros) / Count / 1000.0 : 0.0; }
+	double GetMaxMs() const { return MaxMicros / 1000.0; }
+
+	/** The value below which Percentile (0-100) of the samples fall */
+	double GetPercentileMs(double Percentile) const;
+
+	/** count, mean, p50, p90, p99, p999 and max, in milliseconds */
+	TSharedRef<FJsonObject> ToJson() const;
+
+private:
+	/** 64 sub-buckets, the upper 32 of which repeat for each further power of two */
+	static constexpr int32 SubBucketBits = 6;
+	static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr int32 SubBucketHalf = SubBucketCount / 2;
+
+	/** Values are clamped to 2^36 microseconds, about 19 hours */
+	static constexpr int32 MaxValueBits = 36;
+	static constexpr int32 NumBuckets = SubBucketCount + (MaxValueBits - SubBucketBits) * SubBucketHalf;
+
+	static int32 GetBucket(uint64 Micros);
+	static uint64 GetBucketMidpoint(int32 Bucket);
+
+	uint32 Counts[NumBuckets];
+	int64 Count;
+	uint64 TotalMicros;
+	uint64 MaxMicros;
+};
+
+/**
+ * Per command counts and latency histograms for the MCP server, from any thread.
+ *
+ * Queue wait is submit to dequeue on the game thread, execution is the handler on the game
+ * thread (summed over every chunk of a streamed answer), and serialization is encoding each
+ * response message on the connection's side. Commands answered without the game thread are
+ * counted but have no queue or execution samples.
+ */
+class UNREALMCP_API FMCPServerStats
+{
+public:
+	static FMCPServerStats& Get();
+
+	void RecordQueueWait(const FString& CommandType, double Seconds);
+	void RecordExecute(const FString& CommandType, double Seconds);
+	void RecordSerialize(const FString& CommandType, double Seconds);
+	void RecordCompleted(const FString& CommandType, bool bSucceeded);
+
+	void Reset();
+
+	/** Per command and overall stats, what server_stats returns */
+	TSharedRef<FJsonObject> ToJson() const;
+
+	/** One line per command, slowest p99 execution first */
+	void LogSummary() const;
+
+private:
+	struct FCommandStats
+	{
+		int64 Count = 0;
+		int64 Errors = 0;
+		FMCPLatencyHistogram QueueWait;
+		FMCPLatencyHistogram Execute;
+		FMCPLatencyHistogram Serialize;
+	};
+
+	FMCPServerStats();
+
+	/** Caller holds Lock */
+	FCommandStats& FindOrAdd(const FString& CommandType);
+
+	static TSharedRef<FJsonObject> StatsToJson(const FCommandStats& Stats);
+
+	mutable FCriticalSection Lock;
+	TMap<FString, TUniquePtr<FCommandStats>> Commands;
+	FCommandStats Total;
+
+	/** Since startup or the last reset */
+	double StartSeconds;
+};
+
+/**
+ * Keeps per-message logging affordable: one call in UnrealMCP.LogSampleEvery is logged when
+ * sampling, and no call site logs more than UnrealMCP.LogMaxPerSecond lines a second. Each
+ * call site of the macros below has its own sampler.
+ */
+class UNREALMCP_API FMCPLogSampler
+{
+public:
+	bool ShouldLog(bool bSample);
+
+private:
+	FCriticalSection Lock;
+	uint64 NumCalls = 0;
+	double WindowStart = 0.0;
+	int32 NumInWindow = 0;
+};
+
+/** Per message traces, sampled and rate limited */
+#define UE_LOG_MCP_SAMPLED(Verbosity, Format, ...) \
+	do \
+	{ \
+		static FMCPLogSampler MCPLogSampler; \
+		if (UE_LOG_ACTIVE(LogMCPServer, Verbosity) && MCPLogSampler.ShouldLog(true)) \
+		{ \
+			UE_LOG(LogMCPServer, Verbosity, Format, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+/** Per message problems, every one logged up to the rate limit */
+#define UE_LOG_MCP_LIMITED(Verbosity, Format, ...) \
+	do \
+	{ \
+		static FMCPLogSampler MCPLogSampler; \
+		if (UE_LOG_ACTIVE(LogMCPServer, Verbosity) && MCPLogSampler.ShouldLog(false)) \
+		{ \
+			UE_LOG(LogMCPServer, Verbosity, Format, ##__VA_ARGS__); \
+		} \
+	} while (0)
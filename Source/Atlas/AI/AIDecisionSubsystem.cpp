@@ -0,0 +1,154 @@
+#include "AIDecisionSubsystem.h"
+#include "EnemyAIController.h"
+#include "../Core/AtlasStats.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+static TAutoConsoleVariable<float> CVarAIThinkBudgetMs(
+	TEXT("Atlas.AI.ThinkBudgetMs"),
+	0.25f,
+	TEXT("Game thread time per frame the AI decision scheduler may spend on enemy thinks. At least one think always runs."),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarAIThinkInterval(
+	TEXT("Atlas.AI.ThinkInterval"),
+	0.15f,
+	TEXT("Seconds between two thinks of the same enemy before reaction time scaling."),
+	ECVF_Default
+);
+
+namespace
+{
+	void AddStatSample(TArray<float>& Samples, float Value)
+	{
+		if (Samples.Num() >= UAIDecisionSubsystem::MaxStatSamples)
+		{
+			// Drop the oldest half instead of shifting on every sample
+			Samples.RemoveAt(0, Samples.Num() / 2, EAllowShrinking::No);
+		}
+		Samples.Add(Value);
+	}
+}
+
+void FAIDecisionStats::Reset()
+{
+	ThinkTimesUs.Reset();
+	DecisionLatenciesMs.Reset();
+	FrameTimesMs.Reset();
+	TotalThinks = 0;
+	FramesOverBudget = 0;
+}
+
+void UAIDecisionSubsystem::Deinitialize()
+{
+	Controllers.Empty();
+	Stats.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAIDecisionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAIDecisionSubsystem::Tick(float DeltaTime)
+{
+	SchedulerTime += DeltaTime;
+
+	if (Controllers.Num() == 0)
+	{
+		return;
+	}
+
+	ATLAS_SCOPE_CYCLE_COUNTER(AIDecisions, "Atlas.AIDecisions.Tick");
+
+	const double BudgetSeconds = FMath::Max(CVarAIThinkBudgetMs.GetValueOnGameThread(), 0.0f) / 1000.0;
+	const float ThinkInterval = FMath::Max(CVarAIThinkInterval.GetValueOnGameThread(), 0.0f);
+
+	const double FrameStart = FPlatformTime::Seconds();
+	int32 Visited = 0;
+	int32 Thinks = 0;
+
+	while (Visited < Controllers.Num())
+	{
+		if (Cursor >= Controllers.Num())
+		{
+			Cursor = 0;
+		}
+
+		AEnemyAIController* Controller = Controllers[Cursor].Get();
+		if (!IsValid(Controller))
+		{
+			// Swaps the last controller into the cursor slot, so don't advance
+			Controllers.RemoveAtSwap(Cursor);
+			continue;
+		}
+
+		++Visited;
+
+		const double DueTime = Controller->GetNextThinkTime();
+		if (SchedulerTime < DueTime)
+		{
+			++Cursor;
+			continue;
+		}
+
+		// Always let one think through so a tiny budget can't starve everyone
+		if (Thinks > 0 && FPlatformTime::Seconds() - FrameStart >= BudgetSeconds)
+		{
+			++Stats.FramesOverBudget;
+			break;
+		}
+
+		const double ThinkStart = FPlatformTime::Seconds();
+		Controller->Think(SchedulerTime, ThinkInterval);
+		const double ThinkEnd = FPlatformTime::Seconds();
+
+		AddStatSample(Stats.ThinkTimesUs, static_cast<float>((ThinkEnd - ThinkStart) * 1000000.0));
+		AddStatSample(Stats.DecisionLatenciesMs, static_cast<float>((SchedulerTime - DueTime) * 1000.0));
+		++Stats.TotalThinks;
+		++Thinks;
+		++Cursor;
+	}
+
+	if (Thinks > 0)
+	{
+		AddStatSample(Stats.FrameTimesMs, static_cast<float>((FPlatformTime::Seconds() - FrameStart) * 1000.0));
+	}
+}
+
+TStatId UAIDecisionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIDecisionSubsystem, STATGROUP_Tickables);
+}
+
+UAIDecisionSubsystem* UAIDecisionSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<UAIDecisionSubsystem>() : nullptr;
+}
+
+void UAIDecisionSubsystem::RegisterController(AEnemyAIController* Controller)
+{
+	if (!Controller)
+	{
+		return;
+	}
+
+	// Newly registered controllers think on the next pass
+	Controller->SetNextThinkTime(SchedulerTime);
+	Controllers.AddUnique(Controller);
+}
+
+void UAIDecisionSubsystem::UnregisterController(AEnemyAIController* Controller)
+{
+	Controllers.RemoveSwap(Controller);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AIDecisionSubsystem.generated.h"
+
+class AEnemyAIController;
+
+/**
+ * Rolling think statistics, used by Atlas.Bench.AIDecisions and stat displays
+ */
+struct ATLAS_API FAIDecisionStats
+{
+	/** Wall time of individual thinks in microseconds */
+	TArray<float> ThinkTimesUs;
+
+	/** Scheduler time between a controller becoming due and actually thinking, in milliseconds */
+	TArray<float> DecisionLatenciesMs;
+
+	/** Wall time of whole scheduler frames in milliseconds */
+	TArray<float> FrameTimesMs;
+
+	int32 TotalThinks = 0;
+	int32 FramesOverBudget = 0;
+
+	void Reset();
+};
+
+/**
+ * Time-slices enemy "think" updates across frames.
+ *
+ * Controllers register on possess. Each frame the scheduler walks the list round-robin
+ * from where it stopped last frame and lets every controller that is due think, until
+ * Atlas.AI.ThinkBudgetMs is spent. A controller is due again Atlas.AI.ThinkInterval
+ * seconds after its last think, scaled by its difficulty reaction time.
+ */
+UCLASS()
+class ATLAS_API UAIDecisionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UAIDecisionSubsystem* Get(const UObject* WorldContextObject);
+
+	void RegisterController(AEnemyAIController* Controller);
+	void UnregisterController(AEnemyAIController* Controller);
+	int32 GetNumControllers() const { return Controllers.Num(); }
+
+	/** Scheduler clock, advanced by Tick so thinks can be simulated outside of world time */
+	double GetSchedulerTime() const { return SchedulerTime; }
+
+	const FAIDecisionStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats.Reset(); }
+
+	/** Number of samples kept per stats array */
+	static constexpr int32 MaxStatSamples = 4096;
+
+private:
+	TArray<TWeakObjectPtr<AEnemyAIController>> Controllers;
+
+	/** Where the next frame's round-robin pass starts */
+	int32 Cursor = 0;
+
+	double SchedulerTime = 0.0;
+
+	FAIDecisionStats Stats;
+};
@@ -1,10 +1,22 @@
 #include "EnemyAIController.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Enum.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Float.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Name.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "Perception/AISenseConfig_Sight.h"
+#include "Perception/AISense_Sight.h"
+#include "AIDecisionSubsystem.h"
+#include "EnemyPoolSubsystem.h"
 #include "../Characters/EnemyCharacter.h"
 #include "../Characters/PlayerCharacter.h"
+#include "../Components/RoomPerceptionComponent.h"
+#include "../Rooms/RoomBase.h"
+#include "../UI/EnemyBarSubsystem.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -20,6 +32,9 @@ AEnemyAIController::AEnemyAIController()
 
 	bWantsPlayerState = true;
 	bSetControlRotationFromPawnOrientation = false;
+
+	DifficultyComponent = nullptr;
+	PerceptionHub = nullptr;
 }
 
 void AEnemyAIController::SetupPerceptionSystem()
@@ -56,19 +71,62 @@ void AEnemyAIController::OnPossess(APawn* InPawn)
 
 	if (InPawn)
 	{
+		DifficultyComponent = InPawn->FindComponentByClass<UAIDifficultyComponent>();
+
+		// A pooled controller possesses again, start from the same state as a new one
+		SoulAttackReadyTime = 0.0;
+		LostTargetTime = -1.0;
+		NextThinkTime = 0.0;
+		ClearFocus(EAIFocusPriority::Gameplay);
+
 		InitializeBlackboardData();
 
 		if (BehaviorTree)
 		{
 			RunBehaviorTree(BehaviorTree);
+			// RunBehaviorTree may have swapped in the tree's own blackboard asset
+			CacheBlackboardKeys();
+		}
+
+		if (UAIDecisionSubsystem* Decisions = UAIDecisionSubsystem::Get(this))
+		{
+			Decisions->RegisterController(this);
+		}
+
+		if (UEnemyBarSubsystem* EnemyBars = UEnemyBarSubsystem::Get(this))
+		{
+			EnemyBars->RegisterEnemy(Cast<AGameCharacterBase>(InPawn));
+		}
+
+		// A dormant enemy's location says nothing about its room, Wake possesses it again once it is placed
+		if (UEnemyPoolSubsystem::IsDormant(InPawn))
+		{
+			return;
+		}
+
+		if (ARoomBase* Room = ARoomBase::FindRoomContaining(this, InPawn->GetActorLocation()))
+		{
+			SetPerceptionHub(Room->GetPerceptionHub());
 		}
 	}
 }
 
 void AEnemyAIController::OnUnPossess()
 {
+	if (UEnemyBarSubsystem* EnemyBars = UEnemyBarSubsystem::Get(this))
+	{
+		EnemyBars->UnregisterEnemy(Cast<AGameCharacterBase>(GetPawn()));
+	}
+
 	Super::OnUnPossess();
 
+	if (UAIDecisionSubsystem* Decisions = UAIDecisionSubsystem::Get(this))
+	{
+		Decisions->UnregisterController(this);
+	}
+	SetPerceptionHub(nullptr);
+	DifficultyComponent = nullptr;
+
 	if (BehaviorTree)
 	{
 		UBehaviorTreeComponent* BTComponent = Cast<UBehaviorTreeComponent>(BrainComponent);
@@ -79,84 +137,205 @@ void AEnemyAIController::OnUnPossess()
 	}
 }
 
+void AEnemyAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAIDecisionSubsystem* Decisions = UAIDecisionSubsystem::Get(this))
+	{
+		Decisions->UnregisterController(this);
+	}
+	SetPerceptionHub(nullptr);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AEnemyAIController::InitializeBlackboardData()
 {
 	if (BlackboardData && Blackboard)
 	{
 		Blackboard->InitializeBlackboard(*BlackboardData);
+		CacheBlackboardKeys();
 		
-		Blackboard->SetValueAsFloat(FName("AttackRange"), AttackRange);
-		Blackboard->SetValueAsFloat(FName("DefendRange"), DefendRange);
-		Blackboard->SetValueAsFloat(FName("CatchSpecialRange"), CatchSpecialRange);
-		Blackboard->SetValueAsBool(FName("CanUseSoulAttack"), true);
-		Blackboard->SetValueAsBool(FName("IsInCombat"), false);
-		Blackboard->SetValueAsObject(FName("SelfActor"), GetPawn());
+		Blackboard->SetValue<UBlackboardKeyType_Float>(BlackboardKeys.AttackRange, AttackRange);
+		Blackboard->SetValue<UBlackboardKeyType_Float>(BlackboardKeys.DefendRange, DefendRange);
+		Blackboard->SetValue<UBlackboardKeyType_Float>(BlackboardKeys.CatchSpecialRange, CatchSpecialRange);
+		Blackboard->SetValue<UBlackboardKeyType_Bool>(BlackboardKeys.CanUseSoulAttack, CanUseSoulAttack());
+		Blackboard->SetValue<UBlackboardKeyType_Bool>(BlackboardKeys.IsInCombat, false);
+		Blackboard->SetValue<UBlackboardKeyType_Object>(BlackboardKeys.SelfActor, GetPawn());
+
+		bSoulAttackReadyOnBlackboard = CanUseSoulAttack();
+	}
+}
+
+void AEnemyAIController::CacheBlackboardKeys()
+{
+	BlackboardKeys = FEnemyBlackboardKeys();
+	if (!Blackboard)
+	{
+		return;
 	}
+
+	// Missing keys stay InvalidKey, SetValue ignores those
+	BlackboardKeys.TargetActor = Blackboard->GetKeyID(FName("TargetActor"));
+	BlackboardKeys.LastKnownLocation = Blackboard->GetKeyID(FName("LastKnownLocation"));
+	BlackboardKeys.IsInCombat = Blackboard->GetKeyID(FName("IsInCombat"));
+	BlackboardKeys.DistanceToTarget = Blackboard->GetKeyID(FName("DistanceToTarget"));
+	BlackboardKeys.AttackRange = Blackboard->GetKeyID(FName("AttackRange"));
+	BlackboardKeys.DefendRange = Blackboard->GetKeyID(FName("DefendRange"));
+	BlackboardKeys.CatchSpecialRange = Blackboard->GetKeyID(FName("CatchSpecialRange"));
+	BlackboardKeys.CanUseSoulAttack = Blackboard->GetKeyID(FName("CanUseSoulAttack"));
+	BlackboardKeys.SelfActor = Blackboard->GetKeyID(FName("SelfActor"));
+	BlackboardKeys.CombatAction = Blackboard->GetKeyID(FName("CombatAction"));
+	BlackboardKeys.CombatActionTag = Blackboard->GetKeyID(FName("CombatActionTag"));
 }
 
 void AEnemyAIController::OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus Stimulus)
 {
-	if (!Actor || !Blackboard)
+	// Sight comes from the room hub while registered with one
+	if (PerceptionHub && Stimulus.Type == UAISense::GetSenseID<UAISense_Sight>())
+	{
+		return;
+	}
+
+	if (!Actor || !Cast<APlayerCharacter>(Actor))
+	{
+		return;
+	}
+
+	UpdateTargetSight(Actor, Stimulus.WasSuccessfullySensed(), Stimulus.StimulusLocation);
+}
+
+void AEnemyAIController::HandleSharedSight(AActor* Target, bool bSensed, const FVector& LastSeenLocation)
+{
+	if (bSensed && !Target)
 	{
 		return;
 	}
 
-	APlayerCharacter* PlayerCharacter = Cast<APlayerCharacter>(Actor);
-	if (!PlayerCharacter)
+	UpdateTargetSight(Target, bSensed, LastSeenLocation);
+}
+
+void AEnemyAIController::UpdateTargetSight(AActor* Actor, bool bSensed, const FVector& StimulusLocation)
+{
+	if (!Blackboard)
 	{
 		return;
 	}
 
-	if (Stimulus.WasSuccessfullySensed())
+	if (bSensed)
 	{
-		Blackboard->SetValueAsObject(FName("TargetActor"), Actor);
-		Blackboard->SetValueAsVector(FName("LastKnownLocation"), Actor->GetActorLocation());
-		Blackboard->SetValueAsBool(FName("IsInCombat"), true);
+		Blackboard->SetValue<UBlackboardKeyType_Object>(BlackboardKeys.TargetActor, Actor);
+		Blackboard->SetValue<UBlackboardKeyType_Vector>(BlackboardKeys.LastKnownLocation, Actor->GetActorLocation());
+		Blackboard->SetValue<UBlackboardKeyType_Bool>(BlackboardKeys.IsInCombat, true);
+		LostTargetTime = -1.0;
 		
-		float Distance = FVector::Dist(GetPawn()->GetActorLocation(), Actor->GetActorLocation());
-		Blackboard->SetValueAsFloat(FName("DistanceToTarget"), Distance);
+		if (APawn* ControlledPawn = GetPawn())
+		{
+			float Distance = FVector::Dist(ControlledPawn->GetActorLocation(), Actor->GetActorLocation());
+			Blackboard->SetValue<UBlackboardKeyType_Float>(BlackboardKeys.DistanceToTarget, Distance);
+		}
 	}
 	else
 	{
-		Blackboard->SetValueAsVector(FName("LastKnownLocation"), Stimulus.StimulusLocation);
+		Blackboard->SetValue<UBlackboardKeyType_Vector>(BlackboardKeys.LastKnownLocation, StimulusLocation);
 		
-		GetWorldTimerManager().SetTimer(
-			LostTargetTimer,
-			[this]()
-			{
-				if (Blackboard && !Blackboard->GetValueAsObject(FName("TargetActor")))
-				{
-					Blackboard->SetValueAsBool(FName("IsInCombat"), false);
-				}
-			},
-			3.0f,
-			false
-		);
+		// Checked on the next think after 3 seconds
+		LostTargetTime = GetWorld()->GetTimeSeconds();
 	}
 }
 
-void AEnemyAIController::StartSoulAttackCooldown()
+void AEnemyAIController::SetPerceptionHub(URoomPerceptionComponent* Hub)
 {
-	bCanUseSoulAttack = false;
-	if (Blackboard)
+	// Enemies with special sight keep their own sense
+	if (Hub == PerceptionHub || (Hub && !bUseRoomPerception))
+	{
+		return;
+	}
+
+	if (IsValid(PerceptionHub))
+	{
+		PerceptionHub->UnregisterController(this);
+	}
+
+	PerceptionHub = Hub;
+
+	if (PerceptionHub)
+	{
+		PerceptionHub->RegisterController(this);
+	}
+
+	// Own sight sense only runs while no hub covers it
+	if (AIPerceptionComponent)
+	{
+		AIPerceptionComponent->SetSenseEnabled(UAISense_Sight::StaticClass(), PerceptionHub == nullptr);
+	}
+}
+
+void AEnemyAIController::Think(double SchedulerTime, float ThinkInterval)
+{
+	APawn* ControlledPawn = GetPawn();
+	if (!ControlledPawn || !Blackboard)
 	{
-		Blackboard->SetValueAsBool(FName("CanUseSoulAttack"), false);
+		NextThinkTime = SchedulerTime + ThinkInterval;
+		return;
+	}
+
+	const double WorldTime = GetWorld()->GetTimeSeconds();
+
+	// Soul attack cooldown is a timestamp, only publish when it flips
+	const bool bSoulAttackReady = CanUseSoulAttack();
+	if (bSoulAttackReady != bSoulAttackReadyOnBlackboard)
+	{
+		Blackboard->SetValue<UBlackboardKeyType_Bool>(BlackboardKeys.CanUseSoulAttack, bSoulAttackReady);
+		bSoulAttackReadyOnBlackboard = bSoulAttackReady;
+	}
+
+	AActor* Target = Cast<AActor>(Blackboard->GetValue<UBlackboardKeyType_Object>(BlackboardKeys.TargetActor));
+
+	if (LostTargetTime >= 0.0 && WorldTime - LostTargetTime >= 3.0)
+	{
+		if (!Target)
+		{
+			Blackboard->SetValue<UBlackboardKeyType_Bool>(BlackboardKeys.IsInCombat, false);
+		}
+		LostTargetTime = -1.0;
 	}
 
-	GetWorldTimerManager().SetTimer(
-		SoulAttackCooldownTimer,
-		this,
-		&AEnemyAIController::ResetSoulAttackCooldown,
-		SoulAttackCooldown,
-		false
-	);
+	FAIDecisionContext Context;
+	Context.bHasTarget = Target != nullptr;
+	Context.AttackRange = AttackRange;
+	Context.bCanUseSoulAttack = bSoulAttackReady;
+
+	if (Target)
+	{
+		Context.DistanceToTarget = FVector::Dist(ControlledPawn->GetActorLocation(), Target->GetActorLocation());
+		Blackboard->SetValue<UBlackboardKeyType_Float>(BlackboardKeys.DistanceToTarget, Context.DistanceToTarget);
+	}
+
+	// Enemies without their own difficulty component score with the default table
+	const UAIDifficultyComponent* Scorer = DifficultyComponent ? DifficultyComponent : GetDefault<UAIDifficultyComponent>();
+
+	float Score = 0.0f;
+	CombatAction = Scorer->ChooseCombatAction(Context, Score);
+
+	Blackboard->SetValue<UBlackboardKeyType_Enum>(BlackboardKeys.CombatAction, static_cast<uint8>(CombatAction));
+	Blackboard->SetValue<UBlackboardKeyType_Name>(BlackboardKeys.CombatActionTag, UAIDifficultyComponent::GetActionTag(CombatAction).GetTagName());
+
+	// Faster reacting enemies think more often
+	NextThinkTime = SchedulerTime + ThinkInterval * Scorer->GetReactionTimeModifier();
 }
 
-void AEnemyAIController::ResetSoulAttackCooldown()
+bool AEnemyAIController::CanUseSoulAttack() const
 {
-	bCanUseSoulAttack = true;
+	const UWorld* World = GetWorld();
+	return !World || World->GetTimeSeconds() >= SoulAttackReadyTime;
+}
+
+void AEnemyAIController::StartSoulAttackCooldown()
+{
+	SoulAttackReadyTime = GetWorld()->GetTimeSeconds() + SoulAttackCooldown;
+	bSoulAttackReadyOnBlackboard = false;
 	if (Blackboard)
 	{
-		Blackboard->SetValueAsBool(FName("CanUseSoulAttack"), true);
+		Blackboard->SetValue<UBlackboardKeyType_Bool>(BlackboardKeys.CanUseSoulAttack, false);
 	}
-}
\ No newline at end of file
+}
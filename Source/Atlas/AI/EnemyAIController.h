@@ -3,12 +3,16 @@
 #include "CoreMinimal.h"
 #include "AIController.h"
 #include "Perception/AIPerceptionTypes.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"
+#include "../Components/AIDifficultyComponent.h"
 #include "EnemyAIController.generated.h"
 
 class UAISenseConfig_Sight;
 class UAIPerceptionComponent;
 class UBehaviorTree;
 class UBlackboardData;
+class UAIDifficultyComponent;
+class URoomPerceptionComponent;
 
 UCLASS()
 class ATLAS_API AEnemyAIController : public AAIController
@@ -22,6 +26,7 @@ protected:
 	virtual void BeginPlay() override;
 	virtual void OnPossess(APawn* InPawn) override;
 	virtual void OnUnPossess() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(EditDefaultsOnly, Category = "AI")
 	UBehaviorTree* BehaviorTree;
@@ -35,6 +40,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "AI")
 	UAISenseConfig_Sight* SightConfig;
 
+	/** Let the room's perception hub handle sight, keeping the perception component for other senses */
+	UPROPERTY(EditDefaultsOnly, Category = "AI")
+	bool bUseRoomPerception = true;
+
 	UPROPERTY(EditDefaultsOnly, Category = "AI|Combat")
 	float AttackRange = 200.0f;
 
@@ -57,13 +66,49 @@ private:
 	void SetupPerceptionSystem();
 	void InitializeBlackboardData();
 
-	FTimerHandle SoulAttackCooldownTimer;
-	FTimerHandle LostTargetTimer;
-	bool bCanUseSoulAttack = true;
+	/** Write a sight gain or loss of the target to the blackboard */
+	void UpdateTargetSight(AActor* Actor, bool bSensed, const FVector& StimulusLocation);
+
+	/** Blackboard key IDs resolved once per blackboard instead of by name on every write */
+	struct FEnemyBlackboardKeys
+	{
+		FBlackboard::FKey TargetActor = FBlackboard::InvalidKey;
+		FBlackboard::FKey LastKnownLocation = FBlackboard::InvalidKey;
+		FBlackboard::FKey IsInCombat = FBlackboard::InvalidKey;
+		FBlackboard::FKey DistanceToTarget = FBlackboard::InvalidKey;
+		FBlackboard::FKey AttackRange = FBlackboard::InvalidKey;
+		FBlackboard::FKey DefendRange = FBlackboard::InvalidKey;
+		FBlackboard::FKey CatchSpecialRange = FBlackboard::InvalidKey;
+		FBlackboard::FKey CanUseSoulAttack = FBlackboard::InvalidKey;
+		FBlackboard::FKey SelfActor = FBlackboard::InvalidKey;
+		FBlackboard::FKey CombatAction = FBlackboard::InvalidKey;
+		FBlackboard::FKey CombatActionTag = FBlackboard::InvalidKey;
+	};
+
+	FEnemyBlackboardKeys BlackboardKeys;
+
+	UPROPERTY()
+	UAIDifficultyComponent* DifficultyComponent;
+
+	/** Room hub providing sight, null when the perception component's own sight sense is used */
+	UPROPERTY()
+	URoomPerceptionComponent* PerceptionHub;
+
+	/** World time the soul attack is available again */
+	double SoulAttackReadyTime = 0.0;
+
+	/** Last soul attack availability written to the blackboard */
+	bool bSoulAttackReadyOnBlackboard = true;
+
+	/** World time the target was lost, combat ends if no target is set 3 seconds later */
+	double LostTargetTime = -1.0;
+
+	/** Scheduler time this controller is due to think again */
+	double NextThinkTime = 0.0;
 
 public:
 	UFUNCTION(BlueprintCallable, Category = "AI|Combat")
-	bool CanUseSoulAttack() const { return bCanUseSoulAttack; }
+	bool CanUseSoulAttack() const;
 
 	UFUNCTION(BlueprintCallable, Category = "AI|Combat")
 	void StartSoulAttackCooldown();
@@ -77,6 +122,36 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AI|Combat")
 	float GetCatchSpecialRange() const { return CatchSpecialRange; }
 
+	/** Last action chosen by the decision scheduler */
+	UFUNCTION(BlueprintCallable, Category = "AI|Combat")
+	EAICombatAction GetCombatAction() const { return CombatAction; }
+
+	/**
+	 * Gather target state, score actions and publish the result to the blackboard.
+	 * Called by UAIDecisionSubsystem when this controller is due.
+	 * @param SchedulerTime Current scheduler clock
+	 * @param ThinkInterval Base seconds until the next think
+	 */
+	void Think(double SchedulerTime, float ThinkInterval);
+
+	/** Re-resolve blackboard key IDs, needed whenever the blackboard asset is swapped via UseBlackboard */
+	void CacheBlackboardKeys();
+
+	/**
+	 * Move sight to a room perception hub, or back to this controller's own sight sense when null
+	 * @param Hub The hub to register with
+	 */
+	void SetPerceptionHub(URoomPerceptionComponent* Hub);
+
+	URoomPerceptionComponent* GetPerceptionHub() const { return PerceptionHub; }
+	const UAISenseConfig_Sight* GetSightConfig() const { return SightConfig; }
+
+	/** Sight change published by the room perception hub */
+	void HandleSharedSight(AActor* Target, bool bSensed, const FVector& LastSeenLocation);
+
+	double GetNextThinkTime() const { return NextThinkTime; }
+	void SetNextThinkTime(double Time) { NextThinkTime = Time; }
+
 private:
-	void ResetSoulAttackCooldown();
+	EAICombatAction CombatAction = EAICombatAction::Reposition;
 };
\ No newline at end of file
@@ -0,0 +1,370 @@
+#include "EnemyPoolSubsystem.h"
+#include "../Characters/GameCharacterBase.h"
+#include "../Components/HealthComponent.h"
+#include "../Components/ActionManagerComponent.h"
+#include "../Components/AIDifficultyComponent.h"
+#include "../Core/AtlasStats.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEnemyPoolEnabled(
+	TEXT("Atlas.EnemyPool.Enabled"),
+	1,
+	TEXT("1 to reuse pooled enemies for room spawns, 0 to spawn and destroy every enemy."),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<int32> CVarEnemyPoolMaxDormant(
+	TEXT("Atlas.EnemyPool.MaxDormantPerClass"),
+	4,
+	TEXT("Dormant enemies kept per enemy class, released enemies beyond this are destroyed."),
+	ECVF_Default
+);
+
+namespace
+{
+	// Out of sight below the level. Rooms only test XY, so this alone keeps nothing out of
+	// them, dormant enemies skip the room lookups instead (see IsDormant).
+	const FVector DormantLocation(0.0f, 0.0f, -50000.0f);
+
+	template <typename DelegateType>
+	void RemoveBindingsOutside(DelegateType& Delegate, const AActor* Owner)
+	{
+		for (UObject* Bound : Delegate.GetAllObjects())
+		{
+			if (Bound && Bound != Owner && !Bound->IsIn(Owner))
+			{
+				Delegate.RemoveAll(Bound);
+			}
+		}
+	}
+}
+
+void UEnemyPoolSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		for (const auto& Pending : PendingReleases)
+		{
+			FTimerHandle Handle = Pending.Value;
+			World->GetTimerManager().ClearTimer(Handle);
+		}
+	}
+
+	PendingReleases.Empty();
+	Buckets.Empty();
+	Controllers.Empty();
+	Stats.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UEnemyPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UEnemyPoolSubsystem* UEnemyPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<UEnemyPoolSubsystem>() : nullptr;
+}
+
+AGameCharacterBase* UEnemyPoolSubsystem::AcquireEnemy(const UObject* WorldContextObject, TSubclassOf<AGameCharacterBase> EnemyClass, const FTransform& SpawnTransform)
+{
+	if (UEnemyPoolSubsystem* Pool = Get(WorldContextObject))
+	{
+		return Pool->Acquire(EnemyClass, SpawnTransform);
+	}
+
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World || !EnemyClass)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	return World->SpawnActor<AGameCharacterBase>(EnemyClass, SpawnTransform, SpawnParams);
+}
+
+void UEnemyPoolSubsystem::ReleaseEnemy(AActor* Enemy)
+{
+	if (UEnemyPoolSubsystem* Pool = Get(Enemy))
+	{
+		Pool->Release(Enemy);
+	}
+	else if (IsValid(Enemy))
+	{
+		Enemy->Destroy();
+	}
+}
+
+void UEnemyPoolSubsystem::Prewarm(TSubclassOf<AGameCharacterBase> EnemyClass, int32 Count)
+{
+	if (!EnemyClass || CVarEnemyPoolEnabled.GetValueOnGameThread() == 0)
+	{
+		return;
+	}
+
+	const int32 Target = FMath::Min(Count, CVarEnemyPoolMaxDormant.GetValueOnGameThread());
+	TGuardValue<bool> SpawningDormant(bSpawningDormant, true);
+	while (GetNumDormant(EnemyClass) < Target)
+	{
+		AGameCharacterBase* Enemy = SpawnEnemy(EnemyClass, FTransform(DormantLocation));
+		if (!Enemy)
+		{
+			return;
+		}
+
+		MakeDormant(Enemy);
+		++Stats.Prewarmed;
+	}
+}
+
+AGameCharacterBase* UEnemyPoolSubsystem::Acquire(TSubclassOf<AGameCharacterBase> EnemyClass, const FTransform& SpawnTransform)
+{
+	if (!EnemyClass)
+	{
+		return nullptr;
+	}
+
+	ATLAS_SCOPE_CYCLE_COUNTER(EnemyPool, "Atlas.EnemyPool.Acquire");
+
+	FEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass);
+	while (Bucket && Bucket->Dormant.Num() > 0 && CVarEnemyPoolEnabled.GetValueOnGameThread() != 0)
+	{
+		const FPooledEnemy Pooled = Bucket->Dormant.Pop(EAllowShrinking::No);
+		if (!IsValid(Pooled.Enemy))
+		{
+			Controllers.Remove(Pooled.Enemy);
+			continue;
+		}
+
+		// Reset after the move, difficulty looks up the room at the enemy's location
+		Pooled.Enemy->SetActorLocationAndRotation(SpawnTransform.GetLocation(), SpawnTransform.GetRotation(), false, nullptr, ETeleportType::ResetPhysics);
+		Pooled.Enemy->ResetForReuse();
+		Wake(Pooled);
+
+		++Stats.Reused;
+		return Pooled.Enemy;
+	}
+
+	AGameCharacterBase* Enemy = SpawnEnemy(EnemyClass, SpawnTransform);
+	if (Enemy)
+	{
+		++Stats.Spawned;
+	}
+	return Enemy;
+}
+
+void UEnemyPoolSubsystem::Release(AActor* Enemy)
+{
+	if (!IsValid(Enemy))
+	{
+		return;
+	}
+
+	ATLAS_SCOPE_CYCLE_COUNTER(EnemyPool, "Atlas.EnemyPool.Release");
+
+	FTimerHandle PendingRelease;
+	if (PendingReleases.RemoveAndCopyValue(Enemy, PendingRelease))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(PendingRelease);
+	}
+
+	AGameCharacterBase* Character = Cast<AGameCharacterBase>(Enemy);
+	if (!Character || !Controllers.Contains(Character))
+	{
+		Enemy->Destroy();
+		return;
+	}
+
+	FEnemyPoolBucket& Bucket = Buckets.FindOrAdd(Character->GetClass());
+	if (Bucket.Dormant.ContainsByPredicate([Character](const FPooledEnemy& Pooled) { return Pooled.Enemy == Character; }))
+	{
+		return;
+	}
+
+	// Pool is full, let this one go for real
+	if (Bucket.Dormant.Num() >= CVarEnemyPoolMaxDormant.GetValueOnGameThread() || CVarEnemyPoolEnabled.GetValueOnGameThread() == 0)
+	{
+		AController* Controller = Controllers.FindAndRemoveChecked(Character);
+		if (IsValid(Controller))
+		{
+			Controller->UnPossess();
+			Controller->Destroy();
+		}
+		Character->Destroy();
+		return;
+	}
+
+	RemoveExternalBindings(Character);
+	MakeDormant(Character);
+	++Stats.Released;
+}
+
+void UEnemyPoolSubsystem::ReleaseAfter(AActor* Enemy, float Delay)
+{
+	if (!IsValid(Enemy))
+	{
+		return;
+	}
+
+	TWeakObjectPtr<AActor> WeakEnemy = Enemy;
+	FTimerHandle& Handle = PendingReleases.FindOrAdd(WeakEnemy);
+	GetWorld()->GetTimerManager().SetTimer(Handle, FTimerDelegate::CreateWeakLambda(this, [this, WeakEnemy]()
+	{
+		PendingReleases.Remove(WeakEnemy);
+		if (AActor* PendingEnemy = WeakEnemy.Get())
+		{
+			Release(PendingEnemy);
+		}
+	}), Delay, false);
+}
+
+bool UEnemyPoolSubsystem::IsPooled(const AActor* Enemy) const
+{
+	const AGameCharacterBase* Character = Cast<AGameCharacterBase>(Enemy);
+	return Character && Controllers.Contains(Character);
+}
+
+bool UEnemyPoolSubsystem::IsDormant(const AActor* Enemy)
+{
+	const UEnemyPoolSubsystem* Pool = Get(Enemy);
+	if (!Pool)
+	{
+		return false;
+	}
+
+	if (Pool->bSpawningDormant)
+	{
+		return true;
+	}
+
+	const FEnemyPoolBucket* Bucket = Pool->Buckets.Find(Enemy->GetClass());
+	return Bucket && Bucket->Dormant.ContainsByPredicate([Enemy](const FPooledEnemy& Pooled) { return Pooled.Enemy == Enemy; });
+}
+
+int32 UEnemyPoolSubsystem::GetNumDormant(TSubclassOf<AGameCharacterBase> EnemyClass) const
+{
+	const FEnemyPoolBucket* Bucket = Buckets.Find(EnemyClass);
+	return Bucket ? Bucket->Dormant.Num() : 0;
+}
+
+AGameCharacterBase* UEnemyPoolSubsystem::SpawnEnemy(TSubclassOf<AGameCharacterBase> EnemyClass, const FTransform& SpawnTransform)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	AGameCharacterBase* Enemy = GetWorld()->SpawnActor<AGameCharacterBase>(EnemyClass, SpawnTransform, SpawnParams);
+	if (!Enemy)
+	{
+		UE_LOG(LogTemp, Error, TEXT("EnemyPool: Failed to spawn %s"), *EnemyClass->GetName());
+		return nullptr;
+	}
+
+	if (!Enemy->GetController())
+	{
+		Enemy->SpawnDefaultController();
+	}
+
+	Controllers.Add(Enemy, Enemy->GetController());
+	return Enemy;
+}
+
+void UEnemyPoolSubsystem::MakeDormant(AGameCharacterBase* Enemy)
+{
+	AController* Controller = Enemy->GetController();
+	if (Controller)
+	{
+		// OnUnPossess stops the behavior tree and leaves the decision scheduler and room sight
+		Controller->UnPossess();
+		Controllers.Add(Enemy, Controller);
+	}
+	else
+	{
+		Controller = Controllers.FindRef(Enemy);
+	}
+
+	// A dying enemy may already have a lifespan from before it was pooled
+	Enemy->SetLifeSpan(0.0f);
+
+	// Stop following the last room's player model, Acquire looks up the next room
+	if (UAIDifficultyComponent* Difficulty = Enemy->FindComponentByClass<UAIDifficultyComponent>())
+	{
+		Difficulty->SetSharedPlayerModel(nullptr);
+	}
+
+	if (UCharacterMovementComponent* MoveComp = Enemy->GetCharacterMovement())
+	{
+		MoveComp->StopMovementImmediately();
+		MoveComp->DisableMovement();
+	}
+
+	Enemy->SetActorHiddenInGame(true);
+	Enemy->SetActorEnableCollision(false);
+	Enemy->SetActorTickEnabled(false);
+	for (UActorComponent* Component : Enemy->GetComponents())
+	{
+		Component->SetComponentTickEnabled(false);
+	}
+
+	Enemy->SetActorLocation(DormantLocation, false, nullptr, ETeleportType::ResetPhysics);
+
+	FPooledEnemy& Pooled = Buckets.FindOrAdd(Enemy->GetClass()).Dormant.AddDefaulted_GetRef();
+	Pooled.Enemy = Enemy;
+	Pooled.Controller = Controller;
+}
+
+void UEnemyPoolSubsystem::Wake(const FPooledEnemy& Pooled)
+{
+	AGameCharacterBase* Enemy = Pooled.Enemy;
+
+	Enemy->SetActorHiddenInGame(false);
+	Enemy->SetActorEnableCollision(true);
+	Enemy->SetActorTickEnabled(Enemy->PrimaryActorTick.bStartWithTickEnabled);
+	for (UActorComponent* Component : Enemy->GetComponents())
+	{
+		// Same tick state a fresh spawn starts with
+		Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+	}
+
+	AController* Controller = Pooled.Controller;
+	if (IsValid(Controller))
+	{
+		Controller->Possess(Enemy);
+	}
+	else
+	{
+		Enemy->SpawnDefaultController();
+		Controller = Enemy->GetController();
+	}
+	Controllers.Add(Enemy, Controller);
+}
+
+void UEnemyPoolSubsystem::RemoveExternalBindings(AGameCharacterBase* Enemy)
+{
+	if (UHealthComponent* Health = Enemy->GetHealthComponent())
+	{
+		RemoveBindingsOutside(Health->OnHealthChanged, Enemy);
+		RemoveBindingsOutside(Health->OnDamageTaken, Enemy);
+		RemoveBindingsOutside(Health->OnHealed, Enemy);
+		RemoveBindingsOutside(Health->OnDeath, Enemy);
+		RemoveBindingsOutside(Health->OnRevived, Enemy);
+	}
+
+	if (UActionManagerComponent* ActionManager = Enemy->GetActionManagerComponent())
+	{
+		RemoveBindingsOutside(ActionManager->OnActionSlotChanged, Enemy);
+		RemoveBindingsOutside(ActionManager->OnActionActivated, Enemy);
+	}
+}
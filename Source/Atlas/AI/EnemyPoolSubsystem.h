@@ -0,0 +1,134 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyPoolSubsystem.generated.h"
+
+class AGameCharacterBase;
+class AController;
+
+/**
+ * Pool counters, used by Atlas.Bench.EnemyPool
+ */
+struct ATLAS_API FEnemyPoolStats
+{
+	/** Dormant enemies spawned ahead of time */
+	int32 Prewarmed = 0;
+
+	/** Acquires served by a dormant enemy */
+	int32 Reused = 0;
+
+	/** Acquires that had to spawn because nothing of the class was dormant */
+	int32 Spawned = 0;
+
+	int32 Released = 0;
+
+	void Reset() { *this = FEnemyPoolStats(); }
+};
+
+/** A pooled enemy and the controller that possesses it while it is active */
+USTRUCT()
+struct FPooledEnemy
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	AGameCharacterBase* Enemy = nullptr;
+
+	UPROPERTY()
+	AController* Controller = nullptr;
+};
+
+USTRUCT()
+struct FEnemyPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FPooledEnemy> Dormant;
+};
+
+/**
+ * Keeps enemies and their AI controllers alive between rooms.
+ *
+ * Spawning a character spins up its components, anim instance and a controller in the
+ * frame the room's spawn timer fires. The pool spawns them ahead of time during the room
+ * transition and parks them hidden, with collision, ticking and the controller's brain off.
+ * Acquire moves a dormant enemy to the spawn point, resets it through
+ * AGameCharacterBase::ResetForReuse and re-possesses it, so the controller goes through the
+ * same OnPossess setup as on a fresh spawn. Dormant enemies are bound to no room: the
+ * controller and difficulty skip their room lookups while IsDormant, and MakeDormant drops
+ * the room's player model.
+ *
+ * Enemies handed out by the pool go back to it instead of being destroyed, through Release
+ * or when they die. Release destroys actors the pool doesn't own, so callers can use it
+ * for any enemy.
+ */
+UCLASS()
+class ATLAS_API UEnemyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	static UEnemyPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Acquire from the world's pool, or a plain SpawnActor in worlds without one */
+	static AGameCharacterBase* AcquireEnemy(const UObject* WorldContextObject, TSubclassOf<AGameCharacterBase> EnemyClass, const FTransform& SpawnTransform);
+
+	/** Release to the enemy's world pool, or destroy it in worlds without one */
+	static void ReleaseEnemy(AActor* Enemy);
+
+	/** Spawn dormant enemies until Count of the class are waiting, capped by Atlas.EnemyPool.MaxDormantPerClass */
+	void Prewarm(TSubclassOf<AGameCharacterBase> EnemyClass, int32 Count = 1);
+
+	/** A ready enemy at the transform, dormant if one is available, spawned otherwise */
+	AGameCharacterBase* Acquire(TSubclassOf<AGameCharacterBase> EnemyClass, const FTransform& SpawnTransform);
+
+	/** Return an enemy to the pool, or destroy it if the pool doesn't own it */
+	void Release(AActor* Enemy);
+
+	/** Release after a delay, in place of the lifespan a dying enemy would otherwise get */
+	void ReleaseAfter(AActor* Enemy, float Delay);
+
+	/** Whether the enemy was handed out by this pool */
+	bool IsPooled(const AActor* Enemy) const;
+
+	/** Whether the enemy is parked in its world's pool, or being spawned into it by Prewarm */
+	static bool IsDormant(const AActor* Enemy);
+
+	int32 GetNumDormant(TSubclassOf<AGameCharacterBase> EnemyClass) const;
+
+	const FEnemyPoolStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats.Reset(); }
+
+private:
+	/** Spawn an enemy with its controller, outside any room */
+	AGameCharacterBase* SpawnEnemy(TSubclassOf<AGameCharacterBase> EnemyClass, const FTransform& SpawnTransform);
+
+	/** Hide and switch off a pooled enemy, its controller stays alive but unpossessed */
+	void MakeDormant(AGameCharacterBase* Enemy);
+
+	/** Switch a pooled enemy back on and give it its controller */
+	void Wake(const FPooledEnemy& Pooled);
+
+	/** Drop delegate bindings made by rooms and the run manager while the enemy was active */
+	static void RemoveExternalBindings(AGameCharacterBase* Enemy);
+
+	UPROPERTY()
+	TMap<UClass*, FEnemyPoolBucket> Buckets;
+
+	/** Every enemy the pool owns, active or dormant, with its controller */
+	UPROPERTY()
+	TMap<AGameCharacterBase*, AController*> Controllers;
+
+	TMap<TWeakObjectPtr<AActor>, FTimerHandle> PendingReleases;
+
+	FEnemyPoolStats Stats;
+
+	/** Set while Prewarm spawns, the new enemy is dormant before it is in a bucket */
+	bool bSpawningDormant = false;
+};
@@ -4,9 +4,10 @@
 #include "../Characters/PlayerCharacter.h"
 #include "../Components/HealthComponent.h"
 #include "../Components/VulnerabilityComponent.h"
+#include "../Core/AtlasLog.h"
+#include "../Debug/AtlasDebugDraw.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
-#include "DrawDebugHelpers.h"
 #include "TimerManager.h"
 #include "Engine/OverlapResult.h"
 
@@ -36,7 +37,7 @@ void AValveInteractable::TriggerAoEEffect(AActor* Interactor)
     // Get all actors in radius
     TArray<AActor*> AffectedActors = GetActorsInRadius();
     
-    UE_LOG(LogTemp, Warning, TEXT("VALVE: %s AoE triggered (Type: %s, Radius: %.0f, Actors: %d)"), 
+    UE_LOG(LogAtlasInteractables, Verbose, TEXT("VALVE: %s AoE triggered (Type: %s, Radius: %.0f, Actors: %d)"), 
         *GetName(), 
         ValveType == EValveType::Vulnerability ? TEXT("Vulnerability") : TEXT("Stagger"),
         AoERadius, AffectedActors.Num());
@@ -44,30 +45,34 @@ void AValveInteractable::TriggerAoEEffect(AActor* Interactor)
     // Visual effects based on type
     FColor EffectColor = ValveType == EValveType::Vulnerability ? FColor::Purple : FColor::Yellow;
     
-    // Draw area effect visualization
-    DrawDebugSphere(GetWorld(), GetActorLocation(), AoERadius, 32, EffectColor, false, 3.0f, 0, 3.0f);
-    
-    // Draw radial lines for effect
-    FVector Center = GetActorLocation();
-    for (int32 i = 0; i < 12; i++)
+    #if ATLAS_WITH_DEBUG_DRAW
+    if (FAtlasDebugDraw::IsEnabled())
     {
-        float Angle = (360.0f / 12) * i;
-        FVector EndPoint = Center + FVector(
-            FMath::Cos(FMath::DegreesToRadians(Angle)) * AoERadius,
-            FMath::Sin(FMath::DegreesToRadians(Angle)) * AoERadius,
-            0
-        );
-        DrawDebugLine(GetWorld(), Center, EndPoint, EffectColor, false, 3.0f, 0, 2.0f);
-    }
-    
-    // Draw circles at different heights for volume effect
-    for (int32 Height = -100; Height <= 100; Height += 50)
-    {
-        FVector HeightOffset = FVector(0, 0, Height);
-        DrawDebugCircle(GetWorld(), Center + HeightOffset, AoERadius * (1.0f - FMath::Abs(Height) / 200.0f), 
-            24, EffectColor, false, 3.0f, 0, 2.0f, 
-            FVector(0, 1, 0), FVector(1, 0, 0), false);
+        // Draw area effect visualization
+        FAtlasDebugDraw::Sphere(this, GetActorLocation(), AoERadius, EffectColor, 3.0f, 3.0f);
+        
+        // Draw radial lines for effect
+        FVector Center = GetActorLocation();
+        for (int32 i = 0; i < 12; i++)
+        {
+            float Angle = (360.0f / 12) * i;
+            FVector EndPoint = Center + FVector(
+                FMath::Cos(FMath::DegreesToRadians(Angle)) * AoERadius,
+                FMath::Sin(FMath::DegreesToRadians(Angle)) * AoERadius,
+                0
+            );
+            FAtlasDebugDraw::Line(this, Center, EndPoint, EffectColor, 3.0f, 2.0f);
+        }
+        
+        // Draw circles at different heights for volume effect
+        for (int32 Height = -100; Height <= 100; Height += 50)
+        {
+            FVector HeightOffset = FVector(0, 0, Height);
+            FAtlasDebugDraw::Circle(this, Center + HeightOffset, AoERadius * (1.0f - FMath::Abs(Height) / 200.0f), 
+                FVector(0, 1, 0), FVector(1, 0, 0), EffectColor, 3.0f, 2.0f);
+        }
     }
+    #endif
     
     // Apply effect to all actors in range (neutral behavior)
     for (AActor* Target : AffectedActors)
@@ -77,8 +82,7 @@ void AValveInteractable::TriggerAoEEffect(AActor* Interactor)
             ApplyEffectToActor(Target);
             
             // Draw line from valve to affected actor
-            DrawDebugLine(GetWorld(), GetActorLocation(), Target->GetActorLocation(), 
-                EffectColor, false, 1.0f, 0, 1.0f);
+            ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Line(this, GetActorLocation(), Target->GetActorLocation(), EffectColor, 1.0f, 1.0f));
         }
     }
     
@@ -86,7 +90,7 @@ void AValveInteractable::TriggerAoEEffect(AActor* Interactor)
     SpawnVisualEffect(ValveType, AoERadius);
     OnAoETriggered(AffectedActors);
     
-    UE_LOG(LogTemp, Warning, TEXT("Valve %s triggered %s AoE effect (Radius: %.0f)"), 
+    UE_LOG(LogAtlasInteractables, Verbose, TEXT("Valve %s triggered %s AoE effect (Radius: %.0f)"), 
         *GetName(), 
         ValveType == EValveType::Vulnerability ? TEXT("Vulnerability") : TEXT("Stagger"),
         AoERadius);
@@ -118,7 +122,7 @@ void AValveInteractable::ApplyEffectToActor(AActor* Target)
         {
             // Valve applies Stunned tier (yellow) - lightest vulnerability
             VulnComp->ApplyVulnerabilityTier(EVulnerabilityTier::Stunned);
-            UE_LOG(LogTemp, Warning, TEXT("Valve applied Stunned vulnerability to %s"), 
+            UE_LOG(LogAtlasInteractables, Verbose, TEXT("Valve applied Stunned vulnerability to %s"), 
                 *Target->GetName());
         }
     }
@@ -129,19 +133,16 @@ void AValveInteractable::ApplyEffectToActor(AActor* Target)
         {
             HealthComp->TakePoiseDamage(StaggerPoiseDamage);
             HealthComp->PlayHitReaction();
-            UE_LOG(LogTemp, Warning, TEXT("Valve applied %.0f poise damage to %s"), 
+            UE_LOG(LogAtlasInteractables, Verbose, TEXT("Valve applied %.0f poise damage to %s"), 
                 StaggerPoiseDamage, *Target->GetName());
         }
     }
     
-    // Visual feedback on the target
-    FColor EffectColor = ValveType == EValveType::Vulnerability ? FColor::Purple : FColor::Yellow;
-    
     // Draw effect indicator above target
-    DrawDebugSphere(GetWorld(), Target->GetActorLocation() + FVector(0, 0, 100), 
-        30, 12, EffectColor, false, 3.0f, 0, 2.0f);
+    ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Sphere(this, Target->GetActorLocation() + FVector(0, 0, 100), 30.0f,
+        ValveType == EValveType::Vulnerability ? FColor::Purple : FColor::Yellow, 3.0f, 2.0f));
     
-    UE_LOG(LogTemp, Log, TEXT("Valve effect applied to %s"), *Target->GetName());
+    UE_LOG(LogAtlasInteractables, Verbose, TEXT("Valve effect applied to %s"), *Target->GetName());
 }
 
 TArray<AActor*> AValveInteractable::GetActorsInRadius() const
@@ -4,9 +4,10 @@
 #include "../Characters/GameCharacterBase.h"
 #include "../Characters/PlayerCharacter.h"
 #include "../Components/HealthComponent.h"
+#include "../Core/AtlasLog.h"
+#include "../Debug/AtlasDebugDraw.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
-#include "DrawDebugHelpers.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
@@ -76,13 +77,13 @@ void AVentInteractable::ExecuteInteraction(AActor* Interactor)
     // Prevent multiple triggers
     if (bHasBeenTriggered)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Vent %s has already been triggered!"), *GetName());
+        UE_LOG(LogAtlasInteractables, Verbose, TEXT("Vent %s has already been triggered!"), *GetName());
         return;
     }
     
     Super::ExecuteInteraction(Interactor);
     
-    UE_LOG(LogTemp, Warning, TEXT("VENT: Launching projectile (Interactor: %s)"), 
+    UE_LOG(LogAtlasInteractables, Verbose, TEXT("VENT: Launching projectile (Interactor: %s)"), 
         Interactor ? *Interactor->GetName() : TEXT("None"));
     
     bHasBeenTriggered = true;
@@ -94,7 +95,7 @@ void AVentInteractable::LaunchSelf(AActor* Interactor)
 {
     if (!MeshComponent)
     {
-        UE_LOG(LogTemp, Error, TEXT("Vent %s has no MeshComponent!"), *GetName());
+        UE_LOG(LogAtlasInteractables, Error, TEXT("Vent %s has no MeshComponent!"), *GetName());
         return;
     }
     
@@ -106,9 +107,9 @@ void AVentInteractable::LaunchSelf(AActor* Interactor)
     FVector StartLocation = GetActorLocation();
     FVector PredictedEndLocation = StartLocation + FinalLaunchDirection * LaunchRange;
     
-    DrawDebugLine(GetWorld(), StartLocation, PredictedEndLocation, FColor::Cyan, false, 5.0f, 0, 5.0f);
-    DrawDebugSphere(GetWorld(), StartLocation, 30, 12, FColor::Green, false, 5.0f);
-    DrawDebugSphere(GetWorld(), PredictedEndLocation, 50, 12, FColor::Red, false, 5.0f);
+    ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Line(this, StartLocation, PredictedEndLocation, FColor::Cyan, 5.0f, 5.0f));
+    ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Sphere(this, StartLocation, 30.0f, FColor::Green, 5.0f));
+    ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Sphere(this, PredictedEndLocation, 50.0f, FColor::Red, 5.0f));
     
     // Enable physics simulation
     MeshComponent->SetSimulatePhysics(true);
@@ -144,7 +145,7 @@ void AVentInteractable::LaunchSelf(AActor* Interactor)
     
     OnVentLaunched(LaunchVelocity);
     
-    UE_LOG(LogTemp, Warning, TEXT("Vent %s launched with velocity: %s (Speed: %.0f)"), 
+    UE_LOG(LogAtlasInteractables, Verbose, TEXT("Vent %s launched with velocity: %s (Speed: %.0f)"), 
         *GetName(), *LaunchVelocity.ToString(), LaunchVelocity.Size());
 }
 
@@ -161,7 +162,7 @@ FVector AVentInteractable::GetPredeterminedLaunchDirection() const
     // Normalize to ensure consistent speed
     Direction.Normalize();
     
-    UE_LOG(LogTemp, Warning, TEXT("Vent %s launching in predetermined direction: %s"), 
+    UE_LOG(LogAtlasInteractables, Verbose, TEXT("Vent %s launching in predetermined direction: %s"), 
         *GetName(), *Direction.ToString());
     
     return Direction;
@@ -184,12 +185,12 @@ void AVentInteractable::OnHit(UPrimitiveComponent* HitComponent, AActor* OtherAc
     
     if (HitCharacter)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Vent %s hit %s!"), *GetName(), *OtherActor->GetName());
+        UE_LOG(LogAtlasInteractables, Verbose, TEXT("Vent %s hit %s!"), *GetName(), *OtherActor->GetName());
         
         ApplyStaggerToTarget(OtherActor);
         
         // Visual feedback
-        DrawDebugSphere(GetWorld(), Hit.Location, 75, 12, FColor::Yellow, false, 2.0f);
+        ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Sphere(this, Hit.Location, 75.0f, FColor::Yellow, 2.0f));
         
         // Despawn after hitting a character
         FTimerHandle DespawnTimer;
@@ -206,7 +207,7 @@ void AVentInteractable::OnHit(UPrimitiveComponent* HitComponent, AActor* OtherAc
     if (bShouldBounce && MeshComponent)
     {
         // Physics engine handles bouncing automatically with restitution
-        UE_LOG(LogTemp, Log, TEXT("Vent bounced off %s"), *OtherActor->GetName());
+        UE_LOG(LogAtlasInteractables, Verbose, TEXT("Vent bounced off %s"), *OtherActor->GetName());
     }
 }
 
@@ -226,11 +227,11 @@ void AVentInteractable::ApplyStaggerToTarget(AActor* HitActor)
         
         if (HealthComp->IsStaggered())
         {
-            UE_LOG(LogTemp, Warning, TEXT("Vent staggered %s!"), *HitActor->GetName());
+            UE_LOG(LogAtlasInteractables, Verbose, TEXT("Vent staggered %s!"), *HitActor->GetName());
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("Vent damaged %s's poise (%.0f damage)"), *HitActor->GetName(), StaggerPoiseDamage);
+            UE_LOG(LogAtlasInteractables, Verbose, TEXT("Vent damaged %s's poise (%.0f damage)"), *HitActor->GetName(), StaggerPoiseDamage);
         }
     }
     
@@ -2,6 +2,7 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "../Components/ActionManagerComponent.h"
 #include "../Characters/GameCharacterBase.h"
+#include "../Core/AtlasStats.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
 #include "CollisionQueryParams.h"
@@ -45,6 +46,7 @@ void UAttackNotify::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase*
         QueryParams.AddIgnoredActor(Character);
         QueryParams.bTraceComplex = false;
 
+        AtlasStats::CountAttackSweep();
         bool bHit = MeshComp->GetWorld()->SweepMultiByChannel(
             HitResults,
             HitboxCenter,
@@ -2,6 +2,7 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "../Components/ActionManagerComponent.h"
 #include "../Characters/GameCharacterBase.h"
+#include "../Core/AtlasStats.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
 #include "CollisionQueryParams.h"
@@ -25,6 +26,8 @@ void UAttackNotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequ
 
 void UAttackNotifyState::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
 {
+    ATLAS_SCOPE_CYCLE_COUNTER(AttackNotifyTick, "Atlas.AttackNotifyState.NotifyTick");
+
     Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
 
     if (bContinuousHitDetection)
@@ -74,6 +77,7 @@ void UAttackNotifyState::PerformHitDetection(USkeletalMeshComponent* MeshComp)
     QueryParams.AddIgnoredActor(Character);
     QueryParams.bTraceComplex = false;
 
+    AtlasStats::CountAttackSweep();
     bool bHit = MeshComp->GetWorld()->SweepMultiByChannel(
         HitResults,
         HitboxCenter,
@@ -24,6 +24,17 @@ public class Atlas : ModuleRules
 			"SlateCore"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		PrivateDependencyModuleNames.AddRange(new string[] { "Json" });
+
+		// Reading traces back in automation tests needs the developer trace analysis modules
+		if (Target.bBuildDeveloperTools && Target.Configuration != UnrealTargetConfiguration.Shipping)
+		{
+			PrivateDependencyModuleNames.AddRange(new string[] { "TraceAnalysis", "TraceServices" });
+			PrivateDefinitions.Add("ATLAS_WITH_TRACE_ANALYSIS=1");
+		}
+		else
+		{
+			PrivateDefinitions.Add("ATLAS_WITH_TRACE_ANALYSIS=0");
+		}
 	}
 }
@@ -9,6 +9,8 @@
 #include "../Components/StationIntegrityComponent.h"
 #include "../Components/SlotManagerComponent.h"
 #include "../Components/FocusModeComponent.h"
+#include "../Components/AIDifficultyComponent.h"
+#include "Animation/AnimInstance.h"
 #include "../Actions/ActionInstance.h"
 
 AGameCharacterBase::AGameCharacterBase()
@@ -62,6 +64,77 @@ void AGameCharacterBase::SetupPlayerInputComponent(UInputComponent* PlayerInputC
 	Super::SetupPlayerInputComponent(PlayerInputComponent);
 }
 
+void AGameCharacterBase::ResetForReuse()
+{
+	// Action manager first, it owns the combat state tags the other components clear on the way out
+	if (ActionManagerComponent)
+	{
+		ActionManagerComponent->ResetActions();
+	}
+
+	if (HealthComponent)
+	{
+		HealthComponent->ResetHealth();
+	}
+
+	if (VulnerabilityComponent)
+	{
+		VulnerabilityComponent->EndVulnerability();
+		VulnerabilityComponent->EndIFrames();
+	}
+
+	if (StationIntegrityComponent)
+	{
+		StationIntegrityComponent->ResetIntegrity();
+	}
+
+	if (SlotManagerComponent)
+	{
+		SlotManagerComponent->ClearAllRewards();
+	}
+
+	if (FocusModeComponent)
+	{
+		FocusModeComponent->StopFocusMode();
+	}
+
+	// Undo a ragdoll knockback and any montage still playing from the last encounter
+	if (USkeletalMeshComponent* MeshComponent = GetMesh())
+	{
+		if (MeshComponent->IsSimulatingPhysics())
+		{
+			MeshComponent->SetSimulatePhysics(false);
+			MeshComponent->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+			MeshComponent->SetRelativeLocationAndRotation(GetBaseTranslationOffset(), GetBaseRotationOffset());
+			if (const USkeletalMeshComponent* MeshDefaults = Cast<USkeletalMeshComponent>(MeshComponent->GetArchetype()))
+			{
+				MeshComponent->SetCollisionEnabled(MeshDefaults->GetCollisionEnabled());
+			}
+		}
+
+		if (UAnimInstance* AnimInstance = MeshComponent->GetAnimInstance())
+		{
+			AnimInstance->StopAllMontages(0.0f);
+		}
+	}
+
+	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	{
+		MoveComp->StopMovementImmediately();
+		MoveComp->SetMovementMode(MOVE_Walking);
+		if (const UCharacterMovementComponent* Defaults = Cast<UCharacterMovementComponent>(MoveComp->GetArchetype()))
+		{
+			MoveComp->MaxWalkSpeed = Defaults->MaxWalkSpeed;
+		}
+	}
+
+	// Difficulty scales max health, so it goes after the health reset
+	if (UAIDifficultyComponent* Difficulty = FindComponentByClass<UAIDifficultyComponent>())
+	{
+		Difficulty->ResetForReuse();
+	}
+}
+
 // ICombatInterface Implementation
 bool AGameCharacterBase::IsInCombat_Implementation() const
 {
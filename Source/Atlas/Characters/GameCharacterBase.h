@@ -56,6 +56,13 @@ public:
 	virtual void Tick(float DeltaTime) override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
+	/**
+	 * Put every gameplay component back the way a fresh spawn has it, used by UEnemyPoolSubsystem
+	 * before handing out a pooled character again
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	virtual void ResetForReuse();
+
 	FORCEINLINE class USpringArmComponent* GetCameraBoom() const { return CameraBoom; }
 	FORCEINLINE class UCameraComponent* GetFollowCamera() const { return FollowCamera; }
 	FORCEINLINE class UActionManagerComponent* GetActionManagerComponent() const { return ActionManagerComponent; }
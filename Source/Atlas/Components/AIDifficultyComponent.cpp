@@ -2,6 +2,8 @@
 #include "Atlas/Characters/GameCharacterBase.h"
 #include "Atlas/Components/HealthComponent.h"
 #include "Atlas/Components/SlotManagerComponent.h"
+#include "Atlas/Rooms/RoomBase.h"
+#include "Atlas/AI/EnemyPoolSubsystem.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
@@ -9,6 +11,63 @@
 UAIDifficultyComponent::UAIDifficultyComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
+	SharedPlayerModel = nullptr;
+	
+	// Default utility table, tuned to match the old weighted rolls
+	FAIActionUtility Attack;
+	Attack.Action = EAICombatAction::Attack;
+	Attack.BaseScore = 0.2f;
+	Attack.AggressionWeight = 0.6f;
+	Attack.BerserkBonus = 0.3f;
+	Attack.PlayerBlockWeight = -0.2f;
+	Attack.PlayerDashWeight = 0.1f;
+	Attack.OutOfRangeScale = 0.1f;
+	ActionUtilities.Add(Attack);
+	
+	FAIActionUtility HeavyAttack;
+	HeavyAttack.Action = EAICombatAction::HeavyAttack;
+	HeavyAttack.AggressionWeight = 0.3f;
+	HeavyAttack.ComboWeight = 0.5f;
+	HeavyAttack.BerserkBonus = 0.2f;
+	HeavyAttack.PlayerBlockWeight = 0.5f;
+	HeavyAttack.PlayerParryWeight = -0.4f;
+	HeavyAttack.OutOfRangeScale = 0.1f;
+	ActionUtilities.Add(HeavyAttack);
+	
+	FAIActionUtility Block;
+	Block.Action = EAICombatAction::Block;
+	Block.DefenseWeight = 0.6f;
+	Block.BerserkBonus = -0.5f;
+	Block.PlayerAttackWeight = 0.2f;
+	Block.PlayerHeavyAttackWeight = 0.3f;
+	Block.OutOfRangeScale = 0.3f;
+	ActionUtilities.Add(Block);
+	
+	FAIActionUtility ParryBait;
+	ParryBait.Action = EAICombatAction::ParryBait;
+	ParryBait.DefenseWeight = 0.3f;
+	ParryBait.BerserkBonus = -0.5f;
+	ParryBait.PlayerAttackWeight = 0.4f;
+	ParryBait.PlayerHeavyAttackWeight = 0.2f;
+	ParryBait.PlayerParryWeight = -0.3f;
+	ParryBait.OutOfRangeScale = 0.2f;
+	ActionUtilities.Add(ParryBait);
+	
+	FAIActionUtility Reposition;
+	Reposition.Action = EAICombatAction::Reposition;
+	Reposition.BaseScore = 0.3f;
+	Reposition.DefenseWeight = 0.1f;
+	Reposition.PlayerDashWeight = 0.3f;
+	Reposition.InRangeScale = 0.3f;
+	Reposition.OutOfRangeScale = 2.0f;
+	ActionUtilities.Add(Reposition);
+	
+	FAIActionUtility SoulAttack;
+	SoulAttack.Action = EAICombatAction::SoulAttack;
+	SoulAttack.AbilityWeight = 0.7f;
+	SoulAttack.PlayerBlockWeight = 0.2f;
+	SoulAttack.PlayerDashWeight = 0.2f;
+	ActionUtilities.Add(SoulAttack);
 }
 
 void UAIDifficultyComponent::BeginPlay()
@@ -18,20 +77,53 @@ void UAIDifficultyComponent::BeginPlay()
 	// Get owner reference
 	OwnerCharacter = Cast<AGameCharacterBase>(GetOwner());
 	
+	InitializeDifficulty();
+}
+
+void UAIDifficultyComponent::InitializeDifficulty()
+{
 	// Calculate initial difficulty
 	RecalculateDifficulty();
 	
 	// Apply initial scaling
 	ApplyDifficultyScaling();
+	
+	// Share the player analysis with the other enemies in our room, pooled enemies find theirs when they are acquired
+	if (!SharedPlayerModel && !UEnemyPoolSubsystem::IsDormant(GetOwner()))
+	{
+		if (ARoomBase* Room = ARoomBase::FindRoomContaining(this, GetOwner()->GetActorLocation()))
+		{
+			SetSharedPlayerModel(Room->GetPlayerModel());
+		}
+	}
+}
+
+void UAIDifficultyComponent::ResetForReuse()
+{
+	SetSharedPlayerModel(nullptr);
+	ResetPatternAnalysis();
+	InitializeDifficulty();
+}
+
+void UAIDifficultyComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	SetSharedPlayerModel(nullptr);
+	
+	Super::EndPlay(EndPlayReason);
 }
 
 void UAIDifficultyComponent::CalculateDifficulty(int32 PlayerEquippedSlots)
 {
 	// GDD Rule: Enemy Power = Player Equipped Slots + 1
-	PowerLevel = PlayerEquippedSlots + 1;
-	
 	UE_LOG(LogTemp, Log, TEXT("AI Difficulty calculated - Power Level: %d (Player Slots: %d)"), 
-		PowerLevel, PlayerEquippedSlots);
+		PlayerEquippedSlots + 1, PlayerEquippedSlots);
+	
+	SetPowerLevel(PlayerEquippedSlots + 1);
+}
+
+void UAIDifficultyComponent::SetPowerLevel(int32 InPowerLevel)
+{
+	PowerLevel = FMath::Clamp(InPowerLevel, 1, 10);
 	
 	// Apply scaling based on power level
 	ApplyPowerLevelScaling(PowerLevel);
@@ -62,7 +154,12 @@ void UAIDifficultyComponent::ApplyDifficultyScaling()
 	// Apply health scaling
 	if (UHealthComponent* HealthComp = OwnerCharacter->GetHealthComponent())
 	{
-		float BaseHealth = HealthComp->GetMaxHealth();
+		// Scale from the unscaled max health so applying again doesn't compound
+		if (BaseMaxHealth < 0.0f)
+		{
+			BaseMaxHealth = HealthComp->GetMaxHealth();
+		}
+		float BaseHealth = BaseMaxHealth;
 		float ScaledHealth = BaseHealth * HealthMultiplier;
 		HealthComp->SetMaxHealth(ScaledHealth);
 		HealthComp->Heal(ScaledHealth, nullptr); // Set to max health
@@ -114,62 +211,19 @@ void UAIDifficultyComponent::RecordPlayerAction(FGameplayTag ActionTag)
 {
 	if (!bEnableAdaptiveAI)
 		return;
-		
-	// Update pattern data
-	PlayerPattern.LastPlayerAction = ActionTag;
 	
-	// Track specific actions
-	FString ActionString = ActionTag.ToString();
-	if (ActionString.Contains(TEXT("Block")))
-	{
-		PlayerPattern.BlockCount++;
-	}
-	else if (ActionString.Contains(TEXT("Parry")))
-	{
-		PlayerPattern.ParryCount++;
-	}
-	else if (ActionString.Contains(TEXT("Dash")))
+	// The room model dedupes and notifies every enemy in the room, including us
+	if (SharedPlayerModel)
 	{
-		PlayerPattern.DashCount++;
-	}
-	else if (ActionString.Contains(TEXT("Attack.Heavy")))
-	{
-		PlayerPattern.HeavyAttackCount++;
-	}
-	else if (ActionString.Contains(TEXT("Attack")))
-	{
-		PlayerPattern.AttackCount++;
+		SharedPlayerModel->RecordPlayerAction(ActionTag);
+		return;
 	}
 	
-	// Track reaction time
-	float CurrentTime = GetWorld()->GetTimeSeconds();
-	if (LastActionTime > 0.0f)
-	{
-		float ReactionTime = CurrentTime - LastActionTime;
-		ReactionTimes.Add(ReactionTime);
-		
-		// Keep only recent reaction times
-		if (ReactionTimes.Num() > 20)
-		{
-			ReactionTimes.RemoveAt(0);
-		}
-		
-		// Calculate average
-		float TotalTime = 0.0f;
-		for (float Time : ReactionTimes)
-		{
-			TotalTime += Time;
-		}
-		PlayerPattern.AverageReactionTime = TotalTime / ReactionTimes.Num();
-	}
-	LastActionTime = CurrentTime;
+	LocalPlayerModel.RecordAction(ActionTag, GetWorld()->GetTimeSeconds());
+	LocalPlayerModel.FillPatternData(PlayerPattern);
 	
 	// Check if we should adapt
-	int32 TotalActions = PlayerPattern.BlockCount + PlayerPattern.ParryCount + 
-	                     PlayerPattern.DashCount + PlayerPattern.AttackCount + 
-	                     PlayerPattern.HeavyAttackCount;
-	                     
-	if (TotalActions >= MinActionsForAdaptation)
+	if (LocalPlayerModel.GetTotalActions() >= MinActionsForAdaptation)
 	{
 		AnalyzePlayerPattern();
 	}
@@ -177,30 +231,16 @@ void UAIDifficultyComponent::RecordPlayerAction(FGameplayTag ActionTag)
 
 void UAIDifficultyComponent::AnalyzePlayerPattern()
 {
-	int32 DefensiveActions = PlayerPattern.BlockCount + PlayerPattern.ParryCount;
-	int32 OffensiveActions = PlayerPattern.AttackCount + PlayerPattern.HeavyAttackCount;
-	int32 EvasiveActions = PlayerPattern.DashCount;
+	GetActivePlayerModel().FillPatternData(PlayerPattern);
 	
-	// Determine most used action type
-	if (DefensiveActions > OffensiveActions && DefensiveActions > EvasiveActions)
-	{
-		PlayerPattern.MostUsedAction = FGameplayTag::RequestGameplayTag(TEXT("Player.Style.Defensive"));
-	}
-	else if (OffensiveActions > DefensiveActions && OffensiveActions > EvasiveActions)
-	{
-		PlayerPattern.MostUsedAction = FGameplayTag::RequestGameplayTag(TEXT("Player.Style.Aggressive"));
-	}
-	else if (EvasiveActions > DefensiveActions && EvasiveActions > OffensiveActions)
-	{
-		PlayerPattern.MostUsedAction = FGameplayTag::RequestGameplayTag(TEXT("Player.Style.Evasive"));
-	}
-	else
-	{
-		PlayerPattern.MostUsedAction = FGameplayTag::RequestGameplayTag(TEXT("Player.Style.Balanced"));
-	}
+	// Counter strategies stack, so only adapt when the style actually changes
+	if (PlayerPattern.Style == AdaptedStyle)
+		return;
 	
 	UE_LOG(LogTemp, Log, TEXT("Player pattern analyzed - Style: %s"), 
-		*PlayerPattern.MostUsedAction.ToString());
+		*UEnum::GetValueAsString(PlayerPattern.Style));
+	
+	AdaptedStyle = PlayerPattern.Style;
 	
 	// Adapt strategy
 	AdaptToPlayerStrategy();
@@ -210,30 +250,66 @@ void UAIDifficultyComponent::AdaptToPlayerStrategy()
 {
 	if (!bEnableAdaptiveAI)
 		return;
-		
-	FString StyleString = PlayerPattern.MostUsedAction.ToString();
 	
-	if (StyleString.Contains(TEXT("Defensive")))
+	switch (PlayerPattern.Style)
 	{
-		CounterDefensivePlayer();
+		case EPlayerCombatStyle::Defensive:
+			CounterDefensivePlayer();
+			break;
+		case EPlayerCombatStyle::Aggressive:
+			CounterAggressivePlayer();
+			break;
+		case EPlayerCombatStyle::Evasive:
+			CounterEvasivePlayer();
+			break;
+		default:
+			break;
 	}
-	else if (StyleString.Contains(TEXT("Aggressive")))
+}
+
+void UAIDifficultyComponent::ResetPatternAnalysis()
+{
+	PlayerPattern = FPlayerPatternData();
+	LocalPlayerModel.Reset();
+	AdaptedStyle = EPlayerCombatStyle::Balanced;
+	
+	UE_LOG(LogTemp, Log, TEXT("Pattern analysis reset"));
+}
+
+void UAIDifficultyComponent::SetSharedPlayerModel(UPlayerModelComponent* InSharedModel)
+{
+	if (IsValid(SharedPlayerModel))
 	{
-		CounterAggressivePlayer();
+		SharedPlayerModel->OnModelUpdated.Remove(SharedModelHandle);
 	}
-	else if (StyleString.Contains(TEXT("Evasive")))
+	SharedModelHandle.Reset();
+	SharedPlayerModel = InSharedModel;
+	
+	if (SharedPlayerModel)
 	{
-		CounterEvasivePlayer();
+		SharedModelHandle = SharedPlayerModel->OnModelUpdated.AddUObject(this, &UAIDifficultyComponent::HandleSharedModelUpdated);
+		HandleSharedModelUpdated();
 	}
 }
 
-void UAIDifficultyComponent::ResetPatternAnalysis()
+void UAIDifficultyComponent::HandleSharedModelUpdated()
 {
-	PlayerPattern = FPlayerPatternData();
-	ReactionTimes.Empty();
-	LastActionTime = 0.0f;
+	if (!bEnableAdaptiveAI || !SharedPlayerModel)
+		return;
 	
-	UE_LOG(LogTemp, Log, TEXT("Pattern analysis reset"));
+	if (SharedPlayerModel->GetModel().GetTotalActions() >= MinActionsForAdaptation)
+	{
+		AnalyzePlayerPattern();
+	}
+	else
+	{
+		SharedPlayerModel->GetModel().FillPatternData(PlayerPattern);
+	}
+}
+
+const FPlayerActionModel& UAIDifficultyComponent::GetActivePlayerModel() const
+{
+	return SharedPlayerModel ? SharedPlayerModel->GetModel() : LocalPlayerModel;
 }
 
 bool UAIDifficultyComponent::ShouldAttack() const
@@ -262,61 +338,102 @@ bool UAIDifficultyComponent::ShouldUseAbility() const
 
 FGameplayTag UAIDifficultyComponent::GetRecommendedAction()
 {
-	// Check for berserker mode
-	if (IsBerserking())
-	{
-		// Always attack when berserking
-		return FMath::FRandRange(0.0f, 1.0f) < 0.3f ? 
-			FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.HeavyAttack")) :
-			FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.BasicAttack"));
-	}
+	// No controller context here, assume the target is in reach
+	FAIDecisionContext Context;
+	Context.bHasTarget = true;
 	
-	// Calculate action weights
-	float AttackWeight = CalculateAttackWeight();
-	float DefenseWeight = CalculateDefenseWeight();
-	float AbilityWeight = CalculateAbilityWeight();
+	float Score = 0.0f;
+	return GetActionTag(ChooseCombatAction(Context, Score));
+}
+
+EAICombatAction UAIDifficultyComponent::ChooseCombatAction(const FAIDecisionContext& Context, float& OutScore) const
+{
+	const bool bBerserking = IsBerserking();
+	const bool bInRange = Context.bHasTarget && Context.DistanceToTarget <= Context.AttackRange;
 	
-	// Normalize weights
-	float TotalWeight = AttackWeight + DefenseWeight + AbilityWeight;
-	if (TotalWeight <= 0.0f)
-		TotalWeight = 1.0f;
-		
-	AttackWeight /= TotalWeight;
-	DefenseWeight /= TotalWeight;
-	AbilityWeight /= TotalWeight;
+	// Player action mix as fractions of everything recorded so far
+	const float TotalActions = static_cast<float>(FMath::Max(PlayerPattern.AttackCount + PlayerPattern.HeavyAttackCount +
+		PlayerPattern.BlockCount + PlayerPattern.ParryCount + PlayerPattern.DashCount, 1));
+	const float AttackRatio = PlayerPattern.AttackCount / TotalActions;
+	const float HeavyAttackRatio = PlayerPattern.HeavyAttackCount / TotalActions;
+	const float BlockRatio = PlayerPattern.BlockCount / TotalActions;
+	const float ParryRatio = PlayerPattern.ParryCount / TotalActions;
+	const float DashRatio = PlayerPattern.DashCount / TotalActions;
 	
-	// Choose action based on weights
-	float RandomValue = FMath::FRandRange(0.0f, 1.0f);
+	EAICombatAction BestAction = EAICombatAction::Reposition;
+	float BestScore = -MAX_FLT;
 	
-	if (RandomValue < AttackWeight)
+	for (const FAIActionUtility& Utility : ActionUtilities)
 	{
-		// Choose attack type
-		if (FMath::FRandRange(0.0f, 1.0f) < ComboLikelihood)
+		if (Utility.Action == EAICombatAction::SoulAttack && !Context.bCanUseSoulAttack)
+			continue;
+		
+		float Score = Utility.BaseScore
+			+ Utility.AggressionWeight * AggressionLevel
+			+ Utility.DefenseWeight * DefensePriority
+			+ Utility.ComboWeight * ComboLikelihood
+			+ Utility.AbilityWeight * AbilityUsageFrequency
+			+ Utility.PlayerAttackWeight * AttackRatio
+			+ Utility.PlayerHeavyAttackWeight * HeavyAttackRatio
+			+ Utility.PlayerBlockWeight * BlockRatio
+			+ Utility.PlayerParryWeight * ParryRatio
+			+ Utility.PlayerDashWeight * DashRatio;
+		
+		if (bBerserking)
 		{
-			return FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.HeavyAttack"));
+			Score += Utility.BerserkBonus;
 		}
-		else
+		
+		if (Utility.RespondToPlayerAction.IsValid() && PlayerPattern.LastPlayerAction.MatchesTag(Utility.RespondToPlayerAction))
 		{
-			return FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.BasicAttack"));
+			Score += Utility.RespondBonus;
 		}
-	}
-	else if (RandomValue < AttackWeight + DefenseWeight)
-	{
-		// Choose defense type
-		if (FMath::FRandRange(0.0f, 1.0f) < 0.5f)
+		
+		Score *= bInRange ? Utility.InRangeScale : Utility.OutOfRangeScale;
+		
+		if (DecisionNoise > 0.0f)
 		{
-			return FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Block"));
+			Score += FMath::FRand() * DecisionNoise;
 		}
-		else
+		
+		if (Score > BestScore)
 		{
-			return FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Dash"));
+			BestScore = Score;
+			BestAction = Utility.Action;
 		}
 	}
-	else
-	{
-		// Use ability
-		return FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.SoulAttack"));
-	}
+	
+	OutScore = BestScore == -MAX_FLT ? 0.0f : BestScore;
+	return BestAction;
+}
+
+FGameplayTag UAIDifficultyComponent::GetActionTag(EAICombatAction Action)
+{
+	// Resolved once instead of a tag lookup by string every decision
+	static const FGameplayTag BasicAttackTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.BasicAttack"));
+	static const FGameplayTag HeavyAttackTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.HeavyAttack"));
+	static const FGameplayTag BlockTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Block"));
+	static const FGameplayTag ParryTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Parry"));
+	static const FGameplayTag DashTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Dash"));
+	static const FGameplayTag SoulAttackTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.SoulAttack"));
+	
+	switch (Action)
+	{
+		case EAICombatAction::Attack:
+			return BasicAttackTag;
+		case EAICombatAction::HeavyAttack:
+			return HeavyAttackTag;
+		case EAICombatAction::Block:
+			return BlockTag;
+		case EAICombatAction::ParryBait:
+			return ParryTag;
+		case EAICombatAction::Reposition:
+			return DashTag;
+		case EAICombatAction::SoulAttack:
+			return SoulAttackTag;
+	}
+	
+	return FGameplayTag();
 }
 
 float UAIDifficultyComponent::GetDifficultyRating() const
@@ -483,7 +600,7 @@ float UAIDifficultyComponent::CalculateAttackWeight() const
 	}
 	
 	// Modify based on player's last action
-	if (PlayerPattern.LastPlayerAction.ToString().Contains(TEXT("Block")))
+	if (FPlayerActionModel::ClassifyAction(PlayerPattern.LastPlayerAction) == EPlayerActionCategory::Block)
 	{
 		Weight += 0.1f; // More likely to attack if player is blocking
 	}
@@ -502,7 +619,8 @@ float UAIDifficultyComponent::CalculateDefenseWeight() const
 	}
 	
 	// More defense if player is attacking
-	if (PlayerPattern.LastPlayerAction.ToString().Contains(TEXT("Attack")))
+	const EPlayerActionCategory LastCategory = FPlayerActionModel::ClassifyAction(PlayerPattern.LastPlayerAction);
+	if (LastCategory == EPlayerActionCategory::Attack || LastCategory == EPlayerActionCategory::HeavyAttack)
 	{
 		Weight += 0.2f;
 	}
@@ -521,7 +639,7 @@ float UAIDifficultyComponent::CalculateAbilityWeight() const
 	}
 	
 	// Use abilities to counter evasive players
-	if (PlayerPattern.MostUsedAction.ToString().Contains(TEXT("Evasive")))
+	if (PlayerPattern.Style == EPlayerCombatStyle::Evasive)
 	{
 		Weight += 0.1f;
 	}
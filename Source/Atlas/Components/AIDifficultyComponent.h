@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
+#include "PlayerModelComponent.h"
 #include "AIDifficultyComponent.generated.h"
 
 /**
@@ -18,6 +19,94 @@ enum class EAIBehaviorPreset : uint8
 	Tactical      UMETA(DisplayName = "Tactical (Uses environment)")
 };
 
+/**
+ * Candidate actions the AI decision scheduler scores every think
+ */
+UENUM(BlueprintType)
+enum class EAICombatAction : uint8
+{
+	Attack        UMETA(DisplayName = "Attack"),
+	HeavyAttack   UMETA(DisplayName = "Heavy Attack"),
+	Block         UMETA(DisplayName = "Block"),
+	ParryBait     UMETA(DisplayName = "Parry Bait (Hold guard to draw an attack)"),
+	Reposition    UMETA(DisplayName = "Reposition"),
+	SoulAttack    UMETA(DisplayName = "Soul Attack")
+};
+
+/**
+ * One row of the utility table. The score of an action is
+ * (BaseScore + sum of weight * input) * range scale, where the inputs are the
+ * AI's behavior modifiers and the player's action mix from FPlayerPatternData.
+ */
+USTRUCT(BlueprintType)
+struct FAIActionUtility
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EAICombatAction Action = EAICombatAction::Attack;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float BaseScore = 0.0f;
+
+	// Behavior modifier weights
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Behavior")
+	float AggressionWeight = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Behavior")
+	float DefenseWeight = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Behavior")
+	float ComboWeight = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Behavior")
+	float AbilityWeight = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Behavior")
+	float BerserkBonus = 0.0f;
+
+	// Player action mix weights (fraction of recorded actions, 0-1)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Pattern")
+	float PlayerAttackWeight = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Pattern")
+	float PlayerHeavyAttackWeight = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Pattern")
+	float PlayerBlockWeight = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Pattern")
+	float PlayerParryWeight = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Pattern")
+	float PlayerDashWeight = 0.0f;
+
+	/** Added when the player's last action matches this tag (hierarchical match) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Pattern")
+	FGameplayTag RespondToPlayerAction;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Player Pattern")
+	float RespondBonus = 0.0f;
+
+	// Range scaling, in range means within the controller's attack range
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Range")
+	float InRangeScale = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Range")
+	float OutOfRangeScale = 1.0f;
+};
+
+/**
+ * Inputs the controller gathers once per think
+ */
+struct FAIDecisionContext
+{
+	bool bHasTarget = false;
+	float DistanceToTarget = 0.0f;
+	float AttackRange = 200.0f;
+	bool bCanUseSoulAttack = true;
+};
+
 /**
  * Player pattern analysis data
  */
@@ -44,9 +133,16 @@ struct FPlayerPatternData
 	UPROPERTY(BlueprintReadOnly)
 	float AverageReactionTime = 0.0f;
 
+	UPROPERTY(BlueprintReadOnly)
+	float ReactionTimeStdDev = 0.0f;
+
+	/** Most used action within the recent window */
 	UPROPERTY(BlueprintReadOnly)
 	FGameplayTag MostUsedAction;
 
+	UPROPERTY(BlueprintReadOnly)
+	EPlayerCombatStyle Style = EPlayerCombatStyle::Balanced;
+
 	UPROPERTY(BlueprintReadOnly)
 	FGameplayTag LastPlayerAction;
 
@@ -67,6 +163,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	// ========================================
@@ -80,6 +177,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AI Difficulty")
 	void CalculateDifficulty(int32 PlayerEquippedSlots);
 	
+	/**
+	 * Set the power level directly, e.g. from the run's encounter director
+	 * @param InPowerLevel Power level (1-10)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI Difficulty")
+	void SetPowerLevel(int32 InPowerLevel);
+	
 	/**
 	 * Apply difficulty scaling to the AI
 	 */
@@ -220,6 +324,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AI Difficulty|Adaptive")
 	void ResetPatternAnalysis();
 	
+	/**
+	 * Read player patterns from a room-wide model instead of recording locally
+	 * @param InSharedModel The room's player model, null to go back to the local model
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI Difficulty|Adaptive")
+	void SetSharedPlayerModel(UPlayerModelComponent* InSharedModel);
+	
+	/**
+	 * Forget the previous encounter and redo the BeginPlay setup, for enemies reused from a pool
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI Difficulty")
+	void ResetForReuse();
+	
 	// ========================================
 	// DECISION MAKING
 	// ========================================
@@ -252,6 +369,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AI Difficulty|Decisions")
 	FGameplayTag GetRecommendedAction();
 	
+	/**
+	 * Score every row of the utility table and return the best action
+	 * @param Context Target and cooldown state gathered by the controller
+	 * @param OutScore Utility of the chosen action
+	 * @return Highest scoring action
+	 */
+	EAICombatAction ChooseCombatAction(const FAIDecisionContext& Context, float& OutScore) const;
+	
+	/**
+	 * Gameplay tag the action system uses for a combat action
+	 * @param Action The scored action
+	 * @return Matching Action.Combat tag
+	 */
+	static FGameplayTag GetActionTag(EAICombatAction Action);
+	
 	// ========================================
 	// QUERIES
 	// ========================================
@@ -263,6 +395,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AI Difficulty")
 	int32 GetPowerLevel() const { return PowerLevel; }
 	
+	/**
+	 * Get the room model patterns are read from
+	 * @return The shared model, null when recording locally
+	 */
+	UFUNCTION(BlueprintPure, Category = "AI Difficulty|Adaptive")
+	UPlayerModelComponent* GetSharedPlayerModel() const { return SharedPlayerModel; }
+	
 	/**
 	 * Get difficulty rating (0-10)
 	 * @return Difficulty rating
@@ -307,6 +446,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
 	int32 PowerLevel = 1;
 	
+	/** Owner max health before any scaling, captured on the first ApplyDifficultyScaling */
+	float BaseMaxHealth = -1.0f;
+	
 	/** Damage output multiplier */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
 	float DamageMultiplier = 1.0f;
@@ -375,6 +517,18 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Adaptive")
 	int32 MinActionsForAdaptation = 10;
 	
+	// ========================================
+	// DECISIONS
+	// ========================================
+	
+	/** Utility table scored by ChooseCombatAction, one row per candidate action */
+	UPROPERTY(EditDefaultsOnly, Category = "Decisions")
+	TArray<FAIActionUtility> ActionUtilities;
+	
+	/** Random score added to each row so equal scores don't always resolve the same way */
+	UPROPERTY(EditDefaultsOnly, Category = "Decisions", meta = (ClampMin = "0.0"))
+	float DecisionNoise = 0.05f;
+	
 	// ========================================
 	// CONFIGURATION
 	// ========================================
@@ -397,7 +551,21 @@ protected:
 	UPROPERTY()
 	class AGameCharacterBase* OwnerCharacter;
 	
-	/** Time tracking for pattern analysis */
-	float LastActionTime = 0.0f;
-	TArray<float> ReactionTimes;
+	/** Room-wide player model shared with the other enemies in the room */
+	UPROPERTY()
+	UPlayerModelComponent* SharedPlayerModel;
+	
+	/** Used when no room model is available */
+	FPlayerActionModel LocalPlayerModel;
+	
+	FDelegateHandle SharedModelHandle;
+	
+	/** Style the current adaptation was made for */
+	EPlayerCombatStyle AdaptedStyle = EPlayerCombatStyle::Balanced;
+	
+	void HandleSharedModelUpdated();
+	
+	/** Difficulty, scaling and room model lookup shared by BeginPlay and ResetForReuse */
+	void InitializeDifficulty();
+	const FPlayerActionModel& GetActivePlayerModel() const;
 };
\ No newline at end of file
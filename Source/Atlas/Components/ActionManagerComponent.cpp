@@ -9,6 +9,8 @@
 #include "../Data/CombatRulesDataAsset.h"
 #include "../Data/StationIntegrityDataAsset.h"
 #include "../Core/AtlasGameState.h"
+#include "../Core/AtlasLog.h"
+#include "../Core/AtlasStats.h"
 #include "GameFramework/Character.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
@@ -193,14 +195,14 @@ void UActionManagerComponent::OnSlotPressed(FName SlotName)
 	{
 		if (!PlayerChar->AreAbilityInputsEnabled())
 		{
-			UE_LOG(LogTemp, Error, TEXT("INPUT BLOCKED: Ability inputs disabled, cannot use %s"), *SlotName.ToString());
+			UE_LOG(LogAtlasActions, Verbose, TEXT("INPUT BLOCKED: Ability inputs disabled, cannot use %s"), *SlotName.ToString());
 			return;
 		}
 	}
 
 	// Check if we're in an attack state and not in a combo window
 	bool bIsAttacking = IsAttacking();
-	UE_LOG(LogTemp, Warning, TEXT("OnSlotPressed %s - IsAttacking: %s, ComboWindow: %s"), 
+	UE_LOG(LogAtlasActions, Verbose, TEXT("OnSlotPressed %s - IsAttacking: %s, ComboWindow: %s"), 
 		*SlotName.ToString(), 
 		bIsAttacking ? TEXT("TRUE") : TEXT("FALSE"),
 		bComboWindowActive ? TEXT("ACTIVE") : TEXT("INACTIVE"));
@@ -208,7 +210,7 @@ void UActionManagerComponent::OnSlotPressed(FName SlotName)
 	if (bIsAttacking && !bComboWindowActive)
 	{
 		// Block all action inputs while attacking (except during combo windows)
-		UE_LOG(LogTemp, Error, TEXT("INPUT BLOCKED: Cannot use %s while attacking (not in combo window)"), *SlotName.ToString());
+		UE_LOG(LogAtlasActions, Verbose, TEXT("INPUT BLOCKED: Cannot use %s while attacking (not in combo window)"), *SlotName.ToString());
 		return;
 	}
 
@@ -217,7 +219,7 @@ void UActionManagerComponent::OnSlotPressed(FName SlotName)
 	{
 		BufferedSlot = SlotName;
 		BufferedInputTime = GetWorld()->GetTimeSeconds();
-		UE_LOG(LogTemp, Log, TEXT("Buffered input: %s during combo window %s"), *SlotName.ToString(), *CurrentComboWindow.ToString());
+		UE_LOG(LogAtlasActions, Verbose, TEXT("Buffered input: %s during combo window %s"), *SlotName.ToString(), *CurrentComboWindow.ToString());
 		return;
 	}
 
@@ -230,7 +232,7 @@ void UActionManagerComponent::OnSlotPressed(FName SlotName)
 	// Check if this is the same action already active
 	if (CurrentAction && CurrentAction == Action && CurrentAction->IsActive())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Same action already active, ignoring press for %s"), *SlotName.ToString());
+		UE_LOG(LogAtlasActions, Verbose, TEXT("Same action already active, ignoring press for %s"), *SlotName.ToString());
 		return;
 	}
 	
@@ -253,7 +255,7 @@ void UActionManagerComponent::OnSlotPressed(FName SlotName)
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Action cannot activate: %s"), *SlotName.ToString());
+		UE_LOG(LogAtlasActions, Verbose, TEXT("Action cannot activate: %s"), *SlotName.ToString());
 	}
 }
 
@@ -282,6 +284,42 @@ void UActionManagerComponent::InterruptCurrentAction()
 	}
 }
 
+void UActionManagerComponent::ResetActions()
+{
+	InterruptCurrentAction();
+	CurrentAction = nullptr;
+	CurrentActionData = nullptr;
+
+	bComboWindowActive = false;
+	CurrentComboWindow = NAME_None;
+	BufferedSlot = NAME_None;
+	BufferedInputTime = 0.0f;
+
+	CombatStateTags.Reset();
+	LastCombatActionTime = 0.0f;
+	bIsParrying = false;
+	ParryStartTime = 0.0f;
+
+	// Park every slotted instance, then the defaults pick theirs back up
+	for (auto& Slot : ActionSlots)
+	{
+		if (Slot.Value)
+		{
+			if (UActionDataAsset* ActionData = Slot.Value->GetActionData())
+			{
+				SpareActionInstances.Add(ActionData, Slot.Value);
+			}
+			Slot.Value = nullptr;
+			OnActionSlotChanged.Broadcast(Slot.Key, nullptr);
+		}
+	}
+
+	for (const auto& DefaultSlot : DefaultSlotAssignments)
+	{
+		AssignActionToSlot(DefaultSlot.Key, DefaultSlot.Value);
+	}
+}
+
 void UActionManagerComponent::LoadAvailableActions()
 {
 	// If actions were already set in editor, keep them but still try to load defaults
@@ -334,7 +372,13 @@ UActionInstance* UActionManagerComponent::CreateActionInstance(UActionDataAsset*
 		return nullptr;
 	}
 
-	UActionInstance* NewAction = NewObject<UActionInstance>(this, UActionInstance::StaticClass());
+	// Reuse an instance parked by ResetActions before allocating
+	UActionInstance* NewAction = nullptr;
+	if (!SpareActionInstances.RemoveAndCopyValue(ActionData, NewAction))
+	{
+		NewAction = NewObject<UActionInstance>(this, UActionInstance::StaticClass());
+	}
+
 	if (NewAction)
 	{
 		NewAction->Initialize(ActionData);
@@ -344,6 +388,8 @@ UActionInstance* UActionManagerComponent::CreateActionInstance(UActionDataAsset*
 
 void UActionManagerComponent::TickActions(float DeltaTime)
 {
+	ATLAS_SCOPE_CYCLE_COUNTER(TickActions, "Atlas.ActionManager.TickActions");
+
 	// Tick all actions for cooldown and other updates
 	for (const auto& Slot : ActionSlots)
 	{
@@ -86,6 +86,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Action Manager")
 	UActionInstance* GetCurrentAction() const { return CurrentAction; }
 
+	/**
+	 * Back to a freshly spawned state: no running action, combo or combat state, and only the
+	 * default slot assignments. Instances that leave their slot are kept and handed out again
+	 * when the same action is assigned, so a pooled enemy rebinds its abilities without allocating.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Action Manager")
+	void ResetActions();
+
 	UFUNCTION(BlueprintPure, Category = "Action Manager")
 	bool IsActionActive() const { return CurrentAction != nullptr && CurrentAction->IsActive(); }
 
@@ -244,6 +252,10 @@ protected:
 	// Default slot assignments (for testing)
 	UPROPERTY(EditDefaultsOnly, Category = "Action Manager|Config")
 	TMap<FName, FGameplayTag> DefaultSlotAssignments;
+
+	// Instances taken out of their slot by ResetActions, reused by CreateActionInstance
+	UPROPERTY()
+	TMap<UActionDataAsset*, UActionInstance*> SpareActionInstances;
 	
 	// Combo system state
 	bool bComboWindowActive = false;
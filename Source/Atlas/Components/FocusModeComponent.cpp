@@ -3,6 +3,7 @@
 #include "../Interfaces/IInteractable.h"
 // #include "../Core/AtlasGameplayTags.h" // TODO: Fix AtlasGameplayTags compilation
 #include "../Characters/GameCharacterBase.h"
+#include "../Core/AtlasStats.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/World.h"
@@ -113,6 +114,8 @@ void UFocusModeComponent::ToggleFocusMode()
 
 void UFocusModeComponent::ScanForTargets()
 {
+    ATLAS_SCOPE_CYCLE_COUNTER(FocusScan, "Atlas.FocusMode.ScanForTargets");
+
     PotentialTargets.Empty();
     
     if (!GetOwner() || !CachedCamera)
@@ -1,7 +1,9 @@
 #include "HealthComponent.h"
 #include "ActionManagerComponent.h"
+#include "Atlas/AI/EnemyPoolSubsystem.h"
+#include "Atlas/Core/AtlasLog.h"
+#include "Atlas/Debug/AtlasDebugDraw.h"
 #include "GameFramework/Actor.h"
-#include "Engine/Engine.h"
 #include "TimerManager.h"
 #include "GameFramework/Character.h"
 #include "Animation/AnimInstance.h"
@@ -36,9 +38,11 @@ void UHealthComponent::TakeDamage(float DamageAmount, AActor* DamageInstigator)
     OnDamageTaken.Broadcast(ActualDamage, DamageInstigator);
     BroadcastHealthChange(-ActualDamage);
 
-    // Damage taken - will add UI later
+    UE_LOG(LogAtlasHealth, Verbose, TEXT("%s took %.1f damage from %s. Health: %.1f/%.1f"),
+        *GetOwner()->GetName(), ActualDamage, DamageInstigator ? *DamageInstigator->GetName() : TEXT("Unknown"), CurrentHealth, MaxHealth);
 
-    // Will add damage UI feedback later
+    ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Message(this, GetOwner()->GetUniqueID(),
+        FString::Printf(TEXT("%s Health: %.0f/%.0f (-%.0f)"), *GetOwner()->GetName(), CurrentHealth, MaxHealth, ActualDamage), FColor::Red, 2.0f));
 
     if (CurrentHealth <= 0.0f && !bIsDead)
     {
@@ -59,15 +63,11 @@ void UHealthComponent::Heal(float HealAmount, AActor* HealInstigator)
     OnHealed.Broadcast(ActualHeal, HealInstigator);
     BroadcastHealthChange(ActualHeal);
 
-    UE_LOG(LogTemp, Log, TEXT("%s healed for %.1f. Health: %.1f/%.1f"), 
+    UE_LOG(LogAtlasHealth, Verbose, TEXT("%s healed for %.1f. Health: %.1f/%.1f"), 
         *GetOwner()->GetName(), ActualHeal, CurrentHealth, MaxHealth);
 
-    if (GEngine)
-    {
-        FString DebugMessage = FString::Printf(TEXT("%s Health: %.0f/%.0f (+%.0f)"),
-            *GetOwner()->GetName(), CurrentHealth, MaxHealth, ActualHeal);
-        GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Green, DebugMessage);
-    }
+    ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Message(this, GetOwner()->GetUniqueID(),
+        FString::Printf(TEXT("%s Health: %.0f/%.0f (+%.0f)"), *GetOwner()->GetName(), CurrentHealth, MaxHealth, ActualHeal), FColor::Green, 2.0f));
 }
 
 void UHealthComponent::SetMaxHealth(float NewMaxHealth, bool bScaleCurrentHealth)
@@ -112,7 +112,34 @@ void UHealthComponent::ReviveWithHealth(float ReviveHealth)
     OnRevived.Broadcast();
     BroadcastHealthChange(CurrentHealth);
 
-    UE_LOG(LogTemp, Log, TEXT("%s revived with %.1f health"), *GetOwner()->GetName(), CurrentHealth);
+    UE_LOG(LogAtlasHealth, Log, TEXT("%s revived with %.1f health"), *GetOwner()->GetName(), CurrentHealth);
+}
+
+void UHealthComponent::ResetHealth()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(PoiseRegenTimerHandle);
+        World->GetTimerManager().ClearTimer(StaggerRecoveryTimerHandle);
+    }
+
+    // Max health may have been scaled by difficulty, and invincibility toggled at runtime
+    if (const UHealthComponent* Defaults = Cast<UHealthComponent>(GetArchetype()))
+    {
+        MaxHealth = Defaults->MaxHealth;
+        bIsInvincible = Defaults->bIsInvincible;
+    }
+
+    CurrentHealth = MaxHealth;
+    CurrentPoise = MaxPoise;
+    bIsDead = false;
+    bIsStaggered = false;
+    PoiseRegenDelayTime = 0.0f;
+    bPoiseRegenActive = false;
+    LastDamageInstigator = nullptr;
+
+    BroadcastHealthChange(0.0f);
+    BroadcastPoiseChange(0.0f);
 }
 
 float UHealthComponent::GetHealthPercent() const
@@ -139,15 +166,12 @@ void UHealthComponent::HandleDeath(AActor* KilledBy)
 
     OnDeath.Broadcast(KilledBy);
 
-    UE_LOG(LogTemp, Warning, TEXT("%s has died! Killed by: %s"), 
+    UE_LOG(LogAtlasHealth, Log, TEXT("%s has died! Killed by: %s"), 
         *GetOwner()->GetName(), 
         KilledBy ? *KilledBy->GetName() : TEXT("Unknown"));
 
-    if (GEngine)
-    {
-        FString DebugMessage = FString::Printf(TEXT("%s DIED!"), *GetOwner()->GetName());
-        GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, DebugMessage);
-    }
+    ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Message(this, GetOwner()->GetUniqueID(),
+        FString::Printf(TEXT("%s DIED!"), *GetOwner()->GetName()), FColor::Red, 5.0f));
     
     // Destroy the actor after a delay (to allow death animations)
     // Don't destroy player characters
@@ -159,8 +183,16 @@ void UHealthComponent::HandleDeath(AActor* KilledBy)
         
         if (!bIsPlayer)
         {
-            // Destroy after 3 seconds to allow death animations
-            Owner->SetLifeSpan(3.0f);
+            // Destroy after 3 seconds to allow death animations, pooled enemies go back to their pool instead
+            UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(Owner);
+            if (Pool && Pool->IsPooled(Owner))
+            {
+                Pool->ReleaseAfter(Owner, 3.0f);
+            }
+            else
+            {
+                Owner->SetLifeSpan(3.0f);
+            }
         }
     }
 }
@@ -227,11 +259,9 @@ void UHealthComponent::TakePoiseDamage(float PoiseDamage, AActor* DamageInstigat
             false
         );
         
-        if (GEngine)
-        {
-            FString DebugMessage = FString::Printf(TEXT("%s STAGGERED!"), *GetOwner()->GetName());
-            GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Yellow, DebugMessage);
-        }
+        UE_LOG(LogAtlasHealth, Verbose, TEXT("%s staggered"), *GetOwner()->GetName());
+        ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Message(this, GetOwner()->GetUniqueID(),
+            FString::Printf(TEXT("%s STAGGERED!"), *GetOwner()->GetName()), FColor::Yellow, 2.0f));
     }
 }
 
@@ -318,9 +348,6 @@ void UHealthComponent::RecoverFromStagger()
     OnStaggerRecovered.Broadcast();
     ResetPoise();
     
-    if (GEngine)
-    {
-        FString DebugMessage = FString::Printf(TEXT("%s recovered from stagger"), *GetOwner()->GetName());
-        GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::Green, DebugMessage);
-    }
+    ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Message(this, GetOwner()->GetUniqueID(),
+        FString::Printf(TEXT("%s recovered from stagger"), *GetOwner()->GetName()), FColor::Green, 1.0f));
 }
\ No newline at end of file
@@ -68,6 +68,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Health")
     void ReviveWithHealth(float ReviveHealth);
 
+    /** Back to a freshly spawned state: full health and poise, not dead or staggered, timers cleared */
+    UFUNCTION(BlueprintCallable, Category = "Health")
+    void ResetHealth();
+
     UFUNCTION(BlueprintCallable, Category = "Health")
     float GetHealthPercent() const;
 
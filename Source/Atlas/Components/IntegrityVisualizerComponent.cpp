@@ -1,6 +1,7 @@
 // IntegrityVisualizerComponent.cpp
 #include "IntegrityVisualizerComponent.h"
 #include "StationIntegrityComponent.h"
+#include "../Core/AtlasStats.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Character.h"
@@ -28,6 +29,9 @@ UIntegrityVisualizerComponent::UIntegrityVisualizerComponent()
     CurrentFlickerInterval = 0.0f;
     bStrobeActive = false;
     bEmergencyLightingActive = false;
+    // Full strength until a station integrity component reports otherwise
+    BreachStrengthMultiplier = 1.0f;
+    BoundIntegrityComponent = nullptr;
 }
 
 void UIntegrityVisualizerComponent::BeginPlay()
@@ -37,10 +41,24 @@ void UIntegrityVisualizerComponent::BeginPlay()
     // Cache all lights in the scene
     UGameplayStatics::GetAllActorsOfClass(GetWorld(), ALight::StaticClass(), 
         reinterpret_cast<TArray<AActor*>&>(SceneLights));
+    
+    // Breach strength follows the station's integrity thresholds
+    BoundIntegrityComponent = FindStationIntegrity();
+    if (BoundIntegrityComponent)
+    {
+        BoundIntegrityComponent->OnIntegrityChanged.AddDynamic(this, &UIntegrityVisualizerComponent::HandleStationIntegrityChanged);
+        HandleStationIntegrityChanged(BoundIntegrityComponent->GetCurrentIntegrity(), BoundIntegrityComponent->GetMaxIntegrity(), 0.0f);
+    }
 }
 
 void UIntegrityVisualizerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    if (IsValid(BoundIntegrityComponent))
+    {
+        BoundIntegrityComponent->OnIntegrityChanged.RemoveDynamic(this, &UIntegrityVisualizerComponent::HandleStationIntegrityChanged);
+    }
+    BoundIntegrityComponent = nullptr;
+    
     // Clean up all active effects
     ClearAllEffects();
     
@@ -50,39 +68,142 @@ void UIntegrityVisualizerComponent::EndPlay(const EEndPlayReason::Type EndPlayRe
 void UIntegrityVisualizerComponent::TickComponent(float DeltaTime, ELevelTick TickType, 
     FActorComponentTickFunction* ThisTickFunction)
 {
+    ATLAS_SCOPE_CYCLE_COUNTER(IntegrityVisualizerTick, "Atlas.IntegrityVisualizer.Tick");
+
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     // Update active hull breaches
-    for (FHullBreachData& Breach : ActiveBreaches)
+    UpdateBreachForceField();
+}
+
+EIntegrityState UIntegrityVisualizerComponent::GetIntegrityStateForPercent(float IntegrityPercent) const
+{
+    if (IntegrityPercent <= CriticalThreshold)
     {
-        if (Breach.VacuumEffect)
-        {
-            // Apply suction force to nearby actors
-            ApplySuctionForce(Breach.Location, Breach.Radius, Breach.Severity);
-        }
+        return EIntegrityState::Critical;
     }
+    if (IntegrityPercent <= WarningThreshold)
+    {
+        return EIntegrityState::Warning;
+    }
+    if (IntegrityPercent <= MinorDamageThreshold)
+    {
+        return EIntegrityState::MinorDamage;
+    }
+    return EIntegrityState::Normal;
 }
 
-void UIntegrityVisualizerComponent::UpdateIntegrityVisuals(float CurrentIntegrity)
+void UIntegrityVisualizerComponent::HandleStationIntegrityChanged(float CurrentIntegrity, float MaxIntegrity, float IntegrityDelta)
 {
-    float IntegrityPercent = FMath::Clamp(CurrentIntegrity, 0.0f, 100.0f);
+    const float IntegrityPercent = MaxIntegrity > 0.0f ? (CurrentIntegrity / MaxIntegrity) * 100.0f : 0.0f;
     
-    // Determine new state
-    EIntegrityState NewState = EIntegrityState::Normal;
+    switch (GetIntegrityStateForPercent(IntegrityPercent))
+    {
+        case EIntegrityState::Critical:
+            BreachStrengthMultiplier = CriticalBreachStrength;
+            break;
+        case EIntegrityState::Warning:
+            BreachStrengthMultiplier = WarningBreachStrength;
+            break;
+        case EIntegrityState::MinorDamage:
+            BreachStrengthMultiplier = MinorDamageBreachStrength;
+            break;
+        case EIntegrityState::Normal:
+            BreachStrengthMultiplier = NormalBreachStrength;
+            break;
+    }
+}
+
+void UIntegrityVisualizerComponent::UpdateBreachForceField()
+{
+    if (ActiveBreaches.Num() == 0 || BreachStrengthMultiplier <= 0.0f) return;
     
-    if (IntegrityPercent <= CriticalThreshold)
+    // One box query covering every breach instead of one sphere query per breach
+    FBox BreachBounds(ForceInit);
+    for (const FHullBreachData& Breach : ActiveBreaches)
+    {
+        BreachBounds += FBox::BuildAABB(Breach.Location, FVector(Breach.Radius));
+    }
+    
+    TArray<FOverlapResult> Overlaps;
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(HullBreachSuction), false);
+    GetWorld()->OverlapMultiByChannel(
+        Overlaps,
+        BreachBounds.GetCenter(),
+        FQuat::Identity,
+        ECC_WorldDynamic,
+        FCollisionShape::MakeBox(BreachBounds.GetExtent()),
+        QueryParams
+    );
+    
+    // Sum the pull of every breach on each body
+    AccumulatedSuction.Reset();
+    for (const FOverlapResult& Overlap : Overlaps)
     {
-        NewState = EIntegrityState::Critical;
+        AActor* Actor = Overlap.GetActor();
+        if (!Actor || AccumulatedSuction.Contains(Actor)) continue;
+        
+        const FVector ActorLocation = Actor->GetActorLocation();
+        FVector Suction = FVector::ZeroVector;
+        
+        for (const FHullBreachData& Breach : ActiveBreaches)
+        {
+            FVector ToCenter = Breach.Location - ActorLocation;
+            const float Distance = ToCenter.Size();
+            
+            if (Distance > 10.0f && Distance < Breach.Radius)
+            {
+                // Apply force based on distance
+                const float ForceMultiplier = 1.0f - (Distance / Breach.Radius);
+                Suction += (ToCenter / Distance) * 1000.0f * Breach.Severity * ForceMultiplier;
+            }
+        }
+        
+        AccumulatedSuction.Add(Actor, Suction * BreachStrengthMultiplier);
     }
-    else if (IntegrityPercent <= WarningThreshold)
+    
+    // One combined impulse per body
+    for (const TPair<AActor*, FVector>& Entry : AccumulatedSuction)
     {
-        NewState = EIntegrityState::Warning;
+        if (Entry.Value.IsNearlyZero()) continue;
+        
+        if (ACharacter* Character = Cast<ACharacter>(Entry.Key))
+        {
+            Character->LaunchCharacter(Entry.Value, false, false);
+        }
+        else if (UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(Entry.Key->GetRootComponent()))
+        {
+            if (PrimComp->IsSimulatingPhysics())
+            {
+                PrimComp->AddImpulse(Entry.Value * PrimComp->GetMass());
+            }
+        }
     }
-    else if (IntegrityPercent <= MinorDamageThreshold)
+}
+
+UStationIntegrityComponent* UIntegrityVisualizerComponent::FindStationIntegrity() const
+{
+    if (UStationIntegrityComponent* OwnerIntegrity = GetOwner()->FindComponentByClass<UStationIntegrityComponent>())
+    {
+        return OwnerIntegrity;
+    }
+    
+    // Station integrity normally lives on the player character
+    if (APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0))
     {
-        NewState = EIntegrityState::MinorDamage;
+        return PlayerPawn->FindComponentByClass<UStationIntegrityComponent>();
     }
     
+    return nullptr;
+}
+
+void UIntegrityVisualizerComponent::UpdateIntegrityVisuals(float CurrentIntegrity)
+{
+    float IntegrityPercent = FMath::Clamp(CurrentIntegrity, 0.0f, 100.0f);
+    
+    // Determine new state
+    EIntegrityState NewState = GetIntegrityStateForPercent(IntegrityPercent);
+    
     // Handle state change
     if (NewState != CurrentState)
     {
@@ -216,7 +337,7 @@ void UIntegrityVisualizerComponent::TriggerHullBreach(FVector Location)
     }
     
     // Apply initial impulse to nearby actors
-    ApplySuctionForce(Location, Breach.Radius, Breach.Severity * 2.0f);
+    ApplySuctionForce(Location, Breach.Radius, Breach.Severity * 2.0f * BreachStrengthMultiplier);
     
     // Spawn debris
     SpawnDebris(Location, Breach.Severity);
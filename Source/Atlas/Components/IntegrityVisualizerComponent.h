@@ -84,6 +84,19 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Integrity")
     float MinorDamageThreshold = 75.0f;
     
+    // Suction strength of hull breaches for each integrity state
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Integrity|Hull Breach")
+    float NormalBreachStrength = 0.25f;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Integrity|Hull Breach")
+    float MinorDamageBreachStrength = 0.5f;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Integrity|Hull Breach")
+    float WarningBreachStrength = 0.75f;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Integrity|Hull Breach")
+    float CriticalBreachStrength = 1.0f;
+    
     // Visual effect assets
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
     UParticleSystem* SparksEffect;
@@ -139,6 +152,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Integrity")
     void ClearAllEffects();
     
+    // Pulls every body near any active breach with one combined broadphase query
+    UFUNCTION(BlueprintCallable, Category = "Integrity")
+    void UpdateBreachForceField();
+    
+    UFUNCTION(BlueprintPure, Category = "Integrity")
+    EIntegrityState GetIntegrityStateForPercent(float IntegrityPercent) const;
+    
+    UFUNCTION(BlueprintPure, Category = "Integrity")
+    float GetBreachStrengthMultiplier() const { return BreachStrengthMultiplier; }
+    
+    const TArray<FHullBreachData>& GetActiveBreaches() const { return ActiveBreaches; }
+    
     // Get current integrity state
     UFUNCTION(BlueprintPure, Category = "Integrity")
     EIntegrityState GetCurrentIntegrityState() const { return CurrentState; }
@@ -157,6 +182,9 @@ protected:
     
     UFUNCTION(BlueprintImplementableEvent, Category = "Integrity")
     void OnElectricalFailureTriggered(const FVector& Location);
+    
+    UFUNCTION()
+    void HandleStationIntegrityChanged(float CurrentIntegrity, float MaxIntegrity, float IntegrityDelta);
 
 private:
     // State management
@@ -191,6 +219,7 @@ private:
     void StopAllAudio();
     
     // Helper functions
+    class UStationIntegrityComponent* FindStationIntegrity() const;
     void ApplySuctionForce(const FVector& Location, float Radius, float Severity);
     void SpawnDebris(const FVector& Location, float Severity);
     class UParticleSystemComponent* SpawnVacuumParticles(const FVector& Location);
@@ -202,6 +231,15 @@ private:
     
     // Active effects
     TArray<FHullBreachData> ActiveBreaches;
+    
+    // Breach suction scale from the station integrity thresholds
+    float BreachStrengthMultiplier;
+    
+    // Per-update suction accumulated for each body across all breaches, kept to reuse its allocation
+    TMap<AActor*, FVector> AccumulatedSuction;
+    
+    UPROPERTY()
+    class UStationIntegrityComponent* BoundIntegrityComponent;
     TArray<class UParticleSystemComponent*> ActiveParticles;
     TArray<class UAudioComponent*> ActiveAudioComponents;
     
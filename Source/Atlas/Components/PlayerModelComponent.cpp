@@ -0,0 +1,349 @@
+#include "PlayerModelComponent.h"
+#include "Atlas/Components/AIDifficultyComponent.h"
+#include "Atlas/Components/ActionManagerComponent.h"
+#include "Atlas/Actions/ActionInstance.h"
+#include "Engine/World.h"
+
+// ========================================
+// FSlidingWindowStats
+// ========================================
+
+FSlidingWindowStats::FSlidingWindowStats(int32 InCapacity)
+	: Capacity(FMath::Max(InCapacity, 1))
+{
+	Samples.Reserve(Capacity);
+}
+
+void FSlidingWindowStats::Add(float Value)
+{
+	if (Samples.Num() < Capacity)
+	{
+		Samples.Add(Value);
+	}
+	else
+	{
+		// Overwrite the oldest sample
+		const float Oldest = Samples[Head];
+		Sum -= Oldest;
+		SumSquares -= static_cast<double>(Oldest) * Oldest;
+		Samples[Head] = Value;
+		Head = (Head + 1) % Capacity;
+	}
+
+	Sum += Value;
+	SumSquares += static_cast<double>(Value) * Value;
+
+	if (++AddsSinceResum >= Capacity * 1024)
+	{
+		Resum();
+	}
+}
+
+void FSlidingWindowStats::Reset()
+{
+	Samples.Reset();
+	Head = 0;
+	AddsSinceResum = 0;
+	Sum = 0.0;
+	SumSquares = 0.0;
+}
+
+float FSlidingWindowStats::GetMean() const
+{
+	return Samples.Num() > 0 ? static_cast<float>(Sum / Samples.Num()) : 0.0f;
+}
+
+float FSlidingWindowStats::GetVariance() const
+{
+	if (Samples.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	const double Mean = Sum / Samples.Num();
+	return static_cast<float>(FMath::Max(SumSquares / Samples.Num() - Mean * Mean, 0.0));
+}
+
+void FSlidingWindowStats::Resum()
+{
+	Sum = 0.0;
+	SumSquares = 0.0;
+	for (float Sample : Samples)
+	{
+		Sum += Sample;
+		SumSquares += static_cast<double>(Sample) * Sample;
+	}
+	AddsSinceResum = 0;
+}
+
+// ========================================
+// FPlayerActionModel
+// ========================================
+
+FPlayerActionModel::FPlayerActionModel(int32 InWindowSize, float InStyleHalfLife)
+	: StyleHalfLife(InStyleHalfLife)
+	, WindowSize(FMath::Max(InWindowSize, 1))
+	, ReactionTimes(InWindowSize)
+{
+	Reset();
+}
+
+void FPlayerActionModel::Reset()
+{
+	FMemory::Memzero(Counts);
+	FMemory::Memzero(WindowCounts);
+	FMemory::Memzero(StyleWeights);
+	TotalActions = 0;
+
+	RecentCategories.Reset();
+	RecentCategories.Reserve(WindowSize);
+	RecentHead = 0;
+
+	ReactionTimes.Reset();
+	StyleTime = 0.0;
+	LastAction = FGameplayTag();
+	LastActionTime = -1.0;
+}
+
+EPlayerActionCategory FPlayerActionModel::ClassifyAction(const FGameplayTag& ActionTag)
+{
+	// Exact tags seeded once, anything else is resolved through the tag hierarchy
+	// on first sight and remembered
+	static TMap<FGameplayTag, EPlayerActionCategory> CategoryTable;
+	if (CategoryTable.Num() == 0)
+	{
+		for (int32 i = 0; i < NumCategories; ++i)
+		{
+			const FGameplayTag CategoryTag = GetCategoryTag(static_cast<EPlayerActionCategory>(i));
+			if (CategoryTag.IsValid())
+			{
+				CategoryTable.Add(CategoryTag, static_cast<EPlayerActionCategory>(i));
+			}
+		}
+	}
+
+	if (!ActionTag.IsValid())
+	{
+		return EPlayerActionCategory::Other;
+	}
+
+	if (const EPlayerActionCategory* Found = CategoryTable.Find(ActionTag))
+	{
+		return *Found;
+	}
+
+	EPlayerActionCategory Category = EPlayerActionCategory::Other;
+	for (int32 i = 0; i < NumCategories; ++i)
+	{
+		const FGameplayTag CategoryTag = GetCategoryTag(static_cast<EPlayerActionCategory>(i));
+		if (CategoryTag.IsValid() && ActionTag.MatchesTag(CategoryTag))
+		{
+			Category = static_cast<EPlayerActionCategory>(i);
+			break;
+		}
+	}
+
+	CategoryTable.Add(ActionTag, Category);
+	return Category;
+}
+
+FGameplayTag FPlayerActionModel::GetCategoryTag(EPlayerActionCategory Category)
+{
+	static const FGameplayTag AttackTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.BasicAttack"));
+	static const FGameplayTag HeavyAttackTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.HeavyAttack"));
+	static const FGameplayTag BlockTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Block"));
+	static const FGameplayTag ParryTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Parry"));
+	static const FGameplayTag DashTag = FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Dash"));
+
+	switch (Category)
+	{
+		case EPlayerActionCategory::Attack:
+			return AttackTag;
+		case EPlayerActionCategory::HeavyAttack:
+			return HeavyAttackTag;
+		case EPlayerActionCategory::Block:
+			return BlockTag;
+		case EPlayerActionCategory::Parry:
+			return ParryTag;
+		case EPlayerActionCategory::Dash:
+			return DashTag;
+		default:
+			return FGameplayTag();
+	}
+}
+
+void FPlayerActionModel::RecordAction(const FGameplayTag& ActionTag, double Time)
+{
+	const EPlayerActionCategory Category = ClassifyAction(ActionTag);
+	const int32 CategoryIndex = static_cast<int32>(Category);
+
+	++Counts[CategoryIndex];
+	++TotalActions;
+
+	// Category window
+	if (RecentCategories.Num() < WindowSize)
+	{
+		RecentCategories.Add(Category);
+	}
+	else
+	{
+		--WindowCounts[static_cast<int32>(RecentCategories[RecentHead])];
+		RecentCategories[RecentHead] = Category;
+		RecentHead = (RecentHead + 1) % WindowSize;
+	}
+	++WindowCounts[CategoryIndex];
+
+	// Interval window
+	if (LastActionTime >= 0.0)
+	{
+		ReactionTimes.Add(static_cast<float>(Time - LastActionTime));
+	}
+	LastAction = ActionTag;
+	LastActionTime = Time;
+
+	// Decay the profile up to now, then add this action at full weight
+	if (StyleHalfLife > 0.0f && Time > StyleTime)
+	{
+		const float Decay = FMath::Exp(-UE_LN2 * static_cast<float>(Time - StyleTime) / StyleHalfLife);
+		for (float& Weight : StyleWeights)
+		{
+			Weight *= Decay;
+		}
+	}
+	StyleTime = FMath::Max(StyleTime, Time);
+	StyleWeights[CategoryIndex] += 1.0f;
+}
+
+EPlayerCombatStyle FPlayerActionModel::GetStyle() const
+{
+	const float Defensive = StyleWeights[static_cast<int32>(EPlayerActionCategory::Block)] +
+		StyleWeights[static_cast<int32>(EPlayerActionCategory::Parry)];
+	const float Offensive = StyleWeights[static_cast<int32>(EPlayerActionCategory::Attack)] +
+		StyleWeights[static_cast<int32>(EPlayerActionCategory::HeavyAttack)];
+	const float Evasive = StyleWeights[static_cast<int32>(EPlayerActionCategory::Dash)];
+
+	if (Defensive > Offensive && Defensive > Evasive)
+	{
+		return EPlayerCombatStyle::Defensive;
+	}
+	if (Offensive > Defensive && Offensive > Evasive)
+	{
+		return EPlayerCombatStyle::Aggressive;
+	}
+	if (Evasive > Defensive && Evasive > Offensive)
+	{
+		return EPlayerCombatStyle::Evasive;
+	}
+	return EPlayerCombatStyle::Balanced;
+}
+
+void FPlayerActionModel::FillPatternData(FPlayerPatternData& OutPattern) const
+{
+	OutPattern.AttackCount = GetCount(EPlayerActionCategory::Attack);
+	OutPattern.HeavyAttackCount = GetCount(EPlayerActionCategory::HeavyAttack);
+	OutPattern.BlockCount = GetCount(EPlayerActionCategory::Block);
+	OutPattern.ParryCount = GetCount(EPlayerActionCategory::Parry);
+	OutPattern.DashCount = GetCount(EPlayerActionCategory::Dash);
+	OutPattern.AverageReactionTime = ReactionTimes.GetMean();
+	OutPattern.ReactionTimeStdDev = ReactionTimes.GetStdDev();
+	OutPattern.LastPlayerAction = LastAction;
+	OutPattern.Style = GetStyle();
+
+	// Most used action within the recent window
+	int32 BestIndex = INDEX_NONE;
+	for (int32 i = 0; i < NumCategories; ++i)
+	{
+		if (GetCategoryTag(static_cast<EPlayerActionCategory>(i)).IsValid() &&
+			WindowCounts[i] > 0 && (BestIndex == INDEX_NONE || WindowCounts[i] > WindowCounts[BestIndex]))
+		{
+			BestIndex = i;
+		}
+	}
+	OutPattern.MostUsedAction = BestIndex != INDEX_NONE ? GetCategoryTag(static_cast<EPlayerActionCategory>(BestIndex)) : FGameplayTag();
+}
+
+// ========================================
+// UPlayerModelComponent
+// ========================================
+
+UPlayerModelComponent::UPlayerModelComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	BoundActionManager = nullptr;
+}
+
+void UPlayerModelComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Window size is only known once properties are loaded
+	Model = FPlayerActionModel(WindowSize, StyleHalfLife);
+}
+
+void UPlayerModelComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindFromPlayer();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UPlayerModelComponent::BindToPlayer(AActor* PlayerActor)
+{
+	UActionManagerComponent* ActionManager = PlayerActor ? PlayerActor->FindComponentByClass<UActionManagerComponent>() : nullptr;
+	if (ActionManager == BoundActionManager)
+	{
+		return;
+	}
+
+	UnbindFromPlayer();
+
+	if (ActionManager)
+	{
+		ActionManager->OnActionActivated.AddDynamic(this, &UPlayerModelComponent::HandleActionActivated);
+		BoundActionManager = ActionManager;
+	}
+}
+
+void UPlayerModelComponent::UnbindFromPlayer()
+{
+	if (IsValid(BoundActionManager))
+	{
+		BoundActionManager->OnActionActivated.RemoveDynamic(this, &UPlayerModelComponent::HandleActionActivated);
+	}
+	BoundActionManager = nullptr;
+}
+
+void UPlayerModelComponent::RecordPlayerAction(FGameplayTag ActionTag)
+{
+	if (GFrameCounter == LastRecordFrame && ActionTag == Model.GetLastAction())
+	{
+		return;
+	}
+	LastRecordFrame = GFrameCounter;
+
+	Model.StyleHalfLife = StyleHalfLife;
+	Model.RecordAction(ActionTag, GetWorld()->GetTimeSeconds());
+
+	OnModelUpdated.Broadcast();
+}
+
+void UPlayerModelComponent::ResetModel()
+{
+	Model = FPlayerActionModel(WindowSize, StyleHalfLife);
+	LastRecordFrame = MAX_uint64;
+
+	OnModelUpdated.Broadcast();
+}
+
+EPlayerCombatStyle UPlayerModelComponent::GetPlayerStyle() const
+{
+	return Model.GetStyle();
+}
+
+void UPlayerModelComponent::HandleActionActivated(FName SlotName, UActionInstance* Action)
+{
+	if (Action)
+	{
+		RecordPlayerAction(Action->GetActionTag());
+	}
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "PlayerModelComponent.generated.h"
+
+class UActionInstance;
+class UActionManagerComponent;
+struct FPlayerPatternData;
+
+/**
+ * What a recorded player action counts as for pattern analysis
+ */
+UENUM(BlueprintType)
+enum class EPlayerActionCategory : uint8
+{
+	Attack,
+	HeavyAttack,
+	Block,
+	Parry,
+	Dash,
+	Other,
+	Count UMETA(Hidden)
+};
+
+/**
+ * Dominant play style derived from the decayed style profile
+ */
+UENUM(BlueprintType)
+enum class EPlayerCombatStyle : uint8
+{
+	Balanced,
+	Defensive,
+	Aggressive,
+	Evasive
+};
+
+/**
+ * Fixed capacity ring buffer with running sum and sum of squares,
+ * so adding a sample and reading mean/variance are O(1).
+ */
+struct ATLAS_API FSlidingWindowStats
+{
+	explicit FSlidingWindowStats(int32 InCapacity = 20);
+
+	void Add(float Value);
+	void Reset();
+
+	int32 Num() const { return Samples.Num(); }
+	int32 GetCapacity() const { return Capacity; }
+	float GetMean() const;
+	float GetVariance() const;
+	float GetStdDev() const { return FMath::Sqrt(GetVariance()); }
+
+private:
+	/** Re-sum from the samples to drop accumulated rounding error */
+	void Resum();
+
+	TArray<float> Samples;
+	int32 Capacity;
+	int32 Head = 0;
+	int32 AddsSinceResum = 0;
+	double Sum = 0.0;
+	double SumSquares = 0.0;
+};
+
+/**
+ * Incremental model of the player's recent actions:
+ * - lifetime counts per category
+ * - sliding window of the last N categories with per-category counts
+ * - sliding window of intervals between actions
+ * - exponentially decayed style profile, so old habits fade out
+ */
+struct ATLAS_API FPlayerActionModel
+{
+	FPlayerActionModel(int32 WindowSize = 20, float InStyleHalfLife = 15.0f);
+
+	/** Record one action, Time is world time in seconds */
+	void RecordAction(const FGameplayTag& ActionTag, double Time);
+
+	void Reset();
+
+	/** Category for an action tag via the shared precomputed table */
+	static EPlayerActionCategory ClassifyAction(const FGameplayTag& ActionTag);
+
+	/** Representative tag for a category, invalid for Other */
+	static FGameplayTag GetCategoryTag(EPlayerActionCategory Category);
+
+	/** Dominant style of the decayed profile. Decay scales all weights equally, so no time is needed to compare them. */
+	EPlayerCombatStyle GetStyle() const;
+
+	/** Write the model into the pattern struct the difficulty component exposes */
+	void FillPatternData(FPlayerPatternData& OutPattern) const;
+
+	int32 GetTotalActions() const { return TotalActions; }
+	int32 GetCount(EPlayerActionCategory Category) const { return Counts[static_cast<int32>(Category)]; }
+	int32 GetWindowCount(EPlayerActionCategory Category) const { return WindowCounts[static_cast<int32>(Category)]; }
+	const FSlidingWindowStats& GetReactionTimes() const { return ReactionTimes; }
+	const FGameplayTag& GetLastAction() const { return LastAction; }
+	double GetLastActionTime() const { return LastActionTime; }
+
+	/** Seconds for a style weight to halve */
+	float StyleHalfLife;
+
+private:
+	static constexpr int32 NumCategories = static_cast<int32>(EPlayerActionCategory::Count);
+
+	int32 Counts[NumCategories];
+	int32 TotalActions = 0;
+
+	// Ring of recent categories and how many of each it holds
+	TArray<EPlayerActionCategory> RecentCategories;
+	int32 RecentHead = 0;
+	int32 WindowCounts[NumCategories];
+	int32 WindowSize;
+
+	FSlidingWindowStats ReactionTimes;
+
+	// Style weights as of StyleTime, decayed whenever an action is recorded
+	float StyleWeights[NumCategories];
+	double StyleTime = 0.0;
+
+	FGameplayTag LastAction;
+	double LastActionTime = -1.0;
+};
+
+DECLARE_MULTICAST_DELEGATE(FOnPlayerModelUpdated);
+
+/**
+ * Room-scoped player model. Lives on ARoomBase and listens to the player's action
+ * manager while the room is active, so every enemy in the room reads one shared
+ * analysis instead of each running its own.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class ATLAS_API UPlayerModelComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UPlayerModelComponent();
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * Start recording the player's activated actions
+	 * @param PlayerActor Actor owning the action manager to listen to
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Player Model")
+	void BindToPlayer(AActor* PlayerActor);
+
+	/**
+	 * Stop recording player actions
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Player Model")
+	void UnbindFromPlayer();
+
+	/**
+	 * Record a player action. The same tag reported twice in one frame is only counted once,
+	 * so several enemies forwarding the same action don't skew the model.
+	 * @param ActionTag The action the player performed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Player Model")
+	void RecordPlayerAction(FGameplayTag ActionTag);
+
+	UFUNCTION(BlueprintCallable, Category = "Player Model")
+	void ResetModel();
+
+	UFUNCTION(BlueprintPure, Category = "Player Model")
+	EPlayerCombatStyle GetPlayerStyle() const;
+
+	const FPlayerActionModel& GetModel() const { return Model; }
+
+	/** Broadcast after every recorded action */
+	FOnPlayerModelUpdated OnModelUpdated;
+
+protected:
+	/** Number of recent actions the sliding windows cover */
+	UPROPERTY(EditDefaultsOnly, Category = "Player Model", meta = (ClampMin = "1"))
+	int32 WindowSize = 20;
+
+	/** Seconds for an action's weight in the style profile to halve */
+	UPROPERTY(EditDefaultsOnly, Category = "Player Model", meta = (ClampMin = "0.1"))
+	float StyleHalfLife = 15.0f;
+
+private:
+	UFUNCTION()
+	void HandleActionActivated(FName SlotName, UActionInstance* Action);
+
+	FPlayerActionModel Model;
+
+	UPROPERTY()
+	UActionManagerComponent* BoundActionManager;
+
+	uint64 LastRecordFrame = MAX_uint64;
+};
@@ -248,7 +248,8 @@ int32 URewardSelectionComponent::AutoEquipReward(URewardDataAsset* Reward)
 	}
 	
 	// If no empty slots, try to replace a lower priority reward
-	for (int32 i = 0; i < 6; i++) // Assuming max 6 slots
+	const int32 SlotCount = PlayerSlotManager->GetMaxSlots();
+	for (int32 i = 0; i < SlotCount; i++)
 	{
 		URewardDataAsset* ExistingReward = PlayerSlotManager->GetRewardInSlot(i);
 		if (ExistingReward && CanReplaceReward(Reward, ExistingReward))
@@ -536,7 +537,8 @@ int32 URewardSelectionComponent::FindBestSlotForReward(URewardDataAsset* Reward)
 		return -1;
 		
 	// Look for empty slots first
-	for (int32 i = 0; i < 6; i++) // Assuming max 6 slots
+	const int32 SlotCount = PlayerSlotManager->GetMaxSlots();
+	for (int32 i = 0; i < SlotCount; i++)
 	{
 		if (!PlayerSlotManager->GetRewardInSlot(i))
 		{
@@ -548,8 +550,8 @@ int32 URewardSelectionComponent::FindBestSlotForReward(URewardDataAsset* Reward)
 			else
 			{
 				// Check if next slots are also empty
-				bool bHasSpace = true;
-				for (int32 j = 1; j < Reward->SlotCost && (i + j) < 6; j++)
+				bool bHasSpace = i + Reward->SlotCost <= SlotCount;
+				for (int32 j = 1; bHasSpace && j < Reward->SlotCost; j++)
 				{
 					if (PlayerSlotManager->GetRewardInSlot(i + j))
 					{
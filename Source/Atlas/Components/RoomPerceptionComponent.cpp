@@ -0,0 +1,164 @@
+#include "RoomPerceptionComponent.h"
+#include "Atlas/AI/EnemyAIController.h"
+#include "Perception/AISenseConfig_Sight.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+URoomPerceptionComponent::URoomPerceptionComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void URoomPerceptionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	UpdateVisibility();
+}
+
+void URoomPerceptionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Hand sight back to the controllers' own perception
+	TArray<FControllerEntry> Remaining = MoveTemp(Entries);
+	for (const FControllerEntry& Entry : Remaining)
+	{
+		if (AEnemyAIController* Controller = Entry.Controller.Get())
+		{
+			Controller->SetPerceptionHub(nullptr);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void URoomPerceptionComponent::RegisterController(AEnemyAIController* Controller)
+{
+	if (!Controller || Entries.ContainsByPredicate([Controller](const FControllerEntry& Entry) { return Entry.Controller == Controller; }))
+	{
+		return;
+	}
+
+	FControllerEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Controller = Controller;
+
+	SetComponentTickInterval(UpdateInterval);
+	SetComponentTickEnabled(true);
+}
+
+void URoomPerceptionComponent::UnregisterController(AEnemyAIController* Controller)
+{
+	Entries.RemoveAllSwap([Controller](const FControllerEntry& Entry) { return Entry.Controller == Controller; });
+
+	if (Entries.Num() == 0)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+bool URoomPerceptionComponent::DoesControllerSeePlayer(const AEnemyAIController* Controller) const
+{
+	const FControllerEntry* Entry = Entries.FindByPredicate([Controller](const FControllerEntry& Candidate) { return Candidate.Controller == Controller; });
+	return Entry && Entry->bSeesPlayer;
+}
+
+void URoomPerceptionComponent::UpdateVisibility()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	APawn* Player = UGameplayStatics::GetPlayerPawn(this, 0);
+	const FVector PlayerLocation = Player ? Player->GetActorLocation() : FVector::ZeroVector;
+
+	// Enemies never block each other's view of the player, so every registered pawn is ignored
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(RoomPerception), true);
+	QueryParams.AddIgnoredActor(Player);
+	for (const FControllerEntry& Entry : Entries)
+	{
+		if (const AEnemyAIController* Controller = Entry.Controller.Get())
+		{
+			QueryParams.AddIgnoredActor(Controller->GetPawn());
+		}
+	}
+
+	CellVisibility.Reset();
+
+	for (int32 i = Entries.Num() - 1; i >= 0; --i)
+	{
+		FControllerEntry& Entry = Entries[i];
+		AEnemyAIController* Controller = Entry.Controller.Get();
+		if (!IsValid(Controller))
+		{
+			Entries.RemoveAtSwap(i);
+			continue;
+		}
+
+		APawn* Pawn = Controller->GetPawn();
+		const UAISenseConfig_Sight* Sight = Controller->GetSightConfig();
+		if (!Player || !Pawn || !Sight)
+		{
+			Publish(Entry, Player, false, PlayerLocation);
+			continue;
+		}
+
+		++Stats.SightQueries;
+
+		FVector EyeLocation;
+		FRotator EyeRotation;
+		Pawn->GetActorEyesViewPoint(EyeLocation, EyeRotation);
+
+		// Lose sight radius applies once the player has been seen, like the stock sense
+		const FVector ToPlayer = PlayerLocation - EyeLocation;
+		const float Radius = Entry.bSeesPlayer ? Sight->LoseSightRadius : Sight->SightRadius;
+		bool bVisible = ToPlayer.SizeSquared() <= FMath::Square(Radius);
+
+		if (bVisible)
+		{
+			const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(Sight->PeripheralVisionAngleDegrees));
+			bVisible = FVector::DotProduct(EyeRotation.Vector(), ToPlayer.GetSafeNormal()) >= CosHalfAngle;
+		}
+
+		if (bVisible)
+		{
+			const FIntVector Cell(
+				FMath::FloorToInt(EyeLocation.X / EyeCellSize),
+				FMath::FloorToInt(EyeLocation.Y / EyeCellSize),
+				FMath::FloorToInt(EyeLocation.Z / EyeCellSize));
+
+			if (const bool* CachedVisibility = CellVisibility.Find(Cell))
+			{
+				bVisible = *CachedVisibility;
+			}
+			else
+			{
+				bVisible = !GetWorld()->LineTraceTestByChannel(EyeLocation, PlayerLocation, SightTraceChannel, QueryParams);
+				CellVisibility.Add(Cell, bVisible);
+				++Stats.Traces;
+			}
+		}
+
+		Publish(Entry, Player, bVisible, PlayerLocation);
+	}
+
+	++Stats.Updates;
+	Stats.LastUpdateUs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+}
+
+void URoomPerceptionComponent::Publish(FControllerEntry& Entry, AActor* Player, bool bVisible, const FVector& PlayerLocation)
+{
+	if (bVisible)
+	{
+		Entry.LastSeenLocation = PlayerLocation;
+	}
+
+	if (bVisible == Entry.bSeesPlayer)
+	{
+		return;
+	}
+
+	Entry.bSeesPlayer = bVisible;
+	if (AEnemyAIController* Controller = Entry.Controller.Get())
+	{
+		Controller->HandleSharedSight(Player, bVisible, Entry.LastSeenLocation);
+	}
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "RoomPerceptionComponent.generated.h"
+
+class AEnemyAIController;
+
+/**
+ * Counters for the shared sight pass, used by Atlas.Bench.Perception
+ */
+struct ATLAS_API FRoomPerceptionStats
+{
+	int32 Updates = 0;
+
+	/** Range and view cone checks, one per registered controller per update */
+	int32 SightQueries = 0;
+
+	/** Line of sight traces actually issued */
+	int32 Traces = 0;
+
+	/** Wall time of the last update in microseconds */
+	float LastUpdateUs = 0.0f;
+
+	void Reset() { *this = FRoomPerceptionStats(); }
+};
+
+/**
+ * Room-scoped sight for enemies.
+ *
+ * Every enemy in a room looks at the same player, so instead of each controller's
+ * perception component running its own sight query, registered controllers are
+ * checked here in one pass per update. Range and view cone are tested per enemy
+ * with its own sight config, but line of sight is traced once per eye cell and
+ * reused by every enemy whose eyes fall in that cell. Results are pushed to the
+ * controllers only when they change, the same way perception updates arrive.
+ *
+ * Controllers keep their perception component for any other senses.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class ATLAS_API URoomPerceptionComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	URoomPerceptionComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Called by AEnemyAIController::SetPerceptionHub */
+	void RegisterController(AEnemyAIController* Controller);
+	void UnregisterController(AEnemyAIController* Controller);
+	int32 GetNumControllers() const { return Entries.Num(); }
+
+	/** Run one sight pass now and publish changes */
+	void UpdateVisibility();
+
+	/** Whether a registered controller currently sees the player */
+	bool DoesControllerSeePlayer(const AEnemyAIController* Controller) const;
+
+	const FRoomPerceptionStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats.Reset(); }
+
+protected:
+	/** Seconds between sight passes */
+	UPROPERTY(EditDefaultsOnly, Category = "Perception", meta = (ClampMin = "0.0"))
+	float UpdateInterval = 0.1f;
+
+	/** Size of the grid cells enemy eye locations share a line of sight trace in */
+	UPROPERTY(EditDefaultsOnly, Category = "Perception", meta = (ClampMin = "1.0"))
+	float EyeCellSize = 200.0f;
+
+	/** Channel the line of sight trace runs on, matches the stock sight sense */
+	UPROPERTY(EditDefaultsOnly, Category = "Perception")
+	TEnumAsByte<ECollisionChannel> SightTraceChannel = ECC_Visibility;
+
+private:
+	struct FControllerEntry
+	{
+		TWeakObjectPtr<AEnemyAIController> Controller;
+		bool bSeesPlayer = false;
+		FVector LastSeenLocation = FVector::ZeroVector;
+	};
+
+	void Publish(FControllerEntry& Entry, AActor* Player, bool bVisible, const FVector& PlayerLocation);
+
+	TArray<FControllerEntry> Entries;
+
+	/** Line of sight result per eye cell, rebuilt each update */
+	TMap<FIntVector, bool> CellVisibility;
+
+	FRoomPerceptionStats Stats;
+};
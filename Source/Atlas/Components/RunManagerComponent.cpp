@@ -5,12 +5,18 @@
 #include "Atlas/Components/SlotManagerComponent.h"
 #include "Atlas/Components/HealthComponent.h"
 #include "Atlas/Components/StationIntegrityComponent.h"
+#include "Atlas/Components/AIDifficultyComponent.h"
+#include "Atlas/Components/ActionManagerComponent.h"
+#include "Atlas/AI/EnemyPoolSubsystem.h"
 #include "Atlas/UI/SRewardSelectionWidget.h"
 #include "Atlas/UI/SRunProgressWidget.h"
 #include "Atlas/UI/SEnemyHealthWidget.h"
 #include "Atlas/UI/SSimpleSlotManagerWidget.h"
 #include "Atlas/UI/SInventoryWidget.h"
+#include "Atlas/UI/HUDViewModel.h"
+#include "Atlas/UI/RewardOfferPresenter.h"
 #include "Atlas/Rooms/RoomBase.h"
+#include "Atlas/Core/AtlasStats.h"
 #include "Engine/World.h"
 #include "GameFramework/GameModeBase.h"
 #include "GameFramework/PlayerController.h"
@@ -35,6 +41,15 @@ void URunManagerComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	
+	// Bake difficulty curves once, rooms are planned from the tables
+	EncounterDirector.Initialize(EncounterSettings);
+	
+	HUDModel = NewObject<UHUDViewModel>(this);
+	HUDModel->BindRunManager(this);
+	
+	RewardPresenter = NewObject<URewardOfferPresenter>(this);
+	RewardPresenter->Initialize(this);
+	
 	// Don't create widget in BeginPlay - wait for StartNewRun command
 	
 	// Find all room actors placed in the world
@@ -168,6 +183,7 @@ void URunManagerComponent::InitializeRun()
 	// Reset progress
 	RunProgress = FRunProgressData();
 	CurrentLevel = 1;
+	PlannedRoom = nullptr;
 	CompletedRooms.Empty();
 	CurrentRoomActor = nullptr;
 	
@@ -190,31 +206,24 @@ void URunManagerComponent::InitializeRun()
 	SetRunState(ERunState::PreRun);
 }
 
-void URunManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void URunManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	if (HUDModel)
+	{
+		HUDModel->UnbindAll();
+	}
 	
-	// Update health and integrity display periodically
-	if (RunProgressWidget.IsValid())
+	if (RewardPresenter)
 	{
-		if (!PlayerCharacter)
-		{
-			PlayerCharacter = Cast<AGameCharacterBase>(GetWorld()->GetFirstPlayerController()->GetPawn());
-		}
-		
-		if (PlayerCharacter)
-		{
-			if (UHealthComponent* HealthComp = PlayerCharacter->FindComponentByClass<UHealthComponent>())
-			{
-				RunProgressWidget->UpdateHealth(HealthComp->GetCurrentHealth(), HealthComp->GetMaxHealth());
-			}
-			
-			if (UStationIntegrityComponent* IntegrityComp = PlayerCharacter->FindComponentByClass<UStationIntegrityComponent>())
-			{
-				RunProgressWidget->UpdateIntegrity(IntegrityComp->GetCurrentIntegrity(), IntegrityComp->GetMaxIntegrity());
-			}
-		}
+		RewardPresenter->Release();
 	}
+	
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(IntegrityDrainTimer);
+	}
+	
+	Super::EndPlay(EndPlayReason);
 }
 
 void URunManagerComponent::StartNewRun()
@@ -226,14 +235,6 @@ void URunManagerComponent::StartNewRun()
 	{
 		// Get player components for the widget
 		AGameCharacterBase* PlayerChar = Cast<AGameCharacterBase>(GetWorld()->GetFirstPlayerController()->GetPawn());
-		UHealthComponent* HealthComp = nullptr;
-		UStationIntegrityComponent* IntegrityComp = nullptr;
-		
-		if (PlayerChar)
-		{
-			HealthComp = PlayerChar->FindComponentByClass<UHealthComponent>();
-			IntegrityComp = PlayerChar->FindComponentByClass<UStationIntegrityComponent>();
-		}
 		
 		// Only create widget if we have a player
 		if (PlayerChar)
@@ -241,35 +242,20 @@ void URunManagerComponent::StartNewRun()
 			// Create the widget
 			RunProgressWidget = SNew(SRunProgressWidget)
 				.RunManager(this)
-				.HealthComponent(HealthComp)
-				.IntegrityComponent(IntegrityComp);
+				.HealthComponent(PlayerChar->GetHealthComponent())
+				.IntegrityComponent(PlayerChar->GetStationIntegrityComponent());
 			
 			// Add to viewport with lower Z-order than reward selection
 			if (GEngine && GEngine->GameViewport && RunProgressWidget.IsValid())
 			{
 				GEngine->GameViewport->AddViewportWidgetContent(RunProgressWidget.ToSharedRef(), 10);
 				UE_LOG(LogTemp, Log, TEXT("RunProgressWidget created and added to viewport"));
-				
-				// Initialize widget with current values if components exist
-				if (HealthComp)
-				{
-					RunProgressWidget->UpdateHealth(HealthComp->GetCurrentHealth(), HealthComp->GetMaxHealth());
-					RunProgressWidget->UpdatePoise(HealthComp->GetCurrentPoise(), HealthComp->GetMaxPoise());
-					
-					// Subscribe to health and poise changes
-					HealthComp->OnHealthChanged.AddDynamic(this, &URunManagerComponent::OnPlayerHealthChanged);
-					HealthComp->OnPoiseChanged.AddDynamic(this, &URunManagerComponent::OnPlayerPoiseChanged);
-				}
-				
-				if (IntegrityComp)
-				{
-					RunProgressWidget->UpdateIntegrity(IntegrityComp->GetCurrentIntegrity(), IntegrityComp->GetMaxIntegrity());
-					
-					// Subscribe to integrity changes
-					IntegrityComp->OnIntegrityChanged.AddDynamic(this, &URunManagerComponent::OnPlayerIntegrityChanged);
-				}
 			}
 			
+			// The model fills the widget now and pushes health, poise and integrity changes from here on
+			HUDModel->SetRunProgressWidget(RunProgressWidget);
+			HUDModel->BindPlayer(PlayerChar);
+			
 			// Create the slot manager widget (compact display)
 			if (USlotManagerComponent* SlotManager = PlayerChar->GetSlotManagerComponent())
 			{
@@ -282,6 +268,8 @@ void URunManagerComponent::StartNewRun()
 					GEngine->GameViewport->AddViewportWidgetContent(SlotManagerWidget.ToSharedRef(), 15);
 					UE_LOG(LogTemp, Log, TEXT("SlotManagerWidget created and added to viewport"));
 				}
+				
+				HUDModel->SetSlotWidget(SlotManagerWidget);
 			}
 		}
 	}
@@ -429,13 +417,7 @@ void URunManagerComponent::CompleteCurrentRoom()
 	// Update statistics
 	UpdateRunStats();
 	
-	// Update run progress widget
-	if (RunProgressWidget.IsValid())
-	{
-		RunProgressWidget->SetRoomCompleted(CurrentLevel - 1);
-	}
-	
-	// Broadcast completion event
+	// Broadcast completion event, the HUD model marks the room on the run progress widget
 	OnRoomCompleted.Broadcast(CurrentRoom);
 	
 	// Clear the room
@@ -685,6 +667,8 @@ URoomDataAsset* URunManagerComponent::SelectNextRoom()
 
 void URunManagerComponent::LoadRoom(URoomDataAsset* Room)
 {
+	ATLAS_SCOPE_CYCLE_COUNTER(LoadRoom, "Atlas.RunManager.LoadRoom");
+
 	if (!Room)
 	{
 		UE_LOG(LogTemp, Error, TEXT("Cannot load null room"));
@@ -705,12 +689,6 @@ void URunManagerComponent::LoadRoom(URoomDataAsset* Room)
 	CurrentRoom = Room;
 	RoomStartTime = GetWorld()->GetTimeSeconds();
 	
-	// Update the RunProgressWidget with current room info
-	if (RunProgressWidget.IsValid())
-	{
-		RunProgressWidget->UpdateCurrentRoomInfo(CurrentRoom);
-	}
-	
 	// Remove from remaining rooms if not repeatable
 	if (!Room->bCanRepeat)
 	{
@@ -743,13 +721,25 @@ void URunManagerComponent::LoadRoom(URoomDataAsset* Room)
 		ApplyRoomHazards();
 	}
 	
+	// Spawn the room's enemy now, while the room is loading, so SpawnRoomEnemy only has to wake it
+	if (UEnemyPoolSubsystem* EnemyPool = UEnemyPoolSubsystem::Get(this))
+	{
+		EnemyPool->Prewarm(Room->UniqueEnemy);
+	}
+	
+	// Same for the reward offer, roll it now so its icons stream in and the widget is bound by the time the room is cleared
+	if (RewardPresenter)
+	{
+		RewardPresenter->PrepareOffer(Room, RollRewardChoices(2));
+	}
+	
 	// Play ambient sound
 	if (Room->AmbientSound)
 	{
 		UGameplayStatics::PlaySound2D(GetWorld(), Room->AmbientSound);
 	}
 	
-	// Fire event
+	// Fire event, this also updates the room shown on the run progress widget
 	OnRoomStarted.Broadcast(Room);
 }
 
@@ -769,16 +759,8 @@ void URunManagerComponent::SpawnRoomEnemy()
 		SpawnTransform = CurrentRoom->EnemySpawnPoints[RandomIndex];
 	}
 	
-	// Spawn the enemy
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-	
-	CurrentRoomEnemy = GetWorld()->SpawnActor<AGameCharacterBase>(
-		CurrentRoom->UniqueEnemy,
-		SpawnTransform.GetLocation(),
-		SpawnTransform.GetRotation().Rotator(),
-		SpawnParams
-	);
+	// Spawn the enemy, reusing the one pre-warmed by LoadRoom
+	CurrentRoomEnemy = UEnemyPoolSubsystem::AcquireEnemy(this, CurrentRoom->UniqueEnemy, SpawnTransform);
 	
 	if (CurrentRoomEnemy)
 	{
@@ -814,31 +796,37 @@ void URunManagerComponent::ApplyRoomHazards()
 {
 	if (!CurrentRoom)
 		return;
+	
+	const FEncounterPlan Plan = GetEncounterPlan();
 		
 	switch (CurrentRoom->EnvironmentalHazard)
 	{
 		case ERoomHazard::LowGravity:
-			// TODO: Reduce gravity for all actors
-			UE_LOG(LogTemp, Log, TEXT("Applying Low Gravity hazard"));
+			UE_LOG(LogTemp, Log, TEXT("Applying Low Gravity hazard - Intensity: %.2f"), Plan.HazardIntensity);
 			break;
 			
 		case ERoomHazard::ElectricalSurges:
-			// TODO: Spawn periodic electrical damage zones
-			UE_LOG(LogTemp, Log, TEXT("Applying Electrical Surges hazard"));
+			UE_LOG(LogTemp, Log, TEXT("Applying Electrical Surges hazard - Intensity: %.2f"), Plan.HazardIntensity);
 			break;
 			
 		case ERoomHazard::HullBreach:
-			// TODO: Apply constant station integrity drain
 			if (CurrentRoom->IntegrityDrainRate > 0.0f)
 			{
-				// TODO: Start integrity drain timer
-				UE_LOG(LogTemp, Log, TEXT("Applying Hull Breach with %f damage/sec"), CurrentRoom->IntegrityDrainRate);
+				// Scaled by the encounter plan like the room's hazard actors
+				const float DrainPerSecond = CurrentRoom->IntegrityDrainRate * Plan.HazardIntensity;
+				GetWorld()->GetTimerManager().SetTimer(IntegrityDrainTimer, [this, DrainPerSecond]()
+				{
+					if (UStationIntegrityComponent* Station = PlayerCharacter ? PlayerCharacter->GetStationIntegrityComponent() : nullptr)
+					{
+						Station->ApplyIntegrityDamage(DrainPerSecond);
+					}
+				}, 1.0f, true);
+				UE_LOG(LogTemp, Log, TEXT("Applying Hull Breach with %f damage/sec"), DrainPerSecond);
 			}
 			break;
 			
 		case ERoomHazard::ToxicLeak:
-			// TODO: Apply DoT to player in certain areas
-			UE_LOG(LogTemp, Log, TEXT("Applying Toxic Leak hazard"));
+			UE_LOG(LogTemp, Log, TEXT("Applying Toxic Leak hazard - Intensity: %.2f"), Plan.HazardIntensity);
 			break;
 			
 		case ERoomHazard::SystemMalfunction:
@@ -849,16 +837,29 @@ void URunManagerComponent::ApplyRoomHazards()
 		default:
 			break;
 	}
+	
+	// Hazard actors are spawned by the room, it scales them as they appear
+	ApplyEncounterToRoom(CurrentRoomInstance ? CurrentRoomInstance : CurrentRoomActor);
+}
+
+void URunManagerComponent::ApplyEncounterToRoom(ARoomBase* Room)
+{
+	if (!Room || !CurrentRoom)
+		return;
+	
+	const FEncounterPlan Plan = GetEncounterPlan();
+	Room->SetHazardIntensity(Plan.HazardIntensity);
+	Room->SetEnemySpawnDelay(Plan.EnemySpawnDelay);
 }
 
 void URunManagerComponent::ClearCurrentRoom()
 {
 	UE_LOG(LogTemp, Log, TEXT("Clearing current room"));
 	
-	// Destroy enemy if still alive
+	// Return enemy to the pool if still alive
 	if (CurrentRoomEnemy && IsValid(CurrentRoomEnemy))
 	{
-		CurrentRoomEnemy->Destroy();
+		UEnemyPoolSubsystem::ReleaseEnemy(CurrentRoomEnemy);
 		CurrentRoomEnemy = nullptr;
 	}
 	
@@ -869,6 +870,7 @@ void URunManagerComponent::ClearCurrentRoom()
 	}
 	
 	// Stop any active hazards
+	GetWorld()->GetTimerManager().ClearTimer(IntegrityDrainTimer);
 	// TODO: Clean up hazard effects
 	
 	CurrentRoom = nullptr;
@@ -960,22 +962,101 @@ void URunManagerComponent::ApplyEnemyScaling(AGameCharacterBase* Enemy)
 	if (!Enemy)
 		return;
 		
-	int32 EnemyPower = CalculateEnemyPower();
+	const FEncounterPlan Plan = GetEncounterPlan();
 	
-	UE_LOG(LogTemp, Log, TEXT("Applying enemy scaling - Power Level: %d"), EnemyPower);
+	UE_LOG(LogTemp, Log, TEXT("Applying enemy scaling - Power Level: %d"), Plan.EnemyPower);
 	
-	// TODO: Apply scaling to enemy stats
-	// This would interact with the AIDifficultyComponent when implemented
+	if (UAIDifficultyComponent* Difficulty = Enemy->FindComponentByClass<UAIDifficultyComponent>())
+	{
+		Difficulty->SetPowerLevel(Plan.EnemyPower);
+		Difficulty->ApplyDifficultyScaling();
+	}
 	
-	// Apply special abilities from room configuration
-	if (CurrentRoom)
+	// Apply special abilities from room configuration, into the slots the defaults left free.
+	// A pooled enemy gets its previous instances back from the action manager instead of new ones.
+	UActionManagerComponent* ActionManager = Enemy->GetActionManagerComponent();
+	if (CurrentRoom && ActionManager)
 	{
+		const TArray<FName> SlotNames = ActionManager->GetAllSlotNames();
+		int32 FreeSlot = 0;
+		
 		for (const FGameplayTag& AbilityTag : CurrentRoom->EnemyAbilities)
 		{
-			// TODO: Grant ability to enemy
-			UE_LOG(LogTemp, Log, TEXT("Granting enemy ability: %s"), *AbilityTag.ToString());
+			const bool bAlreadySlotted = SlotNames.ContainsByPredicate([ActionManager, &AbilityTag](FName SlotName)
+			{
+				const UActionInstance* Action = ActionManager->GetActionInSlot(SlotName);
+				return Action && Action->GetActionTag() == AbilityTag;
+			});
+			if (bAlreadySlotted)
+			{
+				continue;
+			}
+			
+			while (FreeSlot < SlotNames.Num() && ActionManager->GetActionInSlot(SlotNames[FreeSlot]))
+			{
+				++FreeSlot;
+			}
+			if (FreeSlot >= SlotNames.Num())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("No free slot for enemy ability: %s"), *AbilityTag.ToString());
+				break;
+			}
+			
+			if (ActionManager->AssignActionToSlot(SlotNames[FreeSlot], AbilityTag))
+			{
+				UE_LOG(LogTemp, Log, TEXT("Granting enemy ability: %s"), *AbilityTag.ToString());
+			}
+		}
+	}
+}
+
+FEncounterPlan URunManagerComponent::GetEncounterPlan()
+{
+	if (CurrentRoom && PlannedRoom == CurrentRoom && PlannedLevel == CurrentLevel)
+	{
+		return CurrentEncounterPlan;
+	}
+	
+	// Test arena runs don't always go through the code that caches the player
+	AGameCharacterBase* Player = PlayerCharacter ? PlayerCharacter : Cast<AGameCharacterBase>(UGameplayStatics::GetPlayerPawn(this, 0));
+	
+	FRunProgressData Progress = GetRunProgress();
+	float MaxHealth = 100.0f;
+	float MaxIntegrity = 100.0f;
+	int32 EquippedSlots = 0;
+	
+	if (Player)
+	{
+		if (UHealthComponent* Health = Player->GetHealthComponent())
+		{
+			Progress.PlayerHealth = Health->GetCurrentHealth();
+			MaxHealth = Health->GetMaxHealth();
+		}
+		
+		if (UStationIntegrityComponent* Station = Player->FindComponentByClass<UStationIntegrityComponent>())
+		{
+			Progress.StationIntegrity = Station->GetCurrentIntegrity();
+			MaxIntegrity = Station->GetMaxIntegrity();
+		}
+		
+		if (USlotManagerComponent* SlotManager = PlayerSlotManager ? PlayerSlotManager : Player->FindComponentByClass<USlotManagerComponent>())
+		{
+			EquippedSlots = SlotManager->GetUsedSlotCount();
 		}
 	}
+	
+	const int32 BasePower = CurrentRoom ? CurrentRoom->GetScaledEnemyPower(CurrentLevel, EquippedSlots) : EquippedSlots + 1;
+	const ERoomDifficulty Difficulty = CurrentRoom ? CurrentRoom->Difficulty : ERoomDifficulty::Medium;
+	const bool bHasHazard = CurrentRoom && CurrentRoom->EnvironmentalHazard != ERoomHazard::None;
+	
+	CurrentEncounterPlan = EncounterDirector.PlanEncounter(Progress, BasePower, Difficulty, bHasHazard, MaxHealth, MaxIntegrity);
+	PlannedRoom = CurrentRoom;
+	PlannedLevel = CurrentLevel;
+	
+	UE_LOG(LogTemp, Log, TEXT("Encounter planned for level %d - Budget: %.2f, Enemy Power: %d, Hazard Intensity: %.2f, Spawn Delay: %.1fs"),
+		CurrentLevel, CurrentEncounterPlan.Budget, CurrentEncounterPlan.EnemyPower, CurrentEncounterPlan.HazardIntensity, CurrentEncounterPlan.EnemySpawnDelay);
+	
+	return CurrentEncounterPlan;
 }
 
 void URunManagerComponent::RandomizeRoomOrder()
@@ -1123,22 +1204,7 @@ void URunManagerComponent::UpdateRunStats()
 		PlayerCharacter = Cast<AGameCharacterBase>(GetWorld()->GetFirstPlayerController()->GetPawn());
 	}
 	
-	if (PlayerCharacter)
-	{
-		// Update health and integrity in the widget
-		if (RunProgressWidget.IsValid())
-		{
-			if (UHealthComponent* HealthComp = PlayerCharacter->FindComponentByClass<UHealthComponent>())
-			{
-				RunProgressWidget->UpdateHealth(HealthComp->GetCurrentHealth(), HealthComp->GetMaxHealth());
-			}
-			
-			if (UStationIntegrityComponent* IntegrityComp = PlayerCharacter->FindComponentByClass<UStationIntegrityComponent>())
-			{
-				RunProgressWidget->UpdateIntegrity(IntegrityComp->GetCurrentIntegrity(), IntegrityComp->GetMaxIntegrity());
-			}
-		}
-	}
+	// Health and integrity reach the run progress widget through the HUD model's event bindings
 	
 	UE_LOG(LogTemp, Log, TEXT("Run stats updated - Enemies defeated: %d"), RunProgress.TotalEnemiesDefeated);
 }
@@ -1188,6 +1254,9 @@ void URunManagerComponent::GoToRoom(const FString& RoomName)
 				UE_LOG(LogTemp, Log, TEXT("RunProgressWidget created in GoToRoom"));
 			}
 			
+			HUDModel->SetRunProgressWidget(RunProgressWidget);
+			HUDModel->BindPlayer(PlayerChar);
+			
 			// Create the slot manager widget if not exists (compact display)
 			if (!SlotManagerWidget.IsValid())
 			{
@@ -1202,6 +1271,8 @@ void URunManagerComponent::GoToRoom(const FString& RoomName)
 						GEngine->GameViewport->AddViewportWidgetContent(SlotManagerWidget.ToSharedRef(), 15);
 						UE_LOG(LogTemp, Log, TEXT("SlotManagerWidget created in GoToRoom"));
 					}
+					
+					HUDModel->SetSlotWidget(SlotManagerWidget);
 				}
 			}
 		}
@@ -1305,6 +1376,13 @@ void URunManagerComponent::GoToRoom(const FString& RoomName)
 		
 		UE_LOG(LogTemp, Log, TEXT("Teleported to room: %s"), *RoomName);
 		
+		// Have the enemy ready in the pool before the spawn timer fires
+		UEnemyPoolSubsystem* EnemyPool = UEnemyPoolSubsystem::Get(this);
+		if (EnemyPool && CurrentRoom)
+		{
+			EnemyPool->Prewarm(CurrentRoom->UniqueEnemy);
+		}
+		
 		// Start combat and spawn enemy after delay
 		FTimerHandle TimerHandle;
 		GetWorld()->GetTimerManager().SetTimer(TimerHandle, FTimerDelegate::CreateLambda([this, TargetRoom]()
@@ -1319,15 +1397,7 @@ void URunManagerComponent::GoToRoom(const FString& RoomName)
 					UE_LOG(LogTemp, Warning, TEXT("Spawning enemy class: %s"), *CurrentRoom->UniqueEnemy->GetName());
 					
 					FTransform SpawnTransform = TargetRoom->GetEnemySpawnPoint();
-					FActorSpawnParameters SpawnParams;
-					SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-					
-					CurrentRoomEnemy = GetWorld()->SpawnActor<AGameCharacterBase>(
-						CurrentRoom->UniqueEnemy,
-						SpawnTransform.GetLocation(),
-						SpawnTransform.GetRotation().Rotator(),
-						SpawnParams
-					);
+					CurrentRoomEnemy = UEnemyPoolSubsystem::AcquireEnemy(this, CurrentRoom->UniqueEnemy, SpawnTransform);
 					
 					if (CurrentRoomEnemy)
 					{
@@ -1399,7 +1469,7 @@ void URunManagerComponent::CompleteRoomTest()
 	// Clear any enemies (simulating enemy death)
 	if (CurrentRoomEnemy)
 	{
-		CurrentRoomEnemy->Destroy();
+		UEnemyPoolSubsystem::ReleaseEnemy(CurrentRoomEnemy);
 		CurrentRoomEnemy = nullptr;
 	}
 	
@@ -1613,8 +1683,15 @@ void URunManagerComponent::StartRewardSelection()
 	
 	bRewardSelectionActive = true;
 	
-	// Get rewards from current room
-	TArray<URewardDataAsset*> RewardChoices = GetRandomRewardsFromRoom(2);
+	if (RewardPresenter)
+	{
+		RewardPresenter->MarkRoomCleared();
+	}
+	
+	// Use the offer prepared when the room loaded, or roll one now
+	TArray<URewardDataAsset*> RewardChoices = RewardPresenter && RewardPresenter->HasPreparedOffer()
+		? RewardPresenter->TakePreparedOffer()
+		: GetRandomRewardsFromRoom(2);
 	CurrentRewardChoices = RewardChoices;
 	
 	UE_LOG(LogTemp, Warning, TEXT("========== REWARD SELECTION =========="));
@@ -1654,10 +1731,20 @@ void URunManagerComponent::StartRewardSelection()
 
 TArray<URewardDataAsset*> URunManagerComponent::GetRandomRewardsFromRoom(int32 Count)
 {
-	TArray<URewardDataAsset*> SelectedRewards;
-	
 	UE_LOG(LogTemp, Warning, TEXT("GetRandomRewardsFromRoom called with Count=%d"), Count);
 	
+	TArray<URewardDataAsset*> SelectedRewards = RollRewardChoices(Count);
+	
+	// Store current choices for console commands
+	CurrentRewardChoices = SelectedRewards;
+	
+	return SelectedRewards;
+}
+
+TArray<URewardDataAsset*> URunManagerComponent::RollRewardChoices(int32 Count)
+{
+	TArray<URewardDataAsset*> SelectedRewards;
+	
 	// If we have a current room with a reward pool, use it
 	if (CurrentRoom && CurrentRoom->RewardPool.Num() > 0)
 	{
@@ -1671,11 +1758,7 @@ TArray<URewardDataAsset*> URunManagerComponent::GetRandomRewardsFromRoom(int32 C
 		SelectedRewards = CreateTestRewardsForRoom(Count);
 	}
 	
-	// Store current choices for console commands
-	CurrentRewardChoices = SelectedRewards;
-	
 	return SelectedRewards;
-	
 }
 
 TArray<URewardDataAsset*> URunManagerComponent::CreateTestRewardsForRoom(int32 Count)
@@ -1802,6 +1885,11 @@ TArray<URewardDataAsset*> URunManagerComponent::CreateTestRewardsForRoom(int32 C
 
 URewardDataAsset* URunManagerComponent::CreateTestReward(const FString& Name, const FString& Description, ERewardCategory Category)
 {
+	if (URewardDataAsset* CachedReward = TestRewardCache.FindRef(Name))
+	{
+		return CachedReward;
+	}
+	
 	URewardDataAsset* TestReward = NewObject<URewardDataAsset>(this);
 	
 	if (!TestReward)
@@ -1872,6 +1960,8 @@ URewardDataAsset* URunManagerComponent::CreateTestReward(const FString& Name, co
 			break;
 	}
 	
+	TestRewardCache.Add(Name, TestReward);
+	
 	return TestReward;
 }
 
@@ -1913,17 +2003,10 @@ void URunManagerComponent::SelectReward(int32 RewardIndex)
 			FString::Printf(TEXT("Reward Selected: %s"), *SelectedRewardName));
 	}
 	
-	// Close ONLY the reward selection widget, not the slot manager
-	if (RewardSelectionWidget.IsValid())
+	// Hide ONLY the reward selection widget, not the slot manager
+	if (RewardPresenter && RewardPresenter->IsShowing())
 	{
-		// Remove from viewport
-		if (GEngine && GEngine->GameViewport)
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(RewardSelectionWidget.ToSharedRef());
-		}
-		
-		// Reset widget reference
-		RewardSelectionWidget.Reset();
+		RewardPresenter->Hide();
 		
 		UE_LOG(LogTemp, Log, TEXT("Closed reward selection widget"));
 	}
@@ -1946,12 +2029,6 @@ void URunManagerComponent::SelectReward(int32 RewardIndex)
 						UE_LOG(LogTemp, Log, TEXT("Reward equipped to slot"));
 						CloseInventoryWidget();
 						
-						// Refresh the compact slot manager display
-						if (SlotManagerWidget.IsValid())
-						{
-							SlotManagerWidget->RefreshSlots();
-						}
-						
 						CompleteRewardSelection();
 					})
 					.OnBackToRewardSelection_Lambda([this]()
@@ -2271,9 +2348,6 @@ void URunManagerComponent::CreateRewardSelectionUI()
 		}
 	}
 	
-	// Close existing widget if any
-	CloseRewardSelectionUI();
-	
 	// Don't transition to inventory mode here - that happens after selecting a reward
 	// Just log that rewards are available
 	UE_LOG(LogTemp, Warning, TEXT("Reward selection UI ready with %d rewards"), CurrentRewardChoices.Num());
@@ -2287,258 +2361,64 @@ void URunManagerComponent::CreateRewardSelectionUI()
 	UE_LOG(LogTemp, Warning, TEXT("  Atlas.CancelReward   (to skip reward)"));
 	UE_LOG(LogTemp, Warning, TEXT("================================="));
 	
-	// Create the Slate widget
-	UE_LOG(LogTemp, Warning, TEXT("Creating SRewardSelectionWidget..."));
-	RewardSelectionWidget = SNew(SRewardSelectionWidget)
-		.RewardChoices(CurrentRewardChoices)
-		.RunManager(this)
-		.OnRewardSelected_Lambda([this]()
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Slate UI: Reward selected callback"));
-			// Reward was selected, close the UI
-			CloseRewardSelectionUI();
-		})
-		.OnSelectionCancelled_Lambda([this]()
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Slate UI: Selection cancelled callback"));
-			// Selection was cancelled, close the UI
-			CloseRewardSelectionUI();
-		});
+	ShowRewardOffer();
+}
+
+void URunManagerComponent::CreateSimpleRewardSelectionUI()
+{
+	UE_LOG(LogTemp, Warning, TEXT("Showing reward UI without the console walkthrough"));
 	
-	// Check if widget was created successfully
-	if (!RewardSelectionWidget.IsValid())
+	if (CurrentRewardChoices.Num() == 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to create SRewardSelectionWidget!"));
-		return;
+		CurrentRewardChoices = CreateTestRewardsForRoom(2);
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("SRewardSelectionWidget created successfully"));
-	
-	// Add to viewport
-	if (GEngine)
+	ShowRewardOffer();
+}
+
+void URunManagerComponent::ShowRewardOffer()
+{
+	if (!RewardPresenter)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GEngine exists"));
-		
-		if (GEngine->GameViewport)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("GameViewport exists - adding widget"));
-			GEngine->GameViewport->AddViewportWidgetContent(RewardSelectionWidget.ToSharedRef(), 1000);
-			
-			// Set input mode to UI only
-			if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Setting input mode to UI only"));
-				FInputModeUIOnly InputMode;
-				InputMode.SetWidgetToFocus(RewardSelectionWidget);
-				PC->SetInputMode(InputMode);
-				PC->bShowMouseCursor = true;
-			}
-			else
-			{
-				UE_LOG(LogTemp, Error, TEXT("No player controller found!"));
-			}
-			
-			// Pause the game
-			UGameplayStatics::SetGamePaused(GetWorld(), true);
-			
-			UE_LOG(LogTemp, Warning, TEXT("✓ Successfully created Slate reward selection UI"));
-			UE_LOG(LogTemp, Warning, TEXT("✓ Game paused - waiting for player input"));
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("GameViewport is NULL!"));
-		}
+		UE_LOG(LogTemp, Error, TEXT("No reward presenter, use console commands to select rewards"));
+		return;
 	}
-	else
+	
+	if (!GEngine || !GEngine->GameViewport)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GEngine is NULL!"));
-		UE_LOG(LogTemp, Error, TEXT("Failed to create reward selection UI - no game engine"));
+		UE_LOG(LogTemp, Error, TEXT("GameViewport is NULL!"));
 		UE_LOG(LogTemp, Error, TEXT("Use console commands instead to select rewards"));
+		return;
 	}
-}
-
-void URunManagerComponent::CreateSimpleRewardSelectionUI()
-{
-	UE_LOG(LogTemp, Warning, TEXT("Creating simple pure Slate reward UI"));
 	
-	// Close any existing widget
-	CloseRewardSelectionUI();
+	// The widget already exists and is usually bound to these rewards, this only shows it
+	RewardPresenter->Show(CurrentRewardChoices);
 	
-	// Create a simple Slate widget with hardcoded rewards
-	RewardSelectionWidget = 
-		SNew(SBox)
-		.HAlign(HAlign_Fill)
-		.VAlign(VAlign_Fill)
-		[
-			// Semi-transparent background overlay
-			SNew(SBorder)
-			.BorderBackgroundColor(FLinearColor(0, 0, 0, 0.8f))
-			.HAlign(HAlign_Center)
-			.VAlign(VAlign_Center)
-			[
-				// Main reward panel
-				SNew(SBox)
-				.WidthOverride(600.0f)
-				.HeightOverride(300.0f)
-				[
-					SNew(SBorder)
-					.BorderBackgroundColor(FLinearColor(0.1f, 0.1f, 0.1f, 0.95f))
-					[
-						SNew(SVerticalBox)
-						
-						// Title
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						.Padding(20.0f, 20.0f, 20.0f, 10.0f)
-						.HAlign(HAlign_Center)
-						[
-							SNew(STextBlock)
-							.Text(FText::FromString("Choose Your Reward"))
-							.Font(FCoreStyle::GetDefaultFontStyle("Bold", 24))
-							.ColorAndOpacity(FLinearColor::White)
-						]
-						
-						// Rewards
-						+ SVerticalBox::Slot()
-						.FillHeight(1.0f)
-						.Padding(20.0f, 10.0f)
-						[
-							SNew(SHorizontalBox)
-							
-							// Reward 1
-							+ SHorizontalBox::Slot()
-							.FillWidth(1.0f)
-							.Padding(10.0f, 0.0f)
-							[
-								SNew(SButton)
-								.OnClicked_Lambda([this]() -> FReply
-								{
-									UE_LOG(LogTemp, Warning, TEXT("Player selected Sharp Blade via Slate UI"));
-									SelectReward(0);
-									return FReply::Handled();
-								})
-								.ContentPadding(FMargin(15.0f, 10.0f))
-								[
-									SNew(SVerticalBox)
-									+ SVerticalBox::Slot()
-									.AutoHeight()
-									.HAlign(HAlign_Center)
-									[
-										SNew(STextBlock)
-										.Text(FText::FromString("Sharp Blade"))
-										.Font(FCoreStyle::GetDefaultFontStyle("Bold", 18))
-										.ColorAndOpacity(FLinearColor::White)
-									]
-									+ SVerticalBox::Slot()
-									.AutoHeight()
-									.HAlign(HAlign_Center)
-									.Padding(0.0f, 5.0f, 0.0f, 0.0f)
-									[
-										SNew(STextBlock)
-										.Text(FText::FromString("+25%% Attack Damage"))
-										.Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
-										.ColorAndOpacity(FLinearColor(0.8f, 0.8f, 0.8f, 1.0f))
-										.AutoWrapText(true)
-									]
-								]
-							]
-							
-							// Reward 2
-							+ SHorizontalBox::Slot()
-							.FillWidth(1.0f)
-							.Padding(10.0f, 0.0f)
-							[
-								SNew(SButton)
-								.OnClicked_Lambda([this]() -> FReply
-								{
-									UE_LOG(LogTemp, Warning, TEXT("Player selected Iron Skin via Slate UI"));
-									SelectReward(1);
-									return FReply::Handled();
-								})
-								.ContentPadding(FMargin(15.0f, 10.0f))
-								[
-									SNew(SVerticalBox)
-									+ SVerticalBox::Slot()
-									.AutoHeight()
-									.HAlign(HAlign_Center)
-									[
-										SNew(STextBlock)
-										.Text(FText::FromString("Iron Skin"))
-										.Font(FCoreStyle::GetDefaultFontStyle("Bold", 18))
-										.ColorAndOpacity(FLinearColor::White)
-									]
-									+ SVerticalBox::Slot()
-									.AutoHeight()
-									.HAlign(HAlign_Center)
-									.Padding(0.0f, 5.0f, 0.0f, 0.0f)
-									[
-										SNew(STextBlock)
-										.Text(FText::FromString("-15%% Damage Taken"))
-										.Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
-										.ColorAndOpacity(FLinearColor(0.8f, 0.8f, 0.8f, 1.0f))
-										.AutoWrapText(true)
-									]
-								]
-							]
-						]
-						
-						// Cancel button
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						.Padding(20.0f, 10.0f, 20.0f, 20.0f)
-						.HAlign(HAlign_Center)
-						[
-							SNew(SButton)
-							.Text(FText::FromString("Skip Reward"))
-							.OnClicked_Lambda([this]() -> FReply
-							{
-								UE_LOG(LogTemp, Warning, TEXT("Player cancelled reward selection via Slate UI"));
-								CancelRewardSelection();
-								return FReply::Handled();
-							})
-						]
-					]
-				]
-			]
-		];
-	
-	// Add to viewport
-	if (GEngine && GEngine->GameViewport && RewardSelectionWidget.IsValid())
-	{
-		GEngine->GameViewport->AddViewportWidgetContent(RewardSelectionWidget.ToSharedRef(), 1000);
-		
-		// Set input mode to UI
-		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
-		{
-			FInputModeUIOnly InputMode;
-			InputMode.SetWidgetToFocus(RewardSelectionWidget);
-			PC->SetInputMode(InputMode);
-			PC->bShowMouseCursor = true;
-		}
-		
-		// Pause the game
-		UGameplayStatics::SetGamePaused(GetWorld(), true);
-		
-		UE_LOG(LogTemp, Warning, TEXT("Successfully created simple Slate reward UI"));
+	// Set input mode to UI only
+	if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
+	{
+		FInputModeUIOnly InputMode;
+		InputMode.SetWidgetToFocus(RewardPresenter->GetWidget());
+		PC->SetInputMode(InputMode);
+		PC->bShowMouseCursor = true;
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to create simple Slate UI"));
+		UE_LOG(LogTemp, Error, TEXT("No player controller found!"));
 	}
+	
+	// Pause the game
+	UGameplayStatics::SetGamePaused(GetWorld(), true);
+	
+	UE_LOG(LogTemp, Warning, TEXT("Reward offer interactive %.2f ms after room clear"), RewardPresenter->GetLastPresentLatencyMs());
 }
 
 void URunManagerComponent::CloseRewardSelectionUI()
 {
-	if (RewardSelectionWidget.IsValid())
+	if (RewardPresenter && RewardPresenter->IsShowing())
 	{
-		// Remove from viewport
-		if (GEngine && GEngine->GameViewport)
-		{
-			GEngine->GameViewport->RemoveViewportWidgetContent(RewardSelectionWidget.ToSharedRef());
-		}
-		
-		// Reset widget reference
-		RewardSelectionWidget.Reset();
+		// Hide, the widget is kept for the next room
+		RewardPresenter->Hide();
 		
 		// Restore input mode
 		if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
@@ -2654,16 +2534,8 @@ void URunManagerComponent::ShowEnemyHealthWidget(AGameCharacterBase* Enemy)
 		if (GEngine && GEngine->GameViewport && EnemyHealthWidget.IsValid())
 		{
 			GEngine->GameViewport->AddViewportWidgetContent(EnemyHealthWidget.ToSharedRef(), 15);
+			HUDModel->SetEnemyHealthWidget(EnemyHealthWidget);
 			
-			// Subscribe to health changes
-			if (!EnemyHealthComp->OnHealthChanged.IsAlreadyBound(this, &URunManagerComponent::OnEnemyHealthChanged))
-			{
-				EnemyHealthComp->OnHealthChanged.AddDynamic(this, &URunManagerComponent::OnEnemyHealthChanged);
-			}
-			if (!EnemyHealthComp->OnPoiseChanged.IsAlreadyBound(this, &URunManagerComponent::OnEnemyPoiseChanged))
-			{
-				EnemyHealthComp->OnPoiseChanged.AddDynamic(this, &URunManagerComponent::OnEnemyPoiseChanged);
-			}
 			// Subscribe to death event
 			if (!EnemyHealthComp->OnDeath.IsAlreadyBound(this, &URunManagerComponent::OnEnemyDefeated))
 			{
@@ -2689,15 +2561,6 @@ void URunManagerComponent::ShowEnemyHealthWidget(AGameCharacterBase* Enemy)
 			EnemyHealthWidget->SetEnemyName(EnemyName);
 			EnemyHealthWidget->SetEnemyHealthComponent(HealthComp);
 			
-			// Subscribe to health changes
-			if (!HealthComp->OnHealthChanged.IsAlreadyBound(this, &URunManagerComponent::OnEnemyHealthChanged))
-			{
-				HealthComp->OnHealthChanged.AddDynamic(this, &URunManagerComponent::OnEnemyHealthChanged);
-			}
-			if (!HealthComp->OnPoiseChanged.IsAlreadyBound(this, &URunManagerComponent::OnEnemyPoiseChanged))
-			{
-				HealthComp->OnPoiseChanged.AddDynamic(this, &URunManagerComponent::OnEnemyPoiseChanged);
-			}
 			// Subscribe to death event
 			if (!HealthComp->OnDeath.IsAlreadyBound(this, &URunManagerComponent::OnEnemyDefeated))
 			{
@@ -2716,18 +2579,8 @@ void URunManagerComponent::ShowEnemyHealthWidget(AGameCharacterBase* Enemy)
 		UE_LOG(LogTemp, Warning, TEXT("Calling ShowWidget on EnemyHealthWidget"));
 		EnemyHealthWidget->ShowWidget();
 		
-		// Force update with current values
-		if (UHealthComponent* HealthComp = Enemy->GetHealthComponent())
-		{
-			UpdateEnemyHealthDisplay(
-				HealthComp->GetCurrentHealth(),
-				HealthComp->GetMaxHealth(),
-				HealthComp->GetCurrentPoise(),
-				HealthComp->GetMaxPoise());
-			UE_LOG(LogTemp, Warning, TEXT("Updated enemy display - Health: %.0f/%.0f, Poise: %.0f/%.0f"),
-				HealthComp->GetCurrentHealth(), HealthComp->GetMaxHealth(),
-				HealthComp->GetCurrentPoise(), HealthComp->GetMaxPoise());
-		}
+		// Fills the widget with the enemy's current values and follows its health and poise
+		HUDModel->BindEnemy(Enemy);
 	}
 	else
 	{
@@ -2737,6 +2590,11 @@ void URunManagerComponent::ShowEnemyHealthWidget(AGameCharacterBase* Enemy)
 
 void URunManagerComponent::HideEnemyHealthWidget()
 {
+	if (HUDModel)
+	{
+		HUDModel->BindEnemy(nullptr);
+	}
+	
 	if (EnemyHealthWidget.IsValid())
 	{
 		EnemyHealthWidget->HideWidget();
@@ -2748,46 +2606,4 @@ void URunManagerComponent::HideEnemyHealthWidget()
 		}
 		EnemyHealthWidget.Reset();
 	}
-}
-
-void URunManagerComponent::OnPlayerHealthChanged(float CurrentHealth, float MaxHealth, float HealthDelta)
-{
-	if (RunProgressWidget.IsValid())
-	{
-		RunProgressWidget->UpdateHealth(CurrentHealth, MaxHealth);
-	}
-}
-
-void URunManagerComponent::OnPlayerPoiseChanged(float CurrentPoise, float MaxPoise, float PoiseDelta)
-{
-	if (RunProgressWidget.IsValid())
-	{
-		RunProgressWidget->UpdatePoise(CurrentPoise, MaxPoise);
-	}
-}
-
-void URunManagerComponent::OnPlayerIntegrityChanged(float CurrentIntegrity, float MaxIntegrity, float IntegrityDelta)
-{
-	if (RunProgressWidget.IsValid())
-	{
-		RunProgressWidget->UpdateIntegrity(CurrentIntegrity, MaxIntegrity);
-	}
-}
-
-void URunManagerComponent::OnEnemyHealthChanged(float CurrentHealth, float MaxHealth, float HealthDelta)
-{
-	// Update the widget directly with the values from the event
-	if (EnemyHealthWidget.IsValid())
-	{
-		EnemyHealthWidget->UpdateEnemyHealth(CurrentHealth, MaxHealth);
-	}
-}
-
-void URunManagerComponent::OnEnemyPoiseChanged(float CurrentPoise, float MaxPoise, float PoiseDelta)
-{
-	// Update the widget directly with the values from the event
-	if (EnemyHealthWidget.IsValid())
-	{
-		EnemyHealthWidget->UpdateEnemyPoise(CurrentPoise, MaxPoise);
-	}
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
 #include "Atlas/Data/RoomDataAsset.h"  // Need full include for ERoomType
+#include "Atlas/Rooms/EncounterDirector.h"
 #include "RunManagerComponent.generated.h"
 
 // Forward declarations
@@ -79,7 +80,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	// ========================================
@@ -267,23 +268,6 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Run Manager|UI")
 	void HideEnemyHealthWidget();
 
-protected:
-	// UI Update callbacks
-	UFUNCTION()
-	void OnPlayerHealthChanged(float CurrentHealth, float MaxHealth, float HealthDelta);
-	
-	UFUNCTION()
-	void OnPlayerPoiseChanged(float CurrentPoise, float MaxPoise, float PoiseDelta);
-	
-	UFUNCTION()
-	void OnPlayerIntegrityChanged(float CurrentIntegrity, float MaxIntegrity, float IntegrityDelta);
-	
-	UFUNCTION()
-	void OnEnemyHealthChanged(float CurrentHealth, float MaxHealth, float HealthDelta);
-	
-	UFUNCTION()
-	void OnEnemyPoiseChanged(float CurrentPoise, float MaxPoise, float PoiseDelta);
-
 public:
 	
 	// ========================================
@@ -380,10 +364,15 @@ public:
 	void CreateRewardSelectionUI();
 	
 	/**
-	 * Create simple pure Slate UI for testing (no UObject dependencies)
+	 * Show the reward selection UI without the console instructions
 	 */
 	void CreateSimpleRewardSelectionUI();
 	
+	/**
+	 * Show CurrentRewardChoices in the persistent reward widget, pause and give it input
+	 */
+	void ShowRewardOffer();
+	
 	/**
 	 * Close the Slate reward selection UI
 	 */
@@ -394,6 +383,13 @@ public:
 	 */
 	void CloseInventoryWidget();
 	
+	/**
+	 * Pick rewards from the current room's pool (or test rewards) without presenting them
+	 * @param Count Number of rewards to pick
+	 * @return Array of random rewards
+	 */
+	TArray<class URewardDataAsset*> RollRewardChoices(int32 Count);
+	
 	/**
 	 * Create test rewards for the current room type
 	 * @param Count Number of rewards to create
@@ -402,7 +398,7 @@ public:
 	TArray<class URewardDataAsset*> CreateTestRewardsForRoom(int32 Count);
 	
 	/**
-	 * Helper to create a single test reward
+	 * Helper to create a single test reward, made once per name and reused after that
 	 */
 	class URewardDataAsset* CreateTestReward(const FString& Name, const FString& Description, ERewardCategory Category);
 	
@@ -436,6 +432,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Run Manager|Scaling")
 	void ApplyEnemyScaling(AGameCharacterBase* Enemy);
 	
+	/**
+	 * Get the encounter plan for the current room, planned once per room and level
+	 * @return Budget and how it was spent
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Run Manager|Scaling")
+	FEncounterPlan GetEncounterPlan();
+	
+	/**
+	 * Apply the current encounter plan's hazard intensity and enemy spawn delay to a room actor
+	 * @param Room The room about to be activated
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Run Manager|Scaling")
+	void ApplyEncounterToRoom(ARoomBase* Room);
+	
 	// ========================================
 	// EVENTS
 	// ========================================
@@ -543,6 +553,9 @@ protected:
 	UPROPERTY()
 	AGameCharacterBase* PlayerCharacter;
 	
+	/** Drains station integrity once a second while a hull breach room is active */
+	FTimerHandle IntegrityDrainTimer;
+	
 	/** Time when current room started */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
 	float RoomStartTime;
@@ -567,6 +580,22 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Configuration")
 	bool bAutoSaveProgress = true;
 	
+	/** Difficulty budget curves and spending rules, baked on BeginPlay */
+	UPROPERTY(EditDefaultsOnly, Category = "Configuration|Encounter")
+	FEncounterDirectorSettings EncounterSettings;
+	
+	/** Plan for the current room */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
+	FEncounterPlan CurrentEncounterPlan;
+	
+	/** Room and level CurrentEncounterPlan was made for */
+	UPROPERTY()
+	URoomDataAsset* PlannedRoom = nullptr;
+	
+	int32 PlannedLevel = 0;
+	
+	FEncounterDirector EncounterDirector;
+	
 	
 	/** Current room actor instance */
 	UPROPERTY()
@@ -598,8 +627,17 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Rewards")
 	bool bRewardSelectionActive = false;
 	
-	/** Slate widget for reward selection */
-	TSharedPtr<SWidget> RewardSelectionWidget;
+	/** Pushes player, enemy and room events into the HUD widgets below */
+	UPROPERTY()
+	class UHUDViewModel* HUDModel;
+	
+	/** Prepares each room's reward offer during the fight and owns the reward selection widget */
+	UPROPERTY()
+	class URewardOfferPresenter* RewardPresenter;
+	
+	/** Test rewards by name, so rooms without a reward pool don't create new ones every offer */
+	UPROPERTY()
+	TMap<FString, class URewardDataAsset*> TestRewardCache;
 	
 	/** Slate widget for run progress display */
 	TSharedPtr<class SRunProgressWidget> RunProgressWidget;
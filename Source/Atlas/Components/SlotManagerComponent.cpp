@@ -25,6 +25,9 @@ void USlotManagerComponent::BeginPlay()
 		ActionManagerComponent = OwnerCharacter->GetActionManagerComponent();
 	}
 	
+	// MaxSlots may have been changed on a subclass after the constructor sized the array
+	EquippedRewards.SetNum(MaxSlots);
+	
 	// Load rewards from save or apply defaults
 	LoadRewardsFromSave();
 	
@@ -152,6 +155,7 @@ bool USlotManagerComponent::EnhanceReward(FGameplayTag RewardTag)
 	
 	// Broadcast event
 	OnRewardEnhanced.Broadcast(SlotIndex, FoundReward.RewardData, EquippedRewards[SlotIndex].StackLevel);
+	OnSlotsChanged.Broadcast();
 	
 	UE_LOG(LogTemp, Log, TEXT("Enhanced reward %s to level %d"), 
 		*FoundReward.RewardData->RewardName.ToString(), EquippedRewards[SlotIndex].StackLevel);
@@ -203,6 +207,25 @@ void USlotManagerComponent::ClearAllRewards()
 	}
 }
 
+void USlotManagerComponent::SetMaxSlots(int32 NewMaxSlots)
+{
+	NewMaxSlots = FMath::Max(NewMaxSlots, 0);
+	if (NewMaxSlots == MaxSlots)
+	{
+		return;
+	}
+	
+	for (int32 i = NewMaxSlots; i < MaxSlots; i++)
+	{
+		RemoveReward(i);
+	}
+	
+	MaxSlots = NewMaxSlots;
+	EquippedRewards.SetNum(MaxSlots);
+	
+	OnSlotsChanged.Broadcast();
+}
+
 URewardDataAsset* USlotManagerComponent::GetRewardInSlot(int32 SlotIndex) const
 {
 	if (SlotIndex < 0 || SlotIndex >= EquippedRewards.Num())
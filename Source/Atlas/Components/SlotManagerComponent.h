@@ -105,6 +105,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Slot Manager")
 	void ClearAllRewards();
 	
+	/**
+	 * Change the number of slots, rewards in slots past the new count are removed
+	 * @param NewMaxSlots The new slot count
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Slot Manager")
+	void SetMaxSlots(int32 NewMaxSlots);
+	
 	// ========================================
 	// QUERIES
 	// ========================================
@@ -117,6 +124,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Slot Manager")
 	URewardDataAsset* GetRewardInSlot(int32 SlotIndex) const;
 	
+	/**
+	 * Get the number of reward slots
+	 * @return Slot count, empty slots included
+	 */
+	UFUNCTION(BlueprintPure, Category = "Slot Manager")
+	int32 GetMaxSlots() const { return MaxSlots; }
+	
+	/** Every slot in slot order, empty ones included, for the slot widgets to diff against */
+	const TArray<FEquippedReward>& GetEquippedRewardSlots() const { return EquippedRewards; }
+	
 	/**
 	 * Get the stack level of a reward in a slot
 	 * @param SlotIndex The slot to check
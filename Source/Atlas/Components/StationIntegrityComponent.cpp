@@ -82,6 +82,19 @@ void UStationIntegrityComponent::SetIntegrityPercent(float Percent)
     SetIntegrity(NewIntegrity);
 }
 
+void UStationIntegrityComponent::ResetIntegrity()
+{
+    const float IntegrityDelta = MaxIntegrity - CurrentIntegrity;
+    CurrentIntegrity = MaxIntegrity;
+    bIsIntegrityCritical = false;
+    bIsIntegrityFailed = false;
+
+    if (!FMath::IsNearlyZero(IntegrityDelta))
+    {
+        BroadcastIntegrityChange(IntegrityDelta);
+    }
+}
+
 float UStationIntegrityComponent::GetIntegrityPercent() const
 {
     if (MaxIntegrity <= 0.0f)
@@ -58,6 +58,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Station Integrity")
     void SetIntegrityPercent(float Percent);
 
+    /** Full integrity with the critical and failed flags cleared, SetIntegrity can't leave the failed state */
+    UFUNCTION(BlueprintCallable, Category = "Station Integrity")
+    void ResetIntegrity();
+
     UFUNCTION(BlueprintCallable, Category = "Station Integrity")
     float GetIntegrityPercent() const;
 
@@ -1,11 +1,12 @@
 #include "WallImpactComponent.h"
 #include "HealthComponent.h"
+#include "../Core/AtlasLog.h"
+#include "../Debug/AtlasDebugDraw.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SphereComponent.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
 #include "TimerManager.h"
 
 UWallImpactComponent::UWallImpactComponent()
@@ -26,22 +27,20 @@ void UWallImpactComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     // Draw debug sphere following the tracked target
-    #if WITH_EDITOR
-    if (bIsTracking && TrackedTarget)
+    #if ATLAS_WITH_DEBUG_DRAW
+    if (bIsTracking && TrackedTarget && FAtlasDebugDraw::IsEnabled())
     {
         FVector CurrentPos = TrackedTarget->GetActorLocation();
         // Draw sphere at current enemy position
-        DrawDebugSphere(GetWorld(), CurrentPos, CollisionSphereRadius, 
-            16, FColor::Yellow, false, 0.0f, 0, 2.0f);
-        DrawDebugString(GetWorld(), CurrentPos + FVector(0, 0, 150), 
+        FAtlasDebugDraw::Sphere(this, CurrentPos, CollisionSphereRadius, FColor::Yellow, 0.0f, 2.0f);
+        FAtlasDebugDraw::String(this, CurrentPos + FVector(0, 0, 150), 
             FString::Printf(TEXT("TRACKING\nPos: %.0f,%.0f,%.0f"), CurrentPos.X, CurrentPos.Y, CurrentPos.Z), 
-            nullptr, FColor::Yellow, 0.0f, true, 1.5f);
+            FColor::Yellow, 0.0f, 1.5f);
         
         // Also show collision sphere actual position
         if (CollisionSphere)
         {
-            FVector SpherePos = CollisionSphere->GetComponentLocation();
-            DrawDebugLine(GetWorld(), CurrentPos, SpherePos, FColor::Orange, false, 0.0f, 0, 2.0f);
+            FAtlasDebugDraw::Line(this, CurrentPos, CollisionSphere->GetComponentLocation(), FColor::Orange, 0.0f, 2.0f);
         }
     }
     #endif
@@ -51,7 +50,7 @@ void UWallImpactComponent::StartKnockbackTracking(AActor* Target, float Knockbac
 {
     if (!Target || KnockbackForce < MinImpactForce)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Knockback force %.1f below threshold %.1f - no tracking"), 
+        UE_LOG(LogAtlasImpact, Verbose, TEXT("Knockback force %.1f below threshold %.1f - no tracking"), 
             KnockbackForce, MinImpactForce);
         return;
     }
@@ -63,8 +62,8 @@ void UWallImpactComponent::StartKnockbackTracking(AActor* Target, float Knockbac
     CurrentKnockbackForce = KnockbackForce;
     bIsTracking = true;
     
-    // Enable ticking to update debug visualization
-    SetComponentTickEnabled(true);
+    // The tick only draws the tracked target, so it stays off unless Atlas.Debug.Draw is on
+    SetComponentTickEnabled(FAtlasDebugDraw::IsEnabled());
     
     // Try to use existing capsule collision from character
     if (ACharacter* Character = Cast<ACharacter>(Target))
@@ -73,7 +72,7 @@ void UWallImpactComponent::StartKnockbackTracking(AActor* Target, float Knockbac
         {
             // Use existing capsule's hit events
             Capsule->OnComponentHit.AddDynamic(this, &UWallImpactComponent::OnTargetHit);
-            UE_LOG(LogTemp, Warning, TEXT("Using character capsule for collision detection on %s"), 
+            UE_LOG(LogAtlasImpact, Verbose, TEXT("Using character capsule for collision detection on %s"), 
                 *Target->GetName());
         }
     }
@@ -98,13 +97,13 @@ void UWallImpactComponent::StartKnockbackTracking(AActor* Target, float Knockbac
             // Bind collision event
             CollisionSphere->OnComponentHit.AddDynamic(this, &UWallImpactComponent::OnTargetHit);
             
-            UE_LOG(LogTemp, Warning, TEXT("Collision sphere created for %s"), *Target->GetName());
+            UE_LOG(LogAtlasImpact, Verbose, TEXT("Collision sphere created for %s"), *Target->GetName());
         }
     }
     
     // Initial debug draw will be handled by Tick
     
-    UE_LOG(LogTemp, Warning, TEXT("[KNOCKBACK TRACKING] Started for %s | Force: %.1f | Threshold: %.1f"), 
+    UE_LOG(LogAtlasImpact, Verbose, TEXT("[KNOCKBACK TRACKING] Started for %s | Force: %.1f | Threshold: %.1f"), 
         *Target->GetName(), KnockbackForce, MinImpactForce);
     
     // Set timeout to stop tracking after reasonable time (e.g., 2 seconds)
@@ -158,20 +157,20 @@ void UWallImpactComponent::StopKnockbackTracking()
 void UWallImpactComponent::OnTargetHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, 
     UPrimitiveComponent* OtherComponent, FVector NormalImpulse, const FHitResult& Hit)
 {
-    UE_LOG(LogTemp, Warning, TEXT("OnTargetHit Called! HitComponent: %s, OtherActor: %s"), 
+    UE_LOG(LogAtlasImpact, Verbose, TEXT("OnTargetHit Called! HitComponent: %s, OtherActor: %s"), 
         HitComponent ? *HitComponent->GetName() : TEXT("NULL"),
         OtherActor ? *OtherActor->GetName() : TEXT("NULL"));
     
     if (!bIsTracking || !TrackedTarget)
     {
-        UE_LOG(LogTemp, Warning, TEXT("OnTargetHit ignored - Tracking: %s, Target: %s"),
+        UE_LOG(LogAtlasImpact, Verbose, TEXT("OnTargetHit ignored - Tracking: %s, Target: %s"),
             bIsTracking ? TEXT("Yes") : TEXT("No"),
             TrackedTarget ? TEXT("Valid") : TEXT("NULL"));
         return;
     }
     
     // Log hit details
-    UE_LOG(LogTemp, Warning, TEXT("Hit detected! BlockingHit: %s, ImpactPoint: %s, Normal: %s"),
+    UE_LOG(LogAtlasImpact, Verbose, TEXT("Hit detected! BlockingHit: %s, ImpactPoint: %s, Normal: %s"),
         Hit.bBlockingHit ? TEXT("Yes") : TEXT("No"),
         *Hit.ImpactPoint.ToString(),
         *Hit.ImpactNormal.ToString());
@@ -179,25 +178,13 @@ void UWallImpactComponent::OnTargetHit(UPrimitiveComponent* HitComponent, AActor
     // Check if this is a significant impact
     if (Hit.bBlockingHit)
     {
-        #if WITH_EDITOR
         // Debug visualization of impact
-        DrawDebugSphere(GetWorld(), Hit.Location, 30.0f, 12, FColor::Red, false, 3.0f);
-        DrawDebugDirectionalArrow(GetWorld(), Hit.Location, 
-            Hit.Location + Hit.Normal * 100.0f, 
-            30.0f, FColor::Cyan, false, 3.0f, 0, 3.0f);
+        ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Sphere(this, Hit.Location, 30.0f, FColor::Red, 3.0f));
+        ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Arrow(this, Hit.Location, Hit.Location + Hit.Normal * 100.0f, 30.0f, FColor::Cyan, 3.0f, 3.0f));
         
-        FString SurfaceType = IsWallHit(Hit) ? TEXT("WALL") : (IsFloorHit(Hit) ? TEXT("FLOOR") : TEXT("SLOPE"));
-        FString ImpactColor = IsWallHit(Hit) ? TEXT("RED") : (IsFloorHit(Hit) ? TEXT("GREEN") : TEXT("YELLOW"));
-        
-        UE_LOG(LogTemp, Warning, TEXT("========================================"));
-        UE_LOG(LogTemp, Warning, TEXT("KNOCKBACK IMPACT DETECTED!"));
-        UE_LOG(LogTemp, Warning, TEXT("  Type: %s"), *SurfaceType);
-        UE_LOG(LogTemp, Warning, TEXT("  Surface Normal Z: %.2f"), Hit.Normal.Z);
-        UE_LOG(LogTemp, Warning, TEXT("  Impact Location: %s"), *Hit.Location.ToString());
-        UE_LOG(LogTemp, Warning, TEXT("  Impact Actor: %s"), Hit.GetActor() ? *Hit.GetActor()->GetName() : TEXT("None"));
-        UE_LOG(LogTemp, Warning, TEXT("  Debug Color: %s"), *ImpactColor);
-        UE_LOG(LogTemp, Warning, TEXT("========================================"));
-        #endif
+        UE_LOG(LogAtlasImpact, Verbose, TEXT("Knockback impact: %s, normal Z %.2f, at %s, against %s"),
+            IsWallHit(Hit) ? TEXT("WALL") : (IsFloorHit(Hit) ? TEXT("FLOOR") : TEXT("SLOPE")),
+            Hit.Normal.Z, *Hit.Location.ToString(), Hit.GetActor() ? *Hit.GetActor()->GetName() : TEXT("None"));
         
         // Determine impact type and apply appropriate effects
         if (IsWallHit(Hit))
@@ -233,10 +220,8 @@ void UWallImpactComponent::ApplyWallImpactEffects(AActor* Target, const FHitResu
         return;
     }
     
-    UE_LOG(LogTemp, Warning, TEXT(">>> WALL IMPACT EFFECTS APPLIED <<<"));
-    UE_LOG(LogTemp, Warning, TEXT("  - Stagger Duration: %.1f seconds"), WallImpactStaggerDuration);
-    UE_LOG(LogTemp, Warning, TEXT("  - Bounce Force Applied"));
-    UE_LOG(LogTemp, Warning, TEXT("  - Wall Break VFX at: %s"), *WallHit.Location.ToString());
+    UE_LOG(LogAtlasImpact, Verbose, TEXT("Wall impact on %s at %s: %.1f s stagger, bounce applied"),
+        *Target->GetName(), *WallHit.Location.ToString(), WallImpactStaggerDuration);
     
     // Apply extended stagger for wall impact
     UHealthComponent* HealthComp = Target->FindComponentByClass<UHealthComponent>();
@@ -277,17 +262,18 @@ void UWallImpactComponent::ApplyWallImpactEffects(AActor* Target, const FHitResu
     }
     
     // Spawn wall breaking effect at impact point
-    #if WITH_EDITOR
-    // Large red sphere for wall impact
-    DrawDebugSphere(GetWorld(), WallHit.Location, 75.0f, 24, FColor::Red, false, 5.0f, 0, 8.0f);
-    // Show impact force direction
-    DrawDebugDirectionalArrow(GetWorld(), WallHit.Location, 
-        WallHit.Location + WallHit.Normal * 200.0f, 
-        50.0f, FColor::Orange, false, 5.0f, 0, 5.0f);
-    // Impact text
-    DrawDebugString(GetWorld(), WallHit.Location + FVector(0, 0, 100), 
-        FString::Printf(TEXT("WALL IMPACT!\n2 sec stagger\nForce: %.0f"), CurrentKnockbackForce), 
-        nullptr, FColor::Red, 5.0f, true, 2.0f);
+    #if ATLAS_WITH_DEBUG_DRAW
+    if (FAtlasDebugDraw::IsEnabled())
+    {
+        // Large red sphere for wall impact
+        FAtlasDebugDraw::Sphere(this, WallHit.Location, 75.0f, FColor::Red, 5.0f, 8.0f);
+        // Show impact force direction
+        FAtlasDebugDraw::Arrow(this, WallHit.Location, WallHit.Location + WallHit.Normal * 200.0f, 50.0f, FColor::Orange, 5.0f, 5.0f);
+        // Impact text
+        FAtlasDebugDraw::String(this, WallHit.Location + FVector(0, 0, 100), 
+            FString::Printf(TEXT("WALL IMPACT!\n2 sec stagger\nForce: %.0f"), CurrentKnockbackForce), 
+            FColor::Red, 5.0f, 2.0f);
+    }
     #endif
     
     // Broadcast wall impact event
@@ -304,10 +290,8 @@ void UWallImpactComponent::ApplyFloorImpactEffects(AActor* Target, const FHitRes
         return;
     }
     
-    UE_LOG(LogTemp, Warning, TEXT(">>> FLOOR IMPACT EFFECTS APPLIED <<<"));
-    UE_LOG(LogTemp, Warning, TEXT("  - Ragdoll Duration: %.1f seconds"), FloorRagdollDuration);
-    UE_LOG(LogTemp, Warning, TEXT("  - Recovery Timer Started"));
-    UE_LOG(LogTemp, Warning, TEXT("  - Floor Impact at: %s"), *FloorHit.Location.ToString());
+    UE_LOG(LogAtlasImpact, Verbose, TEXT("Floor impact on %s at %s: %.1f s ragdoll, recovery timer started"),
+        *Target->GetName(), *FloorHit.Location.ToString(), FloorRagdollDuration);
     
     UHealthComponent* HealthComp = Target->FindComponentByClass<UHealthComponent>();
     if (HealthComp)
@@ -321,7 +305,7 @@ void UWallImpactComponent::ApplyFloorImpactEffects(AActor* Target, const FHitRes
         RecoveryDelegate.BindLambda([Target]()
         {
             // TODO: Play get-up animation
-            UE_LOG(LogTemp, Warning, TEXT("Floor recovery complete - playing get-up animation"));
+            UE_LOG(LogAtlasImpact, Verbose, TEXT("Floor recovery complete - playing get-up animation"));
         });
         
         GetWorld()->GetTimerManager().SetTimer(
@@ -333,15 +317,17 @@ void UWallImpactComponent::ApplyFloorImpactEffects(AActor* Target, const FHitRes
     }
     
     // Spawn floor impact effect
-    #if WITH_EDITOR
-    // Medium green circle for floor impact
-    DrawDebugCircle(GetWorld(), FloorHit.Location, 60.0f, 32, FColor::Green, false, 3.0f, 0, 4.0f, 
-        FVector(0, 0, 1), FVector(1, 0, 0));
-    DrawDebugSphere(GetWorld(), FloorHit.Location, 40.0f, 16, FColor::Green, false, 3.0f, 0, 3.0f);
-    // Impact text
-    DrawDebugString(GetWorld(), FloorHit.Location + FVector(0, 0, 50), 
-        FString::Printf(TEXT("FLOOR IMPACT!\n1 sec ragdoll\nForce: %.0f"), CurrentKnockbackForce), 
-        nullptr, FColor::Green, 3.0f, true, 1.5f);
+    #if ATLAS_WITH_DEBUG_DRAW
+    if (FAtlasDebugDraw::IsEnabled())
+    {
+        // Medium green circle for floor impact
+        FAtlasDebugDraw::Circle(this, FloorHit.Location, 60.0f, FVector(0, 0, 1), FVector(1, 0, 0), FColor::Green, 3.0f, 4.0f);
+        FAtlasDebugDraw::Sphere(this, FloorHit.Location, 40.0f, FColor::Green, 3.0f, 3.0f);
+        // Impact text
+        FAtlasDebugDraw::String(this, FloorHit.Location + FVector(0, 0, 50), 
+            FString::Printf(TEXT("FLOOR IMPACT!\n1 sec ragdoll\nForce: %.0f"), CurrentKnockbackForce), 
+            FColor::Green, 3.0f, 1.5f);
+    }
     #endif
     
     // Broadcast floor impact event
@@ -0,0 +1,6 @@
+#include "AtlasLog.h"
+
+DEFINE_LOG_CATEGORY(LogAtlasActions);
+DEFINE_LOG_CATEGORY(LogAtlasHealth);
+DEFINE_LOG_CATEGORY(LogAtlasImpact);
+DEFINE_LOG_CATEGORY(LogAtlasInteractables);
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * Atlas Log - Per-subsystem log categories
+ *
+ * Per-event messages on hot paths are Verbose, so they are skipped at runtime until raised,
+ * for example with: Log LogAtlasHealth Verbose
+ *
+ * Anything above the compile-time ceiling is not compiled in at all, arguments included.
+ * Development keeps everything, Test keeps warnings and Shipping keeps errors. Define
+ * ATLAS_LOG_COMPILE_VERBOSITY in Atlas.Build.cs to use another ceiling.
+ */
+#ifndef ATLAS_LOG_COMPILE_VERBOSITY
+    #if UE_BUILD_SHIPPING
+        #define ATLAS_LOG_COMPILE_VERBOSITY Error
+    #elif UE_BUILD_TEST
+        #define ATLAS_LOG_COMPILE_VERBOSITY Warning
+    #else
+        #define ATLAS_LOG_COMPILE_VERBOSITY All
+    #endif
+#endif
+
+/** Slot input, action activation and combo buffering */
+ATLAS_API DECLARE_LOG_CATEGORY_EXTERN(LogAtlasActions, Log, ATLAS_LOG_COMPILE_VERBOSITY);
+
+/** Damage, healing, poise, stagger and death */
+ATLAS_API DECLARE_LOG_CATEGORY_EXTERN(LogAtlasHealth, Log, ATLAS_LOG_COMPILE_VERBOSITY);
+
+/** Knockback tracking and wall and floor impacts */
+ATLAS_API DECLARE_LOG_CATEGORY_EXTERN(LogAtlasImpact, Log, ATLAS_LOG_COMPILE_VERBOSITY);
+
+/** Vents, valves and the other interactables */
+ATLAS_API DECLARE_LOG_CATEGORY_EXTERN(LogAtlasInteractables, Log, ATLAS_LOG_COMPILE_VERBOSITY);
@@ -0,0 +1,118 @@
+#include "AtlasStats.h"
+
+DEFINE_STAT(STAT_AtlasTickActions);
+DEFINE_STAT(STAT_AtlasAttackNotifyTick);
+DEFINE_STAT(STAT_AtlasFocusScan);
+DEFINE_STAT(STAT_AtlasHazardTick);
+DEFINE_STAT(STAT_AtlasIntegrityVisualizerTick);
+DEFINE_STAT(STAT_AtlasLoadRoom);
+DEFINE_STAT(STAT_AtlasGravityField);
+DEFINE_STAT(STAT_AtlasAIDecisions);
+DEFINE_STAT(STAT_AtlasEnemyPool);
+DEFINE_STAT(STAT_AtlasEnemyBars);
+
+DEFINE_STAT(STAT_AtlasActiveHazards);
+DEFINE_STAT(STAT_AtlasPoisonDOTs);
+DEFINE_STAT(STAT_AtlasAttackSweeps);
+
+UE_TRACE_CHANNEL_DEFINE(AtlasChannel);
+
+TRACE_DECLARE_INT_COUNTER(AtlasActiveHazards, TEXT("Atlas/ActiveHazards"));
+TRACE_DECLARE_INT_COUNTER(AtlasPoisonDOTs, TEXT("Atlas/PoisonDOTs"));
+TRACE_DECLARE_INT_COUNTER(AtlasAttackSweeps, TEXT("Atlas/AttackSweeps"));
+
+namespace
+{
+    /** A running total that starts over on the first call of each frame. Game thread only */
+    struct FPerFrameCount
+    {
+        uint64 Frame = 0;
+        int64 Count = 0;
+
+        int64 Add(int64 Num)
+        {
+            if (Frame != GFrameCounter)
+            {
+                Frame = GFrameCounter;
+                Count = 0;
+            }
+            return Count += Num;
+        }
+    };
+
+    uint64 ScopeCycles[static_cast<int32>(AtlasStats::EScope::Num)] = {};
+}
+
+namespace AtlasStats
+{
+    const TCHAR* GetScopeName(EScope Scope)
+    {
+        static const TCHAR* const Names[] = {
+            TEXT("Action Manager TickActions"),
+            TEXT("Attack Notify Tick"),
+            TEXT("Focus Mode ScanForTargets"),
+            TEXT("Hazard Tick"),
+            TEXT("Integrity Visualizer Tick"),
+            TEXT("Run Manager LoadRoom"),
+            TEXT("Gravity Field Tick"),
+            TEXT("AI Decision Scheduler"),
+            TEXT("Enemy Pool Acquire/Release"),
+            TEXT("Enemy Bars Tick"),
+        };
+        static_assert(UE_ARRAY_COUNT(Names) == static_cast<int32>(EScope::Num), "A name per scope");
+        return Names[static_cast<int32>(Scope)];
+    }
+
+    double GetScopeSeconds(EScope Scope)
+    {
+        return FPlatformTime::ToSeconds64(ScopeCycles[static_cast<int32>(Scope)]);
+    }
+
+    void AddScopeCycles(EScope Scope, uint64 Cycles)
+    {
+        if (IsInGameThread())
+        {
+            ScopeCycles[static_cast<int32>(Scope)] += Cycles;
+        }
+    }
+
+    void AddActiveHazards(int32 Delta)
+    {
+        INC_DWORD_STAT_BY(STAT_AtlasActiveHazards, Delta);
+        TRACE_COUNTER_ADD(AtlasActiveHazards, Delta);
+    }
+
+    void CountPoisonDOTs(int32 Num)
+    {
+        INC_DWORD_STAT_BY(STAT_AtlasPoisonDOTs, Num);
+
+#if COUNTERSTRACE_ENABLED
+        static FPerFrameCount PoisonDOTs;
+        TRACE_COUNTER_SET(AtlasPoisonDOTs, PoisonDOTs.Add(Num));
+#endif
+    }
+
+    void CountAttackSweep()
+    {
+        INC_DWORD_STAT(STAT_AtlasAttackSweeps);
+
+#if COUNTERSTRACE_ENABLED
+        static FPerFrameCount AttackSweeps;
+        TRACE_COUNTER_SET(AtlasAttackSweeps, AttackSweeps.Add(1));
+#endif
+    }
+
+    bool SetTraceChannelEnabled(bool bEnabled)
+    {
+        return UE::Trace::ToggleChannel(TEXT("Atlas"), bEnabled);
+    }
+
+    bool IsTraceChannelEnabled()
+    {
+#if UE_TRACE_ENABLED
+        return AtlasChannel.IsEnabled();
+#else
+        return false;
+#endif
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/**
+ * Atlas Stats - Instrumentation for the gameplay hot paths
+ *
+ * In game:      stat Atlas
+ * In Insights:  -trace=default,Atlas on the command line, or Atlas.Trace On at runtime
+ *
+ * Cycle stats only exist in builds with stats. The CPU scopes are on the Atlas trace channel,
+ * which is off until switched on, so they cost a branch per scope otherwise and still work in
+ * Test builds. Counters go to both: the stat group, and the counters channel for Insights.
+ * Each scope also adds its game thread time to a running total, read with GetScopeSeconds.
+ */
+DECLARE_STATS_GROUP(TEXT("Atlas"), STATGROUP_Atlas, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Action Manager TickActions"), STAT_AtlasTickActions, STATGROUP_Atlas, ATLAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Attack Notify Tick"), STAT_AtlasAttackNotifyTick, STATGROUP_Atlas, ATLAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Focus Mode ScanForTargets"), STAT_AtlasFocusScan, STATGROUP_Atlas, ATLAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hazard Tick"), STAT_AtlasHazardTick, STATGROUP_Atlas, ATLAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Integrity Visualizer Tick"), STAT_AtlasIntegrityVisualizerTick, STATGROUP_Atlas, ATLAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Run Manager LoadRoom"), STAT_AtlasLoadRoom, STATGROUP_Atlas, ATLAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gravity Field Tick"), STAT_AtlasGravityField, STATGROUP_Atlas, ATLAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Decision Scheduler"), STAT_AtlasAIDecisions, STATGROUP_Atlas, ATLAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Pool Acquire/Release"), STAT_AtlasEnemyPool, STATGROUP_Atlas, ATLAS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Bars Tick"), STAT_AtlasEnemyBars, STATGROUP_Atlas, ATLAS_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Hazards"), STAT_AtlasActiveHazards, STATGROUP_Atlas, ATLAS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Poison DOTs Ticked"), STAT_AtlasPoisonDOTs, STATGROUP_Atlas, ATLAS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Attack Sweeps"), STAT_AtlasAttackSweeps, STATGROUP_Atlas, ATLAS_API);
+
+UE_TRACE_CHANNEL_EXTERN(AtlasChannel, ATLAS_API);
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(AtlasActiveHazards);
+TRACE_DECLARE_INT_COUNTER_EXTERN(AtlasPoisonDOTs);
+TRACE_DECLARE_INT_COUNTER_EXTERN(AtlasAttackSweeps);
+
+/**
+ * Cycle stat STAT_Atlas<Scope>, Atlas channel CPU scope and AtlasStats scope time for the rest of
+ * the enclosing block, for example ATLAS_SCOPE_CYCLE_COUNTER(HazardTick, "Atlas.Hazard.Tick")
+ */
+#define ATLAS_SCOPE_CYCLE_COUNTER(Scope, ScopeName) \
+    SCOPE_CYCLE_COUNTER(STAT_Atlas##Scope); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(ScopeName, AtlasChannel); \
+    const AtlasStats::FScopeTimer PREPROCESSOR_JOIN(AtlasScopeTimer, __LINE__)(AtlasStats::EScope::Scope)
+
+namespace AtlasStats
+{
+    /** One per cycle stat, timed in every build so reports like the stress scenario's work without stats */
+    enum class EScope : uint8
+    {
+        TickActions,
+        AttackNotifyTick,
+        FocusScan,
+        HazardTick,
+        IntegrityVisualizerTick,
+        LoadRoom,
+        GravityField,
+        AIDecisions,
+        EnemyPool,
+        EnemyBars,
+        Num
+    };
+
+    /** Display name, the same as the cycle stat's */
+    ATLAS_API const TCHAR* GetScopeName(EScope Scope);
+
+    /** Seconds spent in the scope on the game thread since startup. Callers diff two reads */
+    ATLAS_API double GetScopeSeconds(EScope Scope);
+
+    ATLAS_API void AddScopeCycles(EScope Scope, uint64 Cycles);
+
+    /** Adds the time until it goes out of scope. Only the game thread is counted */
+    class FScopeTimer
+    {
+    public:
+        explicit FScopeTimer(EScope InScope)
+            : Scope(InScope)
+            , StartCycles(FPlatformTime::Cycles64())
+        {
+        }
+
+        ~FScopeTimer()
+        {
+            AddScopeCycles(Scope, FPlatformTime::Cycles64() - StartCycles);
+        }
+
+    private:
+        EScope Scope;
+        uint64 StartCycles;
+    };
+
+    /** A hazard started or stopped applying its effect */
+    ATLAS_API void AddActiveHazards(int32 Delta);
+
+    /** Poison DOTs that dealt damage this tick. Per frame, the trace counter restarts like the stat */
+    ATLAS_API void CountPoisonDOTs(int32 Num);
+
+    /** One attack hitbox sweep, per frame as above */
+    ATLAS_API void CountAttackSweep();
+
+    /** Switch the Atlas trace channel, false if the trace system does not know it */
+    ATLAS_API bool SetTraceChannelEnabled(bool bEnabled);
+    ATLAS_API bool IsTraceChannelEnabled();
+}
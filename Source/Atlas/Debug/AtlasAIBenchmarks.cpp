@@ -0,0 +1,618 @@
+#include "AtlasConsoleCommands.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "EngineUtils.h"
+#include "GameplayTagContainer.h"
+#include "Atlas/Characters/GameCharacterBase.h"
+#include "Atlas/Characters/EnemyCharacter.h"
+#include "Atlas/Components/AIDifficultyComponent.h"
+#include "Atlas/Components/PlayerModelComponent.h"
+#include "Atlas/Components/RoomPerceptionComponent.h"
+#include "Atlas/Components/RunManagerComponent.h"
+#include "Atlas/Data/RoomDataAsset.h"
+#include "Atlas/AI/AIDecisionSubsystem.h"
+#include "Atlas/AI/EnemyAIController.h"
+#include "Atlas/AI/EnemyPoolSubsystem.h"
+#include "Atlas/Rooms/RoomBase.h"
+#include "Atlas/Rooms/EncounterDirector.h"
+#include "Perception/AIPerceptionComponent.h"
+#include "Perception/AIPerceptionSystem.h"
+#include "Perception/AISenseConfig_Sight.h"
+#include "Perception/AISense_Sight.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Enum.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Float.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Name.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
+
+void FAtlasConsoleCommands::RegisterAIBenchmarks()
+{
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.AIDecisions"),
+        TEXT("Benchmark enemy thinking, every controller every frame vs the time-sliced decision scheduler. Usage: Atlas.Bench.AIDecisions (Controllers=100) (Frames=600)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchAIDecisions),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.PlayerModel"),
+        TEXT("Replay a seeded player action trace through the legacy and current player model and time both. Usage: Atlas.Bench.PlayerModel (Actions=20000) (EnemiesPerRoom=10)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchPlayerModel),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.Perception"),
+        TEXT("Benchmark enemy sight in one room, per-controller sight sense vs the room perception hub. Usage: Atlas.Bench.Perception (Enemies=60) (Updates=100)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchPerception),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.EncounterDirector"),
+        TEXT("Simulate seeded runs headless through the encounter director and print difficulty curve statistics. Usage: Atlas.Bench.EncounterDirector (Runs=1000) (Seed=1)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchEncounterDirector),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.EnemyPool"),
+        TEXT("Compare fresh enemy spawns against pooled acquires, then check a reused enemy matches a fresh one. Usage: Atlas.Bench.EnemyPool (Spawns=20)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchEnemyPool),
+        ECVF_Cheat
+    );
+}
+
+void FAtlasConsoleCommands::BenchAIDecisions(const TArray<FString>& Args)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull);
+    UAIDecisionSubsystem* Decisions = UAIDecisionSubsystem::Get(World);
+    if (!World || !Decisions) return;
+    
+    const int32 NumControllers = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+    const int32 NumFrames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 600;
+    const float FrameTime = 1.0f / 60.0f;
+    
+    // Transient blackboard with the keys the enemy controller writes
+    UBlackboardData* BlackboardAsset = NewObject<UBlackboardData>(GetTransientPackage());
+    auto AddKey = [BlackboardAsset](const TCHAR* Name, UBlackboardKeyType* KeyType)
+    {
+        FBlackboardEntry Entry;
+        Entry.EntryName = FName(Name);
+        Entry.KeyType = KeyType;
+        BlackboardAsset->Keys.Add(Entry);
+    };
+    AddKey(TEXT("TargetActor"), NewObject<UBlackboardKeyType_Object>(BlackboardAsset));
+    AddKey(TEXT("SelfActor"), NewObject<UBlackboardKeyType_Object>(BlackboardAsset));
+    AddKey(TEXT("LastKnownLocation"), NewObject<UBlackboardKeyType_Vector>(BlackboardAsset));
+    AddKey(TEXT("IsInCombat"), NewObject<UBlackboardKeyType_Bool>(BlackboardAsset));
+    AddKey(TEXT("CanUseSoulAttack"), NewObject<UBlackboardKeyType_Bool>(BlackboardAsset));
+    AddKey(TEXT("DistanceToTarget"), NewObject<UBlackboardKeyType_Float>(BlackboardAsset));
+    AddKey(TEXT("AttackRange"), NewObject<UBlackboardKeyType_Float>(BlackboardAsset));
+    AddKey(TEXT("DefendRange"), NewObject<UBlackboardKeyType_Float>(BlackboardAsset));
+    AddKey(TEXT("CatchSpecialRange"), NewObject<UBlackboardKeyType_Float>(BlackboardAsset));
+    AddKey(TEXT("CombatActionTag"), NewObject<UBlackboardKeyType_Name>(BlackboardAsset));
+    UBlackboardKeyType_Enum* ActionKeyType = NewObject<UBlackboardKeyType_Enum>(BlackboardAsset);
+    ActionKeyType->EnumType = StaticEnum<EAICombatAction>();
+    AddKey(TEXT("CombatAction"), ActionKeyType);
+    
+    // Enemies in a ring around the player so distances vary
+    AGameCharacterBase* Player = GetPlayerCharacter();
+    const FVector Origin = Player ? Player->GetActorLocation() : FVector::ZeroVector;
+    
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    
+    TArray<AEnemyCharacter*> Enemies;
+    TArray<AEnemyAIController*> Controllers;
+    for (int32 i = 0; i < NumControllers; ++i)
+    {
+        const float Angle = (2.0f * PI * i) / NumControllers;
+        const float Distance = 150.0f + (i % 10) * 150.0f;
+        const FVector Location = Origin + FVector(FMath::Cos(Angle) * Distance, FMath::Sin(Angle) * Distance, 0.0f);
+        
+        AEnemyCharacter* Enemy = World->SpawnActor<AEnemyCharacter>(AEnemyCharacter::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+        if (!Enemy) continue;
+        
+        if (!Enemy->GetController())
+        {
+            Enemy->SpawnDefaultController();
+        }
+        
+        AEnemyAIController* Controller = Cast<AEnemyAIController>(Enemy->GetController());
+        UBlackboardComponent* BlackboardComp = nullptr;
+        if (!Controller || !Controller->UseBlackboard(BlackboardAsset, BlackboardComp))
+        {
+            Enemy->Destroy();
+            continue;
+        }
+        
+        Controller->CacheBlackboardKeys();
+        BlackboardComp->SetValueAsObject(FName("TargetActor"), Player);
+        
+        Enemies.Add(Enemy);
+        Controllers.Add(Controller);
+    }
+    
+    if (Controllers.Num() == 0) return;
+    
+    // Legacy path: every controller every frame, weighted rolls, name keyed writes and tag lookups by string
+    TArray<float> LegacyFrameMs;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        const double FrameStart = FPlatformTime::Seconds();
+        for (AEnemyAIController* Controller : Controllers)
+        {
+            UBlackboardComponent* BlackboardComp = Controller->GetBlackboardComponent();
+            AActor* Target = Cast<AActor>(BlackboardComp->GetValueAsObject(FName("TargetActor")));
+            if (Target)
+            {
+                BlackboardComp->SetValueAsFloat(FName("DistanceToTarget"), FVector::Dist(Controller->GetPawn()->GetActorLocation(), Target->GetActorLocation()));
+            }
+            
+            const float Roll = FMath::FRand();
+            const TCHAR* TagName = Roll < 0.5f ? (FMath::FRand() < 0.3f ? TEXT("Action.Combat.HeavyAttack") : TEXT("Action.Combat.BasicAttack"))
+                : Roll < 0.8f ? (FMath::FRand() < 0.5f ? TEXT("Action.Combat.Block") : TEXT("Action.Combat.Dash"))
+                : TEXT("Action.Combat.SoulAttack");
+            BlackboardComp->SetValueAsName(FName("CombatActionTag"), FGameplayTag::RequestGameplayTag(TagName).GetTagName());
+            BlackboardComp->SetValueAsBool(FName("CanUseSoulAttack"), Controller->CanUseSoulAttack());
+        }
+        LegacyFrameMs.Add(static_cast<float>((FPlatformTime::Seconds() - FrameStart) * 1000.0));
+    }
+    
+    // Scheduler path
+    Decisions->ResetStats();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Decisions->Tick(FrameTime);
+    }
+    const FAIDecisionStats& Stats = Decisions->GetStats();
+    const float SimulatedSeconds = NumFrames * FrameTime;
+    
+    for (AEnemyCharacter* Enemy : Enemies)
+    {
+        if (AController* Controller = Enemy->GetController())
+        {
+            Controller->UnPossess();
+            Controller->Destroy();
+        }
+        Enemy->Destroy();
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== AI DECISION BENCHMARK (%d controllers, %d frames) ==="), Controllers.Num(), NumFrames);
+    UE_LOG(LogTemp, Warning, TEXT("  Every frame:  avg %.4f ms/frame, p95 %.4f ms, max %.4f ms"),
+        Average(LegacyFrameMs), Percentile(LegacyFrameMs, 0.95f), Percentile(LegacyFrameMs, 1.0f));
+    UE_LOG(LogTemp, Warning, TEXT("  Scheduler:    avg %.4f ms/frame, p95 %.4f ms, max %.4f ms, %d frames hit the budget"),
+        Average(Stats.FrameTimesMs), Percentile(Stats.FrameTimesMs, 0.95f), Percentile(Stats.FrameTimesMs, 1.0f), Stats.FramesOverBudget);
+    UE_LOG(LogTemp, Warning, TEXT("  Think time:   p50 %.2f us, p95 %.2f us, p99 %.2f us, max %.2f us (%.1f thinks/controller/s)"),
+        Percentile(Stats.ThinkTimesUs, 0.5f), Percentile(Stats.ThinkTimesUs, 0.95f), Percentile(Stats.ThinkTimesUs, 0.99f),
+        Percentile(Stats.ThinkTimesUs, 1.0f), Stats.TotalThinks / (Controllers.Num() * SimulatedSeconds));
+    UE_LOG(LogTemp, Warning, TEXT("  Decision latency past due: avg %.2f ms, p95 %.2f ms, max %.2f ms"),
+        Average(Stats.DecisionLatenciesMs), Percentile(Stats.DecisionLatenciesMs, 0.95f), Percentile(Stats.DecisionLatenciesMs, 1.0f));
+}
+
+void FAtlasConsoleCommands::BenchPlayerModel(const TArray<FString>& Args)
+{
+    const int32 NumActions = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 20000;
+    const int32 EnemiesPerRoom = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 10;
+    const int32 WindowSize = 20;
+    
+    struct FTraceEntry
+    {
+        FGameplayTag Tag;
+        EPlayerActionCategory Expected;
+    };
+    
+    const FTraceEntry Vocabulary[] = {
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.BasicAttack")), EPlayerActionCategory::Attack },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.HeavyAttack")), EPlayerActionCategory::HeavyAttack },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Block")), EPlayerActionCategory::Block },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Parry")), EPlayerActionCategory::Parry },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Dash")), EPlayerActionCategory::Dash },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.SoulAttack")), EPlayerActionCategory::Other },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.FocusMode")), EPlayerActionCategory::Other },
+    };
+    const int32 VocabularySize = UE_ARRAY_COUNT(Vocabulary);
+    
+    // Seeded trace of actions with uneven gaps
+    FRandomStream Stream(31);
+    TArray<int32> Trace;
+    TArray<double> Times;
+    double Time = 0.0;
+    for (int32 i = 0; i < NumActions; ++i)
+    {
+        Trace.Add(Stream.RandRange(0, VocabularySize - 1));
+        Time += Stream.FRandRange(0.1f, 1.5f);
+        Times.Add(Time);
+    }
+    
+    // Legacy path: substring classification, shifting window, full re-sum per action
+    int32 LegacyCounts[static_cast<int32>(EPlayerActionCategory::Count)] = {};
+    TArray<float> LegacyReactionTimes;
+    float LegacyAverage = 0.0f;
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumActions; ++i)
+    {
+        const FString ActionString = Vocabulary[Trace[i]].Tag.ToString();
+        if (ActionString.Contains(TEXT("Block"))) LegacyCounts[static_cast<int32>(EPlayerActionCategory::Block)]++;
+        else if (ActionString.Contains(TEXT("Parry"))) LegacyCounts[static_cast<int32>(EPlayerActionCategory::Parry)]++;
+        else if (ActionString.Contains(TEXT("Dash"))) LegacyCounts[static_cast<int32>(EPlayerActionCategory::Dash)]++;
+        else if (ActionString.Contains(TEXT("Attack.Heavy"))) LegacyCounts[static_cast<int32>(EPlayerActionCategory::HeavyAttack)]++;
+        else if (ActionString.Contains(TEXT("Attack"))) LegacyCounts[static_cast<int32>(EPlayerActionCategory::Attack)]++;
+        
+        if (i > 0)
+        {
+            LegacyReactionTimes.Add(static_cast<float>(Times[i] - Times[i - 1]));
+            if (LegacyReactionTimes.Num() > WindowSize)
+            {
+                LegacyReactionTimes.RemoveAt(0);
+            }
+            
+            float TotalTime = 0.0f;
+            for (float Sample : LegacyReactionTimes)
+            {
+                TotalTime += Sample;
+            }
+            LegacyAverage = TotalTime / LegacyReactionTimes.Num();
+        }
+    }
+    const double LegacyMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    // Model path
+    FPlayerActionModel Model(WindowSize);
+    StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < NumActions; ++i)
+    {
+        Model.RecordAction(Vocabulary[Trace[i]].Tag, Times[i]);
+    }
+    const double ModelMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    int32 ExpectedHeavyAttacks = 0;
+    for (int32 Entry : Trace)
+    {
+        ExpectedHeavyAttacks += Vocabulary[Entry].Expected == EPlayerActionCategory::HeavyAttack ? 1 : 0;
+    }
+    
+    const int32 LegacyHeavyMisclassified = ExpectedHeavyAttacks - LegacyCounts[static_cast<int32>(EPlayerActionCategory::HeavyAttack)];
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== PLAYER MODEL BENCHMARK (%d actions, window %d) ==="), NumActions, WindowSize);
+    UE_LOG(LogTemp, Warning, TEXT("  Legacy substring + re-sum: %.1f ns/action, %.3f ms per room with %d enemies (avg %.3f s, %d heavy attacks counted as basic)"),
+        LegacyMs * 1000000.0 / NumActions, LegacyMs * EnemiesPerRoom, EnemiesPerRoom, LegacyAverage, LegacyHeavyMisclassified);
+    UE_LOG(LogTemp, Warning, TEXT("  Tag table + ring windows: %.1f ns/action, %.3f ms per room (shared, avg %.3f s, stddev %.3f s, style %s)"),
+        ModelMs * 1000000.0 / NumActions, ModelMs, Model.GetReactionTimes().GetMean(), Model.GetReactionTimes().GetStdDev(),
+        *UEnum::GetValueAsString(Model.GetStyle()));
+}
+
+void FAtlasConsoleCommands::BenchPerception(const TArray<FString>& Args)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull);
+    AGameCharacterBase* Player = GetPlayerCharacter();
+    UAIPerceptionSystem* PerceptionSystem = UAIPerceptionSystem::GetCurrent(World);
+    if (!World || !Player || !PerceptionSystem)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Atlas.Bench.Perception needs a running game world with a player"));
+        return;
+    }
+    
+    const FVector Origin = Player->GetActorLocation();
+    ARoomBase* Room = ARoomBase::FindRoomContaining(World, Origin);
+    if (!Room)
+    {
+        TActorIterator<ARoomBase> It(World);
+        Room = It ? *It : nullptr;
+    }
+    URoomPerceptionComponent* Hub = Room ? Room->GetPerceptionHub() : nullptr;
+    if (!Hub)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Atlas.Bench.Perception needs an ARoomBase in the level"));
+        return;
+    }
+    
+    const int32 NumEnemies = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 60;
+    const int32 NumUpdates = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 100;
+    const float UpdateTime = 0.1f;
+    
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    
+    // Squads of three around the player, all facing it, so several enemies share eye cells
+    TArray<AEnemyCharacter*> Enemies;
+    TArray<AEnemyAIController*> Controllers;
+    for (int32 i = 0; i < NumEnemies; ++i)
+    {
+        const int32 Squad = i / 3;
+        const float Angle = Squad * 2.39996f;
+        const float Distance = 400.0f + (Squad % 7) * 200.0f;
+        const FVector SquadCenter = Origin + FVector(FMath::Cos(Angle) * Distance, FMath::Sin(Angle) * Distance, 0.0f);
+        const FVector Location = SquadCenter + FVector(((i % 3) - 1) * 45.0f, 0.0f, 0.0f);
+        
+        AEnemyCharacter* Enemy = World->SpawnActor<AEnemyCharacter>(AEnemyCharacter::StaticClass(), Location, (Origin - Location).Rotation(), SpawnParams);
+        if (!Enemy) continue;
+        
+        if (!Enemy->GetController())
+        {
+            Enemy->SpawnDefaultController();
+        }
+        
+        AEnemyAIController* Controller = Cast<AEnemyAIController>(Enemy->GetController());
+        if (!Controller)
+        {
+            Enemy->Destroy();
+            continue;
+        }
+        
+        Enemies.Add(Enemy);
+        Controllers.Add(Controller);
+    }
+    
+    if (Controllers.Num() == 0) return;
+    
+    // Stock path: every controller's own sight sense, driven by the perception system
+    for (AEnemyAIController* Controller : Controllers)
+    {
+        Controller->SetPerceptionHub(nullptr);
+    }
+    
+    TArray<float> StockUpdateMs;
+    for (int32 Update = 0; Update < NumUpdates; ++Update)
+    {
+        const double UpdateStart = FPlatformTime::Seconds();
+        PerceptionSystem->Tick(UpdateTime);
+        StockUpdateMs.Add(static_cast<float>((FPlatformTime::Seconds() - UpdateStart) * 1000.0));
+    }
+    
+    int32 StockSeeing = 0;
+    for (AEnemyAIController* Controller : Controllers)
+    {
+        TArray<AActor*> Perceived;
+        Controller->GetPerceptionComponent()->GetCurrentlyPerceivedActors(UAISense_Sight::StaticClass(), Perceived);
+        StockSeeing += Perceived.Contains(Player) ? 1 : 0;
+    }
+    
+    // Hub path
+    for (AEnemyAIController* Controller : Controllers)
+    {
+        Controller->SetPerceptionHub(Hub);
+    }
+    Hub->ResetStats();
+    
+    TArray<float> HubUpdateMs;
+    for (int32 Update = 0; Update < NumUpdates; ++Update)
+    {
+        Hub->UpdateVisibility();
+        HubUpdateMs.Add(Hub->GetStats().LastUpdateUs / 1000.0f);
+    }
+    const FRoomPerceptionStats HubStats = Hub->GetStats();
+    
+    // Check the shared results against one unshared trace per enemy
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BenchPerception), true);
+    QueryParams.AddIgnoredActor(Player);
+    for (AEnemyCharacter* Enemy : Enemies)
+    {
+        QueryParams.AddIgnoredActor(Enemy);
+    }
+    
+    int32 HubSeeing = 0;
+    int32 Mismatches = 0;
+    for (AEnemyAIController* Controller : Controllers)
+    {
+        const UAISenseConfig_Sight* Sight = Controller->GetSightConfig();
+        FVector EyeLocation;
+        FRotator EyeRotation;
+        Controller->GetPawn()->GetActorEyesViewPoint(EyeLocation, EyeRotation);
+        
+        const FVector ToPlayer = Origin - EyeLocation;
+        const bool bExpected = Sight &&
+            ToPlayer.SizeSquared() <= FMath::Square(Sight->SightRadius) &&
+            FVector::DotProduct(EyeRotation.Vector(), ToPlayer.GetSafeNormal()) >= FMath::Cos(FMath::DegreesToRadians(Sight->PeripheralVisionAngleDegrees)) &&
+            !World->LineTraceTestByChannel(EyeLocation, Origin, ECC_Visibility, QueryParams);
+        
+        const bool bShared = Hub->DoesControllerSeePlayer(Controller);
+        HubSeeing += bShared ? 1 : 0;
+        Mismatches += bShared != bExpected ? 1 : 0;
+    }
+    
+    for (AEnemyCharacter* Enemy : Enemies)
+    {
+        if (AController* Controller = Enemy->GetController())
+        {
+            Controller->UnPossess();
+            Controller->Destroy();
+        }
+        Enemy->Destroy();
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== PERCEPTION BENCHMARK (%d enemies in %s, %d updates) ==="), Controllers.Num(), *Room->GetName(), NumUpdates);
+    UE_LOG(LogTemp, Warning, TEXT("  Per-controller sight: avg %.4f ms/update, p95 %.4f ms, max %.4f ms, %d see the player"),
+        Average(StockUpdateMs), Percentile(StockUpdateMs, 0.95f), Percentile(StockUpdateMs, 1.0f), StockSeeing);
+    UE_LOG(LogTemp, Warning, TEXT("  Room hub:             avg %.4f ms/update, p95 %.4f ms, max %.4f ms, %d see the player"),
+        Average(HubUpdateMs), Percentile(HubUpdateMs, 0.95f), Percentile(HubUpdateMs, 1.0f), HubSeeing);
+    UE_LOG(LogTemp, Warning, TEXT("  Hub traces: %.1f per update for %d enemies (%d sight queries total)"),
+        static_cast<float>(HubStats.Traces) / FMath::Max(HubStats.Updates, 1), Controllers.Num(), HubStats.SightQueries);
+    UE_LOG(LogTemp, Warning, TEXT("  %d enemies differ from an unshared trace (eye cell sharing)"), Mismatches);
+}
+
+// Statistics only, the same seeded sweep is checked against the plan invariants by Atlas.Rooms.EncounterDirector
+void FAtlasConsoleCommands::BenchEncounterDirector(const TArray<FString>& Args)
+{
+    const int32 NumRuns = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+    const int32 Seed = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1;
+    const int32 NumLevels = FEncounterDirector::MaxLevel;
+    
+    FEncounterDirector Director;
+    const URoomDataAsset* RoomDefaults = GetDefault<URoomDataAsset>();
+    
+    struct FLevelSamples
+    {
+        TArray<float> Budget;
+        TArray<float> EnemyPower;
+        TArray<float> HazardIntensity;
+        TArray<float> SpawnDelay;
+        TArray<float> HealthOnEntry;
+        int32 Cleared = 0;
+    };
+    TArray<FLevelSamples> Levels;
+    Levels.SetNum(NumLevels + 1);
+    
+    int32 CompletedRuns = 0;
+    int32 Plans = 0;
+    double PlanSeconds = 0.0;
+    
+    for (int32 Run = 0; Run < NumRuns; ++Run)
+    {
+        FRandomStream Stream(Seed + Run);
+        
+        FRunProgressData Progress;
+        int32 EquippedSlots = 0;
+        const float Skill = Stream.FRandRange(0.3f, 1.0f);
+        
+        for (int32 Level = 1; Level <= NumLevels; ++Level)
+        {
+            Progress.CurrentLevel = Level;
+            const ERoomDifficulty Difficulty = Level == NumLevels ? ERoomDifficulty::Boss : static_cast<ERoomDifficulty>(Stream.RandRange(0, 2));
+            const bool bHasHazard = Stream.FRand() < 0.7f;
+            const int32 BasePower = RoomDefaults->GetScaledEnemyPower(Level, EquippedSlots);
+            
+            const double PlanStart = FPlatformTime::Seconds();
+            const FEncounterPlan Plan = Director.PlanEncounter(Progress, BasePower, Difficulty, bHasHazard, 100.0f, 100.0f);
+            PlanSeconds += FPlatformTime::Seconds() - PlanStart;
+            ++Plans;
+            
+            FLevelSamples& Samples = Levels[Level];
+            Samples.Budget.Add(Plan.Budget);
+            Samples.EnemyPower.Add(static_cast<float>(Plan.EnemyPower));
+            Samples.SpawnDelay.Add(Plan.EnemySpawnDelay);
+            Samples.HealthOnEntry.Add(Progress.PlayerHealth);
+            if (bHasHazard)
+            {
+                Samples.HazardIntensity.Add(Plan.HazardIntensity);
+            }
+            
+            // Toy combat outcome: threat against what the player has built up, skewed by skill
+            const float Threat = Plan.EnemyPower * (bHasHazard ? 1.0f + 0.2f * Plan.HazardIntensity : 1.0f);
+            const float Strength = (EquippedSlots + 1) * (0.5f + Skill);
+            Progress.PlayerHealth -= 25.0f * Threat / Strength * Stream.FRandRange(0.6f, 1.4f);
+            if (bHasHazard)
+            {
+                Progress.StationIntegrity -= 10.0f * Plan.HazardIntensity * Stream.FRandRange(0.5f, 1.5f);
+            }
+            Progress.PerfectParries += Stream.RandRange(0, FMath::FloorToInt(Skill * 4.0f));
+            
+            if (Progress.PlayerHealth <= 0.0f || Progress.StationIntegrity <= 0.0f)
+            {
+                break;
+            }
+            
+            ++Samples.Cleared;
+            if (Level == NumLevels)
+            {
+                ++CompletedRuns;
+            }
+            
+            // Reward between rooms
+            EquippedSlots = FMath::Min(EquippedSlots + 1, 6);
+            Progress.PlayerHealth = FMath::Min(Progress.PlayerHealth + 20.0f, 100.0f);
+        }
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== ENCOUNTER DIRECTOR SIMULATION (%d runs, seed %d) ==="), NumRuns, Seed);
+    for (int32 Level = 1; Level <= NumLevels; ++Level)
+    {
+        const FLevelSamples& Samples = Levels[Level];
+        const int32 Reached = Samples.Budget.Num();
+        if (Reached == 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("  Level %d: never reached"), Level);
+            continue;
+        }
+        
+        UE_LOG(LogTemp, Warning, TEXT("  Level %d: reached %d, cleared %.1f%%, entry health avg %.1f"),
+            Level, Reached, 100.0f * Samples.Cleared / Reached, Average(Samples.HealthOnEntry));
+        UE_LOG(LogTemp, Warning, TEXT("    Budget     avg %.2f  p5 %.2f  p50 %.2f  p95 %.2f"),
+            Average(Samples.Budget), Percentile(Samples.Budget, 0.05f), Percentile(Samples.Budget, 0.5f), Percentile(Samples.Budget, 0.95f));
+        UE_LOG(LogTemp, Warning, TEXT("    Power      avg %.2f  p5 %.0f  p50 %.0f  p95 %.0f"),
+            Average(Samples.EnemyPower), Percentile(Samples.EnemyPower, 0.05f), Percentile(Samples.EnemyPower, 0.5f), Percentile(Samples.EnemyPower, 0.95f));
+        UE_LOG(LogTemp, Warning, TEXT("    Hazard     avg %.2f  p95 %.2f (%d rooms)    Spawn delay avg %.2f s  p5 %.2f s"),
+            Average(Samples.HazardIntensity), Percentile(Samples.HazardIntensity, 0.95f), Samples.HazardIntensity.Num(),
+            Average(Samples.SpawnDelay), Percentile(Samples.SpawnDelay, 0.05f));
+    }
+    UE_LOG(LogTemp, Warning, TEXT("  Runs completed: %.1f%%, %.1f ns per room plan"),
+        100.0f * CompletedRuns / NumRuns, PlanSeconds * 1000000000.0 / FMath::Max(Plans, 1));
+}
+
+void FAtlasConsoleCommands::BenchEnemyPool(const TArray<FString>& Args)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull);
+    AGameCharacterBase* Player = GetPlayerCharacter();
+    UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(World);
+    if (!World || !Player || !Pool)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Atlas.Bench.EnemyPool needs a running game world with a player"));
+        return;
+    }
+    
+    const int32 NumSpawns = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 20;
+    const TSubclassOf<AGameCharacterBase> EnemyClass = AEnemyCharacter::StaticClass();
+    const FTransform SpawnTransform(Player->GetActorRotation() + FRotator(0.0f, 180.0f, 0.0f),
+        Player->GetActorLocation() + Player->GetActorForwardVector() * 600.0f);
+    
+    // Same spawn the rooms did before the pool
+    auto SpawnFresh = [World, EnemyClass, &SpawnTransform]() -> AGameCharacterBase*
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+        AGameCharacterBase* Enemy = World->SpawnActor<AGameCharacterBase>(EnemyClass, SpawnTransform, SpawnParams);
+        if (Enemy && !Enemy->GetController())
+        {
+            Enemy->SpawnDefaultController();
+        }
+        return Enemy;
+    };
+    
+    auto DestroyFresh = [](AGameCharacterBase* Enemy)
+    {
+        if (!Enemy) return;
+        if (AController* Controller = Enemy->GetController())
+        {
+            Controller->UnPossess();
+            Controller->Destroy();
+        }
+        Enemy->Destroy();
+    };
+    
+    TArray<float> FreshMs;
+    for (int32 i = 0; i < NumSpawns; ++i)
+    {
+        const double SpawnStart = FPlatformTime::Seconds();
+        AGameCharacterBase* Enemy = SpawnFresh();
+        FreshMs.Add(static_cast<float>((FPlatformTime::Seconds() - SpawnStart) * 1000.0));
+        DestroyFresh(Enemy);
+    }
+    
+    // Pre-warm outside the timed region, the way a room transition does
+    Pool->ResetStats();
+    TArray<float> PooledMs;
+    for (int32 i = 0; i < NumSpawns; ++i)
+    {
+        Pool->Prewarm(EnemyClass);
+        
+        const double AcquireStart = FPlatformTime::Seconds();
+        AGameCharacterBase* Enemy = Pool->Acquire(EnemyClass, SpawnTransform);
+        PooledMs.Add(static_cast<float>((FPlatformTime::Seconds() - AcquireStart) * 1000.0));
+        Pool->Release(Enemy);
+    }
+    const FEnemyPoolStats PoolStats = Pool->GetStats();
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== ENEMY POOL BENCHMARK (%d spawns of %s) ==="), NumSpawns, *EnemyClass->GetName());
+    UE_LOG(LogTemp, Warning, TEXT("  SpawnActor:   avg %.3f ms, p95 %.3f ms, max %.3f ms"),
+        Average(FreshMs), Percentile(FreshMs, 0.95f), Percentile(FreshMs, 1.0f));
+    UE_LOG(LogTemp, Warning, TEXT("  Pool acquire: avg %.3f ms, p95 %.3f ms, max %.3f ms (%d reused, %d spawned, %d pre-warmed)"),
+        Average(PooledMs), Percentile(PooledMs, 0.95f), Percentile(PooledMs, 1.0f), PoolStats.Reused, PoolStats.Spawned, PoolStats.Prewarmed);
+    UE_LOG(LogTemp, Warning, TEXT("  Worst-case hitch reduction: %.3f ms"), Percentile(FreshMs, 1.0f) - Percentile(PooledMs, 1.0f));
+}
@@ -12,11 +12,14 @@
 #include "Atlas/Data/ActionDataAsset.h"
 #include "Atlas/Data/RoomDataAsset.h"
 #include "Atlas/AtlasGameMode.h"
+#include "Atlas/Debug/StressScenarioSubsystem.h"
+#include "Atlas/Core/AtlasStats.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameplayTagContainer.h"
 
 bool FAtlasConsoleCommands::bGodModeEnabled = false;
 
+
 void FAtlasConsoleCommands::RegisterCommands()
 {
     // Core Run Commands
@@ -114,6 +117,42 @@ void FAtlasConsoleCommands::RegisterCommands()
         ECVF_Cheat
     );
     
+    // Benchmark Commands
+    RegisterHazardBenchmarks();
+    RegisterAIBenchmarks();
+    RegisterUIBenchmarks();
+    RegisterCombatBenchmarks();
+    
+    // Stress Scenario Commands
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Stress.Run"),
+        TEXT("Run a combat stress scenario from the scenario file and report its frame times. Usage: Atlas.Stress.Run <Scenario> (File)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::StressRun),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Stress.List"),
+        TEXT("List the combat stress scenarios in the scenario file. Usage: Atlas.Stress.List (File)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::StressList),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Stress.Stop"),
+        TEXT("End the running stress scenario, reporting the frames captured so far"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::StressStop),
+        ECVF_Cheat
+    );
+    
+    // Trace Commands
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Trace"),
+        TEXT("Switch the Atlas trace channel for Insights, toggling it without an argument. Usage: Atlas.Trace (On|Off)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::TraceAtlas),
+        ECVF_Cheat
+    );
+    
     UE_LOG(LogTemp, Log, TEXT("Atlas Console Commands Registered"));
 }
 
@@ -477,6 +516,83 @@ void FAtlasConsoleCommands::CancelRewardSelection(const TArray<FString>& Args)
     }
 }
 
+void FAtlasConsoleCommands::StressRun(const TArray<FString>& Args)
+{
+    if (Args.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Usage: Atlas.Stress.Run <Scenario> (File)"));
+        return;
+    }
+    
+    UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull);
+    UStressScenarioSubsystem* Runner = UStressScenarioSubsystem::Get(World);
+    if (!Runner)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Atlas.Stress.Run needs a game world"));
+        return;
+    }
+    
+    const FString Path = Args.Num() > 1 ? Args[1] : FStressScenario::GetDefaultPath();
+    TArray<FStressScenario> Scenarios;
+    FString Error;
+    if (!FStressScenario::LoadFile(Path, Scenarios, Error))
+    {
+        UE_LOG(LogTemp, Error, TEXT("%s"), *Error);
+        return;
+    }
+    
+    const FStressScenario* Scenario = Scenarios.FindByPredicate([&Args](const FStressScenario& Candidate) { return Candidate.Name.Equals(Args[0], ESearchCase::IgnoreCase); });
+    if (!Scenario)
+    {
+        UE_LOG(LogTemp, Error, TEXT("No scenario named %s in %s, see Atlas.Stress.List"), *Args[0], *Path);
+        return;
+    }
+    Runner->Start(*Scenario);
+}
+
+void FAtlasConsoleCommands::StressList(const TArray<FString>& Args)
+{
+    const FString Path = Args.Num() > 0 ? Args[0] : FStressScenario::GetDefaultPath();
+    TArray<FStressScenario> Scenarios;
+    FString Error;
+    if (!FStressScenario::LoadFile(Path, Scenarios, Error))
+    {
+        UE_LOG(LogTemp, Error, TEXT("%s"), *Error);
+        return;
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== STRESS SCENARIOS (%s) ==="), *Path);
+    for (const FStressScenario& Scenario : Scenarios)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("  %s: %d enemies, %d hazards, %.0f s. %s"),
+            *Scenario.Name, Scenario.EnemyCount, Scenario.Hazards.Num(), Scenario.DurationSeconds, *Scenario.Description);
+    }
+}
+
+void FAtlasConsoleCommands::StressStop(const TArray<FString>& Args)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull);
+    UStressScenarioSubsystem* Runner = UStressScenarioSubsystem::Get(World);
+    if (!Runner || !Runner->IsRunning())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No stress scenario is running"));
+        return;
+    }
+    Runner->Stop();
+}
+
+void FAtlasConsoleCommands::TraceAtlas(const TArray<FString>& Args)
+{
+    const bool bEnable = Args.Num() > 0 ? Args[0] == TEXT("1") || Args[0].Equals(TEXT("On"), ESearchCase::IgnoreCase) : !AtlasStats::IsTraceChannelEnabled();
+    if (!AtlasStats::SetTraceChannelEnabled(bEnable))
+    {
+        UE_LOG(LogTemp, Error, TEXT("The Atlas trace channel is not available in this build"));
+        return;
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("Atlas trace channel %s"), bEnable ? TEXT("on") : TEXT("off"));
+}
+
 AGameCharacterBase* FAtlasConsoleCommands::GetPlayerCharacter()
 {
     if (UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull))
@@ -487,4 +603,25 @@ AGameCharacterBase* FAtlasConsoleCommands::GetPlayerCharacter()
         }
     }
     return nullptr;
-}
\ No newline at end of file
+}
+
+float FAtlasConsoleCommands::Percentile(TArray<float> Samples, float Fraction)
+{
+    if (Samples.Num() == 0) return 0.0f;
+    
+    Samples.Sort();
+    const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * Samples.Num()) - 1, 0, Samples.Num() - 1);
+    return Samples[Index];
+}
+
+float FAtlasConsoleCommands::Average(const TArray<float>& Samples)
+{
+    if (Samples.Num() == 0) return 0.0f;
+    
+    float Total = 0.0f;
+    for (float Sample : Samples)
+    {
+        Total += Sample;
+    }
+    return Total / Samples.Num();
+}
@@ -34,8 +34,47 @@ private:
     static void SelectReward(const TArray<FString>& Args);
     static void CancelRewardSelection(const TArray<FString>& Args);
     
+    // Hazard Benchmark Commands (AtlasHazardBenchmarks.cpp)
+    static void RegisterHazardBenchmarks();
+    static void BenchChainLightning(const TArray<FString>& Args);
+    static void BenchGravityField(const TArray<FString>& Args);
+    static void BenchToxicCloud(const TArray<FString>& Args);
+    static void BenchHullBreach(const TArray<FString>& Args);
+    
+    // AI Benchmark Commands (AtlasAIBenchmarks.cpp)
+    static void RegisterAIBenchmarks();
+    static void BenchAIDecisions(const TArray<FString>& Args);
+    static void BenchPlayerModel(const TArray<FString>& Args);
+    static void BenchPerception(const TArray<FString>& Args);
+    static void BenchEncounterDirector(const TArray<FString>& Args);
+    static void BenchEnemyPool(const TArray<FString>& Args);
+    
+    // UI Benchmark Commands (AtlasUIBenchmarks.cpp)
+    static void RegisterUIBenchmarks();
+    static void BenchHUD(const TArray<FString>& Args);
+    static void BenchEnemyBars(const TArray<FString>& Args);
+    static void BenchRewardOffer(const TArray<FString>& Args);
+    static void BenchSlotWidgets(const TArray<FString>& Args);
+    
+    // Combat Benchmark Commands (AtlasCombatBenchmarks.cpp)
+    static void RegisterCombatBenchmarks();
+    static void BenchDiagnostics(const TArray<FString>& Args);
+
+    // Stress Scenario Commands
+    static void StressRun(const TArray<FString>& Args);
+    static void StressList(const TArray<FString>& Args);
+    static void StressStop(const TArray<FString>& Args);
+
+    // Trace Commands
+    static void TraceAtlas(const TArray<FString>& Args);
+    
     // Helper functions
     static class AGameCharacterBase* GetPlayerCharacter();
+    static void SpawnBenchmarkProps(UWorld* World, const FVector& Origin, int32 Count, TArray<class AStaticMeshActor*>& OutProps);
+    
+    /** Nearest-rank percentile of an unsorted sample set */
+    static float Percentile(TArray<float> Samples, float Fraction);
+    static float Average(const TArray<float>& Samples);
     
     static bool bGodModeEnabled;
 };
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "AtlasDebugDraw.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+#if ATLAS_WITH_DEBUG_DRAW
+
+static TAutoConsoleVariable<bool> CVarAtlasDebugDraw(
+	TEXT("Atlas.Debug.Draw"),
+	false,
+	TEXT("Draw Atlas gameplay debug shapes and on-screen messages: hits, impacts, interactable areas and health changes. Not available in Test and Shipping builds."),
+	ECVF_Cheat
+);
+
+static TAutoConsoleVariable<int32> CVarAtlasDebugDrawMaxPerFrame(
+	TEXT("Atlas.Debug.DrawMaxPerFrame"),
+	512,
+	TEXT("Debug shapes and messages queued per world per frame before the rest are dropped."),
+	ECVF_Default
+);
+
+namespace
+{
+	void EnqueueFor(const UObject* WorldContext, UAtlasDebugDrawSubsystem::FQueuedShape&& Shape)
+	{
+		if (UAtlasDebugDrawSubsystem* Subsystem = UAtlasDebugDrawSubsystem::Get(WorldContext))
+		{
+			Subsystem->Enqueue(MoveTemp(Shape));
+		}
+	}
+}
+
+bool FAtlasDebugDraw::IsEnabled()
+{
+	return CVarAtlasDebugDraw.GetValueOnGameThread();
+}
+
+void FAtlasDebugDraw::SetEnabled(bool bEnabled)
+{
+	CVarAtlasDebugDraw->Set(bEnabled, ECVF_SetByCode);
+}
+
+void FAtlasDebugDraw::Sphere(const UObject* WorldContext, const FVector& Center, float Radius, const FColor& Color, float Duration, float Thickness)
+{
+	UAtlasDebugDrawSubsystem::FQueuedShape Shape;
+	Shape.Shape = UAtlasDebugDrawSubsystem::EShape::Sphere;
+	Shape.A = Center;
+	Shape.Size = Radius;
+	Shape.Color = Color;
+	Shape.Duration = Duration;
+	Shape.Thickness = Thickness;
+	EnqueueFor(WorldContext, MoveTemp(Shape));
+}
+
+void FAtlasDebugDraw::Line(const UObject* WorldContext, const FVector& Start, const FVector& End, const FColor& Color, float Duration, float Thickness)
+{
+	UAtlasDebugDrawSubsystem::FQueuedShape Shape;
+	Shape.Shape = UAtlasDebugDrawSubsystem::EShape::Line;
+	Shape.A = Start;
+	Shape.B = End;
+	Shape.Color = Color;
+	Shape.Duration = Duration;
+	Shape.Thickness = Thickness;
+	EnqueueFor(WorldContext, MoveTemp(Shape));
+}
+
+void FAtlasDebugDraw::Arrow(const UObject* WorldContext, const FVector& Start, const FVector& End, float HeadSize, const FColor& Color, float Duration, float Thickness)
+{
+	UAtlasDebugDrawSubsystem::FQueuedShape Shape;
+	Shape.Shape = UAtlasDebugDrawSubsystem::EShape::Arrow;
+	Shape.A = Start;
+	Shape.B = End;
+	Shape.Size = HeadSize;
+	Shape.Color = Color;
+	Shape.Duration = Duration;
+	Shape.Thickness = Thickness;
+	EnqueueFor(WorldContext, MoveTemp(Shape));
+}
+
+void FAtlasDebugDraw::Circle(const UObject* WorldContext, const FVector& Center, float Radius, const FVector& YAxis, const FVector& ZAxis, const FColor& Color, float Duration, float Thickness)
+{
+	UAtlasDebugDrawSubsystem::FQueuedShape Shape;
+	Shape.Shape = UAtlasDebugDrawSubsystem::EShape::Circle;
+	Shape.A = Center;
+	Shape.B = YAxis;
+	Shape.C = ZAxis;
+	Shape.Size = Radius;
+	Shape.Color = Color;
+	Shape.Duration = Duration;
+	Shape.Thickness = Thickness;
+	EnqueueFor(WorldContext, MoveTemp(Shape));
+}
+
+void FAtlasDebugDraw::String(const UObject* WorldContext, const FVector& Location, FString Text, const FColor& Color, float Duration, float Scale)
+{
+	UAtlasDebugDrawSubsystem::FQueuedShape Shape;
+	Shape.Shape = UAtlasDebugDrawSubsystem::EShape::String;
+	Shape.A = Location;
+	Shape.Size = Scale;
+	Shape.Color = Color;
+	Shape.Duration = Duration;
+	Shape.Text = MoveTemp(Text);
+	EnqueueFor(WorldContext, MoveTemp(Shape));
+}
+
+void FAtlasDebugDraw::Message(const UObject* WorldContext, uint64 Key, FString Text, const FColor& Color, float Duration)
+{
+	UAtlasDebugDrawSubsystem::FQueuedShape Shape;
+	Shape.Shape = UAtlasDebugDrawSubsystem::EShape::Message;
+	Shape.Key = Key;
+	Shape.Color = Color;
+	Shape.Duration = Duration;
+	Shape.Text = MoveTemp(Text);
+	EnqueueFor(WorldContext, MoveTemp(Shape));
+}
+
+bool UAtlasDebugDrawSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UAtlasDebugDrawSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAtlasDebugDrawSubsystem, STATGROUP_Tickables);
+}
+
+UAtlasDebugDrawSubsystem* UAtlasDebugDrawSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<UAtlasDebugDrawSubsystem>() : nullptr;
+}
+
+bool UAtlasDebugDrawSubsystem::Enqueue(FQueuedShape&& Shape)
+{
+	if (Queue.Num() >= CVarAtlasDebugDrawMaxPerFrame.GetValueOnGameThread())
+	{
+		++NumDropped;
+		return false;
+	}
+
+	Queue.Add(MoveTemp(Shape));
+	return true;
+}
+
+void UAtlasDebugDrawSubsystem::Discard()
+{
+	Queue.Reset();
+	NumDropped = 0;
+}
+
+void UAtlasDebugDrawSubsystem::Tick(float DeltaTime)
+{
+	if (Queue.Num() == 0)
+	{
+		return;
+	}
+
+	// Switched off with shapes still queued, they go unseen
+	if (FAtlasDebugDraw::IsEnabled())
+	{
+		for (const FQueuedShape& Shape : Queue)
+		{
+			Draw(Shape);
+		}
+		if (NumDropped > 0 && GEngine)
+		{
+			GEngine->AddOnScreenDebugMessage(GetUniqueID(), 0.0f, FColor::Orange,
+				FString::Printf(TEXT("Atlas.Debug.Draw: %d shapes over Atlas.Debug.DrawMaxPerFrame dropped"), NumDropped));
+		}
+	}
+	Discard();
+}
+
+void UAtlasDebugDrawSubsystem::Draw(const FQueuedShape& Shape) const
+{
+	const UWorld* World = GetWorld();
+	switch (Shape.Shape)
+	{
+	case EShape::Sphere:
+		DrawDebugSphere(World, Shape.A, Shape.Size, 16, Shape.Color, false, Shape.Duration, 0, Shape.Thickness);
+		break;
+	case EShape::Line:
+		DrawDebugLine(World, Shape.A, Shape.B, Shape.Color, false, Shape.Duration, 0, Shape.Thickness);
+		break;
+	case EShape::Arrow:
+		DrawDebugDirectionalArrow(World, Shape.A, Shape.B, Shape.Size, Shape.Color, false, Shape.Duration, 0, Shape.Thickness);
+		break;
+	case EShape::Circle:
+		DrawDebugCircle(World, Shape.A, Shape.Size, 32, Shape.Color, false, Shape.Duration, 0, Shape.Thickness, Shape.B, Shape.C, false);
+		break;
+	case EShape::String:
+		DrawDebugString(World, Shape.A, Shape.Text, nullptr, Shape.Color, Shape.Duration, true, Shape.Size);
+		break;
+	case EShape::Message:
+		if (GEngine)
+		{
+			GEngine->AddOnScreenDebugMessage(Shape.Key, Shape.Duration, Shape.Color, Shape.Text);
+		}
+		break;
+	}
+}
+
+#else
+
+bool FAtlasDebugDraw::IsEnabled()
+{
+	return false;
+}
+
+void FAtlasDebugDraw::SetEnabled(bool bEnabled)
+{
+}
+
+#endif // ATLAS_WITH_DEBUG_DRAW
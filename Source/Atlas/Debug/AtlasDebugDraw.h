@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AtlasDebugDraw.generated.h"
+
+/** Debug drawing is compiled out of Test and Shipping builds, whatever the engine allows */
+#define ATLAS_WITH_DEBUG_DRAW (ENABLE_DRAW_DEBUG && !UE_BUILD_TEST && !UE_BUILD_SHIPPING)
+
+/**
+ * Runs Expr only while Atlas.Debug.Draw is on, and compiles it out with ATLAS_WITH_DEBUG_DRAW,
+ * so strings for the shapes and messages are neither formatted nor compiled in otherwise.
+ *
+ * ATLAS_DEBUG_DRAW(FAtlasDebugDraw::Sphere(this, Hit.Location, 75.0f, FColor::Yellow, 2.0f));
+ */
+#if ATLAS_WITH_DEBUG_DRAW
+	#define ATLAS_DEBUG_DRAW(Expr) do { if (FAtlasDebugDraw::IsEnabled()) { Expr; } } while (0)
+#else
+	#define ATLAS_DEBUG_DRAW(Expr) do { } while (0)
+#endif
+
+/**
+ * Queues debug shapes and on-screen messages for the world's UAtlasDebugDrawSubsystem, which
+ * draws them once per frame up to Atlas.Debug.DrawMaxPerFrame. Called through ATLAS_DEBUG_DRAW.
+ * Without ATLAS_WITH_DEBUG_DRAW only IsEnabled, always false, and SetEnabled, a no-op, are left.
+ */
+class ATLAS_API FAtlasDebugDraw
+{
+public:
+	static bool IsEnabled();
+	static void SetEnabled(bool bEnabled);
+
+#if ATLAS_WITH_DEBUG_DRAW
+	static void Sphere(const UObject* WorldContext, const FVector& Center, float Radius, const FColor& Color, float Duration = 0.0f, float Thickness = 0.0f);
+	static void Line(const UObject* WorldContext, const FVector& Start, const FVector& End, const FColor& Color, float Duration = 0.0f, float Thickness = 0.0f);
+	static void Arrow(const UObject* WorldContext, const FVector& Start, const FVector& End, float HeadSize, const FColor& Color, float Duration = 0.0f, float Thickness = 0.0f);
+	static void Circle(const UObject* WorldContext, const FVector& Center, float Radius, const FVector& YAxis, const FVector& ZAxis, const FColor& Color, float Duration = 0.0f, float Thickness = 0.0f);
+	static void String(const UObject* WorldContext, const FVector& Location, FString Text, const FColor& Color, float Duration = 0.0f, float Scale = 1.0f);
+
+	/** On-screen message. Messages sharing a key replace each other instead of stacking up */
+	static void Message(const UObject* WorldContext, uint64 Key, FString Text, const FColor& Color, float Duration);
+#endif
+};
+
+/**
+ * Holds a world's queued debug shapes and messages and draws them at the end of its tick.
+ * Without ATLAS_WITH_DEBUG_DRAW it is an empty class that is never created, kept for UHT.
+ */
+UCLASS()
+class ATLAS_API UAtlasDebugDrawSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+#if ATLAS_WITH_DEBUG_DRAW
+public:
+	// UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UAtlasDebugDrawSubsystem* Get(const UObject* WorldContextObject);
+
+	enum class EShape : uint8
+	{
+		Sphere,
+		Line,
+		Arrow,
+		Circle,
+		String,
+		Message
+	};
+
+	struct FQueuedShape
+	{
+		EShape Shape = EShape::Sphere;
+		FVector A = FVector::ZeroVector;
+		FVector B = FVector::ZeroVector;
+		FVector C = FVector::ZeroVector;
+		float Size = 0.0f;
+		float Thickness = 0.0f;
+		float Duration = 0.0f;
+		FColor Color = FColor::White;
+		uint64 Key = 0;
+		FString Text;
+	};
+
+	/** False once this frame's queue is full */
+	bool Enqueue(FQueuedShape&& Shape);
+
+	int32 GetNumQueued() const { return Queue.Num(); }
+	int32 GetNumDropped() const { return NumDropped; }
+
+	/** Forget the queue without drawing it */
+	void Discard();
+
+private:
+	void Draw(const FQueuedShape& Shape) const;
+
+	TArray<FQueuedShape> Queue;
+	int32 NumDropped = 0;
+#else
+public:
+	// UWorldSubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return false; }
+#endif
+};
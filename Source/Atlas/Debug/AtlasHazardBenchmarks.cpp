@@ -0,0 +1,441 @@
+#include "AtlasConsoleCommands.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/SphereComponent.h"
+#include "Atlas/Characters/GameCharacterBase.h"
+#include "Atlas/Components/IntegrityVisualizerComponent.h"
+#include "Atlas/Hazards/ElectricalSurgeHazard.h"
+#include "Atlas/Hazards/HazardWorldSubsystem.h"
+#include "Atlas/Hazards/GravityFieldSubsystem.h"
+#include "Atlas/Hazards/LowGravityHazard.h"
+#include "Atlas/Hazards/ToxicLeakHazard.h"
+
+void FAtlasConsoleCommands::RegisterHazardBenchmarks()
+{
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.ChainLightning"),
+        TEXT("Benchmark electrical chain solving. Usage: Atlas.Bench.ChainLightning (Targets=200) (Iterations=1000)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchChainLightning),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.GravityField"),
+        TEXT("Benchmark low gravity props, per-tick forces vs gravity field subsystem. Usage: Atlas.Bench.GravityField (Props=500) (Frames=120)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchGravityField),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.ToxicCloud"),
+        TEXT("Benchmark toxic cloud growth, per-tick sphere resize vs analytic membership. Usage: Atlas.Bench.ToxicCloud (Frames=600)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchToxicCloud),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.HullBreach"),
+        TEXT("Benchmark hull breach suction, per-breach overlaps vs combined force field. Usage: Atlas.Bench.HullBreach (Breaches=20) (Props=300) (Updates=100)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchHullBreach),
+        ECVF_Cheat
+    );
+}
+
+void FAtlasConsoleCommands::BenchChainLightning(const TArray<FString>& Args)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull);
+    if (!World) return;
+    
+    UHazardWorldSubsystem* HazardSubsystem = UHazardWorldSubsystem::Get(World);
+    if (!HazardSubsystem) return;
+    
+    const int32 NumTargets = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 2) : 200;
+    const int32 Iterations = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 1000;
+    const float ChainRadius = 400.0f;
+    const int32 MaxJumps = 5;
+    
+    // Both paths run against the same conductive props, spawned away from the level geometry
+    const FVector Origin(0.0f, 0.0f, -20000.0f);
+    TArray<AStaticMeshActor*> Props;
+    SpawnBenchmarkProps(World, Origin, NumTargets, Props);
+    if (Props.Num() < 2) return;
+    
+    TSet<AActor*> Targets;
+    for (AStaticMeshActor* Prop : Props)
+    {
+        Prop->GetStaticMeshComponent()->SetSimulatePhysics(false);
+        HazardSubsystem->RegisterDamageableActor(Prop);
+        Targets.Add(Prop);
+    }
+    
+    // Legacy path: the pre-change ChainElectricity, one overlap around the source then a trace per candidate
+    const FCollisionShape SphereShape = FCollisionShape::MakeSphere(ChainRadius);
+    TArray<FOverlapResult> Overlaps;
+    TArray<AActor*> Chained;
+    int32 LegacyHits = 0;
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 Iter = 0; Iter < Iterations; ++Iter)
+    {
+        AActor* Source = Props[Iter % Props.Num()];
+        Chained.Reset();
+        Chained.Add(Source);
+        
+        Overlaps.Reset();
+        World->OverlapMultiByChannel(Overlaps, Source->GetActorLocation(), FQuat::Identity, ECC_Pawn, SphereShape);
+        
+        int32 ChainCount = 0;
+        for (const FOverlapResult& Overlap : Overlaps)
+        {
+            AActor* Target = Overlap.GetActor();
+            if (!Target || Target == Source || Chained.Contains(Target) || !Targets.Contains(Target))
+            {
+                continue;
+            }
+            
+            FHitResult LineTraceHit;
+            FCollisionQueryParams QueryParams;
+            QueryParams.AddIgnoredActor(Source);
+            QueryParams.AddIgnoredActor(Target);
+            
+            const bool bHasLineOfSight = !World->LineTraceSingleByChannel(
+                LineTraceHit, Source->GetActorLocation(), Target->GetActorLocation(), ECC_Visibility, QueryParams);
+            
+            if (bHasLineOfSight)
+            {
+                Chained.Add(Target);
+                if (++ChainCount >= MaxJumps) break;
+            }
+        }
+        LegacyHits += ChainCount;
+    }
+    const double LegacyMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    // Solver path: the current ChainElectricity minus effects and damage. Every chain starts a fresh "frame"
+    // so neither the spatial hash nor the line of sight cache carries over between iterations.
+    TArray<AActor*> Candidates;
+    TArray<FVector> CandidateLocations;
+    TArray<int32> ChainOrder;
+    int32 SolverHits = 0;
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Iter = 0; Iter < Iterations; ++Iter)
+    {
+        AActor* Source = Props[Iter % Props.Num()];
+        HazardSubsystem->InvalidateFrameCaches();
+        
+        Candidates.Reset();
+        HazardSubsystem->QueryDamageableActors(Source->GetActorLocation(), ChainRadius * MaxJumps, Candidates);
+        Candidates.RemoveAllSwap([Source, &Targets](AActor* Candidate)
+        {
+            return Candidate == Source || !Targets.Contains(Candidate);
+        });
+        
+        CandidateLocations.Reset();
+        for (AActor* Candidate : Candidates)
+        {
+            CandidateLocations.Add(Candidate->GetActorLocation());
+        }
+        
+        UElectricalSurgeHazard::BuildChainOrder(Source->GetActorLocation(), CandidateLocations, ChainRadius, MaxJumps,
+            [HazardSubsystem, Source, &Candidates](int32 FromIndex, int32 ToIndex)
+            {
+                AActor* From = FromIndex == INDEX_NONE ? Source : Candidates[FromIndex];
+                return HazardSubsystem->HasLineOfSight(From, Candidates[ToIndex]);
+            },
+            ChainOrder);
+        SolverHits += ChainOrder.Num();
+    }
+    const double SolverMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    for (AStaticMeshActor* Prop : Props)
+    {
+        HazardSubsystem->UnregisterDamageableActor(Prop);
+        Prop->Destroy();
+    }
+    
+    // Hit counts differ by design: the legacy path arcs outward from the source, the solver hops target to target
+    UE_LOG(LogTemp, Warning, TEXT("=== CHAIN LIGHTNING BENCHMARK (%d targets, %d chains) ==="), Props.Num(), Iterations);
+    UE_LOG(LogTemp, Warning, TEXT("  Legacy overlap + traces: %.3f ms total, %.4f ms/chain, %d hits"), LegacyMs, LegacyMs / Iterations, LegacyHits);
+    UE_LOG(LogTemp, Warning, TEXT("  Hash + chain solver:     %.3f ms total, %.4f ms/chain, %d hits"), SolverMs, SolverMs / Iterations, SolverHits);
+}
+
+void FAtlasConsoleCommands::BenchGravityField(const TArray<FString>& Args)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull);
+    UGravityFieldSubsystem* GravityFields = UGravityFieldSubsystem::Get(World);
+    if (!World || !GravityFields) return;
+    
+    const int32 NumProps = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 500;
+    const int32 NumFrames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 120;
+    const float FrameTime = 1.0f / 60.0f;
+    
+    // Fill a low gravity room with physics props above the player
+    const FVector Origin = GetPlayerCharacter() ? GetPlayerCharacter()->GetActorLocation() + FVector(0, 0, 500) : FVector(0, 0, 500);
+    
+    TArray<AStaticMeshActor*> Props;
+    SpawnBenchmarkProps(World, Origin, NumProps, Props);
+    if (Props.Num() == 0) return;
+    
+    TArray<UPrimitiveComponent*> Bodies;
+    for (AStaticMeshActor* Prop : Props)
+    {
+        Bodies.Add(Prop->GetStaticMeshComponent());
+    }
+    
+    // Legacy path: distance check plus two AddForce calls per body every tick
+    const float LegacyGravityScale = 0.2f;
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        const float Time = Frame * FrameTime;
+        for (int32 i = 0; i < Bodies.Num(); ++i)
+        {
+            UPrimitiveComponent* Component = Bodies[i];
+            if (FVector::Dist(Component->GetComponentLocation(), Origin) > 100000.0f) continue;
+            
+            Component->AddForce(FVector(0, 0, Component->GetMass() * 980.0f * (1.0f - LegacyGravityScale)));
+            Component->AddForce(FVector(0, 0, FMath::Sin(Time * 2.0f + i) * 10.0f * Component->GetMass()));
+        }
+    }
+    const double LegacyMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    const int32 LegacyCallsPerFrame = Bodies.Num() * 2;
+    
+    // Field path: one enter per body, then the subsystem pass
+    ULowGravityHazard* Field = NewObject<ULowGravityHazard>(Props[0]);
+    GravityFields->RegisterField(Field, Field->GetPhysicsFieldSettings());
+    
+    StartTime = FPlatformTime::Seconds();
+    for (UPrimitiveComponent* Body : Bodies)
+    {
+        GravityFields->EnterField(Field, Body);
+    }
+    const double EnterMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    // Counted by the pass itself, so what reaches physics is what is reported
+    int64 FieldCalls = 0;
+    int64 BobbedCalls = 0;
+    double FieldSeconds = 0.0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        StartTime = FPlatformTime::Seconds();
+        GravityFields->Tick(FrameTime);
+        FieldSeconds += FPlatformTime::Seconds() - StartTime;
+        FieldCalls += GravityFields->GetNumImpulsesLastTick();
+        BobbedCalls += GravityFields->GetNumBobbedLastTick();
+    }
+    const double FieldMs = FieldSeconds * 1000.0;
+    
+    GravityFields->UnregisterField(Field);
+    for (AStaticMeshActor* Prop : Props)
+    {
+        Prop->Destroy();
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== GRAVITY FIELD BENCHMARK (%d props, %d frames) ==="), Props.Num(), NumFrames);
+    UE_LOG(LogTemp, Warning, TEXT("  Legacy per-tick forces: %.4f ms/frame game thread, %d physics calls/frame"),
+        LegacyMs / NumFrames, LegacyCallsPerFrame);
+    UE_LOG(LogTemp, Warning, TEXT("  Gravity field pass:     %.4f ms/frame game thread, %.1f physics calls/frame, one per body for scaled gravity, %.1f of them with the sliced bob (%.3f ms one-off enter)"),
+        FieldMs / NumFrames, static_cast<double>(FieldCalls) / NumFrames, static_cast<double>(BobbedCalls) / NumFrames, EnterMs);
+    UE_LOG(LogTemp, Warning, TEXT("  Run 'stat physics' while the hazard is live for physics thread cost"));
+}
+
+void FAtlasConsoleCommands::BenchToxicCloud(const TArray<FString>& Args)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull);
+    UHazardWorldSubsystem* HazardSubsystem = UHazardWorldSubsystem::Get(World);
+    AGameCharacterBase* Player = GetPlayerCharacter();
+    if (!World || !HazardSubsystem || !Player) return;
+    
+    const int32 NumFrames = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 600;
+    const float FrameTime = 1.0f / 60.0f;
+    const UToxicLeakHazard* Cloud = GetDefault<UToxicLeakHazard>();
+    
+    // Stand-in trigger configured like the hazard's, centred on the player so something overlaps
+    const FVector Center = Player->GetActorLocation();
+    AActor* Holder = World->SpawnActor<AActor>(Center, FRotator::ZeroRotator);
+    if (!Holder) return;
+    
+    USphereComponent* Sphere = NewObject<USphereComponent>(Holder);
+    Sphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+    Sphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+    Sphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+    Sphere->SetGenerateOverlapEvents(true);
+    Sphere->SetWorldLocation(Center);
+    Sphere->RegisterComponent();
+    
+    auto GetAnalyticMembers = [&](float Radius, TSet<AActor*>& OutMembers)
+    {
+        TArray<AActor*> Nearby;
+        HazardSubsystem->QueryDamageableActors(Center, Radius + Cloud->MaxActorRadius, Nearby);
+        for (AActor* Actor : Nearby)
+        {
+            if (UToxicLeakHazard::IsInsideCloud(Center, Radius, Actor->GetActorLocation(), Actor->GetSimpleCollisionRadius()))
+            {
+                OutMembers.Add(Actor);
+            }
+        }
+    };
+    
+    // Legacy path: resize the trigger every tick while growing
+    int32 LegacyResizes = 0;
+    double LegacyMs = 0.0;
+    float LegacyRadius = Cloud->HazardRadius;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        if (LegacyRadius < Cloud->HazardRadius + Cloud->ToxicCloudSpreadRadius)
+        {
+            LegacyRadius += Cloud->ToxicCloudSpreadRate * FrameTime;
+            
+            const double StartTime = FPlatformTime::Seconds();
+            Sphere->SetSphereRadius(LegacyRadius);
+            LegacyMs += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+            ++LegacyResizes;
+        }
+    }
+    
+    // Analytic path: membership every frame, trigger only resized at coarse steps
+    Sphere->SetSphereRadius(Cloud->HazardRadius);
+    int32 AnalyticResizes = 0;
+    float CollisionRadius = Cloud->HazardRadius;
+    const double StartTime = FPlatformTime::Seconds();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        const float Radius = Cloud->GetCloudRadiusAtTime((Frame + 1) * FrameTime);
+        const float Step = FMath::Max(Cloud->CollisionRadiusStep, 1.0f);
+        const float SteppedRadius = FMath::Min(FMath::CeilToFloat(Radius / Step) * Step, Cloud->HazardRadius + Cloud->ToxicCloudSpreadRadius);
+        if (!FMath::IsNearlyEqual(SteppedRadius, CollisionRadius))
+        {
+            CollisionRadius = SteppedRadius;
+            Sphere->SetSphereRadius(CollisionRadius);
+            ++AnalyticResizes;
+        }
+        
+        TSet<AActor*> Members;
+        GetAnalyticMembers(Radius, Members);
+    }
+    const double AnalyticMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    Holder->Destroy();
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== TOXIC CLOUD BENCHMARK (%d frames) ==="), NumFrames);
+    UE_LOG(LogTemp, Warning, TEXT("  Per-tick resize:   %d overlap updates, %.3f ms total"), LegacyResizes, LegacyMs);
+    UE_LOG(LogTemp, Warning, TEXT("  Analytic + steps:  %d overlap updates, %.3f ms total (includes membership)"), AnalyticResizes, AnalyticMs);
+}
+
+void FAtlasConsoleCommands::BenchHullBreach(const TArray<FString>& Args)
+{
+    UWorld* World = GEngine->GetWorldFromContextObject(GEngine->GameViewport, EGetWorldErrorMode::LogAndReturnNull);
+    if (!World) return;
+    
+    const int32 NumBreaches = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 20;
+    const int32 NumProps = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 300;
+    const int32 NumUpdates = Args.Num() > 2 ? FMath::Max(FCString::Atoi(*Args[2]), 1) : 100;
+    
+    // Props laid out on a grid with breaches scattered over the same area
+    const FVector Origin = GetPlayerCharacter() ? GetPlayerCharacter()->GetActorLocation() + FVector(0, 0, 200) : FVector(0, 0, 200);
+    
+    TArray<AStaticMeshActor*> Props;
+    SpawnBenchmarkProps(World, Origin, NumProps, Props);
+    if (Props.Num() == 0) return;
+    
+    AActor* Holder = World->SpawnActor<AActor>(Origin, FRotator::ZeroRotator);
+    if (!Holder) return;
+    
+    UIntegrityVisualizerComponent* Visualizer = NewObject<UIntegrityVisualizerComponent>(Holder);
+    Visualizer->SetComponentTickEnabled(false);
+    Visualizer->RegisterComponent();
+    
+    const float Extent = FMath::CeilToFloat(FMath::Sqrt(static_cast<float>(Props.Num()))) * 120.0f;
+    FRandomStream Stream(29);
+    for (int32 i = 0; i < NumBreaches; ++i)
+    {
+        Visualizer->TriggerHullBreach(Origin + FVector(Stream.FRandRange(0.0f, Extent), Stream.FRandRange(0.0f, Extent), 0.0f));
+    }
+    const TArray<FHullBreachData>& Breaches = Visualizer->GetActiveBreaches();
+    
+    // Legacy path: one sphere overlap per breach, one impulse per breach per body
+    int32 LegacyImpulses = 0;
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 Update = 0; Update < NumUpdates; ++Update)
+    {
+        for (const FHullBreachData& Breach : Breaches)
+        {
+            TArray<FOverlapResult> Overlaps;
+            World->OverlapMultiByChannel(Overlaps, Breach.Location, FQuat::Identity, ECC_WorldDynamic,
+                FCollisionShape::MakeSphere(Breach.Radius));
+            
+            for (const FOverlapResult& Overlap : Overlaps)
+            {
+                AActor* Actor = Overlap.GetActor();
+                if (!Actor) continue;
+                
+                FVector ToCenter = Breach.Location - Actor->GetActorLocation();
+                const float Distance = ToCenter.Size();
+                if (Distance <= 10.0f || Distance >= Breach.Radius) continue;
+                
+                UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+                if (PrimComp && PrimComp->IsSimulatingPhysics())
+                {
+                    const float Force = 1000.0f * Breach.Severity * (1.0f - Distance / Breach.Radius);
+                    PrimComp->AddImpulse((ToCenter / Distance) * Force * PrimComp->GetMass());
+                    ++LegacyImpulses;
+                }
+            }
+        }
+    }
+    const double LegacyMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    
+    // Force field path: one broadphase query and one impulse per body
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Update = 0; Update < NumUpdates; ++Update)
+    {
+        Visualizer->UpdateBreachForceField();
+    }
+    const double FieldMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    const float BreachStrength = Visualizer->GetBreachStrengthMultiplier();
+    
+    Visualizer->ClearAllEffects();
+    Holder->Destroy();
+    for (AStaticMeshActor* Prop : Props)
+    {
+        Prop->Destroy();
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== HULL BREACH BENCHMARK (%d breaches, %d props, %d updates) ==="), NumBreaches, Props.Num(), NumUpdates);
+    UE_LOG(LogTemp, Warning, TEXT("  Per-breach overlaps:  %.4f ms/update, %d queries/update, %d impulses/update"),
+        LegacyMs / NumUpdates, NumBreaches, LegacyImpulses / NumUpdates);
+    UE_LOG(LogTemp, Warning, TEXT("  Combined force field: %.4f ms/update, 1 query/update (strength x%.2f)"),
+        FieldMs / NumUpdates, BreachStrength);
+}
+
+void FAtlasConsoleCommands::SpawnBenchmarkProps(UWorld* World, const FVector& Origin, int32 Count, TArray<AStaticMeshActor*>& OutProps)
+{
+    UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+    if (!World || !CubeMesh)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Could not load /Engine/BasicShapes/Cube"));
+        return;
+    }
+    
+    const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const FVector Location = Origin + FVector((i % GridSize) * 120.0f, (i / GridSize) * 120.0f, 0.0f);
+        AStaticMeshActor* Prop = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator);
+        if (!Prop) continue;
+        
+        UStaticMeshComponent* Mesh = Prop->GetStaticMeshComponent();
+        Mesh->SetMobility(EComponentMobility::Movable);
+        Mesh->SetStaticMesh(CubeMesh);
+        Mesh->SetWorldScale3D(FVector(0.5f));
+        Mesh->SetSimulatePhysics(true);
+        
+        OutProps.Add(Prop);
+    }
+}
@@ -0,0 +1,341 @@
+#include "AtlasConsoleCommands.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/App.h"
+#include "Atlas/Components/SlotManagerComponent.h"
+#include "Atlas/Data/RewardDataAsset.h"
+#include "Atlas/UI/SEnemyHealthWidget.h"
+#include "Atlas/UI/SEnemyBarOverlay.h"
+#include "Atlas/UI/SRewardSelectionWidget.h"
+#include "Atlas/UI/SSlotManagerWidget.h"
+#include "Atlas/UI/SInventoryWidget.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Widgets/SOverlay.h"
+#include "Rendering/DrawElements.h"
+#include "Input/HittestGrid.h"
+#include "Types/PaintArgs.h"
+#include "Styling/WidgetStyle.h"
+
+namespace
+{
+    /** Lay a widget out and paint it offscreen once, timing both passes in milliseconds */
+    void PaintOffscreen(const TSharedRef<SWidget>& Widget, const FVector2D& DrawSize, float& OutPrepassMs, float& OutPaintMs)
+    {
+        const FGeometry Geometry = FGeometry::MakeRoot(DrawSize, FSlateLayoutTransform());
+        const FSlateRect CullingRect(FVector2D::ZeroVector, DrawSize);
+        
+        FHittestGrid HittestGrid;
+        HittestGrid.SetHittestArea(FVector2D::ZeroVector, DrawSize);
+        FSlateWindowElementList ElementList(nullptr);
+        FPaintArgs PaintArgs(nullptr, HittestGrid, FVector2D::ZeroVector, FApp::GetCurrentTime(), FApp::GetDeltaTime());
+        
+        const double PrepassStart = FPlatformTime::Seconds();
+        Widget->SlatePrepass(1.0f);
+        OutPrepassMs = static_cast<float>((FPlatformTime::Seconds() - PrepassStart) * 1000.0);
+        
+        const double PaintStart = FPlatformTime::Seconds();
+        Widget->Paint(PaintArgs, Geometry, CullingRect, ElementList, 0, FWidgetStyle(), true);
+        OutPaintMs = static_cast<float>((FPlatformTime::Seconds() - PaintStart) * 1000.0);
+    }
+    
+    /** Widgets in a tree, including the root */
+    int32 CountWidgets(const TSharedRef<SWidget>& Widget)
+    {
+        int32 Count = 1;
+        FChildren* Children = Widget->GetChildren();
+        for (int32 i = 0; Children && i < Children->Num(); ++i)
+        {
+            Count += CountWidgets(Children->GetChildAt(i));
+        }
+        return Count;
+    }
+}
+
+void FAtlasConsoleCommands::RegisterUIBenchmarks()
+{
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.HUD"),
+        TEXT("Measure Slate prepass and paint with a stack of enemy health bars, values unchanged vs changing every frame. Usage: Atlas.Bench.HUD (Bars=30) (Frames=300)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchHUD),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.EnemyBars"),
+        TEXT("Compare painting enemy bars through the batched overlay against one enemy health widget per enemy. Usage: Atlas.Bench.EnemyBars (Bars=100) (Frames=120)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchEnemyBars),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.RewardOffer"),
+        TEXT("Compare building a new reward selection widget for each offer against rebinding the persistent one, up to its first paint. Usage: Atlas.Bench.RewardOffer (Offers=50)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchRewardOffer),
+        ECVF_Cheat
+    );
+    
+    IConsoleManager::Get().RegisterConsoleCommand(
+        TEXT("Atlas.Bench.SlotWidgets"),
+        TEXT("Open the slot tile view and inventory list over a slot manager with one reward per slot, then change one slot and scroll through them all. Usage: Atlas.Bench.SlotWidgets (Rewards=500)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&FAtlasConsoleCommands::BenchSlotWidgets),
+        ECVF_Cheat
+    );
+}
+
+void FAtlasConsoleCommands::BenchHUD(const TArray<FString>& Args)
+{
+    if (!FSlateApplication::IsInitialized())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Atlas.Bench.HUD needs Slate"));
+        return;
+    }
+    
+    const int32 NumBars = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 30;
+    const int32 NumFrames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 300;
+    const FVector2D DrawSize(1920.0f, 1080.0f);
+    
+    // Bars stacked on top of each other so every one of them is inside the culling rect
+    TSharedRef<SOverlay> Root = SNew(SOverlay);
+    TArray<TSharedRef<SEnemyHealthWidget>> Bars;
+    for (int32 i = 0; i < NumBars; ++i)
+    {
+        TSharedRef<SEnemyHealthWidget> Bar = SNew(SEnemyHealthWidget)
+            .EnemyName(FText::FromString(FString::Printf(TEXT("Enemy %d"), i)));
+        Bar->UpdateEnemyHealth(100.0f, 100.0f);
+        Bar->UpdateEnemyPoise(100.0f, 100.0f);
+        Bar->ShowWidget();
+        Root->AddSlot()[Bar];
+        Bars.Add(Bar);
+    }
+    
+    struct FPassTimes
+    {
+        TArray<float> UpdateMs;
+        TArray<float> PrepassMs;
+        TArray<float> PaintMs;
+    };
+    
+    // Push values the way the HUD model does, then lay out and paint the whole stack once
+    auto RunPass = [&](bool bChangeValues)
+    {
+        FPassTimes Times;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            const double UpdateStart = FPlatformTime::Seconds();
+            for (int32 i = 0; i < Bars.Num(); ++i)
+            {
+                const float Health = bChangeValues ? 100.0f - static_cast<float>((Frame + i) % 100) : 100.0f;
+                const float Poise = bChangeValues ? 100.0f - static_cast<float>((Frame * 3 + i) % 101) : 100.0f;
+                Bars[i]->UpdateEnemyHealth(Health, 100.0f);
+                Bars[i]->UpdateEnemyPoise(Poise, 100.0f);
+            }
+            Times.UpdateMs.Add(static_cast<float>((FPlatformTime::Seconds() - UpdateStart) * 1000.0));
+            
+            PaintOffscreen(Root, DrawSize, Times.PrepassMs.AddDefaulted_GetRef(), Times.PaintMs.AddDefaulted_GetRef());
+        }
+        return Times;
+    };
+    
+    // Warm up text shaping and font caches outside the timed passes
+    RunPass(true);
+    
+    const FPassTimes Steady = RunPass(false);
+    const FPassTimes Changing = RunPass(true);
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== HUD BENCHMARK (%d enemy health bars, %d frames) ==="), NumBars, NumFrames);
+    UE_LOG(LogTemp, Warning, TEXT("  Values unchanged: update avg %.3f ms, prepass avg %.3f ms p95 %.3f ms, paint avg %.3f ms p95 %.3f ms"),
+        Average(Steady.UpdateMs), Average(Steady.PrepassMs), Percentile(Steady.PrepassMs, 0.95f),
+        Average(Steady.PaintMs), Percentile(Steady.PaintMs, 0.95f));
+    UE_LOG(LogTemp, Warning, TEXT("  Values changing: update avg %.3f ms, prepass avg %.3f ms p95 %.3f ms, paint avg %.3f ms p95 %.3f ms"),
+        Average(Changing.UpdateMs), Average(Changing.PrepassMs), Percentile(Changing.PrepassMs, 0.95f),
+        Average(Changing.PaintMs), Percentile(Changing.PaintMs, 0.95f));
+}
+
+void FAtlasConsoleCommands::BenchEnemyBars(const TArray<FString>& Args)
+{
+    if (!FSlateApplication::IsInitialized())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Atlas.Bench.EnemyBars needs Slate"));
+        return;
+    }
+    
+    const int32 NumBars = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+    const int32 NumFrames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 120;
+    const FVector2D DrawSize(1920.0f, 1080.0f);
+    FRandomStream Random(NumBars);
+    
+    // One widget per enemy, the way SEnemyHealthWidget is used today
+    TSharedRef<SOverlay> Widgets = SNew(SOverlay);
+    TArray<TSharedRef<SEnemyHealthWidget>> HealthWidgets;
+    for (int32 i = 0; i < NumBars; ++i)
+    {
+        TSharedRef<SEnemyHealthWidget> Widget = SNew(SEnemyHealthWidget);
+        Widget->ShowWidget();
+        Widgets->AddSlot()[Widget];
+        HealthWidgets.Add(Widget);
+    }
+    
+    // The same enemies as packed entries, about half of them close enough to show poise
+    TSharedRef<SEnemyBarOverlay> Overlay = SNew(SEnemyBarOverlay);
+    
+    TArray<float> WidgetPrepassMs, WidgetPaintMs, OverlayPrepassMs, OverlayPaintMs;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        TArray<FEnemyBarEntry>& Entries = Overlay->BeginUpdate();
+        for (int32 i = 0; i < NumBars; ++i)
+        {
+            const float Health = Random.FRandRange(0.0f, 100.0f);
+            const float Poise = Random.FRandRange(0.0f, 100.0f);
+            HealthWidgets[i]->UpdateEnemyHealth(Health, 100.0f);
+            HealthWidgets[i]->UpdateEnemyPoise(Poise, 100.0f);
+            
+            FEnemyBarEntry& Entry = Entries.AddDefaulted_GetRef();
+            Entry.Position = FVector2f(Random.FRand(), Random.FRand());
+            Entry.HealthPercent = Health / 100.0f;
+            Entry.PoisePercent = Poise / 100.0f;
+            Entry.bShowPoise = Random.FRand() < 0.5f;
+            Entry.TierColor = Random.FRand() < 0.2f ? FLinearColor::Yellow : FLinearColor::Transparent;
+        }
+        Overlay->EndUpdate();
+        
+        PaintOffscreen(Widgets, DrawSize, WidgetPrepassMs.AddDefaulted_GetRef(), WidgetPaintMs.AddDefaulted_GetRef());
+        PaintOffscreen(Overlay, DrawSize, OverlayPrepassMs.AddDefaulted_GetRef(), OverlayPaintMs.AddDefaulted_GetRef());
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== ENEMY BARS BENCHMARK (%d bars, %d frames) ==="), NumBars, NumFrames);
+    UE_LOG(LogTemp, Warning, TEXT("  Widget per enemy: prepass avg %.3f ms, paint avg %.3f ms p95 %.3f ms"),
+        Average(WidgetPrepassMs), Average(WidgetPaintMs), Percentile(WidgetPaintMs, 0.95f));
+    UE_LOG(LogTemp, Warning, TEXT("  Batched overlay:  prepass avg %.3f ms, paint avg %.3f ms p95 %.3f ms, %d draw elements on 2 layers"),
+        Average(OverlayPrepassMs), Average(OverlayPaintMs), Percentile(OverlayPaintMs, 0.95f), Overlay->GetLastNumDrawElements());
+}
+
+void FAtlasConsoleCommands::BenchRewardOffer(const TArray<FString>& Args)
+{
+    if (!FSlateApplication::IsInitialized())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Atlas.Bench.RewardOffer needs Slate"));
+        return;
+    }
+    
+    const int32 NumOffers = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 50;
+    const FVector2D DrawSize(1920.0f, 1080.0f);
+    const float FrameBudgetMs = 1000.0f / 60.0f;
+    
+    // Two alternating offers so every rebind actually changes the cards
+    TArray<URewardDataAsset*> Offers[2];
+    for (int32 i = 0; i < 4; ++i)
+    {
+        URewardDataAsset* Reward = NewObject<URewardDataAsset>(GetTransientPackage());
+        Reward->RewardName = FText::FromString(FString::Printf(TEXT("Bench Reward %d"), i));
+        Reward->Description = FText::FromString(FString::Printf(TEXT("Description of bench reward %d, long enough to wrap onto a second line"), i));
+        Reward->Category = static_cast<ERewardCategory>(i % 5);
+        Offers[i % 2].Add(Reward);
+    }
+    
+    // Time from "show the offer" until it has been laid out and painted once
+    TArray<float> RebuildMs, RebindMs;
+    TSharedRef<SRewardSelectionWidget> Persistent = SNew(SRewardSelectionWidget).RewardChoices(Offers[1]);
+    float PrepassMs = 0.0f, PaintMs = 0.0f;
+    PaintOffscreen(Persistent, DrawSize, PrepassMs, PaintMs);
+    
+    for (int32 Offer = 0; Offer < NumOffers; ++Offer)
+    {
+        const TArray<URewardDataAsset*>& Choices = Offers[Offer % 2];
+        
+        double Start = FPlatformTime::Seconds();
+        TSharedRef<SRewardSelectionWidget> Fresh = SNew(SRewardSelectionWidget).RewardChoices(Choices);
+        PaintOffscreen(Fresh, DrawSize, PrepassMs, PaintMs);
+        RebuildMs.Add(static_cast<float>((FPlatformTime::Seconds() - Start) * 1000.0));
+        
+        Start = FPlatformTime::Seconds();
+        Persistent->SetRewardChoices(Choices);
+        PaintOffscreen(Persistent, DrawSize, PrepassMs, PaintMs);
+        RebindMs.Add(static_cast<float>((FPlatformTime::Seconds() - Start) * 1000.0));
+    }
+    
+    auto CountOverBudget = [FrameBudgetMs](const TArray<float>& Samples)
+    {
+        return Samples.FilterByPredicate([FrameBudgetMs](float Ms) { return Ms > FrameBudgetMs; }).Num();
+    };
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== REWARD OFFER BENCHMARK (%d offers, show to first paint) ==="), NumOffers);
+    UE_LOG(LogTemp, Warning, TEXT("  New widget per offer: avg %.3f ms, p95 %.3f ms, max %.3f ms, %d over a 60 Hz frame"),
+        Average(RebuildMs), Percentile(RebuildMs, 0.95f), Percentile(RebuildMs, 1.0f), CountOverBudget(RebuildMs));
+    UE_LOG(LogTemp, Warning, TEXT("  Persistent rebind:    avg %.3f ms, p95 %.3f ms, max %.3f ms, %d over a 60 Hz frame"),
+        Average(RebindMs), Percentile(RebindMs, 0.95f), Percentile(RebindMs, 1.0f), CountOverBudget(RebindMs));
+    UE_LOG(LogTemp, Warning, TEXT("  In game, the run manager logs 'Reward offer interactive ... after room clear' for each real offer"));
+}
+
+void FAtlasConsoleCommands::BenchSlotWidgets(const TArray<FString>& Args)
+{
+    if (!FSlateApplication::IsInitialized())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Atlas.Bench.SlotWidgets needs Slate"));
+        return;
+    }
+    
+    const int32 NumRewards = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 500;
+    const FVector2D DrawSize(1920.0f, 1080.0f);
+    
+    // A detached slot manager with every slot filled
+    USlotManagerComponent* SlotManager = NewObject<USlotManagerComponent>(GetTransientPackage());
+    SlotManager->SetMaxSlots(NumRewards);
+    TArray<URewardDataAsset*> Rewards;
+    for (int32 i = 0; i < NumRewards; ++i)
+    {
+        URewardDataAsset* Reward = NewObject<URewardDataAsset>(GetTransientPackage());
+        Reward->RewardName = FText::FromString(FString::Printf(TEXT("Bench Reward %d"), i));
+        Reward->Category = static_cast<ERewardCategory>(i % 5);
+        Reward->SlotCost = 1;
+        SlotManager->EquipReward(Reward, i);
+        Rewards.Add(Reward);
+    }
+    
+    // Open to first paint, the views generate their rows during the first paint's tick
+    float PrepassMs = 0.0f, PaintMs = 0.0f;
+    double Start = FPlatformTime::Seconds();
+    TSharedRef<SSlotManagerWidget> SlotWidget = SNew(SSlotManagerWidget).SlotManager(SlotManager);
+    PaintOffscreen(SlotWidget, DrawSize, PrepassMs, PaintMs);
+    PaintOffscreen(SlotWidget, DrawSize, PrepassMs, PaintMs);
+    const float SlotOpenMs = static_cast<float>((FPlatformTime::Seconds() - Start) * 1000.0);
+    const int32 SlotWidgetCount = CountWidgets(SlotWidget);
+    
+    Start = FPlatformTime::Seconds();
+    TSharedRef<SInventoryWidget> Inventory = SNew(SInventoryWidget).SlotManager(SlotManager).SelectedReward(Rewards[0]);
+    PaintOffscreen(Inventory, DrawSize, PrepassMs, PaintMs);
+    PaintOffscreen(Inventory, DrawSize, PrepassMs, PaintMs);
+    const float InventoryOpenMs = static_cast<float>((FPlatformTime::Seconds() - Start) * 1000.0);
+    const int32 InventoryWidgetCount = CountWidgets(Inventory);
+    
+    // One slot changes, both widgets diff and repaint
+    SlotManager->RemoveReward(0);
+    Start = FPlatformTime::Seconds();
+    SlotWidget->RefreshSlots();
+    Inventory->RefreshSlots();
+    PaintOffscreen(SlotWidget, DrawSize, PrepassMs, PaintMs);
+    PaintOffscreen(Inventory, DrawSize, PrepassMs, PaintMs);
+    const float ChangeMs = static_cast<float>((FPlatformTime::Seconds() - Start) * 1000.0);
+    
+    // Scroll the tile view end to end, released tiles should be reused for the slots scrolling in
+    const int32 TilesBeforeScroll = SlotWidget->GetNumTilesCreated();
+    const int32 ScrollStep = FMath::Max(SlotWidget->GetNumTilesGenerated(), 1);
+    TArray<float> ScrollMs;
+    for (int32 SlotIndex = ScrollStep; SlotIndex < NumRewards; SlotIndex += ScrollStep)
+    {
+        Start = FPlatformTime::Seconds();
+        SlotWidget->ScrollToSlot(SlotIndex);
+        PaintOffscreen(SlotWidget, DrawSize, PrepassMs, PaintMs);
+        PaintOffscreen(SlotWidget, DrawSize, PrepassMs, PaintMs);
+        ScrollMs.Add(static_cast<float>((FPlatformTime::Seconds() - Start) * 1000.0));
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("=== SLOT WIDGETS BENCHMARK (%d equipped rewards) ==="), NumRewards);
+    UE_LOG(LogTemp, Warning, TEXT("  Slot tile view: open to first paint %.3f ms, %d widgets, %d tiles generated"),
+        SlotOpenMs, SlotWidgetCount, TilesBeforeScroll);
+    UE_LOG(LogTemp, Warning, TEXT("  Inventory list: open to first paint %.3f ms, %d widgets"),
+        InventoryOpenMs, InventoryWidgetCount);
+    UE_LOG(LogTemp, Warning, TEXT("  One slot changed: refresh and repaint both %.3f ms"), ChangeMs);
+    UE_LOG(LogTemp, Warning, TEXT("  Scrolled through all slots in %d steps: avg %.3f ms, p95 %.3f ms per step, %d tiles built in total for %d slots"),
+        ScrollMs.Num(), Average(ScrollMs), Percentile(ScrollMs, 0.95f), SlotWidget->GetNumTilesCreated(), NumRewards);
+}
@@ -0,0 +1,714 @@
+#include "StressScenarioSubsystem.h"
+#include "Atlas/AI/AIDecisionSubsystem.h"
+#include "Atlas/AI/EnemyPoolSubsystem.h"
+#include "Atlas/Characters/EnemyCharacter.h"
+#include "Atlas/Characters/GameCharacterBase.h"
+#include "Atlas/Core/AtlasStats.h"
+#include "Atlas/Components/ActionManagerComponent.h"
+#include "Atlas/Components/HealthComponent.h"
+#include "Atlas/Hazards/ElectricalSurgeHazard.h"
+#include "Atlas/Hazards/EnvironmentalHazardComponent.h"
+#include "Atlas/Hazards/HazardWorldSubsystem.h"
+#include "Atlas/Hazards/LowGravityHazard.h"
+#include "Atlas/Hazards/ToxicLeakHazard.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameplayTagContainer.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/TraceAuxiliary.h"
+#include "UObject/UObjectIterator.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	/** How long a scenario waits for the player pawn before giving up */
+	constexpr double PlayerWaitSeconds = 30.0;
+
+	/** Nearest-rank percentile of samples already sorted ascending */
+	float SortedPercentile(const TArray<float>& Sorted, float Fraction)
+	{
+		if (Sorted.Num() == 0) return 0.0f;
+
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Index];
+	}
+
+	struct FSampleSummary
+	{
+		float Average = 0.0f;
+		float P95 = 0.0f;
+		float P99 = 0.0f;
+		float Max = 0.0f;
+	};
+
+	FSampleSummary Summarize(TArray<float> Samples)
+	{
+		FSampleSummary Summary;
+		if (Samples.Num() == 0) return Summary;
+
+		Samples.Sort();
+		double Total = 0.0;
+		for (float Sample : Samples)
+		{
+			Total += Sample;
+		}
+		Summary.Average = static_cast<float>(Total / Samples.Num());
+		Summary.P95 = SortedPercentile(Samples, 0.95f);
+		Summary.P99 = SortedPercentile(Samples, 0.99f);
+		Summary.Max = Samples.Last();
+		return Summary;
+	}
+
+	TSharedRef<FJsonObject> SummaryToJson(const FSampleSummary& Summary)
+	{
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetNumberField(TEXT("avg"), Summary.Average);
+		Json->SetNumberField(TEXT("p95"), Summary.P95);
+		Json->SetNumberField(TEXT("p99"), Summary.P99);
+		Json->SetNumberField(TEXT("max"), Summary.Max);
+		return Json;
+	}
+
+	/** A capture per process from the command line, not one per world loaded after it */
+	bool bCommandLineScenarioStarted = false;
+}
+
+FString FStressScenario::GetDefaultPath()
+{
+	return FPaths::ProjectConfigDir() / TEXT("AtlasStressScenarios.json");
+}
+
+bool FStressScenario::LoadFile(const FString& Path, TArray<FStressScenario>& OutScenarios, FString& OutError)
+{
+	FString Text;
+	if (!FFileHelper::LoadFileToString(Text, *Path))
+	{
+		OutError = FString::Printf(TEXT("Could not read %s"), *Path);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("scenarios"), Entries))
+	{
+		OutError = FString::Printf(TEXT("%s is not JSON with a 'scenarios' array"), *Path);
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& Entry : *Entries)
+	{
+		const TSharedPtr<FJsonObject>* Object = nullptr;
+		FStressScenario Scenario;
+		if (!Entry->TryGetObject(Object) || !(*Object)->TryGetStringField(TEXT("name"), Scenario.Name))
+		{
+			OutError = FString::Printf(TEXT("Scenario %d in %s has no name"), OutScenarios.Num(), *Path);
+			return false;
+		}
+
+		const FJsonObject& Json = **Object;
+		Json.TryGetStringField(TEXT("description"), Scenario.Description);
+		Json.TryGetNumberField(TEXT("warmup_seconds"), Scenario.WarmupSeconds);
+		Json.TryGetNumberField(TEXT("duration_seconds"), Scenario.DurationSeconds);
+		Json.TryGetNumberField(TEXT("enemies"), Scenario.EnemyCount);
+		Json.TryGetStringField(TEXT("enemy_class"), Scenario.EnemyClass);
+		Json.TryGetNumberField(TEXT("spawn_radius"), Scenario.SpawnRadius);
+		Json.TryGetNumberField(TEXT("player_action_interval"), Scenario.PlayerActionInterval);
+		Json.TryGetStringArrayField(TEXT("hazards"), Scenario.Hazards);
+		Json.TryGetBoolField(TEXT("activate_level_hazards"), Scenario.bActivateLevelHazards);
+		Json.TryGetBoolField(TEXT("god_mode"), Scenario.bGodMode);
+		Json.TryGetStringArrayField(TEXT("commands"), Scenario.Commands);
+		Json.TryGetNumberField(TEXT("budget_p95_ms"), Scenario.BudgetP95Ms);
+		Json.TryGetBoolField(TEXT("trace"), Scenario.bTrace);
+
+		const TSharedPtr<FJsonObject>* Actions = nullptr;
+		if (Json.TryGetObjectField(TEXT("actions"), Actions))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Action : (*Actions)->Values)
+			{
+				Scenario.Actions.Add(FName(*Action.Key), Action.Value->AsString());
+			}
+		}
+
+		Scenario.EnemyCount = FMath::Max(Scenario.EnemyCount, 0);
+		Scenario.DurationSeconds = FMath::Max(Scenario.DurationSeconds, 0.1f);
+		OutScenarios.Add(MoveTemp(Scenario));
+	}
+	return true;
+}
+
+void UStressScenarioSubsystem::Deinitialize()
+{
+	if (IsRunning())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Stress scenario %s ended with its world, nothing reported"), *Scenario.Name);
+		Cleanup();
+		Phase = EPhase::Idle;
+	}
+
+	Super::Deinitialize();
+}
+
+void UStressScenarioSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	FString ScenarioName;
+	if (bCommandLineScenarioStarted || !FParse::Value(FCommandLine::Get(), TEXT("AtlasStressScenario="), ScenarioName))
+	{
+		return;
+	}
+	bCommandLineScenarioStarted = true;
+
+	FString Path = FStressScenario::GetDefaultPath();
+	FParse::Value(FCommandLine::Get(), TEXT("AtlasStressFile="), Path);
+	const bool bExit = FParse::Param(FCommandLine::Get(), TEXT("AtlasStressExit"));
+
+	TArray<FStressScenario> Scenarios;
+	FString Error;
+	const FStressScenario* Found = nullptr;
+	if (FStressScenario::LoadFile(Path, Scenarios, Error))
+	{
+		Found = Scenarios.FindByPredicate([&ScenarioName](const FStressScenario& Candidate) { return Candidate.Name.Equals(ScenarioName, ESearchCase::IgnoreCase); });
+		Error = Found ? FString() : FString::Printf(TEXT("No scenario named %s in %s"), *ScenarioName, *Path);
+	}
+
+	if (!Found)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Stress scenario: %s"), *Error);
+		if (bExit)
+		{
+			FPlatformMisc::RequestExitWithStatus(false, 1);
+		}
+		return;
+	}
+	Start(*Found, bExit);
+}
+
+bool UStressScenarioSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UStressScenarioSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UStressScenarioSubsystem, STATGROUP_Tickables);
+}
+
+UStressScenarioSubsystem* UStressScenarioSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<UStressScenarioSubsystem>() : nullptr;
+}
+
+bool UStressScenarioSubsystem::Start(const FStressScenario& InScenario, bool bInExitWhenDone)
+{
+	if (IsRunning())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Stress scenario %s is still running"), *Scenario.Name);
+		return false;
+	}
+
+	Scenario = InScenario;
+	bExitWhenDone = bInExitWhenDone;
+	FrameTimesMs.Reset();
+	GameThreadMs.Reset();
+	ScopeMs.Reset();
+	PlayerActions = 0;
+	TracePath.Reset();
+	bTraceChannelOn = false;
+	Phase = EPhase::WaitingForPlayer;
+	PhaseStartSeconds = FPlatformTime::Seconds();
+
+	UE_LOG(LogTemp, Warning, TEXT("Stress scenario %s: %d enemies, %d hazards, %.0f s warmup, %.0f s capture"),
+		*Scenario.Name, Scenario.EnemyCount, Scenario.Hazards.Num(), Scenario.WarmupSeconds, Scenario.DurationSeconds);
+	return true;
+}
+
+void UStressScenarioSubsystem::Stop()
+{
+	if (Phase == EPhase::Capture)
+	{
+		Finish();
+	}
+	else if (IsRunning())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Stress scenario %s stopped before its capture"), *Scenario.Name);
+		Cleanup();
+		Phase = EPhase::Idle;
+	}
+}
+
+void UStressScenarioSubsystem::Tick(float DeltaTime)
+{
+	if (!IsRunning())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	switch (Phase)
+	{
+	case EPhase::WaitingForPlayer:
+		{
+			APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+			if (AGameCharacterBase* PlayerCharacter = PlayerController ? Cast<AGameCharacterBase>(PlayerController->GetPawn()) : nullptr)
+			{
+				Setup(PlayerCharacter);
+				Phase = EPhase::Warmup;
+				PhaseStartSeconds = Now;
+			}
+			else if (Now - PhaseStartSeconds > PlayerWaitSeconds)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Stress scenario %s: no player after %.0f s"), *Scenario.Name, PlayerWaitSeconds);
+				Finish();
+			}
+			return;
+		}
+	case EPhase::Warmup:
+		if (Now - PhaseStartSeconds >= Scenario.WarmupSeconds)
+		{
+			BeginCapture();
+		}
+		break;
+	case EPhase::Capture:
+		// Wall time between ticks, whatever fixed step the world itself runs at
+		FrameTimesMs.Add(static_cast<float>((Now - LastFrameSeconds) * 1000.0));
+		GameThreadMs.Add(static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime)));
+		LastFrameSeconds = Now;
+		for (int32 Scope = 0; Scope < ScopeMs.Num(); ++Scope)
+		{
+			const double ScopeSeconds = AtlasStats::GetScopeSeconds(static_cast<AtlasStats::EScope>(Scope));
+			ScopeMs[Scope].Add(static_cast<float>((ScopeSeconds - LastScopeSeconds[Scope]) * 1000.0));
+			LastScopeSeconds[Scope] = ScopeSeconds;
+		}
+		if (Now - PhaseStartSeconds >= Scenario.DurationSeconds)
+		{
+			Finish();
+			return;
+		}
+		break;
+	default:
+		break;
+	}
+
+	if (Scenario.PlayerActionInterval > 0.0f && PlayerSlots.Num() > 0 && Now >= NextPlayerActionSeconds)
+	{
+		PressNextPlayerSlot();
+		NextPlayerActionSeconds = Now + Scenario.PlayerActionInterval;
+	}
+}
+
+void UStressScenarioSubsystem::Setup(AGameCharacterBase* InPlayer)
+{
+	Player = InPlayer;
+
+	if (UHealthComponent* Health = InPlayer->GetHealthComponent())
+	{
+		bPlayerWasInvincible = Health->IsInvincible();
+		Health->SetInvincible(Scenario.bGodMode || bPlayerWasInvincible);
+	}
+
+	PlayerSlots.Reset();
+	PlayerSlotCursor = 0;
+	if (UActionManagerComponent* ActionManager = InPlayer->GetActionManagerComponent())
+	{
+		for (const TPair<FName, FString>& Action : Scenario.Actions)
+		{
+			if (ActionManager->AssignActionToSlot(Action.Key, FGameplayTag::RequestGameplayTag(FName(*Action.Value), false)))
+			{
+				PlayerSlots.Add(Action.Key);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Stress scenario %s: could not assign %s to the player's %s"), *Scenario.Name, *Action.Value, *Action.Key.ToString());
+			}
+		}
+	}
+
+	// Spawn counts below are this scenario's alone
+	if (UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this))
+	{
+		Pool->ResetStats();
+	}
+
+	SpawnEnemies();
+	ForceHazards();
+	NextPlayerActionSeconds = FPlatformTime::Seconds();
+}
+
+void UStressScenarioSubsystem::SpawnEnemies()
+{
+	AGameCharacterBase* PlayerCharacter = Player.Get();
+	if (!PlayerCharacter || Scenario.EnemyCount == 0)
+	{
+		return;
+	}
+
+	TSubclassOf<AGameCharacterBase> EnemyClass = AEnemyCharacter::StaticClass();
+	if (!Scenario.EnemyClass.IsEmpty())
+	{
+		EnemyClass = LoadClass<AGameCharacterBase>(nullptr, *Scenario.EnemyClass);
+		if (!EnemyClass)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Stress scenario %s: could not load %s"), *Scenario.Name, *Scenario.EnemyClass);
+			return;
+		}
+	}
+
+	// Evenly round the player, alternating between the inner and outer edge of the ring
+	const FVector Center = PlayerCharacter->GetActorLocation();
+	for (int32 i = 0; i < Scenario.EnemyCount; ++i)
+	{
+		const float Angle = 2.0f * PI * i / Scenario.EnemyCount;
+		const float Radius = Scenario.SpawnRadius * (i % 2 == 0 ? 1.0f : 0.5f);
+		const FVector Location = Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * Radius;
+		const FTransform SpawnTransform((Center - Location).Rotation(), Location);
+
+		AGameCharacterBase* Enemy = UEnemyPoolSubsystem::AcquireEnemy(this, EnemyClass, SpawnTransform);
+		if (!Enemy)
+		{
+			continue;
+		}
+		if (!Enemy->GetController())
+		{
+			Enemy->SpawnDefaultController();
+		}
+		if (UActionManagerComponent* ActionManager = Enemy->GetActionManagerComponent())
+		{
+			for (const TPair<FName, FString>& Action : Scenario.Actions)
+			{
+				ActionManager->AssignActionToSlot(Action.Key, FGameplayTag::RequestGameplayTag(FName(*Action.Value), false));
+			}
+		}
+		Enemies.Add(Enemy);
+	}
+}
+
+void UStressScenarioSubsystem::ForceHazards()
+{
+	UWorld* World = GetWorld();
+	AGameCharacterBase* PlayerCharacter = Player.Get();
+	if (!World || !PlayerCharacter)
+	{
+		return;
+	}
+
+	static const TMap<FString, UClass*> HazardClasses = {
+		{ TEXT("Electrical"), UElectricalSurgeHazard::StaticClass() },
+		{ TEXT("Toxic"), UToxicLeakHazard::StaticClass() },
+		{ TEXT("LowGravity"), ULowGravityHazard::StaticClass() },
+	};
+
+	// Halfway out to the enemies, so they cross the hazards on their way in
+	const FVector Center = PlayerCharacter->GetActorLocation();
+	for (int32 i = 0; i < Scenario.Hazards.Num(); ++i)
+	{
+		UClass* const* HazardClass = HazardClasses.Find(Scenario.Hazards[i]);
+		if (!HazardClass)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Stress scenario %s: unknown hazard %s"), *Scenario.Name, *Scenario.Hazards[i]);
+			continue;
+		}
+
+		const float Angle = 2.0f * PI * (i + 0.5f) / Scenario.Hazards.Num();
+		const FVector Location = Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * Scenario.SpawnRadius * 0.5f;
+		AActor* Holder = World->SpawnActor<AActor>(AActor::StaticClass(), Location, FRotator::ZeroRotator);
+		if (!Holder)
+		{
+			continue;
+		}
+
+		UEnvironmentalHazardComponent* Hazard = NewObject<UEnvironmentalHazardComponent>(Holder, *HazardClass);
+		Hazard->bPermanent = true;
+		Hazard->bShowWarningIndicator = false;
+		Hazard->ActivationDelay = 0.0f;
+		Holder->SetRootComponent(Hazard);
+		Hazard->SetWorldLocation(Location);
+		Holder->RegisterAllComponents();
+		Hazard->ActivateHazard();
+		HazardHolders.Add(Holder);
+	}
+
+	if (Scenario.bActivateLevelHazards)
+	{
+		for (TObjectIterator<UEnvironmentalHazardComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && It->IsRegistered() && !It->IsHazardActive() && !HazardHolders.Contains(It->GetOwner()))
+			{
+				It->ActivateHazard();
+				LevelHazards.Add(*It);
+			}
+		}
+	}
+}
+
+void UStressScenarioSubsystem::BeginCapture()
+{
+	for (const FString& Command : Scenario.Commands)
+	{
+		GEngine->Exec(GetWorld(), *Command);
+	}
+
+	if (UAIDecisionSubsystem* Decisions = UAIDecisionSubsystem::Get(this))
+	{
+		Decisions->ResetStats();
+	}
+
+	if (Scenario.bTrace)
+	{
+		StartTrace();
+	}
+
+	FrameTimesMs.Reserve(FMath::CeilToInt(Scenario.DurationSeconds * 240.0f));
+	GameThreadMs.Reserve(FrameTimesMs.Max());
+
+	const int32 NumScopes = static_cast<int32>(AtlasStats::EScope::Num);
+	ScopeMs.SetNum(NumScopes);
+	LastScopeSeconds.SetNum(NumScopes);
+	for (int32 Scope = 0; Scope < NumScopes; ++Scope)
+	{
+		ScopeMs[Scope].Reset(FrameTimesMs.Max());
+		LastScopeSeconds[Scope] = AtlasStats::GetScopeSeconds(static_cast<AtlasStats::EScope>(Scope));
+	}
+	Phase = EPhase::Capture;
+	PhaseStartSeconds = FPlatformTime::Seconds();
+	LastFrameSeconds = PhaseStartSeconds;
+}
+
+void UStressScenarioSubsystem::PressNextPlayerSlot()
+{
+	AGameCharacterBase* PlayerCharacter = Player.Get();
+	UActionManagerComponent* ActionManager = PlayerCharacter ? PlayerCharacter->GetActionManagerComponent() : nullptr;
+	if (!ActionManager)
+	{
+		return;
+	}
+
+	const FName SlotName = PlayerSlots[PlayerSlotCursor++ % PlayerSlots.Num()];
+	ActionManager->OnSlotPressed(SlotName);
+	ActionManager->OnSlotReleased(SlotName);
+	++PlayerActions;
+}
+
+void UStressScenarioSubsystem::Finish()
+{
+	Phase = EPhase::Idle;
+	const bool bPassed = Report();
+	Cleanup();
+
+	if (bExitWhenDone)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+	}
+}
+
+void UStressScenarioSubsystem::StartTrace()
+{
+	TracePath.Reset();
+	if (FTraceAuxiliary::IsConnected())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Stress scenario %s: a trace is already running, recording into it"), *Scenario.Name);
+	}
+	else
+	{
+		TracePath = FPaths::ConvertRelativePathToFull(FPaths::ProfilingDir() / TEXT("AtlasStress") / FString::Printf(TEXT("%s-%s.utrace"), *Scenario.Name, *FDateTime::Now().ToString()));
+		bTraceStarted = FTraceAuxiliary::Start(FTraceAuxiliary::EConnectionType::File, *TracePath, TEXT("cpu,counters,stats,Atlas"));
+	}
+
+	AtlasStats::SetTraceChannelEnabled(true);
+	bTraceChannelOn = AtlasStats::IsTraceChannelEnabled();
+}
+
+void UStressScenarioSubsystem::StopTrace()
+{
+	if (bTraceStarted)
+	{
+		FTraceAuxiliary::Stop();
+		bTraceStarted = false;
+	}
+}
+
+bool UStressScenarioSubsystem::Report()
+{
+	StopTrace();
+
+	const FSampleSummary Frames = Summarize(FrameTimesMs);
+	const FSampleSummary GameThread = Summarize(GameThreadMs);
+	const bool bCaptured = FrameTimesMs.Num() > 0;
+	const bool bWithinBudget = Scenario.BudgetP95Ms <= 0.0f || Frames.P95 <= Scenario.BudgetP95Ms;
+
+	// Only that the capture was recorded, Atlas.Trace.CaptureHasAtlasCountersAndScopes checks what is in a trace.
+	// Into a trace someone else started there is no file of ours to check, only the channel
+	const int64 TraceBytes = TracePath.IsEmpty() ? 0 : IFileManager::Get().FileSize(*TracePath);
+	const bool bTraced = !Scenario.bTrace || (bTraceChannelOn && (TracePath.IsEmpty() || TraceBytes > 0));
+	const bool bPassed = bCaptured && bWithinBudget && bTraced;
+
+	int32 EnemiesAlive = 0;
+	for (const TWeakObjectPtr<AGameCharacterBase>& Enemy : Enemies)
+	{
+		const UHealthComponent* Health = Enemy.IsValid() ? Enemy->GetHealthComponent() : nullptr;
+		EnemiesAlive += Health && !Health->IsDead() ? 1 : 0;
+	}
+	int32 HazardsActive = 0;
+	for (const TWeakObjectPtr<AActor>& Holder : HazardHolders)
+	{
+		const UEnvironmentalHazardComponent* Hazard = Holder.IsValid() ? Holder->FindComponentByClass<UEnvironmentalHazardComponent>() : nullptr;
+		HazardsActive += Hazard && Hazard->IsHazardActive() ? 1 : 0;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("=== STRESS SCENARIO %s (%d frames over %.1f s) ==="), *Scenario.Name, FrameTimesMs.Num(), Scenario.DurationSeconds);
+	UE_LOG(LogTemp, Warning, TEXT("  Frame:       avg %.2f ms, p95 %.2f ms, p99 %.2f ms, max %.2f ms (%.1f fps)"),
+		Frames.Average, Frames.P95, Frames.P99, Frames.Max, Frames.Average > 0.0f ? 1000.0f / Frames.Average : 0.0f);
+	UE_LOG(LogTemp, Warning, TEXT("  Game thread: avg %.2f ms, p95 %.2f ms, p99 %.2f ms, max %.2f ms"),
+		GameThread.Average, GameThread.P95, GameThread.P99, GameThread.Max);
+
+	// Game thread time per frame in each instrumented subsystem, scopes never entered left out of the log
+	TSharedRef<FJsonObject> SubsystemMs = MakeShared<FJsonObject>();
+	UE_LOG(LogTemp, Warning, TEXT("  Subsystems, game thread ms per frame:"));
+	for (int32 Scope = 0; Scope < ScopeMs.Num(); ++Scope)
+	{
+		const TCHAR* ScopeName = AtlasStats::GetScopeName(static_cast<AtlasStats::EScope>(Scope));
+		const FSampleSummary Summary = Summarize(ScopeMs[Scope]);
+		SubsystemMs->SetObjectField(ScopeName, SummaryToJson(Summary));
+		if (Summary.Max > 0.0f)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("    %-28s avg %.3f, p95 %.3f, p99 %.3f, max %.3f"), ScopeName, Summary.Average, Summary.P95, Summary.P99, Summary.Max);
+		}
+	}
+
+	TSharedRef<FJsonObject> Subsystems = MakeShared<FJsonObject>();
+
+	if (const UAIDecisionSubsystem* Decisions = UAIDecisionSubsystem::Get(this))
+	{
+		const FAIDecisionStats& Stats = Decisions->GetStats();
+		const FSampleSummary Scheduler = Summarize(Stats.FrameTimesMs);
+		UE_LOG(LogTemp, Warning, TEXT("  AI decisions: %d controllers, %d thinks, scheduler avg %.3f ms, p95 %.3f ms, p99 %.3f ms per frame, %d frames over budget"),
+			Decisions->GetNumControllers(), Stats.TotalThinks, Scheduler.Average, Scheduler.P95, Scheduler.P99, Stats.FramesOverBudget);
+
+		TSharedRef<FJsonObject> Json = SummaryToJson(Scheduler);
+		Json->SetNumberField(TEXT("controllers"), Decisions->GetNumControllers());
+		Json->SetNumberField(TEXT("thinks"), Stats.TotalThinks);
+		Json->SetNumberField(TEXT("frames_over_budget"), Stats.FramesOverBudget);
+		Subsystems->SetObjectField(TEXT("ai_decisions"), Json);
+	}
+
+	if (const UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(this))
+	{
+		const FEnemyPoolStats& Stats = Pool->GetStats();
+		UE_LOG(LogTemp, Warning, TEXT("  Enemies:     %d spawned for the scenario, %d alive at the end (pool: %d reused, %d spawned)"),
+			Enemies.Num(), EnemiesAlive, Stats.Reused, Stats.Spawned);
+
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetNumberField(TEXT("enemies"), Enemies.Num());
+		Json->SetNumberField(TEXT("alive"), EnemiesAlive);
+		Json->SetNumberField(TEXT("reused"), Stats.Reused);
+		Json->SetNumberField(TEXT("spawned"), Stats.Spawned);
+		Subsystems->SetObjectField(TEXT("enemy_pool"), Json);
+	}
+
+	if (const UHazardWorldSubsystem* Hazards = UHazardWorldSubsystem::Get(this))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  Hazards:     %d of %d spawned active, %d level hazards forced on, %d stuns active"),
+			HazardsActive, HazardHolders.Num(), LevelHazards.Num(), Hazards->GetActiveStunCount());
+
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetNumberField(TEXT("spawned"), HazardHolders.Num());
+		Json->SetNumberField(TEXT("active"), HazardsActive);
+		Json->SetNumberField(TEXT("level"), LevelHazards.Num());
+		Json->SetNumberField(TEXT("stuns"), Hazards->GetActiveStunCount());
+		Subsystems->SetObjectField(TEXT("hazards"), Json);
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("  Player:      %d slot presses over %d slots"), PlayerActions, PlayerSlots.Num());
+	if (Scenario.BudgetP95Ms > 0.0f)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  Budget:      p95 %.2f ms of %.2f ms"), Frames.P95, Scenario.BudgetP95Ms);
+	}
+	if (Scenario.bTrace)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  Trace:       %s, %lld KB, Atlas channel %s"),
+			TracePath.IsEmpty() ? TEXT("(already running)") : *TracePath, TraceBytes / 1024, bTraceChannelOn ? TEXT("on") : TEXT("unavailable"));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("scenario"), Scenario.Name);
+	Root->SetStringField(TEXT("date"), FDateTime::UtcNow().ToIso8601());
+	Root->SetNumberField(TEXT("frames"), FrameTimesMs.Num());
+	Root->SetObjectField(TEXT("frame_ms"), SummaryToJson(Frames));
+	Root->SetObjectField(TEXT("game_thread_ms"), SummaryToJson(GameThread));
+	Root->SetObjectField(TEXT("subsystem_ms"), SubsystemMs);
+	Root->SetObjectField(TEXT("subsystems"), Subsystems);
+	Root->SetNumberField(TEXT("player_actions"), PlayerActions);
+	Root->SetNumberField(TEXT("budget_p95_ms"), Scenario.BudgetP95Ms);
+	if (!TracePath.IsEmpty())
+	{
+		Root->SetStringField(TEXT("trace"), TracePath);
+	}
+	Root->SetBoolField(TEXT("passed"), bPassed);
+
+	FString Output;
+	FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Output));
+	const FString ResultPath = FPaths::ProfilingDir() / TEXT("AtlasStress") / FString::Printf(TEXT("%s-%s.json"), *Scenario.Name, *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Output, *ResultPath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  Written to %s"), *FPaths::ConvertRelativePathToFull(ResultPath));
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("  %s"), bPassed ? TEXT("PASSED") : TEXT("FAILED"));
+	return bPassed;
+}
+
+void UStressScenarioSubsystem::Cleanup()
+{
+	StopTrace();
+
+	for (const TWeakObjectPtr<AGameCharacterBase>& Enemy : Enemies)
+	{
+		if (Enemy.IsValid())
+		{
+			UEnemyPoolSubsystem::ReleaseEnemy(Enemy.Get());
+		}
+	}
+	for (const TWeakObjectPtr<AActor>& Holder : HazardHolders)
+	{
+		if (Holder.IsValid())
+		{
+			Holder->Destroy();
+		}
+	}
+	for (const TWeakObjectPtr<UEnvironmentalHazardComponent>& Hazard : LevelHazards)
+	{
+		if (Hazard.IsValid())
+		{
+			Hazard->DeactivateHazard();
+		}
+	}
+
+	if (AGameCharacterBase* PlayerCharacter = Player.Get())
+	{
+		if (UHealthComponent* Health = PlayerCharacter->GetHealthComponent())
+		{
+			Health->SetInvincible(bPlayerWasInvincible);
+		}
+	}
+
+	Enemies.Reset();
+	HazardHolders.Reset();
+	LevelHazards.Reset();
+	PlayerSlots.Reset();
+	Player.Reset();
+}
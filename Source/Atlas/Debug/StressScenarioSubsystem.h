@@ -0,0 +1,149 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StressScenarioSubsystem.generated.h"
+
+class AGameCharacterBase;
+class UEnvironmentalHazardComponent;
+
+/**
+ * One scripted combat stress scenario, as read from Config/AtlasStressScenarios.json
+ */
+struct ATLAS_API FStressScenario
+{
+	FString Name;
+	FString Description;
+
+	/** Seconds run after setup and before the capture, so spawn and activation hitches stay out of it */
+	float WarmupSeconds = 3.0f;
+	float DurationSeconds = 20.0f;
+
+	int32 EnemyCount = 0;
+
+	/** Class path, AEnemyCharacter when empty */
+	FString EnemyClass;
+
+	/** Enemies are spread over a ring around the player between half this and this */
+	float SpawnRadius = 1500.0f;
+
+	/** Slot name to action tag, assigned to the player and to every spawned enemy */
+	TMap<FName, FString> Actions;
+
+	/** Seconds between player slot presses, cycling through the assigned slots. 0 leaves the player idle */
+	float PlayerActionInterval = 0.0f;
+
+	/** Hazards spawned permanently active around the player: Electrical, Toxic or LowGravity */
+	TArray<FString> Hazards;
+
+	/** Also switch on every hazard already placed in the level */
+	bool bActivateLevelHazards = false;
+
+	bool bGodMode = true;
+
+	/** Console commands run when the capture starts */
+	TArray<FString> Commands;
+
+	/** A p95 frame time above this fails the scenario, 0 for no budget */
+	float BudgetP95Ms = 0.0f;
+
+	/** Record the capture to a trace file with the Atlas channel on, for Insights. Fails only if no file is written */
+	bool bTrace = false;
+
+	static FString GetDefaultPath();
+
+	/** Every scenario in the file, false with OutError set if it cannot be read */
+	static bool LoadFile(const FString& Path, TArray<FStressScenario>& OutScenarios, FString& OutError);
+};
+
+/**
+ * Runs one stress scenario as a timed capture in the game world.
+ *
+ * Waits for the player, spawns the enemies through the enemy pool, assigns actions, forces the
+ * hazards on and warms up, then records every frame for the scenario's duration and reports
+ * average, p95 and p99 frame and game thread times with a per-subsystem breakdown, to the log
+ * and to Saved/Profiling/AtlasStress. The breakdown's milliseconds come from the AtlasStats
+ * scopes, so they are there in builds without stats too. Everything it spawned is released or destroyed afterwards.
+ *
+ * Started from Atlas.Stress.Run, or headless from the command line for build machines, for
+ * example: Atlas -game -nullrhi -AtlasStressScenario=Swarm -AtlasStressExit. With
+ * -AtlasStressExit the process exits when the capture ends, with code 1 if a budget was missed.
+ */
+UCLASS()
+class ATLAS_API UStressScenarioSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UStressScenarioSubsystem* Get(const UObject* WorldContextObject);
+
+	/** False if a scenario is already running */
+	bool Start(const FStressScenario& InScenario, bool bInExitWhenDone = false);
+
+	/** End the capture early, still reporting the frames recorded so far */
+	void Stop();
+
+	bool IsRunning() const { return Phase != EPhase::Idle; }
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		WaitingForPlayer,
+		Warmup,
+		Capture
+	};
+
+	void Setup(AGameCharacterBase* InPlayer);
+	void SpawnEnemies();
+	void ForceHazards();
+	void BeginCapture();
+	void PressNextPlayerSlot();
+	void Finish();
+
+	/** Start a file trace for the capture, or switch the Atlas channel on in one already running */
+	void StartTrace();
+	void StopTrace();
+
+	/** Log the capture and write it to Saved/Profiling, false if a budget was missed */
+	bool Report();
+
+	void Cleanup();
+
+	FStressScenario Scenario;
+	EPhase Phase = EPhase::Idle;
+	double PhaseStartSeconds = 0.0;
+	double LastFrameSeconds = 0.0;
+	bool bExitWhenDone = false;
+
+	TArray<float> FrameTimesMs;
+	TArray<float> GameThreadMs;
+
+	/** Per AtlasStats scope, game thread milliseconds spent in it each captured frame */
+	TArray<TArray<float>> ScopeMs;
+	TArray<double> LastScopeSeconds;
+
+	FString TracePath;
+	bool bTraceStarted = false;
+	bool bTraceChannelOn = false;
+
+	TWeakObjectPtr<AGameCharacterBase> Player;
+	TArray<TWeakObjectPtr<AGameCharacterBase>> Enemies;
+	TArray<TWeakObjectPtr<AActor>> HazardHolders;
+	TArray<TWeakObjectPtr<UEnvironmentalHazardComponent>> LevelHazards;
+
+	TArray<FName> PlayerSlots;
+	int32 PlayerSlotCursor = 0;
+	double NextPlayerActionSeconds = 0.0;
+	int32 PlayerActions = 0;
+	bool bPlayerWasInvincible = false;
+};
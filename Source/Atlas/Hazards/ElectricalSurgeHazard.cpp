@@ -1,5 +1,6 @@
 // ElectricalSurgeHazard.cpp
 #include "ElectricalSurgeHazard.h"
+#include "HazardWorldSubsystem.h"
 #include "../Characters/GameCharacterBase.h"
 #include "../Components/ActionManagerComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -10,9 +11,7 @@
 #include "DrawDebugHelpers.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/EngineTypes.h"
-#include "Engine/OverlapResult.h"
 #include "../Interfaces/IHealthInterface.h"
-#include "Engine/DamageEvents.h"
 
 // Custom damage type for electrical damage
 
@@ -41,21 +40,14 @@ void UElectricalSurgeHazard::ApplyHazardEffect(AActor* Actor, float DeltaTime)
     if (AGameCharacterBase* Character = Cast<AGameCharacterBase>(Actor))
     {
         // Apply stun through the action manager
-        if (UActionManagerComponent* ActionManager = Character->FindComponentByClass<UActionManagerComponent>())
+        if (Character->FindComponentByClass<UActionManagerComponent>())
         {
             // Stun logic would be implemented through the action system
-            // For now, we'll use a simple movement disable
-            Character->GetCharacterMovement()->DisableMovement();
-            
-            // Re-enable after stun duration
-            FTimerHandle StunTimer;
-            GetWorld()->GetTimerManager().SetTimer(StunTimer, [Character]()
+            // For now, movement is disabled and the hazard subsystem restores it on expiry
+            if (UHazardWorldSubsystem* HazardSubsystem = UHazardWorldSubsystem::Get(this))
             {
-                if (IsValid(Character))
-                {
-                    Character->GetCharacterMovement()->SetMovementMode(MOVE_Walking);
-                }
-            }, StunDuration, false);
+                HazardSubsystem->ApplyStun(Character, StunDuration);
+            }
         }
     }
     
@@ -95,91 +87,123 @@ void UElectricalSurgeHazard::ChainElectricity(AActor* Source)
 {
     if (!Source) return;
     
+    UHazardWorldSubsystem* HazardSubsystem = UHazardWorldSubsystem::Get(this);
+    if (!HazardSubsystem) return;
+    
     // Clear previous chain list
-    ChainedActors.Empty();
+    ChainedActors.Reset();
     ChainedActors.Add(Source);
     
-    // Find nearby targets to chain to
-    TArray<FOverlapResult> Overlaps;
-    FCollisionShape SphereShape = FCollisionShape::MakeSphere(ChainRadius);
+    // Gather everything the chain could reach in MaxChainTargets jumps from the shared spatial hash
+    TArray<AActor*> Candidates;
+    const float MaxReach = ChainRadius * FMath::Max(MaxChainTargets, 1);
+    HazardSubsystem->QueryDamageableActors(Source->GetActorLocation(), MaxReach, Candidates);
+    
+    Candidates.RemoveAllSwap([this, Source](AActor* Candidate)
+    {
+        return Candidate == Source || !ShouldAffectActor(Candidate);
+    });
     
-    GetWorld()->OverlapMultiByChannel(
-        Overlaps,
-        Source->GetActorLocation(),
-        FQuat::Identity,
-        ECC_Pawn,
-        SphereShape
-    );
+    if (Candidates.Num() == 0) return;
     
-    int32 ChainCount = 0;
-    for (const FOverlapResult& Overlap : Overlaps)
+    TArray<FVector> CandidateLocations;
+    CandidateLocations.Reserve(Candidates.Num());
+    for (AActor* Candidate : Candidates)
     {
-        AActor* Target = Overlap.GetActor();
-        
-        // Skip if it's the source, already chained, or not a valid target
-        if (!Target || Target == Source || ChainedActors.Contains(Target) || !ShouldAffectActor(Target))
+        CandidateLocations.Add(Candidate->GetActorLocation());
+    }
+    
+    // Line of sight goes through the subsystem's per-frame cache
+    TArray<int32> ChainOrder;
+    BuildChainOrder(Source->GetActorLocation(), CandidateLocations, ChainRadius, MaxChainTargets,
+        [HazardSubsystem, Source, &Candidates](int32 FromIndex, int32 ToIndex)
         {
-            continue;
-        }
+            AActor* From = FromIndex == INDEX_NONE ? Source : Candidates[FromIndex];
+            return HazardSubsystem->HasLineOfSight(From, Candidates[ToIndex]);
+        },
+        ChainOrder);
+    
+    const float ChainDamage = DamagePerSecond * ChainDamageMultiplier;
+    AActor* PreviousLink = Source;
+    
+    for (int32 CandidateIndex : ChainOrder)
+    {
+        AActor* Target = Candidates[CandidateIndex];
         
-        // Check line of sight
-        FHitResult LineTraceHit;
-        FCollisionQueryParams QueryParams;
-        QueryParams.AddIgnoredActor(Source);
-        QueryParams.AddIgnoredActor(Target);
+        // Spawn chain lightning effect
+        SpawnElectricalArc(PreviousLink->GetActorLocation(), Target->GetActorLocation());
         
-        bool bHasLineOfSight = !GetWorld()->LineTraceSingleByChannel(
-            LineTraceHit,
-            Source->GetActorLocation(),
-            Target->GetActorLocation(),
-            ECC_Visibility,
-            QueryParams
-        );
+        // Apply reduced damage to chained target, candidates all implement the health interface
+        IHealthInterface::Execute_ApplyDamage(Target, ChainDamage, GetOwner());
         
-        if (bHasLineOfSight)
+        // Add to chained list
+        ChainedActors.Add(Target);
+        
+        // Fire chain event
+        OnElectricityChained(PreviousLink, Target, ChainDamage);
+        
+        // Half stun duration for chained targets
+        if (AGameCharacterBase* Character = Cast<AGameCharacterBase>(Target))
         {
-            // Spawn chain lightning effect
-            SpawnElectricalArc(Source->GetActorLocation(), Target->GetActorLocation());
-            
-            // Apply reduced damage to chained target
-            float ChainDamage = DamagePerSecond * ChainDamageMultiplier;
-            // Apply damage to chained target
-            if (Target->GetClass()->ImplementsInterface(UHealthInterface::StaticClass()))
-            {
-                IHealthInterface::Execute_ApplyDamage(Target, ChainDamage, GetOwner());
-            }
-            else
-            {
-                Target->TakeDamage(ChainDamage, FDamageEvent(UDamageType::StaticClass()), nullptr, GetOwner());
-            }
-            
-            // Add to chained list
-            ChainedActors.Add(Target);
-            
-            // Fire chain event
-            OnElectricityChained(Source, Target, ChainDamage);
+            HazardSubsystem->ApplyStun(Character, StunDuration * 0.5f);
+        }
+        
+        PreviousLink = Target;
+    }
+}
+
+void UElectricalSurgeHazard::BuildChainOrder(const FVector& SourceLocation, const TArray<FVector>& CandidateLocations,
+    float InChainRadius, int32 MaxJumps, TFunctionRef<bool(int32, int32)> HasLineOfSight, TArray<int32>& OutChain)
+{
+    OutChain.Reset();
+    
+    if (MaxJumps <= 0 || CandidateLocations.Num() == 0) return;
+    
+    const float RadiusSq = FMath::Square(InChainRadius);
+    TBitArray<> Chained(false, CandidateLocations.Num());
+    
+    // (DistSq, Index) pairs within reach of the current link
+    TArray<TPair<float, int32>, TInlineAllocator<16>> InReach;
+    
+    int32 CurrentIndex = INDEX_NONE;
+    FVector CurrentLocation = SourceLocation;
+    
+    while (OutChain.Num() < MaxJumps)
+    {
+        InReach.Reset();
+        for (int32 i = 0; i < CandidateLocations.Num(); ++i)
+        {
+            if (Chained[i]) continue;
             
-            // Apply brief stun to chained target
-            if (AGameCharacterBase* Character = Cast<AGameCharacterBase>(Target))
+            const float DistSq = FVector::DistSquared(CurrentLocation, CandidateLocations[i]);
+            if (DistSq <= RadiusSq)
             {
-                Character->GetCharacterMovement()->DisableMovement();
-                
-                FTimerHandle StunTimer;
-                GetWorld()->GetTimerManager().SetTimer(StunTimer, [Character]()
-                {
-                    if (IsValid(Character))
-                    {
-                        Character->GetCharacterMovement()->SetMovementMode(MOVE_Walking);
-                    }
-                }, StunDuration * 0.5f, false); // Half stun duration for chained targets
+                InReach.Emplace(DistSq, i);
             }
-            
-            ChainCount++;
-            if (ChainCount >= MaxChainTargets)
+        }
+        
+        // Nearest first, index breaks ties so the order is deterministic
+        InReach.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B)
+        {
+            return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value);
+        });
+        
+        int32 NextIndex = INDEX_NONE;
+        for (const TPair<float, int32>& Entry : InReach)
+        {
+            if (HasLineOfSight(CurrentIndex, Entry.Value))
             {
+                NextIndex = Entry.Value;
                 break;
             }
         }
+        
+        if (NextIndex == INDEX_NONE) break;
+        
+        Chained[NextIndex] = true;
+        OutChain.Add(NextIndex);
+        CurrentIndex = NextIndex;
+        CurrentLocation = CandidateLocations[NextIndex];
     }
 }
 
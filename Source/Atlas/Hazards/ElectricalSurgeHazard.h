@@ -37,6 +37,15 @@ public:
     
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Electrical|Effects")
     TSubclassOf<UCameraShakeBase> ElectricalShake;
+    
+    /**
+     * Greedy nearest-neighbour chain. Starting at SourceLocation, each jump goes to the closest
+     * unvisited candidate within ChainRadius of the previous link that passes HasLineOfSight.
+     * HasLineOfSight receives (FromIndex, ToIndex) where FromIndex is INDEX_NONE for the source.
+     * OutChain holds candidate indices in jump order, at most MaxJumps long.
+     */
+    static void BuildChainOrder(const FVector& SourceLocation, const TArray<FVector>& CandidateLocations,
+        float InChainRadius, int32 MaxJumps, TFunctionRef<bool(int32, int32)> HasLineOfSight, TArray<int32>& OutChain);
 
 protected:
     virtual void ApplyHazardEffect(AActor* Actor, float DeltaTime) override;
@@ -52,6 +61,6 @@ protected:
     void OnElectricityChained(AActor* Source, AActor* Target, float Damage);
 
 private:
-    TArray<AActor*> ChainedActors;
+    TSet<AActor*> ChainedActors;
     float LastChainTime;
 };
\ No newline at end of file
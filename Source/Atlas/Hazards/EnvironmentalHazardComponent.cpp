@@ -3,6 +3,7 @@
 #include "../Components/StationIntegrityComponent.h"
 #include "../Characters/GameCharacterBase.h"
 #include "../Interfaces/IHealthInterface.h"
+#include "../Core/AtlasStats.h"
 #include "Engine/DamageEvents.h"
 #include "Components/SphereComponent.h"
 #include "Components/DecalComponent.h"
@@ -72,6 +73,8 @@ void UEnvironmentalHazardComponent::TickComponent(float DeltaTime, ELevelTick Ti
     
     if (!bIsActive) return;
     
+    ATLAS_SCOPE_CYCLE_COUNTER(HazardTick, "Atlas.Hazard.Tick");
+    
     // Update duration
     if (!bPermanent)
     {
@@ -147,6 +150,7 @@ void UEnvironmentalHazardComponent::StartHazard()
 {
     bIsActive = true;
     CurrentDuration = 0.0f;
+    AtlasStats::AddActiveHazards(1);
     SetComponentTickEnabled(true);
     
     // Spawn effects
@@ -172,6 +176,7 @@ void UEnvironmentalHazardComponent::DeactivateHazard()
     
     bIsActive = false;
     SetComponentTickEnabled(false);
+    AtlasStats::AddActiveHazards(-1);
     
     // Clear timers
     GetWorld()->GetTimerManager().ClearTimer(DeactivationTimerHandle);
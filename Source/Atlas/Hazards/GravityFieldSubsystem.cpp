@@ -0,0 +1,253 @@
+// GravityFieldSubsystem.cpp
+#include "GravityFieldSubsystem.h"
+#include "../Core/AtlasStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGravityFieldTimeSlices(
+    TEXT("Atlas.GravityField.TimeSlices"),
+    4,
+    TEXT("Number of frames the gravity field bob is spread over. Each body gets its bob once per cycle, scaled gravity every frame."),
+    ECVF_Default
+);
+
+void UGravityFieldSubsystem::Deinitialize()
+{
+    for (FFieldBody& Entry : Bodies)
+    {
+        RestoreBody(Entry);
+    }
+
+    Bodies.Empty();
+    BodyIndices.Empty();
+    Fields.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UGravityFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGravityFieldSubsystem::Tick(float DeltaTime)
+{
+    NumImpulsesLastTick = 0;
+    NumBobbedLastTick = 0;
+    if (Bodies.Num() == 0) return;
+
+    ATLAS_SCOPE_CYCLE_COUNTER(GravityField, "Atlas.GravityField.Tick");
+
+    // Each removal swaps the last body in, which has already been checked
+    for (int32 i = Bodies.Num() - 1; i >= 0; --i)
+    {
+        UPrimitiveComponent* Body = Bodies[i].Body.Get();
+        if (!IsValid(Body) || !Body->IsSimulatingPhysics())
+        {
+            RemoveBodyAt(i);
+        }
+    }
+    if (Bodies.Num() == 0) return;
+
+    UWorld* World = GetWorld();
+    const double Now = World->GetTimeSeconds();
+    const float GravityZ = World->GetGravityZ();
+
+    const int32 NumSlices = FMath::Max(CVarGravityFieldTimeSlices.GetValueOnGameThread(), 1);
+    const int32 BodiesThisFrame = FMath::DivideAndRoundUp(Bodies.Num(), NumSlices);
+    if (SliceCursor >= Bodies.Num())
+    {
+        SliceCursor = 0;
+    }
+    const int32 SliceEnd = SliceCursor + BodiesThisFrame;
+
+    for (int32 i = 0; i < Bodies.Num(); ++i)
+    {
+        FFieldBody& Entry = Bodies[i];
+
+        // Scaled gravity every frame, so bodies fall smoothly
+        float VelocityChange = GravityZ * Entry.GravityScale * DeltaTime;
+
+        // The bob only for this frame's slice, integrated over everything since its last visit
+        const bool bInSlice = (i >= SliceCursor && i < SliceEnd) || i < SliceEnd - Bodies.Num();
+        if (bInSlice)
+        {
+            const float Elapsed = static_cast<float>(Now - Entry.LastUpdateTime);
+            Entry.LastUpdateTime = Now;
+
+            const float Bob = FMath::Sin(static_cast<float>(Now) * 2.0f + Entry.BobPhase) * Entry.BobAcceleration;
+            VelocityChange += Bob * Elapsed;
+            ++NumBobbedLastTick;
+        }
+
+        if (VelocityChange != 0.0f)
+        {
+            Entry.Body->AddImpulse(FVector(0.0f, 0.0f, VelocityChange), NAME_None, true);
+            ++NumImpulsesLastTick;
+        }
+    }
+
+    SliceCursor = SliceEnd % Bodies.Num();
+}
+
+TStatId UGravityFieldSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UGravityFieldSubsystem, STATGROUP_Tickables);
+}
+
+UGravityFieldSubsystem* UGravityFieldSubsystem::Get(const UObject* WorldContextObject)
+{
+    if (!WorldContextObject)
+    {
+        return nullptr;
+    }
+
+    UWorld* World = WorldContextObject->GetWorld();
+    return World ? World->GetSubsystem<UGravityFieldSubsystem>() : nullptr;
+}
+
+void UGravityFieldSubsystem::RegisterField(const UObject* Field, const FGravityFieldSettings& Settings)
+{
+    if (!Field) return;
+
+    Fields.Add(Field, Settings);
+
+    // Settings may have changed for bodies already inside
+    for (FFieldBody& Entry : Bodies)
+    {
+        if (Entry.Fields.Contains(Field))
+        {
+            ApplyCombinedSettings(Entry);
+        }
+    }
+}
+
+void UGravityFieldSubsystem::UnregisterField(const UObject* Field)
+{
+    if (!Field || !Fields.Remove(Field)) return;
+
+    const TObjectKey<UObject> FieldKey(Field);
+    for (int32 i = Bodies.Num() - 1; i >= 0; --i)
+    {
+        FFieldBody& Entry = Bodies[i];
+        if (Entry.Fields.Remove(FieldKey) == 0) continue;
+
+        if (Entry.Fields.Num() == 0)
+        {
+            RemoveBodyAt(i);
+        }
+        else
+        {
+            ApplyCombinedSettings(Entry);
+        }
+    }
+}
+
+void UGravityFieldSubsystem::EnterField(const UObject* Field, UPrimitiveComponent* Body)
+{
+    if (!Field || !IsValid(Body) || !Fields.Contains(Field)) return;
+
+    if (const int32* ExistingIndex = BodyIndices.Find(Body))
+    {
+        // Already floating in another field, just stack this one on top
+        FFieldBody& Entry = Bodies[*ExistingIndex];
+        Entry.Fields.AddUnique(Field);
+        ApplyCombinedSettings(Entry);
+        return;
+    }
+
+    const int32 NewIndex = Bodies.AddDefaulted();
+    FFieldBody& Entry = Bodies[NewIndex];
+    Entry.Body = Body;
+    Entry.BodyKey = Body;
+    Entry.Fields.Add(Field);
+    Entry.bOriginalGravityEnabled = Body->IsGravityEnabled();
+    Entry.OriginalLinearDamping = Body->GetLinearDamping();
+    Entry.OriginalAngularDamping = Body->GetAngularDamping();
+    Entry.BobPhase = static_cast<float>(NewIndex);
+    Entry.LastUpdateTime = GetWorld()->GetTimeSeconds();
+
+    BodyIndices.Add(Entry.BodyKey, NewIndex);
+
+    // Engine gravity is replaced by the scaled gravity from the per-frame pass
+    Body->SetEnableGravity(false);
+    ApplyCombinedSettings(Entry);
+}
+
+void UGravityFieldSubsystem::ExitField(const UObject* Field, UPrimitiveComponent* Body)
+{
+    if (!Field || !Body) return;
+
+    const int32* Index = BodyIndices.Find(Body);
+    if (!Index) return;
+
+    const int32 BodyIndex = *Index;
+    FFieldBody& Entry = Bodies[BodyIndex];
+    Entry.Fields.Remove(Field);
+
+    if (Entry.Fields.Num() == 0)
+    {
+        RemoveBodyAt(BodyIndex);
+    }
+    else
+    {
+        ApplyCombinedSettings(Entry);
+    }
+}
+
+bool UGravityFieldSubsystem::IsBodyInField(const UPrimitiveComponent* Body) const
+{
+    return Body && BodyIndices.Contains(Body);
+}
+
+void UGravityFieldSubsystem::ApplyCombinedSettings(FFieldBody& Entry)
+{
+    UPrimitiveComponent* Body = Entry.Body.Get();
+    if (!IsValid(Body)) return;
+
+    float GravityScale = 1.0f;
+    float LinearDamping = Entry.OriginalLinearDamping;
+    float AngularDamping = Entry.OriginalAngularDamping;
+    float BobAcceleration = 0.0f;
+
+    for (const TObjectKey<UObject>& FieldKey : Entry.Fields)
+    {
+        if (const FGravityFieldSettings* Settings = Fields.Find(FieldKey))
+        {
+            GravityScale = FMath::Min(GravityScale, Settings->GravityScale);
+            LinearDamping = FMath::Max(LinearDamping, Settings->LinearDamping);
+            AngularDamping = FMath::Max(AngularDamping, Settings->AngularDamping);
+            BobAcceleration = FMath::Max(BobAcceleration, Settings->BobAcceleration);
+        }
+    }
+
+    // Bodies that never had gravity don't start falling inside a field
+    Entry.GravityScale = Entry.bOriginalGravityEnabled ? GravityScale : 0.0f;
+    Entry.BobAcceleration = BobAcceleration;
+
+    Body->SetLinearDamping(LinearDamping);
+    Body->SetAngularDamping(AngularDamping);
+}
+
+void UGravityFieldSubsystem::RestoreBody(FFieldBody& Entry)
+{
+    UPrimitiveComponent* Body = Entry.Body.Get();
+    if (!IsValid(Body)) return;
+
+    Body->SetEnableGravity(Entry.bOriginalGravityEnabled);
+    Body->SetLinearDamping(Entry.OriginalLinearDamping);
+    Body->SetAngularDamping(Entry.OriginalAngularDamping);
+}
+
+void UGravityFieldSubsystem::RemoveBodyAt(int32 Index)
+{
+    RestoreBody(Bodies[Index]);
+    BodyIndices.Remove(Bodies[Index].BodyKey);
+
+    Bodies.RemoveAtSwap(Index);
+    if (Bodies.IsValidIndex(Index))
+    {
+        BodyIndices.Add(Bodies[Index].BodyKey, Index);
+    }
+}
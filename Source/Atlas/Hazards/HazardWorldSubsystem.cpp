@@ -0,0 +1,257 @@
+// HazardWorldSubsystem.cpp
+#include "HazardWorldSubsystem.h"
+#include "../Characters/GameCharacterBase.h"
+#include "../Interfaces/IHealthInterface.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+#include "Engine/HitResult.h"
+#include "EngineUtils.h"
+
+// FHazardSpatialHash
+
+FHazardSpatialHash::FHazardSpatialHash(float InCellSize)
+    : CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+void FHazardSpatialHash::Reset(float InCellSize)
+{
+    if (InCellSize > 0.0f && !FMath::IsNearlyEqual(InCellSize, CellSize))
+    {
+        CellSize = InCellSize;
+        Cells.Reset();
+        return;
+    }
+
+    // Keep cell allocations around, the same cells are usually reused next frame
+    for (TPair<FIntVector, TArray<int32>>& Cell : Cells)
+    {
+        Cell.Value.Reset();
+    }
+}
+
+void FHazardSpatialHash::Add(int32 Index, const FVector& Location)
+{
+    Cells.FindOrAdd(ToCell(Location)).Add(Index);
+}
+
+FIntVector FHazardSpatialHash::ToCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt32(Location.X / CellSize),
+        FMath::FloorToInt32(Location.Y / CellSize),
+        FMath::FloorToInt32(Location.Z / CellSize)
+    );
+}
+
+// UHazardWorldSubsystem
+
+void UHazardWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    FrameHash.Reset(DamageableCellSize);
+}
+
+void UHazardWorldSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+    }
+    ActorSpawnedHandle.Reset();
+
+    DamageableActors.Empty();
+    FrameActors.Empty();
+    FrameLocations.Empty();
+    LineOfSightCache.Empty();
+    ActiveStuns.Empty();
+
+    Super::Deinitialize();
+}
+
+void UHazardWorldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Pick up everything placed in the level, then track spawns
+    for (TActorIterator<AActor> It(&InWorld); It; ++It)
+    {
+        if (IsDamageable(*It))
+        {
+            RegisterDamageableActor(*It);
+        }
+    }
+
+    ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(
+        FOnActorSpawned::FDelegate::CreateUObject(this, &UHazardWorldSubsystem::OnActorSpawned));
+}
+
+bool UHazardWorldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHazardWorldSubsystem::Tick(float DeltaTime)
+{
+    if (ActiveStuns.Num() == 0) return;
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    for (auto It = ActiveStuns.CreateIterator(); It; ++It)
+    {
+        AGameCharacterBase* Character = It.Key().Get();
+        if (!IsValid(Character))
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        if (Now >= It.Value())
+        {
+            Character->GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+            It.RemoveCurrent();
+        }
+    }
+}
+
+TStatId UHazardWorldSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UHazardWorldSubsystem, STATGROUP_Tickables);
+}
+
+UHazardWorldSubsystem* UHazardWorldSubsystem::Get(const UObject* WorldContextObject)
+{
+    if (!WorldContextObject)
+    {
+        return nullptr;
+    }
+
+    UWorld* World = WorldContextObject->GetWorld();
+    return World ? World->GetSubsystem<UHazardWorldSubsystem>() : nullptr;
+}
+
+void UHazardWorldSubsystem::RegisterDamageableActor(AActor* Actor)
+{
+    if (!Actor) return;
+
+    DamageableActors.AddUnique(Actor);
+    // Force the next query to rebuild the hash
+    FrameCacheCounter = MAX_uint64;
+}
+
+void UHazardWorldSubsystem::UnregisterDamageableActor(AActor* Actor)
+{
+    DamageableActors.RemoveSwap(Actor);
+    FrameCacheCounter = MAX_uint64;
+}
+
+void UHazardWorldSubsystem::QueryDamageableActors(const FVector& Origin, float Radius, TArray<AActor*>& OutActors)
+{
+    RefreshFrameCaches();
+
+    TArray<int32, TInlineAllocator<64>> CellIndices;
+    FrameHash.Query(Origin, Radius, CellIndices);
+
+    const float RadiusSq = FMath::Square(Radius);
+    for (int32 Index : CellIndices)
+    {
+        if (FVector::DistSquared(FrameLocations[Index], Origin) <= RadiusSq)
+        {
+            OutActors.Add(FrameActors[Index]);
+        }
+    }
+}
+
+bool UHazardWorldSubsystem::HasLineOfSight(AActor* From, AActor* To)
+{
+    if (!From || !To) return false;
+
+    RefreshFrameCaches();
+
+    // Order independent key, the trace is symmetric for our purposes
+    const uint32 IdA = FMath::Min(From->GetUniqueID(), To->GetUniqueID());
+    const uint32 IdB = FMath::Max(From->GetUniqueID(), To->GetUniqueID());
+    const uint64 Key = (static_cast<uint64>(IdA) << 32) | IdB;
+
+    if (const bool* Cached = LineOfSightCache.Find(Key))
+    {
+        return *Cached;
+    }
+
+    FHitResult Hit;
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(HazardLineOfSight), false);
+    QueryParams.AddIgnoredActor(From);
+    QueryParams.AddIgnoredActor(To);
+
+    const bool bHasLineOfSight = !GetWorld()->LineTraceSingleByChannel(
+        Hit,
+        From->GetActorLocation(),
+        To->GetActorLocation(),
+        ECC_Visibility,
+        QueryParams
+    );
+
+    LineOfSightCache.Add(Key, bHasLineOfSight);
+    return bHasLineOfSight;
+}
+
+void UHazardWorldSubsystem::ApplyStun(AGameCharacterBase* Character, float Duration)
+{
+    if (!IsValid(Character) || Duration <= 0.0f) return;
+
+    const double ExpireTime = GetWorld()->GetTimeSeconds() + Duration;
+
+    if (double* ExistingExpiry = ActiveStuns.Find(Character))
+    {
+        // Already stunned, only ever extend
+        *ExistingExpiry = FMath::Max(*ExistingExpiry, ExpireTime);
+        return;
+    }
+
+    Character->GetCharacterMovement()->DisableMovement();
+    ActiveStuns.Add(Character, ExpireTime);
+}
+
+bool UHazardWorldSubsystem::IsStunned(AGameCharacterBase* Character) const
+{
+    return ActiveStuns.Contains(Character);
+}
+
+void UHazardWorldSubsystem::RefreshFrameCaches()
+{
+    if (FrameCacheCounter == GFrameCounter) return;
+
+    FrameCacheCounter = GFrameCounter;
+    LineOfSightCache.Reset();
+
+    FrameActors.Reset();
+    FrameLocations.Reset();
+    FrameHash.Reset();
+
+    for (int32 i = DamageableActors.Num() - 1; i >= 0; --i)
+    {
+        AActor* Actor = DamageableActors[i].Get();
+        if (!IsValid(Actor))
+        {
+            DamageableActors.RemoveAtSwap(i);
+            continue;
+        }
+
+        const int32 Index = FrameActors.Add(Actor);
+        FrameLocations.Add(Actor->GetActorLocation());
+        FrameHash.Add(Index, FrameLocations[Index]);
+    }
+}
+
+void UHazardWorldSubsystem::OnActorSpawned(AActor* Actor)
+{
+    if (IsDamageable(Actor))
+    {
+        RegisterDamageableActor(Actor);
+    }
+}
+
+bool UHazardWorldSubsystem::IsDamageable(const AActor* Actor)
+{
+    return Actor && Actor->GetClass()->ImplementsInterface(UHealthInterface::StaticClass());
+}
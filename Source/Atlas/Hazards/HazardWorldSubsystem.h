@@ -0,0 +1,117 @@
+// HazardWorldSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HazardWorldSubsystem.generated.h"
+
+class AGameCharacterBase;
+
+/**
+ * Uniform grid over actor locations. Stores caller-owned indices so the same
+ * hash can back actor queries at runtime and plain location sets in benchmarks.
+ */
+struct ATLAS_API FHazardSpatialHash
+{
+    explicit FHazardSpatialHash(float InCellSize = 400.0f);
+
+    /** Clears all cells (keeping their allocations) and optionally changes the cell size */
+    void Reset(float InCellSize = 0.0f);
+
+    void Add(int32 Index, const FVector& Location);
+
+    /** Appends every index stored in a cell touched by the sphere. Callers still need a distance check. */
+    template <typename AllocatorType>
+    void Query(const FVector& Origin, float Radius, TArray<int32, AllocatorType>& OutIndices) const
+    {
+        const FIntVector MinCell = ToCell(Origin - FVector(Radius));
+        const FIntVector MaxCell = ToCell(Origin + FVector(Radius));
+
+        for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+        {
+            for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+            {
+                for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+                {
+                    if (const TArray<int32>* Cell = Cells.Find(FIntVector(X, Y, Z)))
+                    {
+                        OutIndices.Append(*Cell);
+                    }
+                }
+            }
+        }
+    }
+
+    float GetCellSize() const { return CellSize; }
+
+private:
+    FIntVector ToCell(const FVector& Location) const;
+
+    float CellSize;
+    TMap<FIntVector, TArray<int32>> Cells;
+};
+
+/**
+ * World-scoped state shared by every environmental hazard in the level:
+ * - a spatial hash of damageable actors rebuilt at most once per frame
+ * - a line of sight cache that is invalidated every frame
+ * - a central stun expiry list so hazards don't need one timer per target
+ */
+UCLASS()
+class ATLAS_API UHazardWorldSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // UWorldSubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UHazardWorldSubsystem* Get(const UObject* WorldContextObject);
+
+    // Damageable actor registry (actors implementing IHealthInterface are added automatically)
+    void RegisterDamageableActor(AActor* Actor);
+    void UnregisterDamageableActor(AActor* Actor);
+
+    /** Damageable actors within Radius of Origin, resolved through the per-frame spatial hash */
+    void QueryDamageableActors(const FVector& Origin, float Radius, TArray<AActor*>& OutActors);
+
+    /** Visibility trace between two actors, cached for the rest of the frame in both directions */
+    bool HasLineOfSight(AActor* From, AActor* To);
+
+    /** Drops the per-frame hash and line of sight cache, the next query rebuilds them as if a new frame had started */
+    void InvalidateFrameCaches() { FrameCacheCounter = MAX_uint64; }
+
+    // Stuns
+    void ApplyStun(AGameCharacterBase* Character, float Duration);
+    bool IsStunned(AGameCharacterBase* Character) const;
+    int32 GetActiveStunCount() const { return ActiveStuns.Num(); }
+
+    /** Cell size used for the damageable actor hash */
+    static constexpr float DamageableCellSize = 400.0f;
+
+private:
+    void RefreshFrameCaches();
+    void OnActorSpawned(AActor* Actor);
+    static bool IsDamageable(const AActor* Actor);
+
+    TArray<TWeakObjectPtr<AActor>> DamageableActors;
+
+    // Per-frame snapshot, only valid while FrameCacheCounter == GFrameCounter
+    TArray<AActor*> FrameActors;
+    TArray<FVector> FrameLocations;
+    FHazardSpatialHash FrameHash;
+    TMap<uint64, bool> LineOfSightCache;
+    uint64 FrameCacheCounter = MAX_uint64;
+
+    /** Stunned character -> world time the stun expires */
+    TMap<TWeakObjectPtr<AGameCharacterBase>, double> ActiveStuns;
+
+    FDelegateHandle ActorSpawnedHandle;
+};
@@ -1,8 +1,11 @@
 // LowGravityHazard.cpp
 #include "LowGravityHazard.h"
+#include "GravityFieldSubsystem.h"
+#include "../Core/AtlasStats.h"
 #include "../Characters/GameCharacterBase.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/PrimitiveComponent.h"
+#include "Components/SphereComponent.h"
 #include "Components/AudioComponent.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -21,12 +24,25 @@ ULowGravityHazard::ULowGravityHazard()
     EffectData.HazardColor = FLinearColor(0.5f, 0.3f, 1.0f, 0.3f);
     
     DebrisSpawnTimer = 0.0f;
+    NextDebrisIndex = 0;
 }
 
 void ULowGravityHazard::BeginPlay()
 {
     Super::BeginPlay();
     
+    // Physics props don't implement the health interface, let the trigger see them too
+    if (bAffectsPhysicsObjects && HazardTriggerSphere)
+    {
+        HazardTriggerSphere->SetCollisionResponseToChannel(ECC_PhysicsBody, ECR_Overlap);
+        HazardTriggerSphere->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Overlap);
+    }
+    
+    if (UGravityFieldSubsystem* GravityFields = UGravityFieldSubsystem::Get(this))
+    {
+        GravityFields->RegisterField(this, GetPhysicsFieldSettings());
+    }
+    
     // Start ambient sound
     if (AntiGravityHumSound && bIsActive)
     {
@@ -45,6 +61,34 @@ void ULowGravityHazard::BeginPlay()
     }
 }
 
+void ULowGravityHazard::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    Super::EndPlay(EndPlayReason);
+    
+    // Releases any bodies still floating in this field
+    if (UGravityFieldSubsystem* GravityFields = UGravityFieldSubsystem::Get(this))
+    {
+        GravityFields->UnregisterField(this);
+    }
+}
+
+void ULowGravityHazard::DeactivateHazard()
+{
+    Super::DeactivateHazard();
+    
+    DestroyFloatingDebris();
+}
+
+FGravityFieldSettings ULowGravityHazard::GetPhysicsFieldSettings() const
+{
+    FGravityFieldSettings Settings;
+    Settings.GravityScale = PhysicsObjectGravityScale;
+    Settings.LinearDamping = PhysicsObjectDamping;
+    Settings.AngularDamping = PhysicsObjectDamping;
+    Settings.BobAcceleration = PhysicsObjectBobAcceleration;
+    return Settings;
+}
+
 void ULowGravityHazard::TickComponent(float DeltaTime, ELevelTick TickType, 
     FActorComponentTickFunction* ThisTickFunction)
 {
@@ -52,10 +96,11 @@ void ULowGravityHazard::TickComponent(float DeltaTime, ELevelTick TickType,
     
     if (!bIsActive) return;
     
-    // Update floating objects
-    UpdateFloatingObjects(DeltaTime);
+    ATLAS_SCOPE_CYCLE_COUNTER(HazardTick, "Atlas.Hazard.LowGravity");
+    
+    // Physics props are driven by the gravity field subsystem
     
-    // Spawn floating debris periodically
+    // Recycle floating debris periodically
     DebrisSpawnTimer += DeltaTime;
     if (DebrisSpawnTimer >= 3.0f)
     {
@@ -111,6 +156,23 @@ void ULowGravityHazard::UpdateHazardVisuals(float DeltaTime)
     }
 }
 
+bool ULowGravityHazard::ShouldAffectActor(AActor* Actor) const
+{
+    if (Super::ShouldAffectActor(Actor))
+    {
+        return true;
+    }
+    
+    // Loose physics props float too
+    if (bAffectsPhysicsObjects && Actor)
+    {
+        const UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+        return PrimComp && PrimComp->IsSimulatingPhysics();
+    }
+    
+    return false;
+}
+
 void ULowGravityHazard::OnActorEnterHazard_Implementation(AActor* Actor)
 {
     Super::OnActorEnterHazard_Implementation(Actor);
@@ -187,10 +249,7 @@ void ULowGravityHazard::OnActorExitHazard_Implementation(AActor* Actor)
         if (UPrimitiveComponent* PrimComp = Actor->GetRootComponent() ? 
             Cast<UPrimitiveComponent>(Actor->GetRootComponent()) : nullptr)
         {
-            if (PrimComp->IsSimulatingPhysics())
-            {
-                RestoreGravityToPhysicsObject(PrimComp);
-            }
+            RestoreGravityToPhysicsObject(PrimComp);
         }
     }
 }
@@ -199,18 +258,14 @@ void ULowGravityHazard::ApplyAntiGravityToPhysicsObject(UPrimitiveComponent* Com
 {
     if (!Component || !Component->IsSimulatingPhysics()) return;
     
-    // Store original gravity
-    if (!OriginalPhysicsGravity.Contains(Component))
-    {
-        OriginalPhysicsGravity.Add(Component, Component->IsGravityEnabled() ? 1.0f : 0.0f);
-    }
+    UGravityFieldSubsystem* GravityFields = UGravityFieldSubsystem::Get(this);
+    if (!GravityFields) return;
     
-    // Apply reduced gravity
-    Component->SetEnableGravity(true);
-    // Component->BodyInstance.bOverrideWalkableSlopeOnInstance = true; // This is protected, skip it
+    // Gravity scale and damping are set once here, the subsystem restores them on exit
+    const bool bWasFloating = GravityFields->IsBodyInField(Component);
+    GravityFields->EnterField(this, Component);
     
-    // Add to floating objects list
-    FloatingObjects.AddUnique(Component);
+    if (bWasFloating) return;
     
     // Give initial upward impulse
     FVector Impulse = FVector(0, 0, Component->GetMass() * 200.0f);
@@ -225,15 +280,11 @@ void ULowGravityHazard::RestoreGravityToPhysicsObject(UPrimitiveComponent* Compo
 {
     if (!Component) return;
     
-    // Restore original gravity setting
-    if (float* OriginalGravity = OriginalPhysicsGravity.Find(Component))
+    // Only restores original gravity once no other field holds the body
+    if (UGravityFieldSubsystem* GravityFields = UGravityFieldSubsystem::Get(this))
     {
-        Component->SetEnableGravity(*OriginalGravity > 0.0f);
-        OriginalPhysicsGravity.Remove(Component);
+        GravityFields->ExitField(this, Component);
     }
-    
-    // Remove from floating objects
-    FloatingObjects.Remove(Component);
 }
 
 void ULowGravityHazard::SpawnAntiGravityParticles(AActor* Target)
@@ -252,6 +303,12 @@ void ULowGravityHazard::SpawnAntiGravityParticles(AActor* Target)
     
     if (Particles)
     {
+        // Drop effects whose destroy timer already fired
+        ActiveAntiGravityEffects.RemoveAllSwap([](UParticleSystemComponent* Effect)
+        {
+            return !IsValid(Effect);
+        });
+        
         Particles->SetColorParameter(FName("GravityColor"), EffectData.HazardColor);
         // Auto-destroy after 2 seconds
         FTimerHandle DestroyTimer;
@@ -266,67 +323,50 @@ void ULowGravityHazard::SpawnAntiGravityParticles(AActor* Target)
     }
 }
 
-void ULowGravityHazard::UpdateFloatingObjects(float DeltaTime)
-{
-    // Apply upward force to floating physics objects
-    for (int32 i = FloatingObjects.Num() - 1; i >= 0; --i)
-    {
-        UPrimitiveComponent* Component = FloatingObjects[i];
-        
-        if (!IsValid(Component))
-        {
-            FloatingObjects.RemoveAt(i);
-            continue;
-        }
-        
-        // Check if still in range
-        float Distance = FVector::Dist(Component->GetComponentLocation(), GetComponentLocation());
-        if (Distance > HazardRadius)
-        {
-            RestoreGravityToPhysicsObject(Component);
-            continue;
-        }
-        
-        // Apply anti-gravity force
-        FVector AntiGravity = FVector(0, 0, Component->GetMass() * 980.0f * (1.0f - PhysicsObjectGravityScale));
-        Component->AddForce(AntiGravity);
-        
-        // Add slight floating motion
-        float FloatOffset = FMath::Sin(GetWorld()->GetTimeSeconds() * 2.0f + i) * 10.0f;
-        Component->AddForce(FVector(0, 0, FloatOffset * Component->GetMass()));
-    }
-    
-    // Clean up expired particle effects
-    for (int32 i = ActiveAntiGravityEffects.Num() - 1; i >= 0; --i)
-    {
-        if (!IsValid(ActiveAntiGravityEffects[i]))
-        {
-            ActiveAntiGravityEffects.RemoveAt(i);
-        }
-    }
-}
-
 void ULowGravityHazard::CreateFloatingDebris()
 {
-    if (!FloatingDebrisEffect) return;
+    if (!FloatingDebrisEffect || MaxFloatingDebris <= 0) return;
     
-    // Spawn random floating debris particles
+    // Recycle a random handful of pooled emitters, filling the pool on first use
     int32 DebrisCount = FMath::RandRange(3, 8);
     
     for (int32 i = 0; i < DebrisCount; ++i)
     {
         FVector RandomLocation = GetComponentLocation() + FMath::VRand() * HazardRadius * 0.8f;
         RandomLocation.Z = GetComponentLocation().Z + FMath::FRandRange(-100.0f, 200.0f);
+        const FVector RandomScale = FVector(FMath::FRandRange(0.5f, 1.5f));
         
-        UParticleSystemComponent* Debris = UGameplayStatics::SpawnEmitterAtLocation(
-            GetWorld(),
-            FloatingDebrisEffect,
-            RandomLocation,
-            FRotator::ZeroRotator,
-            FVector(FMath::FRandRange(0.5f, 1.5f))
-        );
+        UParticleSystemComponent* Debris = nullptr;
+        if (FloatingDebrisPool.Num() < MaxFloatingDebris)
+        {
+            Debris = UGameplayStatics::SpawnEmitterAtLocation(
+                GetWorld(),
+                FloatingDebrisEffect,
+                RandomLocation,
+                FRotator::ZeroRotator,
+                RandomScale,
+                false
+            );
+            
+            if (Debris)
+            {
+                FloatingDebrisPool.Add(Debris);
+            }
+        }
+        else
+        {
+            Debris = FloatingDebrisPool[NextDebrisIndex];
+            NextDebrisIndex = (NextDebrisIndex + 1) % FloatingDebrisPool.Num();
+            
+            if (IsValid(Debris))
+            {
+                Debris->SetWorldLocationAndRotation(RandomLocation, FRotator::ZeroRotator);
+                Debris->SetWorldScale3D(RandomScale);
+                Debris->ActivateSystem(true);
+            }
+        }
         
-        if (Debris)
+        if (IsValid(Debris))
         {
             // Set floating velocity
             FVector FloatVelocity = FVector(
@@ -335,15 +375,20 @@ void ULowGravityHazard::CreateFloatingDebris()
                 FMath::FRandRange(10.0f, 50.0f)
             );
             Debris->SetVectorParameter(FName("FloatVelocity"), FloatVelocity);
-            // Auto-destroy after 10 seconds
-            FTimerHandle DestroyTimer2;
-            GetWorld()->GetTimerManager().SetTimer(DestroyTimer2, [Debris]()
-            {
-                if (IsValid(Debris))
-                {
-                    Debris->DestroyComponent();
-                }
-            }, 10.0f, false);
         }
     }
-}
\ No newline at end of file
+}
+
+void ULowGravityHazard::DestroyFloatingDebris()
+{
+    for (UParticleSystemComponent* Debris : FloatingDebrisPool)
+    {
+        if (IsValid(Debris))
+        {
+            Debris->DestroyComponent();
+        }
+    }
+    
+    FloatingDebrisPool.Empty();
+    NextDebrisIndex = 0;
+}
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "EnvironmentalHazardComponent.h"
+#include "GravityFieldSubsystem.h"
 #include "LowGravityHazard.generated.h"
 
 USTRUCT(BlueprintType)
@@ -38,6 +39,11 @@ class ATLAS_API ULowGravityHazard : public UEnvironmentalHazardComponent
 
 public:
     ULowGravityHazard();
+    
+    virtual void DeactivateHazard() override;
+    
+    /** Field settings handed to the gravity field subsystem for physics bodies */
+    FGravityFieldSettings GetPhysicsFieldSettings() const;
 
     // Gravity specific properties
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity", meta = (ClampMin = "0.01", ClampMax = "1.0"))
@@ -58,6 +64,15 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity")
     float PhysicsObjectGravityScale = 0.2f;
     
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity")
+    float PhysicsObjectDamping = 0.5f;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity")
+    float PhysicsObjectBobAcceleration = 10.0f;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity|Effects", meta = (ClampMin = "0"))
+    int32 MaxFloatingDebris = 8;
+    
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity|Effects")
     UParticleSystem* AntiGravityParticles;
     
@@ -72,9 +87,11 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
     virtual void ApplyHazardEffect(AActor* Actor, float DeltaTime) override;
     virtual void UpdateHazardVisuals(float DeltaTime) override;
+    virtual bool ShouldAffectActor(AActor* Actor) const override;
     virtual void OnActorEnterHazard_Implementation(AActor* Actor) override;
     virtual void OnActorExitHazard_Implementation(AActor* Actor) override;
     
@@ -94,16 +111,20 @@ protected:
     void OnActorExitedLowGravity(AActor* Actor);
 
 private:
-    void UpdateFloatingObjects(float DeltaTime);
     void CreateFloatingDebris();
+    void DestroyFloatingDebris();
     
     TMap<class AGameCharacterBase*, FOriginalMovementValues> OriginalCharacterValues;
-    TMap<UPrimitiveComponent*, float> OriginalPhysicsGravity;
-    TArray<UPrimitiveComponent*> FloatingObjects;
     
     UPROPERTY()
     TArray<UParticleSystemComponent*> ActiveAntiGravityEffects;
     
+    /** Debris emitters are spawned once and recycled instead of respawned */
+    UPROPERTY()
+    TArray<UParticleSystemComponent*> FloatingDebrisPool;
+    
+    int32 NextDebrisIndex;
+    
     UPROPERTY()
     UAudioComponent* AmbientHumSound;
     
@@ -1,5 +1,7 @@
 // ToxicLeakHazard.cpp
 #include "ToxicLeakHazard.h"
+#include "HazardWorldSubsystem.h"
+#include "../Core/AtlasStats.h"
 #include "../Characters/GameCharacterBase.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
@@ -31,6 +33,8 @@ UToxicLeakHazard::UToxicLeakHazard()
     DamageTypeClass = UDamageType::StaticClass();
     
     CurrentCloudRadius = HazardRadius;
+    CloudElapsedTime = 0.0f;
+    CurrentCollisionRadius = HazardRadius;
 }
 
 void UToxicLeakHazard::BeginPlay()
@@ -38,6 +42,41 @@ void UToxicLeakHazard::BeginPlay()
     Super::BeginPlay();
     
     CurrentCloudRadius = HazardRadius;
+    CurrentCollisionRadius = HazardRadius;
+}
+
+void UToxicLeakHazard::DeactivateHazard()
+{
+    Super::DeactivateHazard();
+    
+    // The next activation leaks from scratch
+    CloudElapsedTime = 0.0f;
+    CurrentCloudRadius = HazardRadius;
+    CurrentCollisionRadius = HazardRadius;
+    if (HazardTriggerSphere)
+    {
+        HazardTriggerSphere->SetSphereRadius(HazardRadius);
+    }
+    
+    DestroyToxicCloudEmitters();
+}
+
+float UToxicLeakHazard::GetCloudRadiusAtTime(float CloudTime) const
+{
+    return HazardRadius + FMath::Min(ToxicCloudSpreadRate * FMath::Max(CloudTime, 0.0f), ToxicCloudSpreadRadius);
+}
+
+bool UToxicLeakHazard::IsInsideCloud(const FVector& CloudCenter, float CloudRadius, const FVector& ActorLocation, float ActorRadius)
+{
+    return FVector::DistSquared(CloudCenter, ActorLocation) <= FMath::Square(CloudRadius + ActorRadius);
+}
+
+bool UToxicLeakHazard::ShouldAffectActor(AActor* Actor) const
+{
+    if (!Super::ShouldAffectActor(Actor)) return false;
+    
+    // The trigger sphere runs ahead of the cloud, membership follows the analytic radius
+    return IsInsideCloud(GetComponentLocation(), CurrentCloudRadius, Actor->GetActorLocation(), Actor->GetSimpleCollisionRadius());
 }
 
 void UToxicLeakHazard::TickComponent(float DeltaTime, ELevelTick TickType, 
@@ -47,6 +86,9 @@ void UToxicLeakHazard::TickComponent(float DeltaTime, ELevelTick TickType,
     
     if (!bIsActive) return;
     
+    // After the base tick's scope has closed, so nothing is counted twice
+    ATLAS_SCOPE_CYCLE_COUNTER(HazardTick, "Atlas.Hazard.ToxicLeak");
+    
     // Update poison DOTs
     UpdatePoisonDOTs(DeltaTime);
     
@@ -123,33 +165,28 @@ void UToxicLeakHazard::UpdateHazardVisuals(float DeltaTime)
         ActiveHazardEffect->SetColorParameter(FName("CloudColor"), CloudColor);
     }
     
-    // Spawn additional cloud particles as it spreads
-    if (ToxicCloudEffect && FMath::FRand() < 0.2f)
+    // Cloud emitters are spawned once and rescaled as the cloud spreads
+    if (ToxicCloudEffect && ToxicCloudParticles.Num() == 0 && ToxicCloudEmitterCount > 0)
     {
-        FVector RandomOffset = FMath::VRand() * CurrentCloudRadius;
-        RandomOffset.Z = 0; // Keep at ground level
-        
-        UParticleSystemComponent* CloudParticle = UGameplayStatics::SpawnEmitterAtLocation(
-            GetWorld(),
-            ToxicCloudEffect,
-            GetComponentLocation() + RandomOffset,
-            FRotator::ZeroRotator,
-            FVector(1.0f)
-        );
-        
-        if (CloudParticle)
+        for (int32 i = 0; i < ToxicCloudEmitterCount; ++i)
         {
-            // Auto-destroy after 5 seconds
-            FTimerHandle DestroyTimer;
-            GetWorld()->GetTimerManager().SetTimer(DestroyTimer, [CloudParticle]()
+            UParticleSystemComponent* CloudParticle = UGameplayStatics::SpawnEmitterAttached(
+                ToxicCloudEffect,
+                this,
+                NAME_None,
+                FVector::ZeroVector,
+                FRotator::ZeroRotator,
+                EAttachLocation::KeepRelativeOffset,
+                false
+            );
+            
+            if (CloudParticle)
             {
-                if (IsValid(CloudParticle))
-                {
-                    CloudParticle->DestroyComponent();
-                }
-            }, 5.0f, false);
-            ToxicCloudParticles.Add(CloudParticle);
+                ToxicCloudParticles.Add(CloudParticle);
+            }
         }
+        
+        ScaleToxicCloudEmitters();
     }
 }
 
@@ -256,6 +293,8 @@ void UToxicLeakHazard::RemoveToxicScreenEffect(APlayerController* PC)
 
 void UToxicLeakHazard::UpdatePoisonDOTs(float DeltaTime)
 {
+    AtlasStats::CountPoisonDOTs(ActiveDOTs.Num());
+    
     // Update all active DOTs
     for (int32 i = ActiveDOTs.Num() - 1; i >= 0; --i)
     {
@@ -292,24 +331,95 @@ void UToxicLeakHazard::UpdatePoisonDOTs(float DeltaTime)
 
 void UToxicLeakHazard::ExpandToxicCloud(float DeltaTime)
 {
-    // Gradually expand the toxic cloud radius
-    if (CurrentCloudRadius < HazardRadius + ToxicCloudSpreadRadius)
+    CloudElapsedTime += DeltaTime;
+    CurrentCloudRadius = GetCloudRadiusAtTime(CloudElapsedTime);
+    
+    // Only resize the trigger sphere when the cloud crosses the next coarse step
+    const float Step = FMath::Max(CollisionRadiusStep, 1.0f);
+    const float SteppedRadius = FMath::Min(
+        FMath::CeilToFloat(CurrentCloudRadius / Step) * Step,
+        HazardRadius + ToxicCloudSpreadRadius);
+    
+    if (!FMath::IsNearlyEqual(SteppedRadius, CurrentCollisionRadius))
     {
-        CurrentCloudRadius += ToxicCloudSpreadRate * DeltaTime;
+        CurrentCollisionRadius = SteppedRadius;
         
-        // Update trigger sphere radius
         if (HazardTriggerSphere)
         {
-            HazardTriggerSphere->SetSphereRadius(CurrentCloudRadius);
+            HazardTriggerSphere->SetSphereRadius(CurrentCollisionRadius);
         }
+        
+        ScaleToxicCloudEmitters();
     }
     
-    // Clean up old cloud particles
-    for (int32 i = ToxicCloudParticles.Num() - 1; i >= 0; --i)
+    UpdateCloudMembership();
+}
+
+void UToxicLeakHazard::UpdateCloudMembership()
+{
+    // Actors that drifted out of the analytic cloud
+    for (int32 i = AffectedActors.Num() - 1; i >= 0; --i)
     {
-        if (!IsValid(ToxicCloudParticles[i]))
+        AActor* Actor = AffectedActors[i];
+        if (!IsValid(Actor))
+        {
+            AffectedActors.RemoveAt(i);
+            continue;
+        }
+        
+        if (!ShouldAffectActor(Actor))
         {
-            ToxicCloudParticles.RemoveAt(i);
+            AffectedActors.RemoveAt(i);
+            OnActorExitHazard(Actor);
         }
     }
-}
\ No newline at end of file
+    
+    // Actors the cloud has grown over, taken from the registered damageable set
+    UHazardWorldSubsystem* HazardSubsystem = UHazardWorldSubsystem::Get(this);
+    if (!HazardSubsystem) return;
+    
+    // Padded by the largest actor radius, ShouldAffectActor does the exact test
+    TArray<AActor*> NearbyActors;
+    HazardSubsystem->QueryDamageableActors(GetComponentLocation(), CurrentCloudRadius + MaxActorRadius, NearbyActors);
+    
+    for (AActor* Actor : NearbyActors)
+    {
+        if (!AffectedActors.Contains(Actor) && ShouldAffectActor(Actor))
+        {
+            AffectedActors.Add(Actor);
+            OnActorEnterHazard(Actor);
+        }
+    }
+}
+
+void UToxicLeakHazard::ScaleToxicCloudEmitters()
+{
+    if (ToxicCloudParticles.Num() == 0 || HazardRadius <= 0.0f) return;
+    
+    // Emitters sit on a ring at half the cloud radius and grow with it
+    const float CloudScale = CurrentCloudRadius / HazardRadius;
+    const float RingRadius = CurrentCloudRadius * 0.5f;
+    
+    for (int32 i = 0; i < ToxicCloudParticles.Num(); ++i)
+    {
+        UParticleSystemComponent* CloudParticle = ToxicCloudParticles[i];
+        if (!IsValid(CloudParticle)) continue;
+        
+        const float Angle = 2.0f * PI * i / ToxicCloudParticles.Num();
+        CloudParticle->SetRelativeLocation(FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * RingRadius);
+        CloudParticle->SetRelativeScale3D(FVector(CloudScale));
+    }
+}
+
+void UToxicLeakHazard::DestroyToxicCloudEmitters()
+{
+    for (UParticleSystemComponent* CloudParticle : ToxicCloudParticles)
+    {
+        if (IsValid(CloudParticle))
+        {
+            CloudParticle->DestroyComponent();
+        }
+    }
+    
+    ToxicCloudParticles.Empty();
+}
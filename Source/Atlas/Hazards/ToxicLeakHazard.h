@@ -38,6 +38,18 @@ class ATLAS_API UToxicLeakHazard : public UEnvironmentalHazardComponent
 
 public:
     UToxicLeakHazard();
+    
+    virtual void DeactivateHazard() override;
+    
+    /** Cloud radius after it has been active for CloudTime seconds */
+    UFUNCTION(BlueprintPure, Category = "Toxic")
+    float GetCloudRadiusAtTime(float CloudTime) const;
+    
+    UFUNCTION(BlueprintPure, Category = "Toxic")
+    float GetCurrentCloudRadius() const { return CurrentCloudRadius; }
+    
+    /** Analytic stand-in for a sphere overlap against an actor of the given collision radius */
+    static bool IsInsideCloud(const FVector& CloudCenter, float CloudRadius, const FVector& ActorLocation, float ActorRadius);
 
     // Toxic specific properties
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Toxic")
@@ -58,6 +70,17 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Toxic")
     float ToxicCloudSpreadRate = 50.0f; // Units per second
     
+    // The trigger sphere only follows the cloud in steps of this size to avoid per-tick overlap updates
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Toxic", meta = (ClampMin = "1.0"))
+    float CollisionRadiusStep = 50.0f;
+    
+    // Largest actor collision radius the cloud looks out for, actors past the edge by more than this are not picked up
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Toxic", meta = (ClampMin = "0.0"))
+    float MaxActorRadius = 200.0f;
+    
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Toxic|Effects", meta = (ClampMin = "0"))
+    int32 ToxicCloudEmitterCount = 6;
+    
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Toxic|Effects")
     UParticleSystem* ToxicCloudEffect;
     
@@ -72,6 +95,7 @@ protected:
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
     virtual void ApplyHazardEffect(AActor* Actor, float DeltaTime) override;
     virtual void UpdateHazardVisuals(float DeltaTime) override;
+    virtual bool ShouldAffectActor(AActor* Actor) const override;
     virtual void OnActorEnterHazard_Implementation(AActor* Actor) override;
     virtual void OnActorExitHazard_Implementation(AActor* Actor) override;
     
@@ -90,11 +114,17 @@ protected:
 private:
     void UpdatePoisonDOTs(float DeltaTime);
     void ExpandToxicCloud(float DeltaTime);
+    void UpdateCloudMembership();
+    void ScaleToxicCloudEmitters();
+    void DestroyToxicCloudEmitters();
     
     TArray<FPoisonDOTData> ActiveDOTs;
     TMap<AActor*, float> OriginalMovementSpeeds;
     float CurrentCloudRadius;
+    float CloudElapsedTime;
+    float CurrentCollisionRadius;
     
+    /** Fixed set of cloud emitters attached around the leak, rescaled as the cloud grows */
     UPROPERTY()
     TArray<UParticleSystemComponent*> ToxicCloudParticles;
 };
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "EncounterDirector.h"
+#include "Atlas/Components/RunManagerComponent.h"
+
+FEncounterDirectorSettings::FEncounterDirectorSettings()
+{
+	FRichCurve* Level = LevelBudgetCurve.GetRichCurve();
+	Level->AddKey(1.0f, 2.0f);
+	Level->AddKey(2.0f, 3.0f);
+	Level->AddKey(3.0f, 4.0f);
+	Level->AddKey(4.0f, 5.5f);
+	Level->AddKey(5.0f, 7.0f);
+
+	FRichCurve* Health = HealthPressureCurve.GetRichCurve();
+	Health->AddKey(0.0f, 0.6f);
+	Health->AddKey(0.5f, 0.85f);
+	Health->AddKey(1.0f, 1.0f);
+
+	FRichCurve* Integrity = IntegrityPressureCurve.GetRichCurve();
+	Integrity->AddKey(0.0f, 0.7f);
+	Integrity->AddKey(1.0f, 1.0f);
+
+	DifficultyBudgetScale.Add(ERoomDifficulty::Easy, 0.75f);
+	DifficultyBudgetScale.Add(ERoomDifficulty::Medium, 1.0f);
+	DifficultyBudgetScale.Add(ERoomDifficulty::Hard, 1.25f);
+	DifficultyBudgetScale.Add(ERoomDifficulty::Boss, 1.5f);
+}
+
+FEncounterDirector::FEncounterDirector()
+{
+	Initialize(FEncounterDirectorSettings());
+}
+
+void FEncounterDirector::Initialize(const FEncounterDirectorSettings& InSettings)
+{
+	Settings = InSettings;
+
+	const FRichCurve* LevelCurve = Settings.LevelBudgetCurve.GetRichCurveConst();
+	LevelBudget.SetNum(MaxLevel + 1);
+	for (int32 Level = 0; Level <= MaxLevel; ++Level)
+	{
+		LevelBudget[Level] = LevelCurve->Eval(static_cast<float>(FMath::Max(Level, 1)), 1.0f);
+	}
+
+	const FRichCurve* HealthCurve = Settings.HealthPressureCurve.GetRichCurveConst();
+	const FRichCurve* IntegrityCurve = Settings.IntegrityPressureCurve.GetRichCurveConst();
+	HealthPressure.SetNum(CurveSamples);
+	IntegrityPressure.SetNum(CurveSamples);
+	for (int32 i = 0; i < CurveSamples; ++i)
+	{
+		const float Fraction = static_cast<float>(i) / (CurveSamples - 1);
+		HealthPressure[i] = HealthCurve->Eval(Fraction, 1.0f);
+		IntegrityPressure[i] = IntegrityCurve->Eval(Fraction, 1.0f);
+	}
+
+	for (int32 i = 0; i < UE_ARRAY_COUNT(DifficultyScale); ++i)
+	{
+		const float* Scale = Settings.DifficultyBudgetScale.Find(static_cast<ERoomDifficulty>(i));
+		DifficultyScale[i] = Scale ? *Scale : 1.0f;
+	}
+}
+
+float FEncounterDirector::SampleFraction(const TArray<float>& Table, float Fraction)
+{
+	const float Position = FMath::Clamp(Fraction, 0.0f, 1.0f) * (Table.Num() - 1);
+	const int32 Index = FMath::Min(FMath::FloorToInt(Position), Table.Num() - 2);
+	return FMath::Lerp(Table[Index], Table[Index + 1], Position - Index);
+}
+
+FEncounterPlan FEncounterDirector::PlanEncounter(const FRunProgressData& Progress, int32 BaseEnemyPower, ERoomDifficulty Difficulty,
+	bool bHasHazard, float MaxHealth, float MaxIntegrity) const
+{
+	FEncounterPlan Plan;
+
+	// Budget: level base, eased off for a hurt player or failing station, raised for skilled parrying
+	const int32 Level = FMath::Clamp(Progress.CurrentLevel, 1, MaxLevel);
+	const float HealthFraction = MaxHealth > 0.0f ? Progress.PlayerHealth / MaxHealth : 1.0f;
+	const float IntegrityFraction = MaxIntegrity > 0.0f ? Progress.StationIntegrity / MaxIntegrity : 1.0f;
+	const float ParryBonus = FMath::Min(Progress.PerfectParries * Settings.BudgetPerPerfectParry, Settings.MaxPerfectParryBonus);
+
+	Plan.Budget = LevelBudget[Level]
+		* SampleFraction(HealthPressure, HealthFraction)
+		* SampleFraction(IntegrityPressure, IntegrityFraction)
+		* DifficultyScale[FMath::Clamp(static_cast<int32>(Difficulty), 0, 3)]
+		+ ParryBonus;
+
+	// Split the budget, a room without a hazard puts that share into the enemy
+	const float HazardBudget = bHasHazard ? Plan.Budget * Settings.HazardShare : 0.0f;
+	const float TempoBudget = Plan.Budget * Settings.TempoShare;
+	const float EnemyBudget = FMath::Max(Plan.Budget - HazardBudget - TempoBudget, 0.0f);
+
+	Plan.EnemyPower = FMath::Clamp(BaseEnemyPower + FMath::FloorToInt(EnemyBudget / Settings.EnemyPowerCost), 1, 10);
+
+	Plan.HazardIntensity = bHasHazard
+		? FMath::Clamp(HazardBudget / Settings.HazardIntensityCost, Settings.MinHazardIntensity, Settings.MaxHazardIntensity)
+		: 1.0f;
+
+	Plan.EnemySpawnDelay = FMath::Clamp(Settings.MaxEnemySpawnDelay - TempoBudget / Settings.SpawnDelayCostPerSecond,
+		Settings.MinEnemySpawnDelay, Settings.MaxEnemySpawnDelay);
+
+	return Plan;
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/CurveFloat.h"
+#include "Atlas/Data/RoomDataAsset.h"
+#include "EncounterDirector.generated.h"
+
+struct FRunProgressData;
+
+/**
+ * Tuning for the encounter director. The curves are baked into lookup tables
+ * once when the director is initialized, planning a room only reads the tables.
+ */
+USTRUCT(BlueprintType)
+struct ATLAS_API FEncounterDirectorSettings
+{
+	GENERATED_BODY()
+
+	/** Base difficulty budget per run level (1-5) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget")
+	FRuntimeFloatCurve LevelBudgetCurve;
+
+	/** Budget multiplier by player health fraction, hurt players get an easier room */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget")
+	FRuntimeFloatCurve HealthPressureCurve;
+
+	/** Budget multiplier by station integrity fraction */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget")
+	FRuntimeFloatCurve IntegrityPressureCurve;
+
+	/** Budget multiplier per room difficulty */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget")
+	TMap<ERoomDifficulty, float> DifficultyBudgetScale;
+
+	/** Extra budget per perfect parry so far in the run */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget", meta = (ClampMin = "0.0"))
+	float BudgetPerPerfectParry = 0.2f;
+
+	/** Cap on the perfect parry bonus */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget", meta = (ClampMin = "0.0"))
+	float MaxPerfectParryBonus = 1.5f;
+
+	/** Share of the budget spent on hazards when the room has one, the rest goes to enemy power and tempo */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spending", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float HazardShare = 0.25f;
+
+	/** Share of the budget spent on a shorter enemy spawn delay */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spending", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float TempoShare = 0.15f;
+
+	/** Budget for one enemy power level above the GDD base (player slots + 1) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spending", meta = (ClampMin = "0.1"))
+	float EnemyPowerCost = 1.5f;
+
+	/** Budget for hazard intensity 1.0 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spending", meta = (ClampMin = "0.1"))
+	float HazardIntensityCost = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spending", meta = (ClampMin = "0.0"))
+	float MinHazardIntensity = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spending", meta = (ClampMin = "0.0"))
+	float MaxHazardIntensity = 2.0f;
+
+	/** Budget per second taken off the enemy spawn delay */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spending", meta = (ClampMin = "0.1"))
+	float SpawnDelayCostPerSecond = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spending", meta = (ClampMin = "0.0"))
+	float MinEnemySpawnDelay = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spending", meta = (ClampMin = "0.0"))
+	float MaxEnemySpawnDelay = 3.0f;
+
+	FEncounterDirectorSettings();
+};
+
+/**
+ * What the director decided for one room
+ */
+USTRUCT(BlueprintType)
+struct ATLAS_API FEncounterPlan
+{
+	GENERATED_BODY()
+
+	/** Total difficulty budget for the room */
+	UPROPERTY(BlueprintReadOnly)
+	float Budget = 0.0f;
+
+	/** Power level handed to the enemy's AIDifficultyComponent */
+	UPROPERTY(BlueprintReadOnly)
+	int32 EnemyPower = 1;
+
+	/** Multiplier on hazard damage, 1 is the authored value */
+	UPROPERTY(BlueprintReadOnly)
+	float HazardIntensity = 1.0f;
+
+	/** Seconds between room activation and the enemy spawning */
+	UPROPERTY(BlueprintReadOnly)
+	float EnemySpawnDelay = 2.0f;
+};
+
+/**
+ * Turns run progress into a per-room difficulty budget and spends it on enemy
+ * power, hazard intensity and spawn timing. Plain C++ so it can be driven
+ * headless by Atlas.Bench.EncounterDirector.
+ */
+class ATLAS_API FEncounterDirector
+{
+public:
+	FEncounterDirector();
+
+	/** Bake the settings' curves into lookup tables */
+	void Initialize(const FEncounterDirectorSettings& InSettings);
+
+	/**
+	 * Plan one room
+	 * @param Progress Run progress, CurrentLevel, PlayerHealth, StationIntegrity and PerfectParries are used
+	 * @param BaseEnemyPower Power before the budget is spent, usually URoomDataAsset::GetScaledEnemyPower
+	 * @param Difficulty Authored room difficulty
+	 * @param bHasHazard Whether the room has a hazard to spend budget on
+	 * @param MaxHealth Player max health, to turn PlayerHealth into a fraction
+	 * @param MaxIntegrity Station max integrity, to turn StationIntegrity into a fraction
+	 */
+	FEncounterPlan PlanEncounter(const FRunProgressData& Progress, int32 BaseEnemyPower, ERoomDifficulty Difficulty,
+		bool bHasHazard, float MaxHealth, float MaxIntegrity) const;
+
+	const FEncounterDirectorSettings& GetSettings() const { return Settings; }
+
+	/** Samples per baked fraction curve */
+	static constexpr int32 CurveSamples = 33;
+
+	/** Highest run level with its own budget entry */
+	static constexpr int32 MaxLevel = 5;
+
+private:
+	/** Linear lookup into a table baked over [0, 1] */
+	static float SampleFraction(const TArray<float>& Table, float Fraction);
+
+	FEncounterDirectorSettings Settings;
+
+	TArray<float> LevelBudget;
+	TArray<float> HealthPressure;
+	TArray<float> IntegrityPressure;
+	float DifficultyScale[4];
+};
@@ -4,6 +4,13 @@
 #include "Atlas/Characters/GameCharacterBase.h"
 #include "Atlas/Components/HealthComponent.h"
 #include "Atlas/Components/RunManagerComponent.h"
+#include "Atlas/Components/PlayerModelComponent.h"
+#include "Atlas/Components/RoomPerceptionComponent.h"
+#include "Atlas/Components/AIDifficultyComponent.h"
+#include "Atlas/AI/EnemyAIController.h"
+#include "Atlas/AI/EnemyPoolSubsystem.h"
+#include "Atlas/Hazards/EnvironmentalHazardComponent.h"
+#include "EngineUtils.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
@@ -88,6 +95,12 @@ ARoomBase::ARoomBase()
 		InteractableSpawnPoints[2]->SetRelativeLocation(FVector(0.0f, 300.0f, 100.0f));
 	}
 
+	// Create shared player model
+	PlayerModel = CreateDefaultSubobject<UPlayerModelComponent>(TEXT("PlayerModel"));
+
+	// Create shared enemy sight
+	PerceptionHub = CreateDefaultSubobject<URoomPerceptionComponent>(TEXT("PerceptionHub"));
+
 	// Default configuration
 	EnemySpawnDelay = 2.0f;
 	bLockExitUntilClear = true;
@@ -116,15 +129,33 @@ void ARoomBase::ActivateRoom(URoomDataAsset* RoomData)
 	bIsRoomActive = true;
 	RoomActivationTime = GetWorld()->GetTimeSeconds();
 
+	// Hazard intensity and spawn timing come from the run's encounter plan for this room
+	URunManagerComponent* RunManager = FindRunManager();
+	if (RunManager && RunManager->GetCurrentRoom() == RoomData)
+	{
+		RunManager->ApplyEncounterToRoom(this);
+	}
+
+	// Start learning the player's habits for this room's enemies
+	if (PlayerModel)
+	{
+		PlayerModel->BindToPlayer(UGameplayStatics::GetPlayerPawn(this, 0));
+	}
+
 	// Apply environmental effects
 	ApplyEnvironmentalEffects();
 
 	// Start combat music
 	StartCombatMusic();
 
-	// Spawn enemy after delay
+	// Spawn enemy after delay, pre-warmed now so the timer only has to wake it
 	if (EnemySpawnDelay > 0.0f)
 	{
+		if (UEnemyPoolSubsystem* EnemyPool = UEnemyPoolSubsystem::Get(this))
+		{
+			EnemyPool->Prewarm(RoomData->UniqueEnemy);
+		}
+
 		FTimerHandle SpawnTimer;
 		GetWorld()->GetTimerManager().SetTimer(SpawnTimer, this, &ARoomBase::SpawnRoomEnemy, EnemySpawnDelay, false);
 	}
@@ -154,6 +185,11 @@ void ARoomBase::DeactivateRoom()
 {
 	bIsRoomActive = false;
 
+	if (PlayerModel)
+	{
+		PlayerModel->UnbindFromPlayer();
+	}
+
 	// Clear all spawned entities
 	ClearSpawnedEntities();
 
@@ -196,11 +232,8 @@ void ARoomBase::SpawnRoomEnemy()
 	// Get spawn transform
 	FTransform SpawnTransform = GetEnemySpawnPoint();
 
-	// Spawn enemy
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-	SpawnedEnemy = GetWorld()->SpawnActor<AGameCharacterBase>(CurrentRoomData->UniqueEnemy, SpawnTransform, SpawnParams);
+	// Spawn enemy, or wake the one pre-warmed in ActivateRoom
+	SpawnedEnemy = UEnemyPoolSubsystem::AcquireEnemy(this, CurrentRoomData->UniqueEnemy, SpawnTransform);
 
 	if (SpawnedEnemy)
 	{
@@ -210,16 +243,30 @@ void ARoomBase::SpawnRoomEnemy()
 			HealthComp->OnDeath.AddDynamic(this, &ARoomBase::OnEnemyDefeated);
 		}
 
+		// Read player patterns from the room's shared model
+		if (UAIDifficultyComponent* Difficulty = SpawnedEnemy->FindComponentByClass<UAIDifficultyComponent>())
+		{
+			Difficulty->SetSharedPlayerModel(PlayerModel);
+		}
+
+		// See the player through the room's sight hub, even if the spawn point is outside the room radius
+		if (AEnemyAIController* EnemyController = SpawnedEnemy->GetController<AEnemyAIController>())
+		{
+			EnemyController->SetPerceptionHub(PerceptionHub);
+		}
+
 		// Fire custom spawn event
 		BP_CustomEnemySpawn(SpawnedEnemy);
 
 		// Notify RunManagerComponent about the spawned enemy
-		if (AGameModeBase* GameMode = GetWorld()->GetAuthGameMode())
+		if (URunManagerComponent* RunManager = FindRunManager())
 		{
-			if (URunManagerComponent* RunManager = GameMode->FindComponentByClass<URunManagerComponent>())
+			// Scale with the run's encounter plan when this is the run's current room
+			if (RunManager->GetCurrentRoom() == CurrentRoomData)
 			{
-				RunManager->ShowEnemyHealthWidget(SpawnedEnemy);
+				RunManager->ApplyEnemyScaling(SpawnedEnemy);
 			}
+			RunManager->ShowEnemyHealthWidget(SpawnedEnemy);
 		}
 	}
 }
@@ -252,6 +299,7 @@ void ARoomBase::SpawnRoomHazards()
 		AActor* Hazard = GetWorld()->SpawnActor<AActor>(*HazardClass, SpawnPoint->GetComponentTransform(), SpawnParams);
 		if (Hazard)
 		{
+			ApplyHazardIntensity(Hazard);
 			SpawnedHazards.Add(Hazard);
 		}
 	}
@@ -292,10 +340,10 @@ void ARoomBase::SpawnRoomInteractables()
 
 void ARoomBase::ClearSpawnedEntities()
 {
-	// Destroy enemy
+	// Return enemy to the pool
 	if (SpawnedEnemy)
 	{
-		SpawnedEnemy->Destroy();
+		UEnemyPoolSubsystem::ReleaseEnemy(SpawnedEnemy);
 		SpawnedEnemy = nullptr;
 	}
 
@@ -320,6 +368,42 @@ void ARoomBase::ClearSpawnedEntities()
 	SpawnedInteractables.Empty();
 }
 
+void ARoomBase::SetHazardIntensity(float Intensity)
+{
+	HazardIntensity = FMath::Max(Intensity, 0.0f);
+
+	for (AActor* Hazard : SpawnedHazards)
+	{
+		ApplyHazardIntensity(Hazard);
+	}
+}
+
+void ARoomBase::ApplyHazardIntensity(AActor* Hazard) const
+{
+	if (!Hazard)
+	{
+		return;
+	}
+
+	TInlineComponentArray<UEnvironmentalHazardComponent*> HazardComponents(Hazard);
+	for (UEnvironmentalHazardComponent* HazardComp : HazardComponents)
+	{
+		// Scale from the archetype's values so repeated calls don't compound
+		const UEnvironmentalHazardComponent* Archetype = Cast<UEnvironmentalHazardComponent>(HazardComp->GetArchetype());
+		if (Archetype)
+		{
+			HazardComp->DamagePerSecond = Archetype->DamagePerSecond * HazardIntensity;
+			HazardComp->IntegrityDamagePerSecond = Archetype->IntegrityDamagePerSecond * HazardIntensity;
+		}
+	}
+}
+
+URunManagerComponent* ARoomBase::FindRunManager() const
+{
+	AGameModeBase* GameMode = GetWorld() ? GetWorld()->GetAuthGameMode() : nullptr;
+	return GameMode ? GameMode->FindComponentByClass<URunManagerComponent>() : nullptr;
+}
+
 FTransform ARoomBase::GetPlayerSpawnPoint() const
 {
 	return PlayerSpawnPoint ? PlayerSpawnPoint->GetComponentTransform() : FTransform();
@@ -539,6 +623,13 @@ void ARoomBase::ResetRoom()
 	bTestRoomCompleted = false;
 	SpawnedEnemy = nullptr;
 	
+	// Forget what was learned about the player
+	if (PlayerModel)
+	{
+		PlayerModel->UnbindFromPlayer();
+		PlayerModel->ResetModel();
+	}
+	
 	// Remove environmental effects
 	RemoveEnvironmentalEffects();
 	
@@ -559,14 +650,44 @@ bool ARoomBase::IsPlayerInRoom() const
 {
 	if (APawn* PlayerPawn = GetWorld()->GetFirstPlayerController()->GetPawn())
 	{
-		FVector PlayerLocation = PlayerPawn->GetActorLocation();
-		FVector RoomCenter = TestArenaPosition;
+		return IsLocationInRoom(PlayerPawn->GetActorLocation());
+	}
+	
+	return false;
+}
+
+bool ARoomBase::IsLocationInRoom(const FVector& Location) const
+{
+	// Check if location is within room radius (2D check)
+	return FVector::Dist2D(Location, TestArenaPosition) <= RoomRadius;
+}
+
+ARoomBase* ARoomBase::FindRoomContaining(const UObject* WorldContextObject, const FVector& Location)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World)
+	{
+		return nullptr;
+	}
+	
+	ARoomBase* InactiveMatch = nullptr;
+	for (TActorIterator<ARoomBase> It(World); It; ++It)
+	{
+		if (!It->IsLocationInRoom(Location))
+		{
+			continue;
+		}
 		
-		// Check if player is within room radius (2D check)
-		float Distance2D = FVector::Dist2D(PlayerLocation, RoomCenter);
+		if (It->IsRoomActive())
+		{
+			return *It;
+		}
 		
-		return Distance2D <= RoomRadius;
+		if (!InactiveMatch)
+		{
+			InactiveMatch = *It;
+		}
 	}
 	
-	return false;
+	return InactiveMatch;
 }
\ No newline at end of file
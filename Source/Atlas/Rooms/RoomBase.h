@@ -9,6 +9,8 @@
 class UBoxComponent;
 class UArrowComponent;
 class AGameCharacterBase;
+class UPlayerModelComponent;
+class URoomPerceptionComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRoomBaseCompleted, ARoomBase*, CompletedRoom);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRoomBaseActivated, ARoomBase*, ActivatedRoom);
@@ -86,6 +88,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Room|Spawning")
 	virtual void ClearSpawnedEntities();
 	
+	/**
+	 * Scale hazard damage, applied to spawned hazards now and to hazards spawned later
+	 * @param Intensity Multiplier on the hazards' authored damage
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Room|Spawning")
+	void SetHazardIntensity(float Intensity);
+	
+	/**
+	 * Set the delay between activation and the enemy spawning
+	 * @param Delay Seconds, 0 spawns immediately
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Room|Spawning")
+	void SetEnemySpawnDelay(float Delay) { EnemySpawnDelay = FMath::Max(Delay, 0.0f); }
+	
 	// ========================================
 	// TEST ARENA SUPPORT
 	// ========================================
@@ -114,6 +130,20 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Room|Testing")
 	bool IsPlayerInRoom() const;
 	
+	/**
+	 * Check if a world location is within this room's radius
+	 */
+	UFUNCTION(BlueprintPure, Category = "Room|Testing")
+	bool IsLocationInRoom(const FVector& Location) const;
+	
+	/**
+	 * Find the room containing a location, preferring active rooms
+	 * @param WorldContextObject Any object in the world to search
+	 * @param Location World location to test
+	 * @return The containing room or null
+	 */
+	static ARoomBase* FindRoomContaining(const UObject* WorldContextObject, const FVector& Location);
+	
 	// ========================================
 	// SPAWN POINTS
 	// ========================================
@@ -170,6 +200,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Room|Queries")
 	TArray<AActor*> GetSpawnedHazards() const { return SpawnedHazards; }
 	
+	/**
+	 * Get the player model shared by every enemy in this room
+	 */
+	UFUNCTION(BlueprintPure, Category = "Room|Queries")
+	UPlayerModelComponent* GetPlayerModel() const { return PlayerModel; }
+	
+	/**
+	 * Get the sight hub shared by every enemy in this room
+	 */
+	UFUNCTION(BlueprintPure, Category = "Room|Queries")
+	URoomPerceptionComponent* GetPerceptionHub() const { return PerceptionHub; }
+	
 	// ========================================
 	// EVENTS
 	// ========================================
@@ -236,6 +278,12 @@ protected:
 	/** Remove room-specific environmental effects */
 	virtual void RemoveEnvironmentalEffects();
 	
+	/** Scale one hazard actor's damage by HazardIntensity */
+	void ApplyHazardIntensity(AActor* Hazard) const;
+	
+	/** Run manager on the game mode, if any */
+	class URunManagerComponent* FindRunManager() const;
+	
 	/** Start combat music for this room */
 	virtual void StartCombatMusic();
 	
@@ -279,6 +327,14 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	TArray<UArrowComponent*> InteractableSpawnPoints;
 	
+	/** Player pattern analysis shared by the room's enemies */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	UPlayerModelComponent* PlayerModel;
+	
+	/** Player visibility computed once for all of the room's enemies */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	URoomPerceptionComponent* PerceptionHub;
+	
 	// ========================================
 	// ROOM STATE
 	// ========================================
@@ -303,6 +359,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
 	TArray<AActor*> SpawnedInteractables;
 	
+	/** Multiplier on spawned hazards' damage, set by the run's encounter plan */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
+	float HazardIntensity = 1.0f;
+	
 	/** Time when room was activated */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State")
 	float RoomActivationTime;
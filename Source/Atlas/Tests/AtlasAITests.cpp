@@ -0,0 +1,295 @@
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "EngineUtils.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "AtlasTestWorld.h"
+#include "Atlas/Characters/EnemyCharacter.h"
+#include "Atlas/Components/HealthComponent.h"
+#include "Atlas/Components/ActionManagerComponent.h"
+#include "Atlas/Components/VulnerabilityComponent.h"
+#include "Atlas/Components/StationIntegrityComponent.h"
+#include "Atlas/Components/SlotManagerComponent.h"
+#include "Atlas/Components/AIDifficultyComponent.h"
+#include "Atlas/Components/PlayerModelComponent.h"
+#include "Atlas/AI/EnemyAIController.h"
+#include "Atlas/AI/EnemyPoolSubsystem.h"
+#include "Atlas/Rooms/RoomBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** Everything a room relies on after spawning, location excluded since fresh spawns get nudged apart */
+    TArray<FString> DescribeEnemy(AGameCharacterBase* Enemy)
+    {
+        TArray<FString> State;
+        if (!Enemy) return State;
+
+        if (UHealthComponent* Health = Enemy->GetHealthComponent())
+        {
+            State.Add(FString::Printf(TEXT("Health %.1f/%.1f"), Health->GetCurrentHealth(), Health->GetMaxHealth()));
+            State.Add(FString::Printf(TEXT("Poise %.1f/%.1f"), Health->GetCurrentPoise(), Health->GetMaxPoise()));
+            State.Add(FString::Printf(TEXT("Dead %d Staggered %d Invincible %d"), Health->IsDead(), Health->IsStaggered(), Health->IsInvincible()));
+        }
+        if (UActionManagerComponent* ActionManager = Enemy->GetActionManagerComponent())
+        {
+            State.Add(FString::Printf(TEXT("Action active %d"), ActionManager->IsActionActive()));
+            State.Add(FString::Printf(TEXT("Blocking %d Parrying %d"), ActionManager->IsBlocking(), ActionManager->IsParrying()));
+            for (const FName& SlotName : ActionManager->GetAllSlotNames())
+            {
+                const UActionInstance* Action = ActionManager->GetActionInSlot(SlotName);
+                State.Add(FString::Printf(TEXT("%s %s cooldown %.2f"), *SlotName.ToString(),
+                    Action ? *Action->GetActionTag().ToString() : TEXT("empty"), Action ? Action->GetCooldownRemaining() : 0.0f));
+            }
+        }
+        if (UVulnerabilityComponent* Vulnerability = Enemy->GetVulnerabilityComponent())
+        {
+            State.Add(FString::Printf(TEXT("Vulnerable %d IFrames %d"), Vulnerability->IsVulnerable(), Vulnerability->HasIFrames()));
+        }
+        if (UStationIntegrityComponent* Integrity = Enemy->GetStationIntegrityComponent())
+        {
+            State.Add(FString::Printf(TEXT("Integrity %.1f%%"), Integrity->GetIntegrityPercent()));
+        }
+        if (USlotManagerComponent* Slots = Enemy->GetSlotManagerComponent())
+        {
+            State.Add(FString::Printf(TEXT("Rewards %d"), Slots->GetUsedSlotCount()));
+        }
+        if (UAIDifficultyComponent* Difficulty = Enemy->FindComponentByClass<UAIDifficultyComponent>())
+        {
+            State.Add(FString::Printf(TEXT("Power %d"), Difficulty->GetPowerLevel()));
+        }
+        State.Add(FString::Printf(TEXT("Walk speed %.1f Movement mode %d"), Enemy->GetCharacterMovement()->MaxWalkSpeed, static_cast<int32>(Enemy->GetCharacterMovement()->MovementMode)));
+        State.Add(FString::Printf(TEXT("Hidden %d Collision %d Ticking %d"), Enemy->IsHidden(), Enemy->GetActorEnableCollision(), Enemy->IsActorTickEnabled()));
+        State.Add(FString::Printf(TEXT("Controller %s"), Enemy->GetController() ? *Enemy->GetController()->GetClass()->GetName() : TEXT("none")));
+        return State;
+    }
+
+    AGameCharacterBase* SpawnFreshEnemy(UWorld* World, const FTransform& SpawnTransform)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+        AGameCharacterBase* Enemy = World->SpawnActor<AGameCharacterBase>(AEnemyCharacter::StaticClass(), SpawnTransform, SpawnParams);
+        if (Enemy && !Enemy->GetController())
+        {
+            Enemy->SpawnDefaultController();
+        }
+        return Enemy;
+    }
+
+    /** Room model and sight hub an enemy ended up bound to */
+    void GetRoomBindings(AGameCharacterBase* Enemy, UPlayerModelComponent*& OutModel, URoomPerceptionComponent*& OutHub)
+    {
+        const UAIDifficultyComponent* Difficulty = Enemy->FindComponentByClass<UAIDifficultyComponent>();
+        const AEnemyAIController* Controller = Enemy->GetController<AEnemyAIController>();
+        OutModel = Difficulty ? Difficulty->GetSharedPlayerModel() : nullptr;
+        OutHub = Controller ? Controller->GetPerceptionHub() : nullptr;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasEnemyPoolReuseTest, "Atlas.AI.EnemyPool.ReusedMatchesFresh",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasEnemyPoolReuseTest::RunTest(const FString& Parameters)
+{
+    FAtlasTestWorld World;
+    UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(World.Get());
+    if (!TestNotNull(TEXT("Enemy pool"), Pool)) return false;
+
+    const TSubclassOf<AGameCharacterBase> EnemyClass = AEnemyCharacter::StaticClass();
+    const FTransform SpawnTransform(FVector(600.0f, 0.0f, 100.0f));
+
+    // Put an enemy through a rough fight and send it back
+    Pool->Prewarm(EnemyClass);
+    AGameCharacterBase* Used = Pool->Acquire(EnemyClass, SpawnTransform);
+    if (!TestNotNull(TEXT("Acquired enemy"), Used)) return false;
+
+    if (UHealthComponent* Health = Used->GetHealthComponent())
+    {
+        Health->TakeDamage(Health->GetMaxHealth() * 0.6f, nullptr);
+        Health->TakePoiseDamage(Health->GetMaxPoise());
+    }
+    if (UVulnerabilityComponent* Vulnerability = Used->GetVulnerabilityComponent())
+    {
+        Vulnerability->ApplyVulnerability();
+        Vulnerability->StartIFrames();
+    }
+    if (UActionManagerComponent* ActionManager = Used->GetActionManagerComponent())
+    {
+        const TArray<FName> SlotNames = ActionManager->GetAllSlotNames();
+        if (SlotNames.Num() > 0)
+        {
+            ActionManager->ClearSlot(SlotNames[0]);
+        }
+    }
+    if (UStationIntegrityComponent* Integrity = Used->GetStationIntegrityComponent())
+    {
+        Integrity->SetIntegrityPercent(25.0f);
+    }
+    if (UAIDifficultyComponent* Difficulty = Used->FindComponentByClass<UAIDifficultyComponent>())
+    {
+        Difficulty->SetPowerLevel(9);
+    }
+    Used->GetCharacterMovement()->MaxWalkSpeed *= 2.0f;
+    Pool->Release(Used);
+
+    TestTrue(TEXT("Released enemy is dormant"), UEnemyPoolSubsystem::IsDormant(Used));
+
+    // The next acquire hands back the same actor, indistinguishable from a fresh spawn
+    AGameCharacterBase* Reused = Pool->Acquire(EnemyClass, SpawnTransform);
+    AGameCharacterBase* Fresh = SpawnFreshEnemy(World.Get(), SpawnTransform);
+    TestTrue(TEXT("Acquire reuses the released enemy"), Reused == Used);
+    TestFalse(TEXT("Acquired enemy is not dormant"), UEnemyPoolSubsystem::IsDormant(Reused));
+
+    const TArray<FString> ReusedState = DescribeEnemy(Reused);
+    const TArray<FString> FreshState = DescribeEnemy(Fresh);
+    TestEqual(TEXT("State lines"), ReusedState.Num(), FreshState.Num());
+    for (int32 i = 0; i < FMath::Min(ReusedState.Num(), FreshState.Num()); ++i)
+    {
+        TestEqual(TEXT("Reused enemy matches a fresh spawn"), ReusedState[i], FreshState[i]);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasEnemyPoolDormantTest, "Atlas.AI.EnemyPool.DormantEnemiesBindNoRoom",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasEnemyPoolDormantTest::RunTest(const FString& Parameters)
+{
+    FAtlasTestWorld World;
+    UEnemyPoolSubsystem* Pool = UEnemyPoolSubsystem::Get(World.Get());
+    if (!TestNotNull(TEXT("Enemy pool"), Pool)) return false;
+
+    // A room around the XY origin, right above where dormant enemies are parked
+    ARoomBase* Room = World->SpawnActor<ARoomBase>();
+    if (!TestNotNull(TEXT("Room"), Room)) return false;
+    TestTrue(TEXT("Room covers the XY origin"), Room->IsLocationInRoom(FVector::ZeroVector));
+
+    const TSubclassOf<AGameCharacterBase> EnemyClass = AEnemyCharacter::StaticClass();
+    Pool->Prewarm(EnemyClass);
+
+    AGameCharacterBase* Dormant = nullptr;
+    for (TActorIterator<AEnemyCharacter> It(World.Get()); It; ++It)
+    {
+        Dormant = *It;
+    }
+    if (!TestNotNull(TEXT("Prewarmed enemy"), Dormant)) return false;
+    TestTrue(TEXT("Prewarmed enemy is dormant"), UEnemyPoolSubsystem::IsDormant(Dormant));
+
+    UPlayerModelComponent* Model = nullptr;
+    URoomPerceptionComponent* Hub = nullptr;
+    GetRoomBindings(Dormant, Model, Hub);
+    TestNull(TEXT("Prewarmed enemy reads no room model"), Model);
+    TestNull(TEXT("Prewarmed enemy sees through no room hub"), Hub);
+
+    // Placed inside the room, it binds to that room
+    AGameCharacterBase* Inside = Pool->Acquire(EnemyClass, FTransform(FVector(500.0f, 0.0f, 100.0f)));
+    TestTrue(TEXT("Acquire reuses the prewarmed enemy"), Inside == Dormant);
+    GetRoomBindings(Inside, Model, Hub);
+    TestTrue(TEXT("Enemy placed in the room reads its model"), Model == Room->GetPlayerModel());
+    TestTrue(TEXT("Enemy placed in the room sees through its hub"), Hub == Room->GetPerceptionHub());
+
+    // Released, it lets go of the room
+    Pool->Release(Inside);
+    GetRoomBindings(Inside, Model, Hub);
+    TestNull(TEXT("Released enemy reads no room model"), Model);
+    TestNull(TEXT("Released enemy sees through no room hub"), Hub);
+
+    // Placed outside every room, it stays unbound
+    AGameCharacterBase* Outside = Pool->Acquire(EnemyClass, FTransform(FVector(100000.0f, 0.0f, 100.0f)));
+    TestTrue(TEXT("Acquire reuses the released enemy"), Outside == Dormant);
+    GetRoomBindings(Outside, Model, Hub);
+    TestNull(TEXT("Enemy outside every room reads no room model"), Model);
+    TestNull(TEXT("Enemy outside every room sees through no room hub"), Hub);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasPlayerModelTest, "Atlas.AI.PlayerModel.MatchesBruteForce",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasPlayerModelTest::RunTest(const FString& Parameters)
+{
+    const int32 NumActions = 2000;
+    const int32 WindowSize = 20;
+
+    struct FTraceEntry
+    {
+        FGameplayTag Tag;
+        EPlayerActionCategory Expected;
+    };
+
+    const FTraceEntry Vocabulary[] = {
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.BasicAttack")), EPlayerActionCategory::Attack },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.HeavyAttack")), EPlayerActionCategory::HeavyAttack },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Block")), EPlayerActionCategory::Block },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Parry")), EPlayerActionCategory::Parry },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.Dash")), EPlayerActionCategory::Dash },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.SoulAttack")), EPlayerActionCategory::Other },
+        { FGameplayTag::RequestGameplayTag(TEXT("Action.Combat.FocusMode")), EPlayerActionCategory::Other },
+    };
+    const int32 VocabularySize = UE_ARRAY_COUNT(Vocabulary);
+
+    for (const FTraceEntry& Entry : Vocabulary)
+    {
+        TestTrue(FString::Printf(TEXT("%s classified"), *Entry.Tag.ToString()), FPlayerActionModel::ClassifyAction(Entry.Tag) == Entry.Expected);
+    }
+
+    // Seeded trace of actions with uneven gaps
+    FRandomStream Stream(31);
+    FPlayerActionModel Model(WindowSize);
+    TArray<int32> Trace;
+    TArray<double> Times;
+    double Time = 0.0;
+    for (int32 i = 0; i < NumActions; ++i)
+    {
+        Trace.Add(Stream.RandRange(0, VocabularySize - 1));
+        Time += Stream.FRandRange(0.1f, 1.5f);
+        Times.Add(Time);
+        Model.RecordAction(Vocabulary[Trace.Last()].Tag, Time);
+    }
+
+    // Lifetime and window counts against a recount of the trace
+    int32 ExpectedCounts[static_cast<int32>(EPlayerActionCategory::Count)] = {};
+    int32 ExpectedWindowCounts[static_cast<int32>(EPlayerActionCategory::Count)] = {};
+    for (int32 i = 0; i < NumActions; ++i)
+    {
+        const int32 Category = static_cast<int32>(Vocabulary[Trace[i]].Expected);
+        ++ExpectedCounts[Category];
+        if (i >= NumActions - WindowSize)
+        {
+            ++ExpectedWindowCounts[Category];
+        }
+    }
+    for (int32 Category = 0; Category < static_cast<int32>(EPlayerActionCategory::Count); ++Category)
+    {
+        const EPlayerActionCategory CategoryEnum = static_cast<EPlayerActionCategory>(Category);
+        const FString CategoryName = UEnum::GetValueAsString(CategoryEnum);
+        TestEqual(FString::Printf(TEXT("%s count"), *CategoryName), Model.GetCount(CategoryEnum), ExpectedCounts[Category]);
+        TestEqual(FString::Printf(TEXT("%s window count"), *CategoryName), Model.GetWindowCount(CategoryEnum), ExpectedWindowCounts[Category]);
+    }
+
+    // Running mean and variance against a brute force pass over the last window of intervals
+    TArray<float> Intervals;
+    for (int32 i = FMath::Max(NumActions - WindowSize, 1); i < NumActions; ++i)
+    {
+        Intervals.Add(static_cast<float>(Times[i] - Times[i - 1]));
+    }
+    float ExpectedMean = 0.0f;
+    for (float Interval : Intervals)
+    {
+        ExpectedMean += Interval / Intervals.Num();
+    }
+    float ExpectedVariance = 0.0f;
+    for (float Interval : Intervals)
+    {
+        ExpectedVariance += FMath::Square(Interval - ExpectedMean) / Intervals.Num();
+    }
+
+    TestEqual(TEXT("Reaction time mean"), Model.GetReactionTimes().GetMean(), ExpectedMean, 1e-3f);
+    TestEqual(TEXT("Reaction time variance"), Model.GetReactionTimes().GetVariance(), ExpectedVariance, 1e-3f);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
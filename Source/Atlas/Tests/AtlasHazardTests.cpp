@@ -0,0 +1,256 @@
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Engine/OverlapResult.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "AtlasTestWorld.h"
+#include "Atlas/Characters/EnemyCharacter.h"
+#include "Atlas/Hazards/ElectricalSurgeHazard.h"
+#include "Atlas/Hazards/HazardWorldSubsystem.h"
+#include "Atlas/Hazards/ToxicLeakHazard.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr float TestChainRadius = 400.0f;
+    constexpr int32 TestMaxJumps = 5;
+
+    /** Conductive targets scattered over a single room floor */
+    TArray<FVector> ScatterChainTargets(int32 Num, float Extent, int32 Seed)
+    {
+        FRandomStream Stream(Seed);
+        TArray<FVector> Locations;
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Locations.Add(FVector(Stream.FRandRange(-Extent, Extent), Stream.FRandRange(-Extent, Extent), 0.0f));
+        }
+        return Locations;
+    }
+
+    /** Deterministic occlusion, roughly one pair in four is blocked. INDEX_NONE is the chain source. */
+    bool IsPairBlocked(int32 A, int32 B)
+    {
+        return HashCombine(GetTypeHash(FMath::Min(A, B)), GetTypeHash(FMath::Max(A, B))) % 4 == 0;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasChainLightningHashTest, "Atlas.Hazards.ChainLightning.HashMatchesBruteForce",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasChainLightningHashTest::RunTest(const FString& Parameters)
+{
+    const TArray<FVector> Locations = ScatterChainTargets(200, 3000.0f, 1337);
+
+    FHazardSpatialHash Hash(UHazardWorldSubsystem::DamageableCellSize);
+    for (int32 i = 0; i < Locations.Num(); ++i)
+    {
+        Hash.Add(i, Locations[i]);
+    }
+
+    auto AlwaysVisible = [](int32, int32) { return true; };
+
+    // The hash must never drop a reachable target, so a chain over its candidates matches one over every target
+    TArray<int32> CellIndices;
+    TArray<FVector> AllOthers, CandidateLocations;
+    TArray<int32> AllOtherIds, CandidateIds;
+    TArray<int32> BruteChain, Chain;
+    for (int32 SourceId = 0; SourceId < Locations.Num(); ++SourceId)
+    {
+        AllOthers.Reset();
+        AllOtherIds.Reset();
+        for (int32 i = 0; i < Locations.Num(); ++i)
+        {
+            if (i != SourceId)
+            {
+                AllOtherIds.Add(i);
+                AllOthers.Add(Locations[i]);
+            }
+        }
+
+        CellIndices.Reset();
+        CandidateLocations.Reset();
+        CandidateIds.Reset();
+        Hash.Query(Locations[SourceId], TestChainRadius * TestMaxJumps, CellIndices);
+        CellIndices.Sort();
+        for (int32 Id : CellIndices)
+        {
+            if (Id != SourceId)
+            {
+                CandidateIds.Add(Id);
+                CandidateLocations.Add(Locations[Id]);
+            }
+        }
+
+        UElectricalSurgeHazard::BuildChainOrder(Locations[SourceId], AllOthers, TestChainRadius, TestMaxJumps, AlwaysVisible, BruteChain);
+        UElectricalSurgeHazard::BuildChainOrder(Locations[SourceId], CandidateLocations, TestChainRadius, TestMaxJumps, AlwaysVisible, Chain);
+
+        TArray<int32> BruteIds, HashIds;
+        for (int32 Index : BruteChain) BruteIds.Add(AllOtherIds[Index]);
+        for (int32 Index : Chain) HashIds.Add(CandidateIds[Index]);
+
+        if (!TestTrue(FString::Printf(TEXT("Chain from target %d matches brute force"), SourceId), HashIds == BruteIds))
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasChainLightningLimitsTest, "Atlas.Hazards.ChainLightning.RespectsLimits",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasChainLightningLimitsTest::RunTest(const FString& Parameters)
+{
+    // Dense enough that the source has a dozen or so targets in reach
+    const TArray<FVector> Locations = ScatterChainTargets(300, 1500.0f, 7);
+    auto HasLineOfSight = [](int32 From, int32 To) { return !IsPairBlocked(From, To); };
+    const FVector Source = FVector::ZeroVector;
+    const float RadiusSq = FMath::Square(TestChainRadius);
+
+    TArray<int32> Chain;
+    for (int32 MaxJumps = 0; MaxJumps <= TestMaxJumps + 2; ++MaxJumps)
+    {
+        UElectricalSurgeHazard::BuildChainOrder(Source, Locations, TestChainRadius, MaxJumps, HasLineOfSight, Chain);
+
+        TestTrue(FString::Printf(TEXT("At most %d jumps"), MaxJumps), Chain.Num() <= MaxJumps);
+
+        TSet<int32> Visited;
+        int32 FromIndex = INDEX_NONE;
+        FVector FromLocation = Source;
+        for (int32 Index : Chain)
+        {
+            TestFalse(TEXT("No target is chained twice"), Visited.Contains(Index));
+            TestTrue(TEXT("Every jump stays within the chain radius"), FVector::DistSquared(FromLocation, Locations[Index]) <= RadiusSq);
+            TestFalse(TEXT("No jump crosses a blocked line of sight"), IsPairBlocked(FromIndex, Index));
+
+            // Nothing closer was skipped unless it was already chained or out of sight
+            const float JumpDistSq = FVector::DistSquared(FromLocation, Locations[Index]);
+            for (int32 Other = 0; Other < Locations.Num(); ++Other)
+            {
+                if (Other == Index || Visited.Contains(Other) || IsPairBlocked(FromIndex, Other)) continue;
+
+                TestFalse(TEXT("Every jump goes to the nearest visible target"), FVector::DistSquared(FromLocation, Locations[Other]) < JumpDistSq);
+            }
+
+            Visited.Add(Index);
+            FromIndex = Index;
+            FromLocation = Locations[Index];
+        }
+
+        // A chain cut short must have run out of visible targets in reach
+        if (Chain.Num() < MaxJumps)
+        {
+            for (int32 Other = 0; Other < Locations.Num(); ++Other)
+            {
+                if (Visited.Contains(Other) || IsPairBlocked(FromIndex, Other)) continue;
+
+                TestTrue(TEXT("Chain only stops early when nothing visible is in reach"), FVector::DistSquared(FromLocation, Locations[Other]) > RadiusSq);
+            }
+        }
+    }
+
+    // A fully occluded source never arcs
+    UElectricalSurgeHazard::BuildChainOrder(Source, Locations, TestChainRadius, TestMaxJumps, [](int32, int32) { return false; }, Chain);
+    TestEqual(TEXT("Blocked source chains nothing"), Chain.Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasToxicCloudMembershipTest, "Atlas.Hazards.ToxicCloud.MatchesSphereOverlap",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasToxicCloudMembershipTest::RunTest(const FString& Parameters)
+{
+    FAtlasTestWorld World;
+
+    // A real leak, harmless so nobody dies while the cloud grows
+    AActor* Holder = World->SpawnActor<AActor>();
+    UToxicLeakHazard* Hazard = NewObject<UToxicLeakHazard>(Holder);
+    Hazard->bPermanent = true;
+    Hazard->bShowWarningIndicator = false;
+    Hazard->ActivationDelay = 0.0f;
+    Hazard->DamagePerSecond = 0.0f;
+    Hazard->DOTDamagePerSecond = 0.0f;
+    Hazard->IntegrityDamagePerSecond = 0.0f;
+    Holder->SetRootComponent(Hazard);
+    Holder->RegisterAllComponents();
+
+    const FVector Center = Hazard->GetComponentLocation();
+    const float FullRadius = Hazard->HazardRadius + Hazard->ToxicCloudSpreadRadius;
+
+    // Enemies with spherical capsules of mixed sizes around the leak, out to past the fully grown cloud
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    FRandomStream Stream(28);
+    TArray<AEnemyCharacter*> Bodies;
+    for (int32 i = 0; i < 150; ++i)
+    {
+        const float BodyRadius = Stream.FRandRange(20.0f, Hazard->MaxActorRadius);
+        const FVector Location = Center + Stream.GetUnitVector() * Stream.FRandRange(0.0f, FullRadius + Hazard->MaxActorRadius * 1.5f);
+
+        AEnemyCharacter* Body = World->SpawnActor<AEnemyCharacter>(AEnemyCharacter::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+        if (!TestNotNull(TEXT("Enemy spawned"), Body)) return false;
+        Body->GetCharacterMovement()->DisableMovement();
+        Body->GetCapsuleComponent()->SetCapsuleSize(BodyRadius, BodyRadius);
+        Body->SetActorLocation(Location);
+        Bodies.Add(Body);
+    }
+
+    Hazard->ActivateHazard();
+
+    // Tick the leak frame by frame, its members must be exactly what a sphere of the cloud radius overlaps
+    const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AtlasToxicCloudTest), false);
+    TArray<FOverlapResult> Overlaps;
+    TSet<AActor*> OverlapMembers, HazardMembers;
+    bool bMismatch = false;
+    for (int32 Frame = 0; Frame < 60 * 60; ++Frame)
+    {
+        World.Tick();
+        const float Radius = Hazard->GetCurrentCloudRadius();
+
+        Overlaps.Reset();
+        OverlapMembers.Reset();
+        World->OverlapMultiByChannel(Overlaps, Center, FQuat::Identity, ECC_Pawn, FCollisionShape::MakeSphere(Radius), QueryParams);
+        for (const FOverlapResult& Overlap : Overlaps)
+        {
+            // Only the capsule is the body, whatever else an enemy carries does not count
+            const AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Overlap.GetActor());
+            if (Enemy && Overlap.GetComponent() == Enemy->GetCapsuleComponent())
+            {
+                OverlapMembers.Add(Overlap.GetActor());
+            }
+        }
+
+        HazardMembers.Reset();
+        HazardMembers.Append(Hazard->GetAffectedActors());
+
+        for (AEnemyCharacter* Actor : Bodies)
+        {
+            // Bodies grazing the edge are down to collision tolerance, not membership
+            const float Gap = FVector::Dist(Center, Actor->GetActorLocation()) - Radius - Actor->GetSimpleCollisionRadius();
+            if (FMath::Abs(Gap) < 1.0f) continue;
+
+            if (OverlapMembers.Contains(Actor) != HazardMembers.Contains(Actor))
+            {
+                AddError(FString::Printf(TEXT("Frame %d, radius %.1f: body %.1f past the edge is %s by the overlap but %s by the leak"),
+                    Frame, Radius, Gap, OverlapMembers.Contains(Actor) ? TEXT("hit") : TEXT("missed"),
+                    HazardMembers.Contains(Actor) ? TEXT("affected") : TEXT("not affected")));
+                bMismatch = true;
+                break;
+            }
+        }
+
+        if (Radius >= FullRadius || bMismatch) break;
+    }
+
+    TestTrue(TEXT("Cloud fully grown"), FMath::IsNearlyEqual(Hazard->GetCurrentCloudRadius(), FullRadius));
+    TestTrue(TEXT("Fully grown cloud has members"), HazardMembers.Num() > 0);
+    TestTrue(TEXT("Fully grown cloud misses some bodies"), HazardMembers.Num() < Bodies.Num());
+
+    Hazard->DeactivateHazard();
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,156 @@
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Atlas/Components/RunManagerComponent.h"
+#include "Atlas/Data/RoomDataAsset.h"
+#include "Atlas/Rooms/EncounterDirector.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 SweepRuns = 1000;
+    constexpr int32 SweepSeed = 1;
+
+    /** Plans that broke one invariant, with the first offender for the log */
+    struct FViolations
+    {
+        int32 Count = 0;
+        FString First;
+
+        void Check(bool bHolds, const FString& Description)
+        {
+            if (!bHolds && Count++ == 0)
+            {
+                First = Description;
+            }
+        }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasEncounterDirectorTest, "Atlas.Rooms.EncounterDirector",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasEncounterDirectorTest::RunTest(const FString& Parameters)
+{
+    const FEncounterDirector Director;
+    const FEncounterDirectorSettings& Settings = Director.GetSettings();
+    const URoomDataAsset* RoomDefaults = GetDefault<URoomDataAsset>();
+    const int32 NumLevels = FEncounterDirector::MaxLevel;
+    const ERoomDifficulty Difficulties[] = { ERoomDifficulty::Easy, ERoomDifficulty::Medium, ERoomDifficulty::Hard, ERoomDifficulty::Boss };
+
+    // At full health and integrity the budget only grows with the level, and a hurt player or station never gets a harder room
+    FViolations LevelOrder, HealthOrder, IntegrityOrder;
+    for (const ERoomDifficulty Difficulty : Difficulties)
+    {
+        float PreviousBudget = 0.0f;
+        for (int32 Level = 1; Level <= NumLevels; ++Level)
+        {
+            FRunProgressData Progress;
+            Progress.CurrentLevel = Level;
+            const float Budget = Director.PlanEncounter(Progress, 1, Difficulty, true, 100.0f, 100.0f).Budget;
+            LevelOrder.Check(Budget >= PreviousBudget, FString::Printf(TEXT("difficulty %d level %d budget %.3f after %.3f"),
+                static_cast<int32>(Difficulty), Level, Budget, PreviousBudget));
+            PreviousBudget = Budget;
+
+            float PreviousHealthBudget = Budget;
+            float PreviousIntegrityBudget = Budget;
+            for (int32 Percent = 99; Percent >= 0; --Percent)
+            {
+                FRunProgressData Hurt = Progress;
+                Hurt.PlayerHealth = Percent;
+                const float HealthBudget = Director.PlanEncounter(Hurt, 1, Difficulty, true, 100.0f, 100.0f).Budget;
+                HealthOrder.Check(HealthBudget <= PreviousHealthBudget, FString::Printf(TEXT("level %d health %d%% budget %.3f above %.3f"),
+                    Level, Percent, HealthBudget, PreviousHealthBudget));
+                PreviousHealthBudget = HealthBudget;
+
+                FRunProgressData Failing = Progress;
+                Failing.StationIntegrity = Percent;
+                const float IntegrityBudget = Director.PlanEncounter(Failing, 1, Difficulty, true, 100.0f, 100.0f).Budget;
+                IntegrityOrder.Check(IntegrityBudget <= PreviousIntegrityBudget, FString::Printf(TEXT("level %d integrity %d%% budget %.3f above %.3f"),
+                    Level, Percent, IntegrityBudget, PreviousIntegrityBudget));
+                PreviousIntegrityBudget = IntegrityBudget;
+            }
+        }
+    }
+
+    // The seeded sweep Atlas.Bench.EncounterDirector prints statistics for, every plan has to stay in range
+    FViolations PowerRange, PowerBelowBase, HazardRange, NoHazardIntensity, DelayRange, NegativeBudget;
+    int32 Plans = 0;
+    for (int32 Run = 0; Run < SweepRuns; ++Run)
+    {
+        FRandomStream Stream(SweepSeed + Run);
+
+        FRunProgressData Progress;
+        int32 EquippedSlots = 0;
+        const float Skill = Stream.FRandRange(0.3f, 1.0f);
+
+        for (int32 Level = 1; Level <= NumLevels; ++Level)
+        {
+            Progress.CurrentLevel = Level;
+            const ERoomDifficulty Difficulty = Level == NumLevels ? ERoomDifficulty::Boss : static_cast<ERoomDifficulty>(Stream.RandRange(0, 2));
+            const bool bHasHazard = Stream.FRand() < 0.7f;
+            const int32 BasePower = RoomDefaults->GetScaledEnemyPower(Level, EquippedSlots);
+
+            const FEncounterPlan Plan = Director.PlanEncounter(Progress, BasePower, Difficulty, bHasHazard, 100.0f, 100.0f);
+            ++Plans;
+
+            const FString Where = FString::Printf(TEXT("run %d level %d"), Run, Level);
+            NegativeBudget.Check(Plan.Budget >= 0.0f, FString::Printf(TEXT("%s budget %.3f"), *Where, Plan.Budget));
+            PowerRange.Check(Plan.EnemyPower >= 1 && Plan.EnemyPower <= 10, FString::Printf(TEXT("%s power %d"), *Where, Plan.EnemyPower));
+            PowerBelowBase.Check(Plan.EnemyPower >= FMath::Clamp(BasePower, 1, 10), FString::Printf(TEXT("%s power %d under base %d"), *Where, Plan.EnemyPower, BasePower));
+            if (bHasHazard)
+            {
+                HazardRange.Check(Plan.HazardIntensity >= Settings.MinHazardIntensity && Plan.HazardIntensity <= Settings.MaxHazardIntensity,
+                    FString::Printf(TEXT("%s hazard intensity %.3f"), *Where, Plan.HazardIntensity));
+            }
+            else
+            {
+                NoHazardIntensity.Check(Plan.HazardIntensity == 1.0f, FString::Printf(TEXT("%s hazard intensity %.3f without a hazard"), *Where, Plan.HazardIntensity));
+            }
+            DelayRange.Check(Plan.EnemySpawnDelay >= Settings.MinEnemySpawnDelay && Plan.EnemySpawnDelay <= Settings.MaxEnemySpawnDelay,
+                FString::Printf(TEXT("%s spawn delay %.3f"), *Where, Plan.EnemySpawnDelay));
+
+            // Same toy combat outcome as the bench, so the sweep reaches hurt players and failing stations
+            const float Threat = Plan.EnemyPower * (bHasHazard ? 1.0f + 0.2f * Plan.HazardIntensity : 1.0f);
+            const float Strength = (EquippedSlots + 1) * (0.5f + Skill);
+            Progress.PlayerHealth -= 25.0f * Threat / Strength * Stream.FRandRange(0.6f, 1.4f);
+            if (bHasHazard)
+            {
+                Progress.StationIntegrity -= 10.0f * Plan.HazardIntensity * Stream.FRandRange(0.5f, 1.5f);
+            }
+            Progress.PerfectParries += Stream.RandRange(0, FMath::FloorToInt(Skill * 4.0f));
+
+            if (Progress.PlayerHealth <= 0.0f || Progress.StationIntegrity <= 0.0f)
+            {
+                break;
+            }
+
+            EquippedSlots = FMath::Min(EquippedSlots + 1, 6);
+            Progress.PlayerHealth = FMath::Min(Progress.PlayerHealth + 20.0f, 100.0f);
+        }
+    }
+    TestTrue(TEXT("Sweep planned past the first room"), Plans > SweepRuns);
+
+    const TPair<const TCHAR*, const FViolations*> Invariants[] = {
+        { TEXT("Budget non-decreasing by level at full health"), &LevelOrder },
+        { TEXT("Budget never up as health drops"), &HealthOrder },
+        { TEXT("Budget never up as integrity drops"), &IntegrityOrder },
+        { TEXT("Budget not negative"), &NegativeBudget },
+        { TEXT("EnemyPower in [1, 10]"), &PowerRange },
+        { TEXT("EnemyPower not below the room's base power"), &PowerBelowBase },
+        { TEXT("Hazard intensity in [Min, Max]"), &HazardRange },
+        { TEXT("Hazard intensity 1 without a hazard"), &NoHazardIntensity },
+        { TEXT("Spawn delay in [Min, Max]"), &DelayRange },
+    };
+    for (const TPair<const TCHAR*, const FViolations*>& Invariant : Invariants)
+    {
+        if (!TestEqual(Invariant.Key, Invariant.Value->Count, 0))
+        {
+            AddInfo(FString::Printf(TEXT("First: %s"), *Invariant.Value->First));
+        }
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
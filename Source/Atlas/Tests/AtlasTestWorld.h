@@ -0,0 +1,61 @@
+// AtlasTestWorld.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Throwaway game world for automation tests. World subsystems are created and
+ * have begun play, and actors spawned into it get BeginPlay. There is no game
+ * mode, so no players are spawned. Destroyed when it goes out of scope.
+ */
+class FAtlasTestWorld
+{
+public:
+    FAtlasTestWorld()
+    {
+        World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("AtlasTestWorld"));
+
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+
+        World->InitializeActorsForPlay(FURL());
+        World->BeginPlay();
+
+        // Without a game state nothing starts actor BeginPlay, do what it would
+        if (!World->GetBegunPlay())
+        {
+            World->GetWorldSettings()->NotifyBeginPlay();
+        }
+    }
+
+    ~FAtlasTestWorld()
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    FAtlasTestWorld(const FAtlasTestWorld&) = delete;
+    FAtlasTestWorld& operator=(const FAtlasTestWorld&) = delete;
+
+    UWorld* Get() const { return World; }
+    UWorld* operator->() const { return World; }
+
+    /** Advances the world by whole frames. GFrameCounter is left alone, so per-frame caches need invalidating by hand. */
+    void Tick(int32 NumFrames = 1, float DeltaTime = 1.0f / 60.0f)
+    {
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            World->Tick(LEVELTICK_All, DeltaTime);
+        }
+    }
+
+private:
+    UWorld* World = nullptr;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
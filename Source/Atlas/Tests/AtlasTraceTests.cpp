@@ -0,0 +1,130 @@
+#include "Misc/AutomationTest.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/TraceAuxiliary.h"
+#include "AtlasTestWorld.h"
+#include "Atlas/Characters/EnemyCharacter.h"
+#include "Atlas/Core/AtlasStats.h"
+#include "Atlas/Hazards/ToxicLeakHazard.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && ATLAS_WITH_TRACE_ANALYSIS && UE_TRACE_ENABLED
+
+#include "Modules/ModuleManager.h"
+#include "TraceServices/AnalysisService.h"
+#include "TraceServices/ITraceServicesModule.h"
+#include "TraceServices/Model/AnalysisSession.h"
+#include "TraceServices/Model/Counters.h"
+#include "TraceServices/Model/TimingProfiler.h"
+
+namespace
+{
+    /** How long the trace writer gets to close the file once stopped */
+    constexpr double TraceCloseSeconds = 10.0;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasTraceCaptureTest, "Atlas.Trace.CaptureHasAtlasCountersAndScopes",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasTraceCaptureTest::RunTest(const FString& Parameters)
+{
+    if (FTraceAuxiliary::IsConnected())
+    {
+        AddInfo(TEXT("Skipped, a trace is already running and the capture needs a file of its own"));
+        return true;
+    }
+
+    const FString TracePath = FPaths::ConvertRelativePathToFull(FPaths::AutomationTransientDir() / TEXT("AtlasTraceCapture.utrace"));
+    IFileManager::Get().Delete(*TracePath, false, true, true);
+
+    if (!TestTrue(TEXT("File trace started"), FTraceAuxiliary::Start(FTraceAuxiliary::EConnectionType::File, *TracePath, TEXT("cpu,counters,stats,Atlas"))))
+    {
+        return false;
+    }
+    const bool bWasChannelEnabled = AtlasStats::IsTraceChannelEnabled();
+    AtlasStats::SetTraceChannelEnabled(true);
+    TestTrue(TEXT("Atlas channel on"), AtlasStats::IsTraceChannelEnabled());
+
+    {
+        FAtlasTestWorld World;
+
+        // A toxic leak with an enemy standing in it covers the hazard scopes, the action tick and the hazard and DOT counters
+        AActor* Holder = World->SpawnActor<AActor>();
+        UToxicLeakHazard* Hazard = NewObject<UToxicLeakHazard>(Holder);
+        Hazard->bPermanent = true;
+        Hazard->bShowWarningIndicator = false;
+        Hazard->ActivationDelay = 0.0f;
+        Holder->SetRootComponent(Hazard);
+        Holder->RegisterAllComponents();
+        Hazard->ActivateHazard();
+
+        World->SpawnActor<AEnemyCharacter>(AEnemyCharacter::StaticClass(), FVector(100.0f, 0.0f, 100.0f), FRotator::ZeroRotator);
+
+        // Sweeps need a playing attack montage, the counter alone is what is checked
+        AtlasStats::CountAttackSweep();
+
+        World.Tick(30);
+        Hazard->DeactivateHazard();
+    }
+
+    AtlasStats::SetTraceChannelEnabled(bWasChannelEnabled);
+    FTraceAuxiliary::Stop();
+
+    const double StopSeconds = FPlatformTime::Seconds();
+    while (FTraceAuxiliary::IsConnected() && FPlatformTime::Seconds() - StopSeconds < TraceCloseSeconds)
+    {
+        FPlatformProcess::Sleep(0.01f);
+    }
+    if (!TestTrue(TEXT("Trace file written"), IFileManager::Get().FileSize(*TracePath) > 0))
+    {
+        return false;
+    }
+
+    ITraceServicesModule& TraceServicesModule = FModuleManager::LoadModuleChecked<ITraceServicesModule>(TEXT("TraceServices"));
+    TSharedPtr<const TraceServices::IAnalysisSession> Session = TraceServicesModule.GetAnalysisService()->Analyze(*TracePath);
+    if (!TestTrue(TEXT("Trace analyzed"), Session.IsValid()))
+    {
+        return false;
+    }
+
+    TSet<FString> CounterNames;
+    TSet<FString> ScopeNames;
+    {
+        TraceServices::FAnalysisSessionReadScope ReadScope(*Session);
+
+        TraceServices::ReadCounterProvider(*Session).EnumerateCounters([&CounterNames](const TraceServices::ICounter& Counter)
+        {
+            CounterNames.Add(Counter.GetName());
+        });
+
+        if (const TraceServices::ITimingProfilerProvider* TimingProvider = TraceServices::ReadTimingProfilerProvider(*Session))
+        {
+            TimingProvider->ReadTimers([&ScopeNames](const TraceServices::ITimingProfilerTimerReader& Timers)
+            {
+                for (uint32 TimerId = 0; TimerId < Timers.GetTimerCount(); ++TimerId)
+                {
+                    const TraceServices::FTimingProfilerTimer* Timer = Timers.GetTimer(TimerId);
+                    if (Timer && Timer->Name)
+                    {
+                        ScopeNames.Add(Timer->Name);
+                    }
+                }
+            });
+        }
+    }
+
+    for (const TCHAR* CounterName : { TEXT("Atlas/ActiveHazards"), TEXT("Atlas/PoisonDOTs"), TEXT("Atlas/AttackSweeps") })
+    {
+        TestTrue(FString::Printf(TEXT("Counter %s in the trace"), CounterName), CounterNames.Contains(CounterName));
+    }
+    for (const TCHAR* ScopeName : { TEXT("Atlas.Hazard.Tick"), TEXT("Atlas.Hazard.ToxicLeak"), TEXT("Atlas.ActionManager.TickActions") })
+    {
+        TestTrue(FString::Printf(TEXT("Scope %s in the trace"), ScopeName), ScopeNames.Contains(ScopeName));
+    }
+
+    IFileManager::Get().Delete(*TracePath, false, true, true);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && ATLAS_WITH_TRACE_ANALYSIS && UE_TRACE_ENABLED
@@ -0,0 +1,344 @@
+#include "Misc/AutomationTest.h"
+#include "Misc/App.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Rendering/DrawElements.h"
+#include "Input/HittestGrid.h"
+#include "Types/PaintArgs.h"
+#include "Styling/WidgetStyle.h"
+#include "Atlas/UI/SEnemyHealthWidget.h"
+#include "Atlas/UI/SEnemyBarOverlay.h"
+#include "Atlas/UI/SSlotManagerWidget.h"
+#include "Atlas/UI/SInventoryWidget.h"
+#include "Atlas/UI/RewardSlotListModel.h"
+#include "Atlas/Components/SlotManagerComponent.h"
+#include "Atlas/Data/RewardDataAsset.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** Lay a widget out and paint it offscreen once, returns the highest layer it painted on */
+    int32 PaintOffscreen(const TSharedRef<SWidget>& Widget, const FVector2D& DrawSize, int32 LayerId = 0)
+    {
+        const FGeometry Geometry = FGeometry::MakeRoot(DrawSize, FSlateLayoutTransform());
+        const FSlateRect CullingRect(FVector2D::ZeroVector, DrawSize);
+
+        FHittestGrid HittestGrid;
+        HittestGrid.SetHittestArea(FVector2D::ZeroVector, DrawSize);
+        FSlateWindowElementList ElementList(nullptr);
+        FPaintArgs PaintArgs(nullptr, HittestGrid, FVector2D::ZeroVector, FApp::GetCurrentTime(), FApp::GetDeltaTime());
+
+        Widget->SlatePrepass(1.0f);
+        return Widget->Paint(PaintArgs, Geometry, CullingRect, ElementList, LayerId, FWidgetStyle(), true);
+    }
+
+    /** Every widget of the given Slate type in a tree, root included, in tree order */
+    template <typename WidgetType>
+    void FindWidgets(const TSharedRef<SWidget>& Widget, FName TypeName, TArray<TSharedRef<WidgetType>>& OutWidgets)
+    {
+        if (Widget->GetType() == TypeName)
+        {
+            OutWidgets.Add(StaticCastSharedRef<WidgetType>(Widget));
+        }
+
+        FChildren* Children = Widget->GetChildren();
+        for (int32 i = 0; Children && i < Children->Num(); ++i)
+        {
+            FindWidgets(Children->GetChildAt(i), TypeName, OutWidgets);
+        }
+    }
+
+    /** Widgets in a tree, including the root */
+    int32 CountWidgets(const TSharedRef<SWidget>& Widget)
+    {
+        int32 Count = 1;
+        FChildren* Children = Widget->GetChildren();
+        for (int32 i = 0; Children && i < Children->Num(); ++i)
+        {
+            Count += CountWidgets(Children->GetChildAt(i));
+        }
+        return Count;
+    }
+
+    URewardDataAsset* MakeTestReward(int32 Index)
+    {
+        URewardDataAsset* Reward = NewObject<URewardDataAsset>(GetTransientPackage());
+        Reward->RewardName = FText::FromString(FString::Printf(TEXT("Test Reward %d"), Index));
+        Reward->Category = static_cast<ERewardCategory>(Index % 5);
+        Reward->SlotCost = 1;
+        return Reward;
+    }
+
+    /** A detached slot manager with a reward in every slot */
+    USlotManagerComponent* MakeFilledSlotManager(int32 NumRewards)
+    {
+        USlotManagerComponent* SlotManager = NewObject<USlotManagerComponent>(GetTransientPackage());
+        SlotManager->SetMaxSlots(NumRewards);
+        for (int32 i = 0; i < NumRewards; ++i)
+        {
+            SlotManager->EquipReward(MakeTestReward(i), i);
+        }
+        return SlotManager;
+    }
+
+    /** The text block currently showing exactly Text */
+    TSharedPtr<STextBlock> FindTextBlock(const TSharedRef<SWidget>& Root, const FString& Text)
+    {
+        TArray<TSharedRef<STextBlock>> TextBlocks;
+        FindWidgets(Root, TEXT("STextBlock"), TextBlocks);
+        for (const TSharedRef<STextBlock>& TextBlock : TextBlocks)
+        {
+            if (TextBlock->GetText().ToString() == Text)
+            {
+                return TextBlock;
+            }
+        }
+        return nullptr;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasEnemyHealthUnchangedTest, "Atlas.UI.EnemyHealth.SkipsUnchangedValues",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasEnemyHealthUnchangedTest::RunTest(const FString& Parameters)
+{
+    TSharedRef<SEnemyHealthWidget> Bar = SNew(SEnemyHealthWidget);
+    Bar->UpdateEnemyHealth(75.0f, 100.0f);
+    Bar->UpdateEnemyPoise(40.0f, 100.0f);
+
+    TSharedPtr<STextBlock> HealthText = FindTextBlock(Bar, TEXT("75/100"));
+    TSharedPtr<STextBlock> PoiseText = FindTextBlock(Bar, TEXT("40/100"));
+    if (!TestTrue(TEXT("Health text shows the pushed value"), HealthText.IsValid())) return false;
+    if (!TestTrue(TEXT("Poise text shows the pushed value"), PoiseText.IsValid())) return false;
+
+    // Same value, or one that rounds to what is shown, must leave the text block alone
+    const FText HealthBefore = HealthText->GetText();
+    const FText PoiseBefore = PoiseText->GetText();
+    Bar->UpdateEnemyHealth(75.0f, 100.0f);
+    Bar->UpdateEnemyHealth(75.3f, 100.0f);
+    Bar->UpdateEnemyPoise(40.0f, 100.0f);
+    Bar->UpdateEnemyPoise(39.8f, 100.0f);
+    TestTrue(TEXT("Health text untouched while the shown value is unchanged"), HealthText->GetText().IdenticalTo(HealthBefore));
+    TestTrue(TEXT("Poise text untouched while the shown value is unchanged"), PoiseText->GetText().IdenticalTo(PoiseBefore));
+
+    // A real change updates it
+    Bar->UpdateEnemyHealth(60.0f, 100.0f);
+    TestEqual(TEXT("Health text follows a change"), HealthText->GetText().ToString(), FString(TEXT("60/100")));
+    Bar->UpdateEnemyHealth(60.0f, 120.0f);
+    TestEqual(TEXT("Health text follows a max change"), HealthText->GetText().ToString(), FString(TEXT("60/120")));
+
+    // Staggered is a state change even though the rounded poise only moves to 0 once
+    Bar->UpdateEnemyPoise(0.0f, 100.0f);
+    TestEqual(TEXT("Broken poise shows staggered"), PoiseText->GetText().ToString(), FString(TEXT("STAGGERED")));
+    const FText StaggeredBefore = PoiseText->GetText();
+    Bar->UpdateEnemyPoise(-0.2f, 100.0f);
+    TestTrue(TEXT("Staggered text untouched while still staggered"), PoiseText->GetText().IdenticalTo(StaggeredBefore));
+    Bar->UpdateEnemyPoise(0.4f, 100.0f);
+    TestEqual(TEXT("Recovered poise leaves staggered"), PoiseText->GetText().ToString(), FString(TEXT("0/100")));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasEnemyHealthVisibilityTest, "Atlas.UI.EnemyHealth.VisibleWithHealthData",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasEnemyHealthVisibilityTest::RunTest(const FString& Parameters)
+{
+    TSharedRef<SEnemyHealthWidget> Bar = SNew(SEnemyHealthWidget);
+
+    // The panel is the outermost box under the widget
+    TArray<TSharedRef<SBox>> Boxes;
+    FindWidgets(Bar, TEXT("SBox"), Boxes);
+    if (!TestTrue(TEXT("Health panel found"), Boxes.Num() > 0)) return false;
+    const TSharedRef<SBox> Panel = Boxes[0];
+
+    Bar->UpdateEnemyHealth(0.0f, 0.0f);
+    Bar->HideWidget();
+    TestTrue(TEXT("Hidden without health data"), Panel->GetVisibility() == EVisibility::Collapsed);
+
+    Bar->ShowWidget();
+    TestTrue(TEXT("Shown without health data"), Panel->GetVisibility() == EVisibility::SelfHitTestInvisible);
+
+    // Health data keeps the panel up even when hidden
+    Bar->HideWidget();
+    Bar->UpdateEnemyHealth(50.0f, 100.0f);
+    TestTrue(TEXT("Visible while it has health data"), Panel->GetVisibility() == EVisibility::SelfHitTestInvisible);
+
+    Bar->UpdateEnemyHealth(0.0f, 0.0f);
+    TestTrue(TEXT("Hidden again once the health data is gone"), Panel->GetVisibility() == EVisibility::Collapsed);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasEnemyBarOverlayTest, "Atlas.UI.EnemyBars.OverlayDrawElements",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasEnemyBarOverlayTest::RunTest(const FString& Parameters)
+{
+    if (!FSlateApplication::IsInitialized())
+    {
+        AddInfo(TEXT("Skipped, painting needs Slate"));
+        return true;
+    }
+
+    const FVector2D DrawSize(1920.0f, 1080.0f);
+    const int32 LayerId = 10;
+    TSharedRef<SEnemyBarOverlay> Overlay = SNew(SEnemyBarOverlay);
+
+    // One box for the background and health, one more each for poise and a vulnerability tier
+    TArray<FEnemyBarEntry>& Entries = Overlay->BeginUpdate();
+    FEnemyBarEntry& Plain = Entries.AddDefaulted_GetRef();
+    Plain.bShowPoise = false;
+    FEnemyBarEntry& WithPoise = Entries.AddDefaulted_GetRef();
+    WithPoise.PoisePercent = 0.5f;
+    FEnemyBarEntry& Staggered = Entries.AddDefaulted_GetRef();
+    Staggered.PoisePercent = 0.0f;
+    Staggered.TierColor = FLinearColor::Red;
+    FEnemyBarEntry& FarVulnerable = Entries.AddDefaulted_GetRef();
+    FarVulnerable.bShowPoise = false;
+    FarVulnerable.TierColor = FLinearColor::Yellow;
+    Overlay->EndUpdate();
+
+    int32 TopLayer = PaintOffscreen(Overlay, DrawSize, LayerId);
+    TestEqual(TEXT("Draw elements for the mixed bars"), Overlay->GetLastNumDrawElements(), 2 + 3 + 4 + 3);
+    TestEqual(TEXT("Bars paint on two layers"), TopLayer, LayerId + 1);
+
+    // Every frame starts from an empty array, and the layer count does not grow with the bars
+    TArray<FEnemyBarEntry>& Crowd = Overlay->BeginUpdate();
+    TestEqual(TEXT("BeginUpdate starts empty"), Crowd.Num(), 0);
+    for (int32 i = 0; i < 200; ++i)
+    {
+        FEnemyBarEntry& Entry = Crowd.AddDefaulted_GetRef();
+        Entry.Position = FVector2f((i % 20) / 20.0f, (i / 20) / 10.0f);
+    }
+    Overlay->EndUpdate();
+
+    TopLayer = PaintOffscreen(Overlay, DrawSize, LayerId);
+    TestEqual(TEXT("Entries this frame"), Overlay->GetNumEntries(), 200);
+    TestEqual(TEXT("Draw elements for a crowd"), Overlay->GetLastNumDrawElements(), 200 * 3);
+    TestEqual(TEXT("A crowd still paints on two layers"), TopLayer, LayerId + 1);
+
+    // No enemies, nothing drawn
+    Overlay->BeginUpdate();
+    Overlay->EndUpdate();
+    PaintOffscreen(Overlay, DrawSize, LayerId);
+    TestEqual(TEXT("Draw elements with no enemies"), Overlay->GetLastNumDrawElements(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasSlotListModelTest, "Atlas.UI.SlotWidgets.ModelDiffsSlots",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasSlotListModelTest::RunTest(const FString& Parameters)
+{
+    TArray<URewardDataAsset*> Rewards;
+    for (int32 i = 0; i < 4; ++i)
+    {
+        Rewards.Add(MakeTestReward(i));
+    }
+
+    TArray<FEquippedReward> Slots;
+    Slots.Emplace(Rewards[0], 0);
+    Slots.Emplace(Rewards[1], 1);
+    Slots.Emplace(nullptr, 2);
+    Slots.Emplace(Rewards[2], 3);
+
+    FRewardSlotListModel Model;
+    TArray<int32> Changed;
+    TestTrue(TEXT("First sync adds the slots"), Model.Sync(Slots, Changed));
+    TestEqual(TEXT("Slot items"), Model.Num(), 4);
+    TestTrue(TEXT("Filled slots are reported, the empty one is not"), Changed == TArray<int32>({ 0, 1, 3 }));
+
+    const TArray<TSharedPtr<FRewardSlotItem>> Items = Model.GetItems();
+
+    TestFalse(TEXT("Unchanged sync keeps the slot count"), Model.Sync(Slots, Changed));
+    TestEqual(TEXT("Unchanged sync reports no slots"), Changed.Num(), 0);
+
+    // Only the slots that changed are reported, and their items are kept
+    Slots[1].StackLevel = 2;
+    Slots[2].RewardData = Rewards[3];
+    Slots[0].RewardData = nullptr;
+    TestFalse(TEXT("Changing slots keeps the slot count"), Model.Sync(Slots, Changed));
+    TestTrue(TEXT("Changed slots are reported"), Changed == TArray<int32>({ 0, 1, 2 }));
+    TestEqual(TEXT("Emptied slot has no stack level"), Model.GetItem(0)->StackLevel, 0);
+    TestEqual(TEXT("Stack level follows the slot"), Model.GetItem(1)->StackLevel, 2);
+    for (int32 i = 0; i < Items.Num(); ++i)
+    {
+        TestTrue(TEXT("Slot keeps its item across changes"), Model.GetItem(i) == Items[i]);
+    }
+
+    // Adding and removing slots keeps the items of the slots that remain
+    Slots.Emplace(nullptr, 4);
+    Slots.Emplace(nullptr, 5);
+    TestTrue(TEXT("Growing changes the slot count"), Model.Sync(Slots, Changed));
+    TestEqual(TEXT("New empty slots are not reported"), Changed.Num(), 0);
+    Slots.SetNum(2);
+    TestTrue(TEXT("Shrinking changes the slot count"), Model.Sync(Slots, Changed));
+    TestEqual(TEXT("Slot items after shrinking"), Model.Num(), 2);
+    TestTrue(TEXT("Remaining slots keep their items"), Model.GetItem(0) == Items[0] && Model.GetItem(1) == Items[1]);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAtlasSlotWidgetsVirtualizedTest, "Atlas.UI.SlotWidgets.RowsStayVirtualized",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAtlasSlotWidgetsVirtualizedTest::RunTest(const FString& Parameters)
+{
+    if (!FSlateApplication::IsInitialized())
+    {
+        AddInfo(TEXT("Skipped, painting needs Slate"));
+        return true;
+    }
+
+    const FVector2D DrawSize(1920.0f, 1080.0f);
+
+    // Both views generate their rows during the first paint's tick, the second paint shows them
+    auto Open = [&DrawSize](const TSharedRef<SWidget>& Widget)
+    {
+        PaintOffscreen(Widget, DrawSize);
+        PaintOffscreen(Widget, DrawSize);
+    };
+
+    // Far more slots than fit on screen, doubling them must not add a single widget
+    USlotManagerComponent* SlotManager = MakeFilledSlotManager(500);
+    USlotManagerComponent* LargerSlotManager = MakeFilledSlotManager(1000);
+
+    TSharedRef<SSlotManagerWidget> SlotWidget = SNew(SSlotManagerWidget).SlotManager(SlotManager);
+    TSharedRef<SSlotManagerWidget> LargerSlotWidget = SNew(SSlotManagerWidget).SlotManager(LargerSlotManager);
+    Open(SlotWidget);
+    Open(LargerSlotWidget);
+    TestEqual(TEXT("Slot tiles"), SlotWidget->GetNumSlots(), 500);
+    TestTrue(TEXT("Only visible tiles are built"), SlotWidget->GetNumTilesCreated() > 0 && SlotWidget->GetNumTilesCreated() < 500);
+    TestEqual(TEXT("Tile view widgets do not grow with the slots"), CountWidgets(LargerSlotWidget), CountWidgets(SlotWidget));
+
+    TSharedRef<SInventoryWidget> Inventory = SNew(SInventoryWidget).SlotManager(SlotManager);
+    TSharedRef<SInventoryWidget> LargerInventory = SNew(SInventoryWidget).SlotManager(LargerSlotManager);
+    Open(Inventory);
+    Open(LargerInventory);
+    TestEqual(TEXT("Inventory list widgets do not grow with the slots"), CountWidgets(LargerInventory), CountWidgets(Inventory));
+
+    // One slot changing rebinds a tile, it never builds one
+    const int32 TilesBeforeChange = SlotWidget->GetNumTilesCreated();
+    SlotManager->RemoveReward(0);
+    SlotWidget->RefreshSlots();
+    Open(SlotWidget);
+    TestTrue(TEXT("Changed slot shows empty"), SlotWidget->GetRewardInSlot(0) == nullptr);
+    TestEqual(TEXT("No tiles built for a changed slot"), SlotWidget->GetNumTilesCreated(), TilesBeforeChange);
+
+    // Scrolling end to end reuses the tiles that scroll out for the slots that scroll in
+    const int32 ScrollStep = FMath::Max(SlotWidget->GetNumTilesGenerated(), 1);
+    for (int32 SlotIndex = ScrollStep; SlotIndex < SlotWidget->GetNumSlots(); SlotIndex += ScrollStep)
+    {
+        SlotWidget->ScrollToSlot(SlotIndex);
+        Open(SlotWidget);
+    }
+    TestTrue(TEXT("Scrolling through every slot reuses tiles"), SlotWidget->GetNumTilesCreated() <= TilesBeforeChange * 2);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
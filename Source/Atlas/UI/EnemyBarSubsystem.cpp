@@ -0,0 +1,222 @@
+#include "EnemyBarSubsystem.h"
+#include "SEnemyBarOverlay.h"
+#include "Atlas/Characters/GameCharacterBase.h"
+#include "Atlas/Components/HealthComponent.h"
+#include "Atlas/Components/VulnerabilityComponent.h"
+#include "Atlas/Core/AtlasStats.h"
+#include "Engine/World.h"
+#include "Engine/GameViewportClient.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEnemyBarsEnabled(
+	TEXT("Atlas.EnemyBars.Enabled"),
+	1,
+	TEXT("1 to draw health, poise and vulnerability bars above enemies."),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarEnemyBarsMaxDistance(
+	TEXT("Atlas.EnemyBars.MaxDistance"),
+	2500.0f,
+	TEXT("Enemies further than this from the camera get no bars."),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarEnemyBarsPoiseDistance(
+	TEXT("Atlas.EnemyBars.PoiseDistance"),
+	1200.0f,
+	TEXT("Enemies further than this from the camera only show health."),
+	ECVF_Default
+);
+
+namespace
+{
+	// Anchor above the capsule so the bars clear the head
+	constexpr float BarHeightAboveCapsule = 30.0f;
+
+	// Keep bars that hang slightly off the edge of the screen
+	constexpr float ScreenMargin = 0.05f;
+}
+
+void UEnemyBarSubsystem::Deinitialize()
+{
+	RemoveOverlay();
+	Enemies.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UEnemyBarSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyBarSubsystem::Tick(float DeltaTime)
+{
+	if (CVarEnemyBarsEnabled.GetValueOnGameThread() == 0)
+	{
+		RemoveOverlay();
+		return;
+	}
+
+	if (Enemies.Num() == 0 && !Overlay.IsValid())
+	{
+		return;
+	}
+
+	ATLAS_SCOPE_CYCLE_COUNTER(EnemyBars, "Atlas.EnemyBars.Tick");
+
+	UWorld* World = GetWorld();
+	APlayerController* PC = World->GetFirstPlayerController();
+	UGameViewportClient* Viewport = World->GetGameViewport();
+	if (!PC || !PC->PlayerCameraManager || !Viewport)
+	{
+		return;
+	}
+
+	AddOverlay();
+
+	// One camera, one matrix for every enemy this frame
+	FMinimalViewInfo View = PC->PlayerCameraManager->GetCameraCacheView();
+	FVector2D ViewportSize;
+	Viewport->GetViewportSize(ViewportSize);
+	if (!View.bConstrainAspectRatio && ViewportSize.Y > 0.0f)
+	{
+		View.AspectRatio = ViewportSize.X / ViewportSize.Y;
+	}
+
+	FMatrix ViewMatrix;
+	FMatrix ProjectionMatrix;
+	FMatrix ViewProjection;
+	UGameplayStatics::GetViewProjectionMatrix(View, ViewMatrix, ProjectionMatrix, ViewProjection);
+
+	Enemies.RemoveAllSwap([](const TWeakObjectPtr<AGameCharacterBase>& Enemy) { return !Enemy.IsValid(); }, EAllowShrinking::No);
+
+	BuildEntries(Enemies, View.Location, ViewProjection, Overlay->BeginUpdate());
+	Overlay->EndUpdate();
+}
+
+TStatId UEnemyBarSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyBarSubsystem, STATGROUP_Tickables);
+}
+
+UEnemyBarSubsystem* UEnemyBarSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<UEnemyBarSubsystem>() : nullptr;
+}
+
+void UEnemyBarSubsystem::RegisterEnemy(AGameCharacterBase* Enemy)
+{
+	if (Enemy)
+	{
+		Enemies.AddUnique(Enemy);
+	}
+}
+
+void UEnemyBarSubsystem::UnregisterEnemy(AGameCharacterBase* Enemy)
+{
+	Enemies.RemoveSingleSwap(Enemy, EAllowShrinking::No);
+}
+
+int32 UEnemyBarSubsystem::BuildEntries(const TArray<TWeakObjectPtr<AGameCharacterBase>>& InEnemies, const FVector& ViewLocation,
+	const FMatrix& ViewProjection, TArray<FEnemyBarEntry>& OutEntries)
+{
+	const float MaxDistance = CVarEnemyBarsMaxDistance.GetValueOnGameThread();
+	const float PoiseDistance = CVarEnemyBarsPoiseDistance.GetValueOnGameThread();
+	const float MaxDistanceSq = MaxDistance * MaxDistance;
+	const float PoiseDistanceSq = PoiseDistance * PoiseDistance;
+
+	for (const TWeakObjectPtr<AGameCharacterBase>& WeakEnemy : InEnemies)
+	{
+		const AGameCharacterBase* Enemy = WeakEnemy.Get();
+		if (!Enemy || Enemy->IsHidden())
+		{
+			continue;
+		}
+
+		const UHealthComponent* Health = Enemy->GetHealthComponent();
+		if (!Health || Health->IsDead())
+		{
+			continue;
+		}
+
+		const FVector Anchor = Enemy->GetActorLocation() + FVector(0.0f, 0.0f, Enemy->GetSimpleCollisionHalfHeight() + BarHeightAboveCapsule);
+		const float DistanceSq = FVector::DistSquared(Anchor, ViewLocation);
+		if (DistanceSq > MaxDistanceSq)
+		{
+			continue;
+		}
+
+		// Behind the camera
+		const FVector4 Clip = ViewProjection.TransformFVector4(FVector4(Anchor, 1.0f));
+		if (Clip.W <= UE_KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		const FVector2f Position(
+			0.5f + 0.5f * static_cast<float>(Clip.X / Clip.W),
+			0.5f - 0.5f * static_cast<float>(Clip.Y / Clip.W));
+		if (Position.X < -ScreenMargin || Position.X > 1.0f + ScreenMargin || Position.Y < -ScreenMargin || Position.Y > 1.0f + ScreenMargin)
+		{
+			continue;
+		}
+
+		FEnemyBarEntry& Entry = OutEntries.AddDefaulted_GetRef();
+		Entry.Position = Position;
+		Entry.HealthPercent = Health->GetMaxHealth() > 0.0f ? Health->GetCurrentHealth() / Health->GetMaxHealth() : 0.0f;
+		Entry.PoisePercent = Health->GetMaxPoise() > 0.0f ? Health->GetCurrentPoise() / Health->GetMaxPoise() : 0.0f;
+		Entry.bShowPoise = DistanceSq <= PoiseDistanceSq;
+
+		const UVulnerabilityComponent* Vulnerability = Enemy->GetVulnerabilityComponent();
+		if (Vulnerability && Vulnerability->IsVulnerable())
+		{
+			Entry.TierColor = Vulnerability->GetCurrentTierColor();
+			Entry.TierColor.A = 1.0f;
+		}
+	}
+
+	return OutEntries.Num();
+}
+
+void UEnemyBarSubsystem::AddOverlay()
+{
+	if (Overlay.IsValid())
+	{
+		return;
+	}
+
+	if (UGameViewportClient* Viewport = GetWorld()->GetGameViewport())
+	{
+		// Under the run HUD (10) and the enemy panel (15)
+		Overlay = SNew(SEnemyBarOverlay);
+		Viewport->AddViewportWidgetContent(Overlay.ToSharedRef(), 5);
+	}
+}
+
+void UEnemyBarSubsystem::RemoveOverlay()
+{
+	if (!Overlay.IsValid())
+	{
+		return;
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UGameViewportClient* Viewport = World->GetGameViewport())
+		{
+			Viewport->RemoveViewportWidgetContent(Overlay.ToSharedRef());
+		}
+	}
+	Overlay.Reset();
+}
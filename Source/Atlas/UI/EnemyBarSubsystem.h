@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyBarSubsystem.generated.h"
+
+class AGameCharacterBase;
+class SEnemyBarOverlay;
+struct FEnemyBarEntry;
+
+/**
+ * Owns the world-space enemy bar overlay and fills it once per frame.
+ *
+ * Enemies register while an AI controller possesses them. Each tick the subsystem takes
+ * the player's camera once, projects every registered enemy with the same view-projection
+ * matrix, drops the ones behind the camera, off screen or beyond
+ * Atlas.EnemyBars.MaxDistance, hides poise beyond Atlas.EnemyBars.PoiseDistance, and
+ * writes the result into SEnemyBarOverlay's packed array.
+ */
+UCLASS()
+class ATLAS_API UEnemyBarSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem interface
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UEnemyBarSubsystem* Get(const UObject* WorldContextObject);
+
+	void RegisterEnemy(AGameCharacterBase* Enemy);
+	void UnregisterEnemy(AGameCharacterBase* Enemy);
+	int32 GetNumEnemies() const { return Enemies.Num(); }
+
+	/**
+	 * Project, cull and pack bars for the given enemies.
+	 * @param ViewProjection World to clip space for the camera at ViewLocation
+	 * @return Number of entries written
+	 */
+	static int32 BuildEntries(const TArray<TWeakObjectPtr<AGameCharacterBase>>& InEnemies, const FVector& ViewLocation,
+		const FMatrix& ViewProjection, TArray<FEnemyBarEntry>& OutEntries);
+
+private:
+	void AddOverlay();
+	void RemoveOverlay();
+
+	TArray<TWeakObjectPtr<AGameCharacterBase>> Enemies;
+
+	TSharedPtr<SEnemyBarOverlay> Overlay;
+};
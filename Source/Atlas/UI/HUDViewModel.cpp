@@ -0,0 +1,219 @@
+#include "HUDViewModel.h"
+#include "SRunProgressWidget.h"
+#include "SEnemyHealthWidget.h"
+#include "SSimpleSlotManagerWidget.h"
+#include "Atlas/Characters/GameCharacterBase.h"
+#include "Atlas/Components/HealthComponent.h"
+#include "Atlas/Components/StationIntegrityComponent.h"
+#include "Atlas/Components/SlotManagerComponent.h"
+#include "Atlas/Components/RunManagerComponent.h"
+
+void UHUDViewModel::BindRunManager(URunManagerComponent* InRunManager)
+{
+	if (URunManagerComponent* Previous = RunManager.Get())
+	{
+		Previous->OnRoomStarted.RemoveAll(this);
+		Previous->OnRoomCompleted.RemoveAll(this);
+	}
+
+	RunManager = InRunManager;
+
+	if (InRunManager)
+	{
+		InRunManager->OnRoomStarted.AddUniqueDynamic(this, &UHUDViewModel::HandleRoomStarted);
+		InRunManager->OnRoomCompleted.AddUniqueDynamic(this, &UHUDViewModel::HandleRoomCompleted);
+	}
+}
+
+void UHUDViewModel::BindPlayer(AGameCharacterBase* Player)
+{
+	UnbindPlayer();
+
+	if (!Player)
+	{
+		return;
+	}
+
+	if (UHealthComponent* Health = Player->GetHealthComponent())
+	{
+		PlayerHealth = Health;
+		Health->OnHealthChanged.AddUniqueDynamic(this, &UHUDViewModel::HandlePlayerHealthChanged);
+		Health->OnPoiseChanged.AddUniqueDynamic(this, &UHUDViewModel::HandlePlayerPoiseChanged);
+	}
+
+	if (UStationIntegrityComponent* Integrity = Player->GetStationIntegrityComponent())
+	{
+		PlayerIntegrity = Integrity;
+		Integrity->OnIntegrityChanged.AddUniqueDynamic(this, &UHUDViewModel::HandleIntegrityChanged);
+	}
+
+	if (USlotManagerComponent* Slots = Player->GetSlotManagerComponent())
+	{
+		PlayerSlots = Slots;
+		Slots->OnSlotsChanged.AddUniqueDynamic(this, &UHUDViewModel::HandleSlotsChanged);
+	}
+
+	RefreshPlayer();
+}
+
+void UHUDViewModel::BindEnemy(AGameCharacterBase* Enemy)
+{
+	if (UHealthComponent* Previous = EnemyHealth.Get())
+	{
+		Previous->OnHealthChanged.RemoveAll(this);
+		Previous->OnPoiseChanged.RemoveAll(this);
+	}
+
+	EnemyHealth = Enemy ? Enemy->GetHealthComponent() : nullptr;
+
+	if (UHealthComponent* Health = EnemyHealth.Get())
+	{
+		Health->OnHealthChanged.AddUniqueDynamic(this, &UHUDViewModel::HandleEnemyHealthChanged);
+		Health->OnPoiseChanged.AddUniqueDynamic(this, &UHUDViewModel::HandleEnemyPoiseChanged);
+	}
+
+	RefreshEnemy();
+}
+
+void UHUDViewModel::UnbindAll()
+{
+	UnbindPlayer();
+	BindEnemy(nullptr);
+	BindRunManager(nullptr);
+}
+
+void UHUDViewModel::SetRunProgressWidget(const TSharedPtr<SRunProgressWidget>& Widget)
+{
+	RunProgressWidget = Widget;
+	RefreshPlayer();
+}
+
+void UHUDViewModel::SetEnemyHealthWidget(const TSharedPtr<SEnemyHealthWidget>& Widget)
+{
+	EnemyHealthWidget = Widget;
+	RefreshEnemy();
+}
+
+void UHUDViewModel::SetSlotWidget(const TSharedPtr<SSimpleSlotManagerWidget>& Widget)
+{
+	SlotWidget = Widget;
+	HandleSlotsChanged();
+}
+
+void UHUDViewModel::RefreshPlayer()
+{
+	if (TSharedPtr<SRunProgressWidget> Widget = RunProgressWidget.Pin())
+	{
+		if (const UHealthComponent* Health = PlayerHealth.Get())
+		{
+			Widget->UpdateHealth(Health->GetCurrentHealth(), Health->GetMaxHealth());
+			Widget->UpdatePoise(Health->GetCurrentPoise(), Health->GetMaxPoise());
+		}
+
+		if (const UStationIntegrityComponent* Integrity = PlayerIntegrity.Get())
+		{
+			Widget->UpdateIntegrity(Integrity->GetCurrentIntegrity(), Integrity->GetMaxIntegrity());
+		}
+	}
+
+	HandleSlotsChanged();
+}
+
+void UHUDViewModel::RefreshEnemy()
+{
+	TSharedPtr<SEnemyHealthWidget> Widget = EnemyHealthWidget.Pin();
+	const UHealthComponent* Health = EnemyHealth.Get();
+	if (Widget.IsValid() && Health)
+	{
+		Widget->UpdateEnemyHealth(Health->GetCurrentHealth(), Health->GetMaxHealth());
+		Widget->UpdateEnemyPoise(Health->GetCurrentPoise(), Health->GetMaxPoise());
+	}
+}
+
+void UHUDViewModel::UnbindPlayer()
+{
+	if (UHealthComponent* Health = PlayerHealth.Get())
+	{
+		Health->OnHealthChanged.RemoveAll(this);
+		Health->OnPoiseChanged.RemoveAll(this);
+	}
+
+	if (UStationIntegrityComponent* Integrity = PlayerIntegrity.Get())
+	{
+		Integrity->OnIntegrityChanged.RemoveAll(this);
+	}
+
+	if (USlotManagerComponent* Slots = PlayerSlots.Get())
+	{
+		Slots->OnSlotsChanged.RemoveAll(this);
+	}
+
+	PlayerHealth.Reset();
+	PlayerIntegrity.Reset();
+	PlayerSlots.Reset();
+}
+
+void UHUDViewModel::HandlePlayerHealthChanged(float CurrentHealth, float MaxHealth, float HealthDelta)
+{
+	if (TSharedPtr<SRunProgressWidget> Widget = RunProgressWidget.Pin())
+	{
+		Widget->UpdateHealth(CurrentHealth, MaxHealth);
+	}
+}
+
+void UHUDViewModel::HandlePlayerPoiseChanged(float CurrentPoise, float MaxPoise, float PoiseDelta)
+{
+	if (TSharedPtr<SRunProgressWidget> Widget = RunProgressWidget.Pin())
+	{
+		Widget->UpdatePoise(CurrentPoise, MaxPoise);
+	}
+}
+
+void UHUDViewModel::HandleIntegrityChanged(float CurrentIntegrity, float MaxIntegrity, float IntegrityDelta)
+{
+	if (TSharedPtr<SRunProgressWidget> Widget = RunProgressWidget.Pin())
+	{
+		Widget->UpdateIntegrity(CurrentIntegrity, MaxIntegrity);
+	}
+}
+
+void UHUDViewModel::HandleSlotsChanged()
+{
+	if (TSharedPtr<SSimpleSlotManagerWidget> Widget = SlotWidget.Pin())
+	{
+		Widget->RefreshSlots();
+	}
+}
+
+void UHUDViewModel::HandleEnemyHealthChanged(float CurrentHealth, float MaxHealth, float HealthDelta)
+{
+	if (TSharedPtr<SEnemyHealthWidget> Widget = EnemyHealthWidget.Pin())
+	{
+		Widget->UpdateEnemyHealth(CurrentHealth, MaxHealth);
+	}
+}
+
+void UHUDViewModel::HandleEnemyPoiseChanged(float CurrentPoise, float MaxPoise, float PoiseDelta)
+{
+	if (TSharedPtr<SEnemyHealthWidget> Widget = EnemyHealthWidget.Pin())
+	{
+		Widget->UpdateEnemyPoise(CurrentPoise, MaxPoise);
+	}
+}
+
+void UHUDViewModel::HandleRoomStarted(URoomDataAsset* Room)
+{
+	if (TSharedPtr<SRunProgressWidget> Widget = RunProgressWidget.Pin())
+	{
+		Widget->UpdateCurrentRoomInfo(Room);
+	}
+}
+
+void UHUDViewModel::HandleRoomCompleted(URoomDataAsset* Room)
+{
+	TSharedPtr<SRunProgressWidget> Widget = RunProgressWidget.Pin();
+	if (Widget.IsValid() && RunManager.IsValid())
+	{
+		Widget->SetRoomCompleted(RunManager->GetCurrentLevel() - 1);
+	}
+}
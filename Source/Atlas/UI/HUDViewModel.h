@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "HUDViewModel.generated.h"
+
+class AGameCharacterBase;
+class UHealthComponent;
+class UStationIntegrityComponent;
+class USlotManagerComponent;
+class URunManagerComponent;
+class URoomDataAsset;
+class URewardDataAsset;
+class SRunProgressWidget;
+class SEnemyHealthWidget;
+class SSimpleSlotManagerWidget;
+
+/**
+ * Feeds the run HUD from gameplay events.
+ *
+ * The HUD widgets used to bind their bars and text to getters that Slate re-evaluated on
+ * every paint, with the run manager also pushing player stats from its tick. The model
+ * subscribes to the player's health, poise, integrity and slot events, the current enemy's
+ * health and poise, and the run manager's room events, and pushes each new value into the
+ * widget that shows it. The widgets keep what they last displayed and only touch (and so
+ * invalidate) a child widget when its value actually changes.
+ *
+ * Widgets are registered as they are created and may come and go independently of the
+ * bindings; registering a widget fills it with the latest values.
+ */
+UCLASS()
+class ATLAS_API UHUDViewModel : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Follow the run manager's room started and room completed events */
+	void BindRunManager(URunManagerComponent* InRunManager);
+
+	/** Follow the player's health, poise, integrity and equipped rewards */
+	void BindPlayer(AGameCharacterBase* Player);
+
+	/** Follow an enemy's health and poise, nullptr stops following the current one */
+	void BindEnemy(AGameCharacterBase* Enemy);
+
+	/** Drop every binding */
+	void UnbindAll();
+
+	void SetRunProgressWidget(const TSharedPtr<SRunProgressWidget>& Widget);
+	void SetEnemyHealthWidget(const TSharedPtr<SEnemyHealthWidget>& Widget);
+	void SetSlotWidget(const TSharedPtr<SSimpleSlotManagerWidget>& Widget);
+
+	/** Push the player's current values into the registered widgets */
+	void RefreshPlayer();
+
+	/** Push the current enemy's values into the enemy widget */
+	void RefreshEnemy();
+
+private:
+	void UnbindPlayer();
+
+	UFUNCTION()
+	void HandlePlayerHealthChanged(float CurrentHealth, float MaxHealth, float HealthDelta);
+
+	UFUNCTION()
+	void HandlePlayerPoiseChanged(float CurrentPoise, float MaxPoise, float PoiseDelta);
+
+	UFUNCTION()
+	void HandleIntegrityChanged(float CurrentIntegrity, float MaxIntegrity, float IntegrityDelta);
+
+	UFUNCTION()
+	void HandleSlotsChanged();
+
+	UFUNCTION()
+	void HandleEnemyHealthChanged(float CurrentHealth, float MaxHealth, float HealthDelta);
+
+	UFUNCTION()
+	void HandleEnemyPoiseChanged(float CurrentPoise, float MaxPoise, float PoiseDelta);
+
+	UFUNCTION()
+	void HandleRoomStarted(URoomDataAsset* Room);
+
+	UFUNCTION()
+	void HandleRoomCompleted(URoomDataAsset* Room);
+
+	TWeakObjectPtr<URunManagerComponent> RunManager;
+	TWeakObjectPtr<UHealthComponent> PlayerHealth;
+	TWeakObjectPtr<UStationIntegrityComponent> PlayerIntegrity;
+	TWeakObjectPtr<USlotManagerComponent> PlayerSlots;
+	TWeakObjectPtr<UHealthComponent> EnemyHealth;
+
+	TWeakPtr<SRunProgressWidget> RunProgressWidget;
+	TWeakPtr<SEnemyHealthWidget> EnemyHealthWidget;
+	TWeakPtr<SSimpleSlotManagerWidget> SlotWidget;
+};
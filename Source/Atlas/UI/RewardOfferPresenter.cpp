@@ -0,0 +1,130 @@
+#include "RewardOfferPresenter.h"
+#include "SRewardSelectionWidget.h"
+#include "Atlas/Data/RoomDataAsset.h"
+#include "Atlas/Data/RewardDataAsset.h"
+#include "Atlas/Components/RunManagerComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/Texture2D.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	// Long enough to cover a room's fight and the offer screen
+	constexpr float IconResidentSeconds = 120.0f;
+
+	// Above the HUD and the inventory
+	constexpr int32 OfferZOrder = 1000;
+}
+
+void URewardOfferPresenter::Initialize(URunManagerComponent* InRunManager)
+{
+	RunManager = InRunManager;
+}
+
+void URewardOfferPresenter::PrepareOffer(const URoomDataAsset* Room, const TArray<URewardDataAsset*>& Choices)
+{
+	PreparedChoices = Choices;
+
+	// The offer is already rolled, but stream the rest of the pool too in case it is rerolled
+	TArray<URewardDataAsset*> LikelyRewards = Choices;
+	if (Room)
+	{
+		for (const FRewardChoice& Choice : Room->RewardPool)
+		{
+			LikelyRewards.AddUnique(Choice.Reward);
+		}
+		LikelyRewards.AddUnique(Room->GuaranteedReward);
+	}
+	StreamIcons(LikelyRewards);
+
+	// Bind now while the widget is hidden, so clearing the room only has to show it
+	EnsureWidget();
+	if (!IsShowing())
+	{
+		Widget->SetRewardChoices(PreparedChoices);
+	}
+}
+
+TArray<URewardDataAsset*> URewardOfferPresenter::TakePreparedOffer()
+{
+	TArray<URewardDataAsset*> Choices = MoveTemp(PreparedChoices);
+	PreparedChoices.Reset();
+	return Choices;
+}
+
+void URewardOfferPresenter::MarkRoomCleared()
+{
+	RoomClearedSeconds = FPlatformTime::Seconds();
+}
+
+void URewardOfferPresenter::Show(const TArray<URewardDataAsset*>& Choices)
+{
+	EnsureWidget();
+	Widget->SetRewardChoices(Choices);
+
+	if (!bInViewport && GEngine && GEngine->GameViewport)
+	{
+		GEngine->GameViewport->AddViewportWidgetContent(Widget.ToSharedRef(), OfferZOrder);
+		bInViewport = true;
+	}
+
+	Widget->SetVisibility(EVisibility::Visible);
+
+	if (RoomClearedSeconds > 0.0)
+	{
+		LastPresentLatencyMs = (FPlatformTime::Seconds() - RoomClearedSeconds) * 1000.0;
+		RoomClearedSeconds = 0.0;
+	}
+}
+
+void URewardOfferPresenter::Hide()
+{
+	if (Widget.IsValid())
+	{
+		Widget->SetVisibility(EVisibility::Collapsed);
+	}
+}
+
+bool URewardOfferPresenter::IsShowing() const
+{
+	return Widget.IsValid() && bInViewport && Widget->GetVisibility() == EVisibility::Visible;
+}
+
+void URewardOfferPresenter::Release()
+{
+	if (Widget.IsValid() && bInViewport && GEngine && GEngine->GameViewport)
+	{
+		GEngine->GameViewport->RemoveViewportWidgetContent(Widget.ToSharedRef());
+	}
+
+	bInViewport = false;
+	Widget.Reset();
+	PreparedChoices.Reset();
+}
+
+void URewardOfferPresenter::EnsureWidget()
+{
+	if (Widget.IsValid())
+	{
+		return;
+	}
+
+	// Selection and cancel go through the run manager, which hides this again
+	Widget = SNew(SRewardSelectionWidget)
+		.RunManager(RunManager.Get())
+		.OnRewardSelected(FSimpleDelegate::CreateUObject(this, &URewardOfferPresenter::Hide))
+		.OnSelectionCancelled(FSimpleDelegate::CreateUObject(this, &URewardOfferPresenter::Hide));
+	Widget->SetVisibility(EVisibility::Collapsed);
+}
+
+void URewardOfferPresenter::StreamIcons(const TArray<URewardDataAsset*>& Rewards)
+{
+	for (const URewardDataAsset* Reward : Rewards)
+	{
+		if (Reward && Reward->Icon)
+		{
+			Reward->Icon->SetForceMipLevelsToBeResident(IconResidentSeconds);
+		}
+	}
+}
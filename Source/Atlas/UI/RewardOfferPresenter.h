@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "RewardOfferPresenter.generated.h"
+
+class URunManagerComponent;
+class URoomDataAsset;
+class URewardDataAsset;
+class SRewardSelectionWidget;
+
+/**
+ * Gets the reward offer for a room ready while the room is being fought, and shows it
+ * in one persistent widget.
+ *
+ * The run manager hands over the rolled offer when a room loads. The presenter keeps it,
+ * asks the texture streamer to bring the room's reward icons fully resident, and rebinds
+ * the hidden selection widget to the new rewards. When the room is cleared, showing the
+ * offer is a visibility flip on a widget that is already built, bound and in the viewport,
+ * rather than a new widget tree built while the game pauses.
+ */
+UCLASS()
+class ATLAS_API URewardOfferPresenter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void Initialize(URunManagerComponent* InRunManager);
+
+	/** Take the offer for the room being fought and stream in its icons */
+	void PrepareOffer(const URoomDataAsset* Room, const TArray<URewardDataAsset*>& Choices);
+
+	bool HasPreparedOffer() const { return PreparedChoices.Num() > 0; }
+
+	/** The prepared offer, cleared so the next room rolls its own */
+	TArray<URewardDataAsset*> TakePreparedOffer();
+
+	/** Start timing room clear to interactive offer */
+	void MarkRoomCleared();
+
+	/** Rebind the persistent widget and make it visible */
+	void Show(const TArray<URewardDataAsset*>& Choices);
+	void Hide();
+
+	bool IsShowing() const;
+
+	/** Remove the widget from the viewport, it is rebuilt on the next Show */
+	void Release();
+
+	TSharedPtr<SRewardSelectionWidget> GetWidget() const { return Widget; }
+
+	/** Time from the last MarkRoomCleared to the offer being shown */
+	double GetLastPresentLatencyMs() const { return LastPresentLatencyMs; }
+
+private:
+	void EnsureWidget();
+
+	/** Ask the texture streamer to keep the icons at full resolution for a while */
+	static void StreamIcons(const TArray<URewardDataAsset*>& Rewards);
+
+	TWeakObjectPtr<URunManagerComponent> RunManager;
+
+	UPROPERTY()
+	TArray<URewardDataAsset*> PreparedChoices;
+
+	TSharedPtr<SRewardSelectionWidget> Widget;
+
+	bool bInViewport = false;
+
+	double RoomClearedSeconds = 0.0;
+	double LastPresentLatencyMs = 0.0;
+};
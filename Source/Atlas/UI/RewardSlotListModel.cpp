@@ -0,0 +1,42 @@
+#include "RewardSlotListModel.h"
+
+bool FRewardSlotListModel::Sync(const USlotManagerComponent* SlotManager, TArray<int32>& OutChangedSlots)
+{
+	static const TArray<FEquippedReward> NoSlots;
+	return Sync(SlotManager ? SlotManager->GetEquippedRewardSlots() : NoSlots, OutChangedSlots);
+}
+
+bool FRewardSlotListModel::Sync(const TArray<FEquippedReward>& Slots, TArray<int32>& OutChangedSlots)
+{
+	OutChangedSlots.Reset();
+
+	const bool bCountChanged = Slots.Num() != Items.Num();
+	if (bCountChanged)
+	{
+		// Keep the items of slots that still exist so their rows survive
+		const int32 OldNum = Items.Num();
+		Items.SetNum(Slots.Num());
+		for (int32 SlotIndex = OldNum; SlotIndex < Items.Num(); SlotIndex++)
+		{
+			Items[SlotIndex] = MakeShared<FRewardSlotItem>();
+			Items[SlotIndex]->SlotIndex = SlotIndex;
+		}
+	}
+
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); SlotIndex++)
+	{
+		FRewardSlotItem& Item = *Items[SlotIndex];
+		const FEquippedReward& Slot = Slots[SlotIndex];
+		const int32 StackLevel = Slot.RewardData ? Slot.StackLevel : 0;
+		if (Item.Reward == Slot.RewardData && Item.StackLevel == StackLevel)
+		{
+			continue;
+		}
+
+		Item.Reward = Slot.RewardData;
+		Item.StackLevel = StackLevel;
+		OutChangedSlots.Add(SlotIndex);
+	}
+
+	return bCountChanged;
+}
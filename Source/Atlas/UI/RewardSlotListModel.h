@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/Views/ITableRow.h"
+#include "Atlas/Components/SlotManagerComponent.h"
+
+class URewardDataAsset;
+
+/**
+ * One reward slot as the slot list and tile views show it
+ */
+struct ATLAS_API FRewardSlotItem
+{
+	int32 SlotIndex = INDEX_NONE;
+	URewardDataAsset* Reward = nullptr;
+	int32 StackLevel = 0;
+};
+
+/**
+ * Items behind the slot widgets' list and tile views, diffed against the slot manager.
+ *
+ * There is one item per slot and it is kept for as long as the slot exists, so the views
+ * keep the rows they generated for it. Sync copies the slot manager's EquippedRewards into
+ * the items and reports which slots changed, so a widget only refreshes those rows, and
+ * whether the slot count changed, which is the only case the view has to regenerate.
+ */
+class ATLAS_API FRewardSlotListModel
+{
+public:
+	/**
+	 * Pull the slots from a slot manager, no slot manager means no slots
+	 * @param OutChangedSlots Slots whose reward or stack level changed
+	 * @return True if slots were added or removed
+	 */
+	bool Sync(const USlotManagerComponent* SlotManager, TArray<int32>& OutChangedSlots);
+	bool Sync(const TArray<FEquippedReward>& Slots, TArray<int32>& OutChangedSlots);
+
+	const TArray<TSharedPtr<FRewardSlotItem>>& GetItems() const { return Items; }
+	TSharedPtr<FRewardSlotItem> GetItem(int32 SlotIndex) const { return Items.IsValidIndex(SlotIndex) ? Items[SlotIndex] : nullptr; }
+	int32 Num() const { return Items.Num(); }
+
+private:
+	TArray<TSharedPtr<FRewardSlotItem>> Items;
+};
+
+/**
+ * Rows a list or tile view released when their slot scrolled out of view, handed back to
+ * OnGenerateRow for the next slot that scrolls in instead of building a new row.
+ */
+template<typename RowType>
+class TRewardSlotRowPool
+{
+public:
+	/** A released row to rebind, or null if one has to be built */
+	TSharedPtr<RowType> Acquire()
+	{
+		return FreeRows.Num() > 0 ? FreeRows.Pop(EAllowShrinking::No) : nullptr;
+	}
+
+	/** Count a newly built row */
+	TSharedRef<RowType> Track(const TSharedRef<RowType>& Row)
+	{
+		++NumCreated;
+		return Row;
+	}
+
+	/** Bind to the view's OnRowReleased */
+	void Release(const TSharedRef<ITableRow>& Row)
+	{
+		FreeRows.Add(StaticCastSharedRef<RowType>(Row->AsWidget()));
+	}
+
+	/** Rows built over the pool's lifetime */
+	int32 GetNumCreated() const { return NumCreated; }
+
+private:
+	TArray<TSharedRef<RowType>> FreeRows;
+	int32 NumCreated = 0;
+};
@@ -0,0 +1,88 @@
+#include "SEnemyBarOverlay.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/AppStyle.h"
+
+void SEnemyBarOverlay::Construct(const FArguments& InArgs)
+{
+	BarBrush = FAppStyle::GetBrush("WhiteBrush");
+
+	SetVisibility(EVisibility::HitTestInvisible);
+}
+
+TArray<FEnemyBarEntry>& SEnemyBarOverlay::BeginUpdate()
+{
+	Entries.Reset();
+	return Entries;
+}
+
+void SEnemyBarOverlay::EndUpdate()
+{
+	// Positions follow the camera, so anything on screen has to be redrawn
+	if (Entries.Num() > 0 || LastNumDrawElements > 0)
+	{
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+int32 SEnemyBarOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const FVector2f LocalSize = FVector2f(AllottedGeometry.GetLocalSize());
+	const FLinearColor BackgroundColor(0.05f, 0.05f, 0.05f, 0.8f);
+	const FLinearColor HealthColor(0.8f, 0.2f, 0.2f);
+	const FLinearColor PoiseColor(0.8f, 0.6f, 1.0f);
+	const FLinearColor StaggeredColor(0.5f, 0.0f, 0.5f);
+
+	int32 NumElements = 0;
+	auto DrawBar = [&](const FVector2f& TopLeft, float Width, float Height, const FLinearColor& Color, int32 Layer)
+	{
+		FSlateDrawElement::MakeBox(OutDrawElements, Layer,
+			AllottedGeometry.ToPaintGeometry(FVector2f(Width, Height), FSlateLayoutTransform(TopLeft)),
+			BarBrush, ESlateDrawEffect::None, Color * InWidgetStyle.GetColorAndOpacityTint());
+		++NumElements;
+	};
+
+	// Backgrounds on one layer and fills on the next, so Slate batches each layer into one draw
+	const int32 BackgroundLayer = LayerId;
+	const int32 FillLayer = LayerId + 1;
+
+	for (const FEnemyBarEntry& Entry : Entries)
+	{
+		const float TotalHeight = HealthBarHeight
+			+ (Entry.bShowPoise ? BarSpacing + PoiseBarHeight : 0.0f)
+			+ (Entry.TierColor.A > 0.0f ? BarSpacing + TierBarHeight : 0.0f);
+		FVector2f TopLeft = Entry.Position * LocalSize - FVector2f(BarWidth * 0.5f, TotalHeight);
+
+		DrawBar(TopLeft, BarWidth, TotalHeight, BackgroundColor, BackgroundLayer);
+
+		DrawBar(TopLeft, BarWidth * FMath::Clamp(Entry.HealthPercent, 0.0f, 1.0f), HealthBarHeight, HealthColor, FillLayer);
+		TopLeft.Y += HealthBarHeight + BarSpacing;
+
+		if (Entry.bShowPoise)
+		{
+			if (Entry.PoisePercent <= 0.0f)
+			{
+				DrawBar(TopLeft, BarWidth, PoiseBarHeight, StaggeredColor, FillLayer);
+			}
+			else
+			{
+				DrawBar(TopLeft, BarWidth * FMath::Min(Entry.PoisePercent, 1.0f), PoiseBarHeight, PoiseColor, FillLayer);
+			}
+			TopLeft.Y += PoiseBarHeight + BarSpacing;
+		}
+
+		if (Entry.TierColor.A > 0.0f)
+		{
+			DrawBar(TopLeft, BarWidth, TierBarHeight, Entry.TierColor, FillLayer);
+		}
+	}
+
+	LastNumDrawElements = NumElements;
+	return FillLayer;
+}
+
+FVector2D SEnemyBarOverlay::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	// Fills whatever it is given, the viewport overlay slot stretches it over the game view
+	return FVector2D::ZeroVector;
+}
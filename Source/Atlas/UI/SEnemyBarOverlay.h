@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+
+/**
+ * One enemy's bars, already projected. Written every frame by UEnemyBarSubsystem.
+ */
+struct ATLAS_API FEnemyBarEntry
+{
+	/** Bar anchor in the viewport, 0-1 on both axes */
+	FVector2f Position = FVector2f::ZeroVector;
+
+	float HealthPercent = 1.0f;
+	float PoisePercent = 1.0f;
+
+	/** Vulnerability tier colour, alpha 0 when the enemy isn't vulnerable */
+	FLinearColor TierColor = FLinearColor::Transparent;
+
+	/** Poise is only drawn up close */
+	bool bShowPoise = true;
+};
+
+/**
+ * Draws every world-space enemy bar in a single OnPaint from a packed array, instead of
+ * a widget per enemy with its own attributes and projection.
+ */
+class ATLAS_API SEnemyBarOverlay : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SEnemyBarOverlay)
+	{}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** The array to fill for this frame, call EndUpdate when done */
+	TArray<FEnemyBarEntry>& BeginUpdate();
+	void EndUpdate();
+
+	int32 GetNumEntries() const { return Entries.Num(); }
+
+	/** Draw elements emitted by the last paint */
+	int32 GetLastNumDrawElements() const { return LastNumDrawElements; }
+
+	// SWidget interface
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+	TArray<FEnemyBarEntry> Entries;
+
+	const FSlateBrush* BarBrush = nullptr;
+
+	mutable int32 LastNumDrawElements = 0;
+
+	static constexpr float BarWidth = 80.0f;
+	static constexpr float HealthBarHeight = 6.0f;
+	static constexpr float PoiseBarHeight = 3.0f;
+	static constexpr float TierBarHeight = 2.0f;
+	static constexpr float BarSpacing = 1.0f;
+};
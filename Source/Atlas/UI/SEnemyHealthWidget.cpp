@@ -37,10 +37,9 @@ void SEnemyHealthWidget::Construct(const FArguments& InArgs)
         .VAlign(VAlign_Top)
         .Padding(0, 100, 0, 0)
         [
-            SNew(SBox)
+            SAssignNew(ContentBox, SBox)
             .WidthOverride(500)
             .HeightOverride(220)
-            .Visibility(this, &SEnemyHealthWidget::GetWidgetVisibility)
             [
                 SNew(SBorder)
                 .BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
@@ -55,7 +54,7 @@ void SEnemyHealthWidget::Construct(const FArguments& InArgs)
                     .Padding(0, 0, 0, 8)
                     [
                         SAssignNew(EnemyNameText, STextBlock)
-                        .Text(this, &SEnemyHealthWidget::GetEnemyNameText)
+                        .Text(EnemyName)
                         .Font(FCoreStyle::GetDefaultFontStyle("Bold", 16))
                         .ColorAndOpacity(FSlateColor(FLinearColor(1.0f, 0.2f, 0.2f)))
                         .Justification(ETextJustify::Center)
@@ -84,7 +83,6 @@ void SEnemyHealthWidget::Construct(const FArguments& InArgs)
                     .Padding(0, 0, 0, 8)
                     [
                         SAssignNew(HealthText, STextBlock)
-                        .Text(this, &SEnemyHealthWidget::GetHealthText)
                         .Font(FCoreStyle::GetDefaultFontStyle("Regular", 11))
                         .ColorAndOpacity(FSlateColor(FLinearColor(0.9f, 0.9f, 0.9f)))
                     ]
@@ -111,7 +109,6 @@ void SEnemyHealthWidget::Construct(const FArguments& InArgs)
                     .HAlign(HAlign_Center)
                     [
                         SAssignNew(PoiseText, STextBlock)
-                        .Text(this, &SEnemyHealthWidget::GetPoiseText)
                         .Font(FCoreStyle::GetDefaultFontStyle("Regular", 11))
                         .ColorAndOpacity(FSlateColor(FLinearColor(0.9f, 0.9f, 0.9f)))
                     ]
@@ -119,6 +116,10 @@ void SEnemyHealthWidget::Construct(const FArguments& InArgs)
             ]
         ]
     ];
+    
+    RefreshHealth();
+    RefreshPoise();
+    RefreshVisibility();
 }
 
 TSharedRef<SWidget> SEnemyHealthWidget::CreateEnemyHealthBar()
@@ -138,8 +139,6 @@ TSharedRef<SWidget> SEnemyHealthWidget::CreateEnemyHealthBar()
             + SOverlay::Slot()
             [
                 SAssignNew(HealthBar, SProgressBar)
-                .Percent(this, &SEnemyHealthWidget::GetHealthPercent)
-                .FillColorAndOpacity(this, &SEnemyHealthWidget::GetHealthBarColor)
                 .BackgroundImage(FAppStyle::GetBrush("NoBrush"))
             ]
         ];
@@ -162,8 +161,6 @@ TSharedRef<SWidget> SEnemyHealthWidget::CreateEnemyPoiseBar()
             + SOverlay::Slot()
             [
                 SAssignNew(PoiseBar, SProgressBar)
-                .Percent(this, &SEnemyHealthWidget::GetPoisePercent)
-                .FillColorAndOpacity(this, &SEnemyHealthWidget::GetPoiseBarColor)
                 .BackgroundImage(FAppStyle::GetBrush("NoBrush"))
             ]
         ];
@@ -171,21 +168,41 @@ TSharedRef<SWidget> SEnemyHealthWidget::CreateEnemyPoiseBar()
 
 void SEnemyHealthWidget::UpdateEnemyHealth(float CurrentHealth, float MaxHealth)
 {
+    if (CurrentHealth == CurrentEnemyHealth && MaxHealth == MaxEnemyHealth)
+    {
+        return;
+    }
+    
     CurrentEnemyHealth = CurrentHealth;
     MaxEnemyHealth = MaxHealth;
-    Invalidate(EInvalidateWidgetReason::Paint);
+    RefreshHealth();
+    RefreshVisibility();
 }
 
 void SEnemyHealthWidget::UpdateEnemyPoise(float CurrentPoise, float MaxPoise)
 {
+    if (CurrentPoise == CurrentEnemyPoise && MaxPoise == MaxEnemyPoise)
+    {
+        return;
+    }
+    
     CurrentEnemyPoise = CurrentPoise;
     MaxEnemyPoise = MaxPoise;
-    Invalidate(EInvalidateWidgetReason::Paint);
+    RefreshPoise();
 }
 
 void SEnemyHealthWidget::SetEnemyName(const FText& Name)
 {
+    if (EnemyName.EqualTo(Name))
+    {
+        return;
+    }
+    
     EnemyName = Name;
+    if (EnemyNameText.IsValid())
+    {
+        EnemyNameText->SetText(EnemyName);
+    }
 }
 
 void SEnemyHealthWidget::SetEnemyHealthComponent(UHealthComponent* HealthComp)
@@ -200,30 +217,71 @@ void SEnemyHealthWidget::SetEnemyHealthComponent(UHealthComponent* HealthComp)
         MaxEnemyPoise = HealthComp->GetMaxPoise();
         bIsVisible = true;
         
-        Invalidate(EInvalidateWidgetReason::Paint);
+        RefreshHealth();
+        RefreshPoise();
     }
     else
     {
         bIsVisible = false;
-        Invalidate(EInvalidateWidgetReason::Visibility);
     }
+    
+    RefreshVisibility();
 }
 
 void SEnemyHealthWidget::ShowWidget()
 {
     bIsVisible = true;
-    Invalidate(EInvalidateWidgetReason::Visibility);
+    RefreshVisibility();
 }
 
 void SEnemyHealthWidget::HideWidget()
 {
     bIsVisible = false;
-    Invalidate(EInvalidateWidgetReason::Visibility);
+    RefreshVisibility();
 }
 
-FText SEnemyHealthWidget::GetEnemyNameText() const
+void SEnemyHealthWidget::RefreshHealth()
 {
-    return EnemyName;
+    // The bar setters skip invalidation when handed the value they already have
+    HealthBar->SetPercent(GetHealthPercent());
+    HealthBar->SetFillColorAndOpacity(GetHealthBarColor());
+    
+    const int32 Health = FMath::RoundToInt(CurrentEnemyHealth);
+    const int32 MaxHealth = FMath::RoundToInt(MaxEnemyHealth);
+    if (Health != DisplayedHealth || MaxHealth != DisplayedMaxHealth)
+    {
+        DisplayedHealth = Health;
+        DisplayedMaxHealth = MaxHealth;
+        HealthText->SetText(GetHealthText());
+    }
+}
+
+void SEnemyHealthWidget::RefreshPoise()
+{
+    PoiseBar->SetPercent(GetPoisePercent());
+    PoiseBar->SetFillColorAndOpacity(GetPoiseBarColor());
+    
+    const int32 Poise = FMath::RoundToInt(CurrentEnemyPoise);
+    const int32 MaxPoise = FMath::RoundToInt(MaxEnemyPoise);
+    const bool bStaggered = CurrentEnemyPoise <= 0.0f;
+    if (Poise != DisplayedPoise || MaxPoise != DisplayedMaxPoise || bStaggered != bDisplayedStaggered)
+    {
+        DisplayedPoise = Poise;
+        DisplayedMaxPoise = MaxPoise;
+        bDisplayedStaggered = bStaggered;
+        PoiseText->SetText(GetPoiseText());
+    }
+}
+
+void SEnemyHealthWidget::RefreshVisibility()
+{
+    // Always visible if we have health data
+    const bool bHasHealthData = CurrentEnemyHealth > 0 || MaxEnemyHealth > 0;
+    const EVisibility Visibility = bIsVisible || bHasHealthData ? EVisibility::SelfHitTestInvisible : EVisibility::Collapsed;
+    if (ContentBox.IsValid() && ContentBox->GetVisibility() != Visibility)
+    {
+        ContentBox->SetVisibility(Visibility);
+    }
 }
 
 FText SEnemyHealthWidget::GetHealthText() const
@@ -295,16 +353,3 @@ FSlateColor SEnemyHealthWidget::GetPoiseBarColor() const
     
     return FSlateColor(FLinearColor(0.8f, 0.6f, 1.0f));
 }
-
-EVisibility SEnemyHealthWidget::GetWidgetVisibility() const
-{
-    // Always visible if we have health data
-    if (CurrentEnemyHealth > 0 || MaxEnemyHealth > 0)
-    {
-        return EVisibility::SelfHitTestInvisible;
-    }
-    
-    EVisibility Vis = bIsVisible ? EVisibility::SelfHitTestInvisible : EVisibility::Collapsed;
-    
-    return Vis;
-}
\ No newline at end of file
@@ -7,7 +7,13 @@
 class UHealthComponent;
 class SProgressBar;
 class STextBlock;
+class SBox;
 
+/**
+ * Boss-style health and poise panel for the current room enemy.
+ * Values are pushed in through the Update functions, each child widget is only
+ * touched when what it displays actually changes.
+ */
 class ATLAS_API SEnemyHealthWidget : public SCompoundWidget
 {
 public:
@@ -36,6 +42,14 @@ private:
     float MaxEnemyPoise = 100.0f;
     FText EnemyName;
     
+    // Last values written to the text blocks
+    int32 DisplayedHealth = INDEX_NONE;
+    int32 DisplayedMaxHealth = INDEX_NONE;
+    int32 DisplayedPoise = INDEX_NONE;
+    int32 DisplayedMaxPoise = INDEX_NONE;
+    bool bDisplayedStaggered = false;
+    
+    TSharedPtr<SBox> ContentBox;
     TSharedPtr<STextBlock> EnemyNameText;
     TSharedPtr<SProgressBar> HealthBar;
     TSharedPtr<SProgressBar> PoiseBar;
@@ -45,14 +59,16 @@ private:
     TSharedRef<SWidget> CreateEnemyHealthBar();
     TSharedRef<SWidget> CreateEnemyPoiseBar();
     
-    FText GetEnemyNameText() const;
+    void RefreshHealth();
+    void RefreshPoise();
+    void RefreshVisibility();
+    
     FText GetHealthText() const;
     FText GetPoiseText() const;
     TOptional<float> GetHealthPercent() const;
     TOptional<float> GetPoisePercent() const;
     FSlateColor GetHealthBarColor() const;
     FSlateColor GetPoiseBarColor() const;
-    EVisibility GetWidgetVisibility() const;
     
     bool bIsVisible = false;
 };
\ No newline at end of file
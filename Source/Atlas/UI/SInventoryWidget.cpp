@@ -5,6 +5,7 @@
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/SOverlay.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Views/STableRow.h"
 #include "Atlas/Components/SlotManagerComponent.h"
 #include "Atlas/Data/RewardDataAsset.h"
 #include "Styling/SlateColor.h"
@@ -24,7 +25,121 @@ const TArray<FKey> SInventoryWidget::SlotKeyBinds = {
 	EKeys::Two,
 	EKeys::Three,
 	EKeys::Four,
-	EKeys::Five
+	EKeys::Five,
+	EKeys::Six,
+	EKeys::Seven,
+	EKeys::Eight,
+	EKeys::Nine
+};
+
+DECLARE_DELEGATE_OneParam(FOnInventorySlotClicked, int32);
+
+/**
+ * One slot button in the inventory slot list. SInventoryWidget fills it, and fills it
+ * again when the row is reused for another slot.
+ */
+class SInventorySlotRow : public STableRow<TSharedPtr<FRewardSlotItem>>
+{
+public:
+	SLATE_BEGIN_ARGS(SInventorySlotRow) {}
+		SLATE_EVENT(FOnInventorySlotClicked, OnSlotClicked)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable)
+	{
+		OnSlotClicked = InArgs._OnSlotClicked;
+		
+		STableRow<TSharedPtr<FRewardSlotItem>>::Construct(
+			STableRow<TSharedPtr<FRewardSlotItem>>::FArguments()
+			.Padding(FMargin(0, 3))
+			.ShowSelection(false)
+			[
+				SNew(SButton)
+				.OnClicked(this, &SInventorySlotRow::HandleClicked)
+				.ButtonColorAndOpacity(FLinearColor(0.1f, 0.1f, 0.1f))
+				.ContentPadding(0)
+				[
+					SAssignNew(Border, SBorder)
+					.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+					.Padding(10.0f)
+					[
+						SNew(SHorizontalBox)
+						
+						// Key bind
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(0, 0, 10, 0)
+						[
+							SNew(SBorder)
+							.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+							.BorderBackgroundColor(FLinearColor(0.2f, 0.2f, 0.2f))
+							.Padding(5.0f)
+							[
+								SAssignNew(KeyText, STextBlock)
+								.Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
+								.ColorAndOpacity(FSlateColor(FLinearColor::White))
+							]
+						]
+						
+						// Slot info
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.VAlign(VAlign_Center)
+						[
+							SNew(SVerticalBox)
+							
+							// Slot name
+							+ SVerticalBox::Slot()
+							.AutoHeight()
+							[
+								SAssignNew(SlotNameText, STextBlock)
+								.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
+								.ColorAndOpacity(FSlateColor(FLinearColor(0.7f, 0.7f, 0.7f)))
+							]
+							
+							// Current reward
+							+ SVerticalBox::Slot()
+							.AutoHeight()
+							[
+								SAssignNew(RewardText, STextBlock)
+								.Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
+							]
+							
+							// Stats (if equipped)
+							+ SVerticalBox::Slot()
+							.AutoHeight()
+							[
+								SAssignNew(StatsText, STextBlock)
+								.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
+								.ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.8f, 1.0f)))
+							]
+						]
+					]
+				]
+			],
+			InOwnerTable);
+	}
+
+	TSharedPtr<FRewardSlotItem> Item;
+	TSharedPtr<SBorder> Border;
+	TSharedPtr<STextBlock> KeyText;
+	TSharedPtr<STextBlock> SlotNameText;
+	TSharedPtr<STextBlock> RewardText;
+	TSharedPtr<STextBlock> StatsText;
+
+private:
+	FReply HandleClicked()
+	{
+		// The row may have been reused, so the slot comes from the item it shows now
+		if (Item.IsValid())
+		{
+			OnSlotClicked.ExecuteIfBound(Item->SlotIndex);
+		}
+		return FReply::Handled();
+	}
+
+	FOnInventorySlotClicked OnSlotClicked;
 };
 
 void SInventoryWidget::Construct(const FArguments& InArgs)
@@ -107,7 +222,7 @@ void SInventoryWidget::Construct(const FArguments& InArgs)
 					.Padding(0, 15, 0, 0)
 					[
 						SNew(STextBlock)
-						.Text(FText::FromString(TEXT("Click a slot or press number keys 1-5 to equip the reward")))
+						.Text(FText::FromString(TEXT("Click a slot or press its number key to equip the reward")))
 						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 12))
 						.ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.6f, 0.6f)))
 						.Justification(ETextJustify::Center)
@@ -116,6 +231,8 @@ void SInventoryWidget::Construct(const FArguments& InArgs)
 			]
 		]
 	];
+	
+	RefreshSlots();
 }
 
 TSharedRef<SWidget> SInventoryWidget::CreateSelectedRewardPanel()
@@ -248,41 +365,15 @@ TSharedRef<SWidget> SInventoryWidget::CreateSlotSelectionPanel()
 				.ColorAndOpacity(FSlateColor(FLinearColor(0.7f, 0.7f, 0.7f)))
 			]
 			
-			// Slots
+			// Slots, scrolls when there are more than fit
 			+ SVerticalBox::Slot()
 			.FillHeight(1.0f)
 			[
-				SNew(SVerticalBox)
-				+ SVerticalBox::Slot()
-				.FillHeight(0.2f)
-				.Padding(0, 3)
-				[
-					CreateSlotButton(0)
-				]
-				+ SVerticalBox::Slot()
-				.FillHeight(0.2f)
-				.Padding(0, 3)
-				[
-					CreateSlotButton(1)
-				]
-				+ SVerticalBox::Slot()
-				.FillHeight(0.2f)
-				.Padding(0, 3)
-				[
-					CreateSlotButton(2)
-				]
-				+ SVerticalBox::Slot()
-				.FillHeight(0.2f)
-				.Padding(0, 3)
-				[
-					CreateSlotButton(3)
-				]
-				+ SVerticalBox::Slot()
-				.FillHeight(0.2f)
-				.Padding(0, 3)
-				[
-					CreateSlotButton(4)
-				]
+				SAssignNew(SlotListView, SListView<TSharedPtr<FRewardSlotItem>>)
+				.ListItemsSource(&SlotModel.GetItems())
+				.SelectionMode(ESelectionMode::None)
+				.OnGenerateRow(this, &SInventoryWidget::OnGenerateSlotRow)
+				.OnRowReleased_Lambda([this](const TSharedRef<ITableRow>& Row) { RowPool.Release(Row); })
 			]
 			
 			// Action buttons
@@ -317,81 +408,57 @@ TSharedRef<SWidget> SInventoryWidget::CreateSlotSelectionPanel()
 		];
 }
 
-TSharedRef<SWidget> SInventoryWidget::CreateSlotButton(int32 SlotIndex)
+TSharedRef<ITableRow> SInventoryWidget::OnGenerateSlotRow(TSharedPtr<FRewardSlotItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
 {
-	return SNew(SButton)
-		.OnClicked(this, &SInventoryWidget::OnSlotClicked, SlotIndex)
-		.ButtonColorAndOpacity(FLinearColor(0.1f, 0.1f, 0.1f))
-		.ContentPadding(0)
-		[
-			SNew(SBorder)
-			.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
-			.BorderBackgroundColor(this, &SInventoryWidget::GetSlotBorderColor, SlotIndex)
-			.Padding(10.0f)
-			[
-				SNew(SHorizontalBox)
-				
-				// Key bind
-				+ SHorizontalBox::Slot()
-				.AutoWidth()
-				.VAlign(VAlign_Center)
-				.Padding(0, 0, 10, 0)
-				[
-					SNew(SBorder)
-					.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
-					.BorderBackgroundColor(FLinearColor(0.2f, 0.2f, 0.2f))
-					.Padding(5.0f)
-					[
-						SNew(STextBlock)
-						.Text(FText::AsNumber(SlotIndex + 1))
-						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
-						.ColorAndOpacity(FSlateColor(FLinearColor::White))
-					]
-				]
-				
-				// Slot info
-				+ SHorizontalBox::Slot()
-				.FillWidth(1.0f)
-				.VAlign(VAlign_Center)
-				[
-					SNew(SVerticalBox)
-					
-					// Slot name
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					[
-						SNew(STextBlock)
-						.Text(FText::FromString(SlotNames[SlotIndex]))
-						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
-						.ColorAndOpacity(FSlateColor(FLinearColor(0.7f, 0.7f, 0.7f)))
-					]
-					
-					// Current reward
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					[
-						SNew(STextBlock)
-						.Text(this, &SInventoryWidget::GetSlotText, SlotIndex)
-						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
-						.ColorAndOpacity(this, &SInventoryWidget::GetSlotTextColor, SlotIndex)
-					]
-					
-					// Stats (if equipped)
-					+ SVerticalBox::Slot()
-					.AutoHeight()
-					[
-						SNew(STextBlock)
-						.Text_Lambda([this, SlotIndex]()
-						{
-							URewardDataAsset* CurrentReward = GetRewardInSlot(SlotIndex);
-							return CurrentReward ? GetRewardStats(CurrentReward) : FText::GetEmpty();
-						})
-						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
-						.ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.8f, 1.0f)))
-					]
-				]
-			]
-		];
+	TSharedPtr<SInventorySlotRow> Row = RowPool.Acquire();
+	if (!Row.IsValid())
+	{
+		Row = RowPool.Track(SNew(SInventorySlotRow, OwnerTable)
+			.OnSlotClicked(this, &SInventoryWidget::OnSlotClicked));
+	}
+	
+	BindSlotRow(*Row, Item);
+	return Row.ToSharedRef();
+}
+
+void SInventoryWidget::BindSlotRow(SInventorySlotRow& Row, const TSharedPtr<FRewardSlotItem>& Item) const
+{
+	Row.Item = Item;
+	
+	const bool bHasKey = SlotKeyBinds.IsValidIndex(Item->SlotIndex);
+	Row.KeyText->SetText(FText::AsNumber(Item->SlotIndex + 1));
+	Row.KeyText->SetColorAndOpacity(FSlateColor(bHasKey ? FLinearColor::White : FLinearColor(0.5f, 0.5f, 0.5f)));
+	Row.SlotNameText->SetText(GetSlotName(Item->SlotIndex));
+	RefreshSlotRow(Row);
+}
+
+void SInventoryWidget::RefreshSlotRow(SInventorySlotRow& Row) const
+{
+	URewardDataAsset* Reward = Row.Item->Reward;
+	Row.Border->SetBorderBackgroundColor(GetSlotBorderColor(*Row.Item));
+	Row.RewardText->SetText(GetSlotText(Reward));
+	Row.RewardText->SetColorAndOpacity(GetSlotTextColor(Reward));
+	Row.StatsText->SetText(Reward ? GetRewardStats(Reward) : FText::GetEmpty());
+}
+
+void SInventoryWidget::RefreshSlots()
+{
+	TArray<int32> ChangedSlots;
+	if (SlotModel.Sync(SlotManagerRef, ChangedSlots))
+	{
+		// Slots added or removed, the list regenerates and binds every visible row
+		SlotListView->RequestListRefresh();
+		return;
+	}
+	
+	// Only rows that are on screen exist, the rest are bound when they scroll in
+	for (int32 SlotIndex : ChangedSlots)
+	{
+		if (TSharedPtr<ITableRow> Row = SlotListView->WidgetFromItem(SlotModel.GetItem(SlotIndex)))
+		{
+			RefreshSlotRow(static_cast<SInventorySlotRow&>(Row->AsWidget().Get()));
+		}
+	}
 }
 
 void SInventoryWidget::SetSelectedReward(URewardDataAsset* Reward)
@@ -403,8 +470,8 @@ void SInventoryWidget::SetSelectedReward(URewardDataAsset* Reward)
 
 bool SInventoryWidget::HandleKeyPress(const FKey& Key)
 {
-	// Check for number keys 1-5
-	for (int32 i = 0; i < MaxSlots && i < SlotKeyBinds.Num(); i++)
+	// Number keys for the first slots
+	for (int32 i = 0; i < SlotModel.Num() && i < SlotKeyBinds.Num(); i++)
 	{
 		if (Key == SlotKeyBinds[i])
 		{
@@ -423,10 +490,9 @@ bool SInventoryWidget::HandleKeyPress(const FKey& Key)
 	return false;
 }
 
-FReply SInventoryWidget::OnSlotClicked(int32 SlotIndex)
+void SInventoryWidget::OnSlotClicked(int32 SlotIndex)
 {
 	EquipRewardToSlot(SlotIndex);
-	return FReply::Handled();
 }
 
 FReply SInventoryWidget::OnBackButtonClicked()
@@ -443,7 +509,7 @@ FReply SInventoryWidget::OnCancelButtonClicked()
 
 void SInventoryWidget::EquipRewardToSlot(int32 SlotIndex)
 {
-	if (!SlotManagerRef || !SelectedReward || SlotIndex < 0 || SlotIndex >= MaxSlots)
+	if (!SlotManagerRef || !SelectedReward || SlotIndex < 0 || SlotIndex >= SlotManagerRef->GetMaxSlots())
 		return;
 	
 	// Check if same reward is already in this slot (for enhancement)
@@ -467,15 +533,14 @@ void SInventoryWidget::EquipRewardToSlot(int32 SlotIndex)
 
 URewardDataAsset* SInventoryWidget::GetRewardInSlot(int32 SlotIndex) const
 {
-	if (!SlotManagerRef || SlotIndex < 0 || SlotIndex >= MaxSlots)
+	if (!SlotManagerRef)
 		return nullptr;
 	
 	return SlotManagerRef->GetRewardInSlot(SlotIndex);
 }
 
-FText SInventoryWidget::GetSlotText(int32 SlotIndex) const
+FText SInventoryWidget::GetSlotText(URewardDataAsset* Reward) const
 {
-	URewardDataAsset* Reward = GetRewardInSlot(SlotIndex);
 	if (Reward)
 	{
 		return Reward->RewardName;
@@ -483,6 +548,11 @@ FText SInventoryWidget::GetSlotText(int32 SlotIndex) const
 	return FText::FromString(TEXT("<Empty>"));
 }
 
+FText SInventoryWidget::GetSlotName(int32 SlotIndex) const
+{
+	return FText::FromString(SlotNames.IsValidIndex(SlotIndex) ? SlotNames[SlotIndex] : FString::Printf(TEXT("Slot %d"), SlotIndex + 1));
+}
+
 FText SInventoryWidget::GetRewardStats(URewardDataAsset* Reward) const
 {
 	if (!Reward)
@@ -513,14 +583,14 @@ FText SInventoryWidget::GetRewardStats(URewardDataAsset* Reward) const
 	return FText::FromString(StatsString);
 }
 
-FSlateColor SInventoryWidget::GetSlotBorderColor(int32 SlotIndex) const
+FSlateColor SInventoryWidget::GetSlotBorderColor(const FRewardSlotItem& Item) const
 {
-	if (SlotIndex == HoveredSlotIndex)
+	if (Item.SlotIndex == HoveredSlotIndex)
 	{
 		return FSlateColor(FLinearColor(0.2f, 0.6f, 1.0f));
 	}
 	
-	URewardDataAsset* Reward = GetRewardInSlot(SlotIndex);
+	URewardDataAsset* Reward = Item.Reward;
 	if (Reward)
 	{
 		return FSlateColor(GetCategoryColor(Reward->Category) * 0.5f);
@@ -529,9 +599,8 @@ FSlateColor SInventoryWidget::GetSlotBorderColor(int32 SlotIndex) const
 	return FSlateColor(FLinearColor(0.1f, 0.1f, 0.1f));
 }
 
-FSlateColor SInventoryWidget::GetSlotTextColor(int32 SlotIndex) const
+FSlateColor SInventoryWidget::GetSlotTextColor(URewardDataAsset* Reward) const
 {
-	URewardDataAsset* Reward = GetRewardInSlot(SlotIndex);
 	if (Reward)
 	{
 		return FSlateColor(GetCategoryColor(Reward->Category));
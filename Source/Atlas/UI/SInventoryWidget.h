@@ -3,14 +3,18 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/Views/SListView.h"
 #include "Atlas/Data/RewardDataAsset.h"
+#include "RewardSlotListModel.h"
 
 class USlotManagerComponent;
 class URewardDataAsset;
+class SInventorySlotRow;
 
 /**
  * Inventory widget for reward slot selection
- * Opens as a modal after reward selection to allow the player to choose which slot to equip the reward
+ * Opens as a modal after reward selection to allow the player to choose which slot to equip the reward.
+ * Slots are a virtualized list with one row per slot the slot manager has.
  */
 class ATLAS_API SInventoryWidget : public SCompoundWidget
 {
@@ -28,6 +32,9 @@ public:
 	// Set the reward to be equipped
 	void SetSelectedReward(URewardDataAsset* Reward);
 	
+	// Pull the slots from the slot manager, only rows whose slot changed are touched
+	void RefreshSlots();
+	
 	// Handle keyboard input for slot selection
 	bool HandleKeyPress(const FKey& Key);
 
@@ -35,19 +42,24 @@ private:
 	// Widget creation
 	TSharedRef<SWidget> CreateSelectedRewardPanel();
 	TSharedRef<SWidget> CreateSlotSelectionPanel();
-	TSharedRef<SWidget> CreateSlotButton(int32 SlotIndex);
+	
+	// Row generation, rows scrolled out of view are reused for the next slot
+	TSharedRef<ITableRow> OnGenerateSlotRow(TSharedPtr<FRewardSlotItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void BindSlotRow(SInventorySlotRow& Row, const TSharedPtr<FRewardSlotItem>& Item) const;
+	void RefreshSlotRow(SInventorySlotRow& Row) const;
 	
 	// Slot interaction
-	FReply OnSlotClicked(int32 SlotIndex);
+	void OnSlotClicked(int32 SlotIndex);
 	FReply OnBackButtonClicked();
 	FReply OnCancelButtonClicked();
 	
 	// Helper functions
 	URewardDataAsset* GetRewardInSlot(int32 SlotIndex) const;
-	FText GetSlotText(int32 SlotIndex) const;
+	FText GetSlotText(URewardDataAsset* Reward) const;
+	FText GetSlotName(int32 SlotIndex) const;
 	FText GetRewardStats(URewardDataAsset* Reward) const;
-	FSlateColor GetSlotBorderColor(int32 SlotIndex) const;
-	FSlateColor GetSlotTextColor(int32 SlotIndex) const;
+	FSlateColor GetSlotBorderColor(const FRewardSlotItem& Item) const;
+	FSlateColor GetSlotTextColor(URewardDataAsset* Reward) const;
 	FLinearColor GetCategoryColor(ERewardCategory Category) const;
 	FString GetCategoryName(ERewardCategory Category) const;
 	
@@ -67,8 +79,12 @@ private:
 	// Selection state
 	int32 HoveredSlotIndex;
 	
-	// Slot configuration
-	static constexpr int32 MaxSlots = 5;
+	// One item per slot, diffed against the slot manager on refresh
+	FRewardSlotListModel SlotModel;
+	TSharedPtr<SListView<TSharedPtr<FRewardSlotItem>>> SlotListView;
+	TRewardSlotRowPool<SInventorySlotRow> RowPool;
+	
+	// Names and keys of the first slots, later slots are numbered and clicked
 	static const TArray<FString> SlotNames;
 	static const TArray<FKey> SlotKeyBinds;
 };
\ No newline at end of file
@@ -6,7 +6,6 @@
 
 void SRewardSelectionWidget::Construct(const FArguments& InArgs)
 {
-	RewardChoices = InArgs._RewardChoices;
 	OnRewardSelectedDelegate = InArgs._OnRewardSelected;
 	OnSelectionCancelledDelegate = InArgs._OnSelectionCancelled;
 	RunManagerRef = InArgs._RunManager;
@@ -79,51 +78,96 @@ void SRewardSelectionWidget::Construct(const FArguments& InArgs)
 			]
 		]
 	];
+	
+	SetRewardChoices(InArgs._RewardChoices);
 }
 
-TSharedRef<SWidget> SRewardSelectionWidget::CreateRewardSelectionArea()
+void SRewardSelectionWidget::SetRewardChoices(const TArray<URewardDataAsset*>& InRewardChoices)
 {
-	TSharedRef<SHorizontalBox> RewardBox = SNew(SHorizontalBox);
+	RewardChoices = InRewardChoices;
+	SelectedRewardIndex = -1;
 	
-	// Create reward buttons
-	for (int32 i = 0; i < RewardChoices.Num(); i++)
+	for (int32 i = 0; i < Cards.Num(); i++)
 	{
-		if (RewardChoices[i])
-		{
-			RewardBox->AddSlot()
-			.FillWidth(1.0f)
-			.Padding(10.0f, 0.0f)
-			[
-				CreateRewardButton(RewardChoices[i], i)
-			];
-		}
+		BindRewardCard(Cards[i], RewardChoices.IsValidIndex(i) ? RewardChoices[i] : nullptr);
 	}
 	
-	return RewardBox;
+	if (RewardChoices.Num() > Cards.Num())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Reward selection only shows %d of %d rewards"), Cards.Num(), RewardChoices.Num());
+	}
 }
 
-TSharedRef<SWidget> SRewardSelectionWidget::CreateRewardButton(URewardDataAsset* Reward, int32 Index)
+void SRewardSelectionWidget::BindRewardCard(FRewardCard& Card, URewardDataAsset* Reward)
 {
 	if (!Reward)
 	{
-		return SNew(SBox);
+		Card.Root->SetVisibility(EVisibility::Collapsed);
+		return;
+	}
+	
+	Card.NameText->SetText(Reward->RewardName);
+	Card.DescriptionText->SetText(Reward->Description);
+	Card.CategoryText->SetText(GetCategoryDisplayText(Reward->Category));
+	Card.CategoryText->SetColorAndOpacity(GetCategoryColor(Reward->Category));
+	
+	// Same brush, new texture, so the image has to be told to repaint
+	Card.IconBrush.SetResourceObject(Reward->Icon);
+	Card.IconImage->SetVisibility(Reward->Icon ? EVisibility::Visible : EVisibility::Collapsed);
+	Card.IconImage->Invalidate(EInvalidateWidgetReason::Paint);
+	
+	Card.Root->SetVisibility(EVisibility::Visible);
+}
+
+TSharedRef<SWidget> SRewardSelectionWidget::CreateRewardSelectionArea()
+{
+	TSharedRef<SHorizontalBox> RewardBox = SNew(SHorizontalBox);
+	
+	// Create every reward button up front, unused ones stay collapsed
+	Cards.SetNum(MaxRewardChoices);
+	for (int32 i = 0; i < Cards.Num(); i++)
+	{
+		RewardBox->AddSlot()
+		.FillWidth(1.0f)
+		.Padding(10.0f, 0.0f)
+		[
+			CreateRewardButton(Cards[i], i)
+		];
 	}
 	
-	return SNew(SButton)
+	return RewardBox;
+}
+
+TSharedRef<SWidget> SRewardSelectionWidget::CreateRewardButton(FRewardCard& Card, int32 Index)
+{
+	Card.IconBrush.ImageSize = FVector2D(64.0f, 64.0f);
+	
+	return SAssignNew(Card.Root, SButton)
 		.OnClicked(this, &SRewardSelectionWidget::OnRewardButtonClicked, Index)
 		.ButtonStyle(&FCoreStyle::Get().GetWidgetStyle<FButtonStyle>("Button"))
 		.ContentPadding(FMargin(20.0f, 15.0f))
+		.Visibility(EVisibility::Collapsed)
 		[
 			SNew(SVerticalBox)
 			
+			// Reward icon
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Center)
+			.Padding(0.0f, 0.0f, 0.0f, 10.0f)
+			[
+				SAssignNew(Card.IconImage, SImage)
+				.Image(&Card.IconBrush)
+				.Visibility(EVisibility::Collapsed)
+			]
+			
 			// Reward name
 			+ SVerticalBox::Slot()
 			.AutoHeight()
 			.HAlign(HAlign_Center)
 			.Padding(0.0f, 0.0f, 0.0f, 10.0f)
 			[
-				SNew(STextBlock)
-				.Text(Reward->RewardName)
+				SAssignNew(Card.NameText, STextBlock)
 				.Font(FCoreStyle::GetDefaultFontStyle("Bold", 18))
 				.ColorAndOpacity(FLinearColor::White)
 				.Justification(ETextJustify::Center)
@@ -134,8 +178,7 @@ TSharedRef<SWidget> SRewardSelectionWidget::CreateRewardButton(URewardDataAsset*
 			.AutoHeight()
 			.HAlign(HAlign_Center)
 			[
-				SNew(STextBlock)
-				.Text(Reward->Description)
+				SAssignNew(Card.DescriptionText, STextBlock)
 				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 14))
 				.ColorAndOpacity(FLinearColor(0.8f, 0.8f, 0.8f, 1.0f))
 				.AutoWrapText(true)
@@ -148,11 +191,9 @@ TSharedRef<SWidget> SRewardSelectionWidget::CreateRewardButton(URewardDataAsset*
 			.HAlign(HAlign_Center)
 			.Padding(0.0f, 10.0f, 0.0f, 0.0f)
 			[
-				SNew(STextBlock)
-				.Text(GetCategoryDisplayText(Reward->Category))
-				.Font(FCoreStyle::GetDefaultFontStyle("Italic", 12))
-				.ColorAndOpacity(GetCategoryColor(Reward->Category))
+				SAssignNew(Card.CategoryText, STextBlock)
 				.Justification(ETextJustify::Center)
+				.Font(FCoreStyle::GetDefaultFontStyle("Italic", 12))
 			]
 		];
 }
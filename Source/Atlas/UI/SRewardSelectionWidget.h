@@ -8,9 +8,13 @@
 // Forward declarations
 class URewardDataAsset;
 class URunManagerComponent;
+class STextBlock;
+class SImage;
 
 /**
- * Slate widget for reward selection after defeating enemies
+ * Slate widget for reward selection after defeating enemies.
+ * Builds a fixed set of reward cards once; SetRewardChoices rebinds them so the same
+ * widget can be shown again for every room.
  */
 class ATLAS_API SRewardSelectionWidget : public SCompoundWidget
 {
@@ -30,7 +34,27 @@ public:
 	/** Constructs this widget with InArgs */
 	void Construct(const FArguments& InArgs);
 
+	/** Show a new set of rewards in the existing cards, extra cards are collapsed */
+	void SetRewardChoices(const TArray<URewardDataAsset*>& InRewardChoices);
+
+	/** Most rewards a room can offer (URoomDataAsset::RewardChoiceCount) */
+	static constexpr int32 MaxRewardChoices = 4;
+
 private:
+	/** Widgets of one reward card, kept to rebind without rebuilding */
+	struct FRewardCard
+	{
+		TSharedPtr<SWidget> Root;
+		TSharedPtr<SImage> IconImage;
+		TSharedPtr<STextBlock> NameText;
+		TSharedPtr<STextBlock> DescriptionText;
+		TSharedPtr<STextBlock> CategoryText;
+		FSlateBrush IconBrush;
+	};
+
+	/** Fill one card from a reward, or collapse it if there is none */
+	void BindRewardCard(FRewardCard& Card, URewardDataAsset* Reward);
+
 	/** Handle reward selection */
 	FReply OnRewardButtonClicked(int32 RewardIndex);
 	
@@ -38,7 +62,7 @@ private:
 	FReply OnCancelButtonClicked();
 	
 	/** Create reward button widget */
-	TSharedRef<SWidget> CreateRewardButton(URewardDataAsset* Reward, int32 Index);
+	TSharedRef<SWidget> CreateRewardButton(FRewardCard& Card, int32 Index);
 	
 	/** Get reward button text */
 	FText GetRewardButtonText(URewardDataAsset* Reward, int32 Index) const;
@@ -59,6 +83,9 @@ private:
 	/** The reward choices */
 	TArray<URewardDataAsset*> RewardChoices;
 	
+	/** One card per possible choice, sized once in Construct so the brushes never move */
+	TArray<FRewardCard> Cards;
+	
 	/** Callback delegates */
 	FSimpleDelegate OnRewardSelectedDelegate;
 	FSimpleDelegate OnSelectionCancelledDelegate;
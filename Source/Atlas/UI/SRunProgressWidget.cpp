@@ -30,6 +30,8 @@ void SRunProgressWidget::Construct(const FArguments& InArgs)
 	
 	RoomCompletionStatus.SetNum(TotalRooms);
 	RoomFailureStatus.SetNum(TotalRooms);
+	RoomIcons.SetNum(TotalRooms);
+	RoomConnectors.SetNum(TotalRooms);
 	
 	ChildSlot
 	[
@@ -71,8 +73,8 @@ void SRunProgressWidget::Construct(const FArguments& InArgs)
 			.AutoHeight()
 			.Padding(0, 0, 0, 5)
 			[
-				SNew(STextBlock)
-				.Text(this, &SRunProgressWidget::GetCurrentRoomName)
+				SAssignNew(RoomNameText, STextBlock)
+				.Text(GetCurrentRoomName())
 				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 12))
 				.ColorAndOpacity(FSlateColor(FLinearColor(0.8f, 0.8f, 0.8f)))
 			]
@@ -130,6 +132,11 @@ void SRunProgressWidget::Construct(const FArguments& InArgs)
 			]
 		]
 	];
+	
+	RefreshHealthBar();
+	RefreshPoiseBar();
+	RefreshIntegrityBar();
+	RefreshRoomIcons();
 }
 
 TSharedRef<SWidget> SRunProgressWidget::CreateRoomProgressBar()
@@ -155,9 +162,8 @@ TSharedRef<SWidget> SRunProgressWidget::CreateRoomProgressBar()
 				.WidthOverride(20)
 				.HeightOverride(2)
 				[
-					SNew(SBorder)
+					SAssignNew(RoomConnectors[i + 1], SBorder)
 					.BorderImage(FAppStyle::GetBrush("WhiteBrush"))
-					.BorderBackgroundColor(this, &SRunProgressWidget::GetRoomIconColor, i + 1)
 				]
 			];
 		}
@@ -168,9 +174,8 @@ TSharedRef<SWidget> SRunProgressWidget::CreateRoomProgressBar()
 
 TSharedRef<SWidget> SRunProgressWidget::CreateRoomIcon(int32 RoomIndex)
 {
-	return SNew(SBorder)
+	return SAssignNew(RoomIcons[RoomIndex], SBorder)
 		.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
-		.BorderBackgroundColor(this, &SRunProgressWidget::GetRoomIconColor, RoomIndex)
 		.HAlign(HAlign_Center)
 		.VAlign(VAlign_Center)
 		[
@@ -192,9 +197,7 @@ TSharedRef<SWidget> SRunProgressWidget::CreateHealthBar()
 	return SNew(SBox)
 		.HeightOverride(20)
 		[
-			SNew(SProgressBar)
-			.Percent(this, &SRunProgressWidget::GetHealthPercent)
-			.FillColorAndOpacity(this, &SRunProgressWidget::GetHealthBarColor)
+			SAssignNew(HealthBar, SProgressBar)
 			.BackgroundImage(FAppStyle::GetBrush("ProgressBar.Background"))
 		];
 }
@@ -204,9 +207,7 @@ TSharedRef<SWidget> SRunProgressWidget::CreatePoiseBar()
 	return SNew(SBox)
 		.HeightOverride(20)
 		[
-			SNew(SProgressBar)
-			.Percent(this, &SRunProgressWidget::GetPoisePercent)
-			.FillColorAndOpacity(this, &SRunProgressWidget::GetPoiseBarColor)
+			SAssignNew(PoiseBar, SProgressBar)
 			.BackgroundImage(FAppStyle::GetBrush("ProgressBar.Background"))
 		];
 }
@@ -216,9 +217,7 @@ TSharedRef<SWidget> SRunProgressWidget::CreateIntegrityBar()
 	return SNew(SBox)
 		.HeightOverride(20)
 		[
-			SNew(SProgressBar)
-			.Percent(this, &SRunProgressWidget::GetIntegrityPercent)
-			.FillColorAndOpacity(this, &SRunProgressWidget::GetIntegrityBarColor)
+			SAssignNew(IntegrityBar, SProgressBar)
 			.BackgroundImage(FAppStyle::GetBrush("ProgressBar.Background"))
 		];
 }
@@ -231,38 +230,55 @@ void SRunProgressWidget::UpdateRoomProgress(int32 InCurrentRoomIndex, const TArr
 	{
 		RoomCompletionStatus[i] = true;
 	}
+	
+	RefreshRoomIcons();
 }
 
 void SRunProgressWidget::UpdateHealth(float InCurrentHealth, float InMaxHealth)
 {
+	if (InCurrentHealth == CurrentHealth && InMaxHealth == MaxHealth)
+	{
+		return;
+	}
+	
 	CurrentHealth = InCurrentHealth;
 	MaxHealth = InMaxHealth;
+	RefreshHealthBar();
 }
 
 void SRunProgressWidget::UpdatePoise(float InCurrentPoise, float InMaxPoise)
 {
+	if (InCurrentPoise == CurrentPoise && InMaxPoise == MaxPoise)
+	{
+		return;
+	}
+	
 	CurrentPoise = InCurrentPoise;
 	MaxPoise = InMaxPoise;
+	RefreshPoiseBar();
 }
 
 void SRunProgressWidget::UpdateIntegrity(float InCurrentIntegrity, float InMaxIntegrity)
 {
+	if (InCurrentIntegrity == CurrentIntegrity && InMaxIntegrity == MaxIntegrity)
+	{
+		return;
+	}
+	
 	CurrentIntegrity = InCurrentIntegrity;
 	MaxIntegrity = InMaxIntegrity;
+	RefreshIntegrityBar();
 }
 
 void SRunProgressWidget::UpdateCurrentRoomInfo(URoomDataAsset* RoomData)
 {
-	CurrentRoomData = RoomData;
-	
-	// Force widget to refresh with new room data
-	if (CurrentRoomData)
-	{
-		Invalidate(EInvalidateWidgetReason::Paint);
-	}
-	else
+	if (RoomData == CurrentRoomData)
 	{
+		return;
 	}
+	
+	CurrentRoomData = RoomData;
+	RoomNameText->SetText(GetCurrentRoomName());
 }
 
 void SRunProgressWidget::SetRoomCompleted(int32 RoomIndex)
@@ -271,6 +287,7 @@ void SRunProgressWidget::SetRoomCompleted(int32 RoomIndex)
 	{
 		RoomCompletionStatus[RoomIndex] = true;
 		RoomFailureStatus[RoomIndex] = false;
+		RefreshRoomIcons();
 	}
 }
 
@@ -280,6 +297,44 @@ void SRunProgressWidget::SetRoomFailed(int32 RoomIndex)
 	{
 		RoomFailureStatus[RoomIndex] = true;
 		RoomCompletionStatus[RoomIndex] = false;
+		RefreshRoomIcons();
+	}
+}
+
+void SRunProgressWidget::RefreshHealthBar()
+{
+	// The setters skip invalidation when handed the value the bar already has
+	HealthBar->SetPercent(GetHealthPercent());
+	HealthBar->SetFillColorAndOpacity(GetHealthBarColor());
+}
+
+void SRunProgressWidget::RefreshPoiseBar()
+{
+	PoiseBar->SetPercent(GetPoisePercent());
+	PoiseBar->SetFillColorAndOpacity(GetPoiseBarColor());
+}
+
+void SRunProgressWidget::RefreshIntegrityBar()
+{
+	IntegrityBar->SetPercent(GetIntegrityPercent());
+	IntegrityBar->SetFillColorAndOpacity(GetIntegrityBarColor());
+}
+
+void SRunProgressWidget::RefreshRoomIcons()
+{
+	for (int32 i = 0; i < TotalRooms; i++)
+	{
+		const FSlateColor Color = GetRoomIconColor(i);
+		
+		if (RoomIcons[i].IsValid())
+		{
+			RoomIcons[i]->SetBorderBackgroundColor(Color);
+		}
+		
+		if (RoomConnectors[i].IsValid())
+		{
+			RoomConnectors[i]->SetBorderBackgroundColor(Color);
+		}
 	}
 }
 
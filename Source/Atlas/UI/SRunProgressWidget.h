@@ -8,10 +8,14 @@ class URunManagerComponent;
 class UHealthComponent;
 class UStationIntegrityComponent;
 class URoomDataAsset;
+class SBorder;
+class SProgressBar;
+class STextBlock;
 enum class ERoomHazard : uint8;
 
 /**
  * Slate widget for displaying run progress, room progression, and vital stats
+ * Values are pushed in (see UHUDViewModel), children are only updated when their value changes
  */
 class ATLAS_API SRunProgressWidget : public SCompoundWidget
 {
@@ -40,6 +44,11 @@ private:
 	TSharedRef<SWidget> CreateIntegrityBar();
 	TSharedRef<SWidget> CreateRoomIcon(int32 RoomIndex);
 	
+	void RefreshHealthBar();
+	void RefreshPoiseBar();
+	void RefreshIntegrityBar();
+	void RefreshRoomIcons();
+	
 	FText GetRoomProgressText() const;
 	FText GetHealthText() const;
 	FText GetPoiseText() const;
@@ -74,6 +83,15 @@ private:
 	
 	URoomDataAsset* CurrentRoomData;
 	
+	TSharedPtr<SProgressBar> HealthBar;
+	TSharedPtr<SProgressBar> PoiseBar;
+	TSharedPtr<SProgressBar> IntegrityBar;
+	TSharedPtr<STextBlock> RoomNameText;
+	
+	/** Room icons by index, connectors by the index of the room they lead to */
+	TArray<TSharedPtr<SBorder>> RoomIcons;
+	TArray<TSharedPtr<SBorder>> RoomConnectors;
+	
 	static constexpr int32 TotalRooms = 5;
 	static constexpr float LowHealthThreshold = 0.25f;
 	static constexpr float LowIntegrityThreshold = 0.25f;
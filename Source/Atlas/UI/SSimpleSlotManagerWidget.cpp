@@ -4,6 +4,7 @@
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/SOverlay.h"
+#include "Widgets/Views/STableRow.h"
 #include "Atlas/Components/SlotManagerComponent.h"
 #include "Atlas/Data/RewardDataAsset.h"
 #include "Styling/SlateColor.h"
@@ -17,6 +18,62 @@ const TArray<FString> SSimpleSlotManagerWidget::SlotNames = {
 	TEXT("Accessory")
 };
 
+/**
+ * One line of the compact slot list. SSimpleSlotManagerWidget fills it, and fills it
+ * again when the row is reused for another slot.
+ */
+class SSimpleSlotRow : public STableRow<TSharedPtr<FRewardSlotItem>>
+{
+public:
+	SLATE_BEGIN_ARGS(SSimpleSlotRow) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable)
+	{
+		STableRow<TSharedPtr<FRewardSlotItem>>::Construct(
+			STableRow<TSharedPtr<FRewardSlotItem>>::FArguments()
+			.Padding(FMargin(0, 2))
+			.ShowSelection(false)
+			[
+				SNew(SHorizontalBox)
+				
+				// Key bind
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(0, 0, 5, 0)
+				[
+					SAssignNew(KeyBindText, STextBlock)
+					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 10))
+					.ColorAndOpacity(FSlateColor(FLinearColor(0.5f, 0.5f, 0.5f)))
+				]
+				
+				// Slot name
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(0, 0, 5, 0)
+				[
+					SAssignNew(SlotNameText, STextBlock)
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
+					.ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.6f, 0.6f)))
+				]
+				
+				// Reward name or <Empty>
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				[
+					SAssignNew(RewardText, STextBlock)
+					.Font(FCoreStyle::GetDefaultFontStyle("Bold", 10))
+				]
+			],
+			InOwnerTable);
+	}
+
+	TSharedPtr<FRewardSlotItem> Item;
+	TSharedPtr<STextBlock> KeyBindText;
+	TSharedPtr<STextBlock> SlotNameText;
+	TSharedPtr<STextBlock> RewardText;
+};
+
 void SSimpleSlotManagerWidget::Construct(const FArguments& InArgs)
 {
 	SlotManagerRef = InArgs._SlotManager;
@@ -52,102 +109,80 @@ void SSimpleSlotManagerWidget::Construct(const FArguments& InArgs)
 						.ColorAndOpacity(FSlateColor(FLinearColor(0.8f, 0.8f, 0.8f)))
 					]
 					
-					// Slot list
+					// Slot list, scrolls when there are more slots than fit
 					+ SVerticalBox::Slot()
 					.FillHeight(1.0f)
 					[
-						SNew(SVerticalBox)
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						.Padding(0, 2)
-						[
-							CreateSlotWidget(0)
-						]
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						.Padding(0, 2)
-						[
-							CreateSlotWidget(1)
-						]
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						.Padding(0, 2)
-						[
-							CreateSlotWidget(2)
-						]
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						.Padding(0, 2)
-						[
-							CreateSlotWidget(3)
-						]
-						+ SVerticalBox::Slot()
-						.AutoHeight()
-						.Padding(0, 2)
-						[
-							CreateSlotWidget(4)
-						]
+						SAssignNew(SlotListView, SListView<TSharedPtr<FRewardSlotItem>>)
+						.ListItemsSource(&SlotModel.GetItems())
+						.SelectionMode(ESelectionMode::None)
+						.OnGenerateRow(this, &SSimpleSlotManagerWidget::OnGenerateSlotRow)
+						.OnRowReleased_Lambda([this](const TSharedRef<ITableRow>& Row) { RowPool.Release(Row); })
 					]
 				]
 			]
 		]
 	];
+	
+	RefreshSlots();
 }
 
-TSharedRef<SWidget> SSimpleSlotManagerWidget::CreateSlotWidget(int32 SlotIndex)
+TSharedRef<ITableRow> SSimpleSlotManagerWidget::OnGenerateSlotRow(TSharedPtr<FRewardSlotItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
 {
-	return SNew(SHorizontalBox)
-		
-		// Key bind
-		+ SHorizontalBox::Slot()
-		.AutoWidth()
-		.Padding(0, 0, 5, 0)
-		[
-			SNew(STextBlock)
-			.Text(GetSlotKeyBindText(SlotIndex))
-			.Font(FCoreStyle::GetDefaultFontStyle("Bold", 10))
-			.ColorAndOpacity(FSlateColor(FLinearColor(0.5f, 0.5f, 0.5f)))
-		]
-		
-		// Slot name
-		+ SHorizontalBox::Slot()
-		.AutoWidth()
-		.Padding(0, 0, 5, 0)
-		[
-			SNew(STextBlock)
-			.Text(FText::FromString(SlotNames[SlotIndex] + TEXT(":")))
-			.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
-			.ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.6f, 0.6f)))
-		]
-		
-		// Reward name or <Empty>
-		+ SHorizontalBox::Slot()
-		.FillWidth(1.0f)
-		[
-			SNew(STextBlock)
-			.Text(this, &SSimpleSlotManagerWidget::GetSlotText, SlotIndex)
-			.Font(FCoreStyle::GetDefaultFontStyle("Bold", 10))
-			.ColorAndOpacity(this, &SSimpleSlotManagerWidget::GetSlotTextColor, SlotIndex)
-		];
+	TSharedPtr<SSimpleSlotRow> Row = RowPool.Acquire();
+	if (!Row.IsValid())
+	{
+		Row = RowPool.Track(SNew(SSimpleSlotRow, OwnerTable));
+	}
+	
+	BindSlotRow(*Row, Item);
+	return Row.ToSharedRef();
+}
+
+void SSimpleSlotManagerWidget::BindSlotRow(SSimpleSlotRow& Row, const TSharedPtr<FRewardSlotItem>& Item) const
+{
+	Row.Item = Item;
+	Row.KeyBindText->SetText(GetSlotKeyBindText(Item->SlotIndex));
+	Row.SlotNameText->SetText(GetSlotNameText(Item->SlotIndex));
+	RefreshSlotRow(Row);
+}
+
+void SSimpleSlotManagerWidget::RefreshSlotRow(SSimpleSlotRow& Row) const
+{
+	Row.RewardText->SetText(GetSlotText(Row.Item->Reward));
+	Row.RewardText->SetColorAndOpacity(GetSlotTextColor(Row.Item->Reward));
 }
 
 void SSimpleSlotManagerWidget::RefreshSlots()
 {
-	// Force a visual refresh of all slots
-	Invalidate(EInvalidateWidgetReason::Paint);
+	TArray<int32> ChangedSlots;
+	if (SlotModel.Sync(SlotManagerRef, ChangedSlots))
+	{
+		// Slots added or removed, the list regenerates and binds every visible row
+		SlotListView->RequestListRefresh();
+		return;
+	}
+	
+	// Only rows that are on screen exist, the rest are bound when they scroll in
+	for (int32 SlotIndex : ChangedSlots)
+	{
+		if (TSharedPtr<ITableRow> Row = SlotListView->WidgetFromItem(SlotModel.GetItem(SlotIndex)))
+		{
+			RefreshSlotRow(static_cast<SSimpleSlotRow&>(Row->AsWidget().Get()));
+		}
+	}
 }
 
 URewardDataAsset* SSimpleSlotManagerWidget::GetRewardInSlot(int32 SlotIndex) const
 {
-	if (!SlotManagerRef || SlotIndex < 0 || SlotIndex >= MaxSlots)
+	if (!SlotManagerRef)
 		return nullptr;
 	
 	return SlotManagerRef->GetRewardInSlot(SlotIndex);
 }
 
-FText SSimpleSlotManagerWidget::GetSlotText(int32 SlotIndex) const
+FText SSimpleSlotManagerWidget::GetSlotText(URewardDataAsset* Reward) const
 {
-	URewardDataAsset* Reward = GetRewardInSlot(SlotIndex);
 	if (Reward)
 	{
 		return Reward->RewardName;
@@ -157,16 +192,21 @@ FText SSimpleSlotManagerWidget::GetSlotText(int32 SlotIndex) const
 
 FText SSimpleSlotManagerWidget::GetSlotKeyBindText(int32 SlotIndex) const
 {
-	if (SlotIndex >= 0 && SlotIndex < MaxSlots)
+	if (SlotIndex >= 0)
 	{
 		return FText::Format(FText::FromString(TEXT("[{0}]")), FText::AsNumber(SlotIndex + 1));
 	}
 	return FText::GetEmpty();
 }
 
-FSlateColor SSimpleSlotManagerWidget::GetSlotTextColor(int32 SlotIndex) const
+FText SSimpleSlotManagerWidget::GetSlotNameText(int32 SlotIndex) const
+{
+	const FString SlotName = SlotNames.IsValidIndex(SlotIndex) ? SlotNames[SlotIndex] : FString::Printf(TEXT("Slot %d"), SlotIndex + 1);
+	return FText::FromString(SlotName + TEXT(":"));
+}
+
+FSlateColor SSimpleSlotManagerWidget::GetSlotTextColor(URewardDataAsset* Reward) const
 {
-	URewardDataAsset* Reward = GetRewardInSlot(SlotIndex);
 	if (Reward)
 	{
 		return FSlateColor(GetCategoryColor(Reward->Category));
@@ -3,14 +3,19 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/Views/SListView.h"
 #include "Atlas/Data/RewardDataAsset.h"
+#include "RewardSlotListModel.h"
 
 class USlotManagerComponent;
 class URewardDataAsset;
+class STextBlock;
+class SSimpleSlotRow;
 
 /**
  * Compact slot manager widget - Always visible at bottom-right
- * Shows currently equipped rewards in a simple read-only display
+ * Shows currently equipped rewards in a simple read-only display.
+ * Slots are a virtualized list, one row per slot the slot manager has.
  */
 class ATLAS_API SSimpleSlotManagerWidget : public SCompoundWidget
 {
@@ -21,27 +26,34 @@ public:
 
 	void Construct(const FArguments& InArgs);
 	
-	// Refresh the display when slots change
+	// Refresh the display when slots change, only slots whose reward changed are touched
 	void RefreshSlots();
 	
 	// Get the reward in a specific slot
 	URewardDataAsset* GetRewardInSlot(int32 SlotIndex) const;
 
 private:
-	// Widget creation
-	TSharedRef<SWidget> CreateSlotWidget(int32 SlotIndex);
+	// Row generation, rows scrolled out of view are reused for the next slot
+	TSharedRef<ITableRow> OnGenerateSlotRow(TSharedPtr<FRewardSlotItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void BindSlotRow(SSimpleSlotRow& Row, const TSharedPtr<FRewardSlotItem>& Item) const;
+	void RefreshSlotRow(SSimpleSlotRow& Row) const;
 	
 	// Display helpers
-	FText GetSlotText(int32 SlotIndex) const;
+	FText GetSlotText(URewardDataAsset* Reward) const;
 	FText GetSlotKeyBindText(int32 SlotIndex) const;
-	FSlateColor GetSlotTextColor(int32 SlotIndex) const;
+	FText GetSlotNameText(int32 SlotIndex) const;
+	FSlateColor GetSlotTextColor(URewardDataAsset* Reward) const;
 	FLinearColor GetCategoryColor(ERewardCategory Category) const;
 	
 private:
 	// Core reference
 	USlotManagerComponent* SlotManagerRef;
 	
-	// Slot configuration
-	static constexpr int32 MaxSlots = 5; // Head, Body, Arms, Legs, Accessory
+	// One item per slot, diffed against the slot manager on refresh
+	FRewardSlotListModel SlotModel;
+	TSharedPtr<SListView<TSharedPtr<FRewardSlotItem>>> SlotListView;
+	TRewardSlotRowPool<SSimpleSlotRow> RowPool;
+	
+	// Names of the first slots, later slots are just numbered
 	static const TArray<FString> SlotNames;
 };
\ No newline at end of file
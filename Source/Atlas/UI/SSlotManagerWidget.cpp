@@ -1,15 +1,101 @@
 #include "SSlotManagerWidget.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SBorder.h"
-#include "Widgets/Layout/SGridPanel.h"
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Views/STableRow.h"
 #include "Atlas/Components/SlotManagerComponent.h"
 #include "Atlas/Data/RewardDataAsset.h"
 #include "Styling/SlateColor.h"
 
+namespace
+{
+	// 80x80 slot plus the border and tile padding
+	constexpr float SlotTileSize = 94.0f;
+}
+
+DECLARE_DELEGATE_OneParam(FOnSlotTileClicked, int32);
+
+/**
+ * One slot in the slot tile view. SSlotManagerWidget fills it, and fills it again when
+ * the tile is reused for another slot.
+ */
+class SSlotTile : public STableRow<TSharedPtr<FRewardSlotItem>>
+{
+public:
+	SLATE_BEGIN_ARGS(SSlotTile) {}
+		SLATE_EVENT(FOnSlotTileClicked, OnSlotClicked)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable)
+	{
+		OnSlotClicked = InArgs._OnSlotClicked;
+		
+		STableRow<TSharedPtr<FRewardSlotItem>>::Construct(
+			STableRow<TSharedPtr<FRewardSlotItem>>::FArguments()
+			.Padding(2.0f)
+			.ShowSelection(false)
+			[
+				SNew(SButton)
+				.OnClicked(this, &SSlotTile::HandleClicked)
+				.ButtonColorAndOpacity(FLinearColor(0.1f, 0.1f, 0.1f))
+				[
+					SAssignNew(Border, SBorder)
+					.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+					.Padding(5.0f)
+					[
+						SNew(SBox)
+						.WidthOverride(80)
+						.HeightOverride(80)
+						.HAlign(HAlign_Center)
+						.VAlign(VAlign_Center)
+						[
+							SNew(SOverlay)
+							
+							+ SOverlay::Slot()
+							.HAlign(HAlign_Center)
+							.VAlign(VAlign_Center)
+							[
+								SAssignNew(RewardText, STextBlock)
+								.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
+							]
+							
+							+ SOverlay::Slot()
+							.HAlign(HAlign_Center)
+							.VAlign(VAlign_Center)
+							[
+								SAssignNew(EmptyText, STextBlock)
+								.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
+								.ColorAndOpacity(FSlateColor(FLinearColor(0.5f, 0.5f, 0.5f)))
+							]
+						]
+					]
+				]
+			],
+			InOwnerTable);
+	}
+
+	TSharedPtr<FRewardSlotItem> Item;
+	TSharedPtr<SBorder> Border;
+	TSharedPtr<STextBlock> RewardText;
+	TSharedPtr<STextBlock> EmptyText;
+
+private:
+	FReply HandleClicked()
+	{
+		// The tile may have been reused, so the slot comes from the item it shows now
+		if (Item.IsValid())
+		{
+			OnSlotClicked.ExecuteIfBound(Item->SlotIndex);
+		}
+		return FReply::Handled();
+	}
+
+	FOnSlotTileClicked OnSlotClicked;
+};
+
 void SSlotManagerWidget::Construct(const FArguments& InArgs)
 {
 	SlotManagerRef = InArgs._SlotManager;
@@ -51,84 +137,43 @@ void SSlotManagerWidget::Construct(const FArguments& InArgs)
 			]
 		]
 	];
+	
+	RefreshSlots();
+	RefreshInfoPanel();
 }
 
 TSharedRef<SWidget> SSlotManagerWidget::CreateSlotGrid()
 {
-	TSharedRef<SGridPanel> Grid = SNew(SGridPanel);
-	
-	SlotWidgets.Empty();
-	
-	for (int32 i = 0; i < MaxSlots; i++)
-	{
-		int32 Row = i / GridColumns;
-		int32 Col = i % GridColumns;
-		
-		TSharedPtr<SWidget> SlotWidget = CreateSlotWidget(i);
-		SlotWidgets.Add(SlotWidget);
-		
-		Grid->AddSlot(Col, Row)
-		.Padding(2.0f)
-		[
-			SlotWidget.ToSharedRef()
-		];
-	}
-	
-	return Grid;
+	return SAssignNew(SlotTileView, STileView<TSharedPtr<FRewardSlotItem>>)
+		.ListItemsSource(&SlotModel.GetItems())
+		.SelectionMode(ESelectionMode::None)
+		.ItemWidth(SlotTileSize)
+		.ItemHeight(SlotTileSize)
+		.OnGenerateTile(this, &SSlotManagerWidget::OnGenerateSlotTile)
+		.OnTileReleased_Lambda([this](const TSharedRef<ITableRow>& Tile) { TilePool.Release(Tile); });
 }
 
-TSharedRef<SWidget> SSlotManagerWidget::CreateSlotWidget(int32 SlotIndex)
+TSharedRef<ITableRow> SSlotManagerWidget::OnGenerateSlotTile(TSharedPtr<FRewardSlotItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
 {
-	return SNew(SButton)
-		.OnClicked(this, &SSlotManagerWidget::OnSlotClicked, SlotIndex)
-		.ButtonColorAndOpacity(FLinearColor(0.1f, 0.1f, 0.1f))
-		[
-			SNew(SBorder)
-			.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
-			.BorderBackgroundColor(this, &SSlotManagerWidget::GetSlotBorderColor, SlotIndex)
-			.Padding(5.0f)
-			[
-				SNew(SBox)
-				.WidthOverride(80)
-				.HeightOverride(80)
-				.HAlign(HAlign_Center)
-				.VAlign(VAlign_Center)
-				[
-					SNew(SOverlay)
-					
-					+ SOverlay::Slot()
-					.HAlign(HAlign_Center)
-					.VAlign(VAlign_Center)
-					[
-						SNew(STextBlock)
-						.Text(this, &SSlotManagerWidget::GetSlotText, SlotIndex)
-						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
-						.ColorAndOpacity(this, &SSlotManagerWidget::GetSlotTextColor, SlotIndex)
-						.Visibility(this, &SSlotManagerWidget::GetSlotContentVisibility, SlotIndex)
-					]
-					
-					+ SOverlay::Slot()
-					.HAlign(HAlign_Center)
-					.VAlign(VAlign_Center)
-					[
-						SNew(STextBlock)
-						.Text(FText::Format(NSLOCTEXT("SlotManager", "SlotNumber", "Slot {0}"), FText::AsNumber(SlotIndex + 1)))
-						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
-						.ColorAndOpacity(FSlateColor(FLinearColor(0.5f, 0.5f, 0.5f)))
-						.Visibility(this, &SSlotManagerWidget::GetEmptySlotVisibility, SlotIndex)
-					]
-				]
-			]
-		];
+	TSharedPtr<SSlotTile> Tile = TilePool.Acquire();
+	if (!Tile.IsValid())
+	{
+		Tile = TilePool.Track(SNew(SSlotTile, OwnerTable)
+			.OnSlotClicked(this, &SSlotManagerWidget::OnSlotClicked));
+	}
+	
+	Tile->Item = Item;
+	Tile->EmptyText->SetText(FText::Format(NSLOCTEXT("SlotManager", "SlotNumber", "Slot {0}"), FText::AsNumber(Item->SlotIndex + 1)));
+	RefreshSlotTile(*Tile);
+	return Tile.ToSharedRef();
 }
 
 TSharedRef<SWidget> SSlotManagerWidget::CreateInfoPanel()
 {
-	return SNew(SBorder)
+	return SAssignNew(InfoPanel, SBorder)
 		.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
 		.BorderBackgroundColor(FLinearColor(0.05f, 0.05f, 0.05f))
 		.Padding(10.0f)
-		.Visibility(this, &SSlotManagerWidget::GetInfoPanelVisibility)
 		[
 			SNew(SVerticalBox)
 			
@@ -136,8 +181,7 @@ TSharedRef<SWidget> SSlotManagerWidget::CreateInfoPanel()
 			.AutoHeight()
 			.Padding(0, 0, 0, 5)
 			[
-				SNew(STextBlock)
-				.Text(this, &SSlotManagerWidget::GetSelectedRewardName)
+				SAssignNew(SelectedNameText, STextBlock)
 				.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
 				.ColorAndOpacity(FSlateColor(FLinearColor::White))
 			]
@@ -149,8 +193,7 @@ TSharedRef<SWidget> SSlotManagerWidget::CreateInfoPanel()
 				SNew(SScrollBox)
 				+ SScrollBox::Slot()
 				[
-					SNew(STextBlock)
-					.Text(this, &SSlotManagerWidget::GetSelectedRewardDescription)
+					SAssignNew(SelectedDescriptionText, STextBlock)
 					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
 					.ColorAndOpacity(FSlateColor(FLinearColor(0.8f, 0.8f, 0.8f)))
 					.AutoWrapText(true)
@@ -161,8 +204,7 @@ TSharedRef<SWidget> SSlotManagerWidget::CreateInfoPanel()
 			.AutoHeight()
 			.Padding(0, 5, 0, 5)
 			[
-				SNew(STextBlock)
-				.Text(this, &SSlotManagerWidget::GetSelectedRewardStats)
+				SAssignNew(SelectedStatsText, STextBlock)
 				.Font(FCoreStyle::GetDefaultFontStyle("Regular", 10))
 				.ColorAndOpacity(FSlateColor(FLinearColor(0.6f, 0.8f, 1.0f)))
 			]
@@ -176,24 +218,18 @@ TSharedRef<SWidget> SSlotManagerWidget::CreateInfoPanel()
 				.FillWidth(1.0f)
 				.Padding(0, 0, 5, 0)
 				[
-					SNew(SButton)
+					SAssignNew(ClearSlotButton, SButton)
 					.Text(FText::FromString(TEXT("Clear Slot")))
 					.OnClicked(this, &SSlotManagerWidget::OnClearSlotClicked)
-					.IsEnabled_Lambda([this]() { 
-						return SelectedSlotIndex >= 0 && GetRewardInSlot(SelectedSlotIndex) != nullptr; 
-					})
 				]
 				
 				+ SHorizontalBox::Slot()
 				.FillWidth(1.0f)
 				.Padding(5, 0, 0, 0)
 				[
-					SNew(SButton)
+					SAssignNew(EquipRewardButton, SButton)
 					.Text(FText::FromString(TEXT("Equip Reward")))
 					.OnClicked(this, &SSlotManagerWidget::OnEquipRewardClicked)
-					.IsEnabled_Lambda([this]() { 
-						return SelectedSlotIndex >= 0 && PendingReward != nullptr; 
-					})
 				]
 			]
 		];
@@ -201,28 +237,105 @@ TSharedRef<SWidget> SSlotManagerWidget::CreateInfoPanel()
 
 void SSlotManagerWidget::RefreshSlots()
 {
-	if (!SlotManagerRef)
+	TArray<int32> ChangedSlots;
+	if (SlotModel.Sync(SlotManagerRef, ChangedSlots))
+	{
+		// Slots added or removed, the view regenerates and binds every visible tile
+		if (!SlotModel.GetItems().IsValidIndex(SelectedSlotIndex))
+		{
+			SelectedSlotIndex = -1;
+		}
+		SlotTileView->RequestListRefresh();
+		RefreshInfoPanel();
 		return;
+	}
+	
+	for (int32 SlotIndex : ChangedSlots)
+	{
+		RefreshSlotVisuals(SlotIndex);
+		if (SlotIndex == SelectedSlotIndex)
+		{
+			RefreshInfoPanel();
+		}
+	}
 }
 
 void SSlotManagerWidget::UpdateSlot(int32 SlotIndex)
 {
-	if (!SlotManagerRef || SlotIndex < 0 || SlotIndex >= MaxSlots)
-		return;
+	// The diff is a pointer compare per slot, so one slot refreshes the same way as all of them
+	RefreshSlots();
 }
 
 void SSlotManagerWidget::SelectSlot(int32 SlotIndex)
 {
-	if (SlotIndex >= 0 && SlotIndex < MaxSlots)
+	if (SlotIndex >= 0 && SlotIndex < SlotModel.Num())
 	{
+		const int32 PreviousSlotIndex = SelectedSlotIndex;
 		SelectedSlotIndex = SlotIndex;
+		
+		if (PreviousSlotIndex != SlotIndex)
+		{
+			if (PreviousSlotIndex >= 0)
+			{
+				RefreshSlotVisuals(PreviousSlotIndex);
+			}
+			RefreshSlotVisuals(SlotIndex);
+			RefreshInfoPanel();
+		}
+		
 		OnSlotChangedDelegate.ExecuteIfBound();
 	}
 }
 
+void SSlotManagerWidget::RefreshSlotVisuals(int32 SlotIndex)
+{
+	// Only tiles that are on screen exist, the rest are bound when they scroll in
+	if (TSharedPtr<ITableRow> Tile = SlotTileView->WidgetFromItem(SlotModel.GetItem(SlotIndex)))
+	{
+		RefreshSlotTile(static_cast<SSlotTile&>(Tile->AsWidget().Get()));
+	}
+}
+
+void SSlotManagerWidget::RefreshSlotTile(SSlotTile& Tile) const
+{
+	URewardDataAsset* Reward = Tile.Item->Reward;
+	const bool bHasReward = Reward != nullptr;
+	
+	Tile.Border->SetBorderBackgroundColor(GetSlotBorderColor(*Tile.Item));
+	Tile.RewardText->SetText(GetSlotText(Reward));
+	Tile.RewardText->SetColorAndOpacity(GetSlotTextColor(Reward));
+	Tile.RewardText->SetVisibility(bHasReward ? EVisibility::Visible : EVisibility::Collapsed);
+	Tile.EmptyText->SetVisibility(bHasReward ? EVisibility::Collapsed : EVisibility::Visible);
+}
+
+int32 SSlotManagerWidget::GetNumTilesGenerated() const
+{
+	return SlotTileView->GetNumGeneratedChildren();
+}
+
+void SSlotManagerWidget::ScrollToSlot(int32 SlotIndex)
+{
+	if (TSharedPtr<FRewardSlotItem> Item = SlotModel.GetItem(SlotIndex))
+	{
+		SlotTileView->RequestScrollIntoView(Item);
+	}
+}
+
+void SSlotManagerWidget::RefreshInfoPanel()
+{
+	InfoPanel->SetVisibility(SelectedSlotIndex >= 0 ? EVisibility::Visible : EVisibility::Collapsed);
+	SelectedNameText->SetText(GetSelectedRewardName());
+	SelectedDescriptionText->SetText(GetSelectedRewardDescription());
+	SelectedStatsText->SetText(GetSelectedRewardStats());
+	
+	const bool bSlotHasReward = GetDisplayedReward(SelectedSlotIndex) != nullptr;
+	ClearSlotButton->SetEnabled(bSlotHasReward);
+	EquipRewardButton->SetEnabled(SelectedSlotIndex >= 0 && PendingReward != nullptr);
+}
+
 void SSlotManagerWidget::ClearSlot(int32 SlotIndex)
 {
-	if (!SlotManagerRef || SlotIndex < 0 || SlotIndex >= MaxSlots)
+	if (!SlotManagerRef || SlotIndex < 0 || SlotIndex >= SlotManagerRef->GetMaxSlots())
 		return;
 	
 	SlotManagerRef->RemoveReward(SlotIndex);
@@ -231,7 +344,7 @@ void SSlotManagerWidget::ClearSlot(int32 SlotIndex)
 
 void SSlotManagerWidget::EquipReward(URewardDataAsset* Reward, int32 SlotIndex)
 {
-	if (!SlotManagerRef || !Reward || SlotIndex < 0 || SlotIndex >= MaxSlots)
+	if (!SlotManagerRef || !Reward || SlotIndex < 0 || SlotIndex >= SlotManagerRef->GetMaxSlots())
 		return;
 	
 	SlotManagerRef->EquipReward(Reward, SlotIndex);
@@ -241,16 +354,15 @@ void SSlotManagerWidget::EquipReward(URewardDataAsset* Reward, int32 SlotIndex)
 
 URewardDataAsset* SSlotManagerWidget::GetRewardInSlot(int32 SlotIndex) const
 {
-	if (!SlotManagerRef || SlotIndex < 0 || SlotIndex >= MaxSlots)
+	if (!SlotManagerRef || SlotIndex < 0 || SlotIndex >= SlotManagerRef->GetMaxSlots())
 		return nullptr;
 	
 	return SlotManagerRef->GetRewardInSlot(SlotIndex);
 }
 
-FReply SSlotManagerWidget::OnSlotClicked(int32 SlotIndex)
+void SSlotManagerWidget::OnSlotClicked(int32 SlotIndex)
 {
 	SelectSlot(SlotIndex);
-	return FReply::Handled();
 }
 
 FReply SSlotManagerWidget::OnClearSlotClicked()
@@ -268,13 +380,19 @@ FReply SSlotManagerWidget::OnEquipRewardClicked()
 	{
 		EquipReward(PendingReward, SelectedSlotIndex);
 		PendingReward = nullptr;
+		RefreshInfoPanel();
 	}
 	return FReply::Handled();
 }
 
-FText SSlotManagerWidget::GetSlotText(int32 SlotIndex) const
+URewardDataAsset* SSlotManagerWidget::GetDisplayedReward(int32 SlotIndex) const
+{
+	TSharedPtr<FRewardSlotItem> Item = SlotModel.GetItem(SlotIndex);
+	return Item.IsValid() ? Item->Reward : nullptr;
+}
+
+FText SSlotManagerWidget::GetSlotText(URewardDataAsset* Reward) const
 {
-	URewardDataAsset* Reward = GetRewardInSlot(SlotIndex);
 	if (Reward)
 	{
 		FString RewardNameStr = Reward->RewardName.ToString();
@@ -287,56 +405,47 @@ FText SSlotManagerWidget::GetSlotText(int32 SlotIndex) const
 
 FText SSlotManagerWidget::GetSelectedRewardName() const
 {
-	if (SelectedSlotIndex >= 0)
+	URewardDataAsset* Reward = GetDisplayedReward(SelectedSlotIndex);
+	if (Reward)
 	{
-		URewardDataAsset* Reward = GetRewardInSlot(SelectedSlotIndex);
-		if (Reward)
-		{
-			return Reward->RewardName;
-		}
+		return Reward->RewardName;
 	}
 	return FText::FromString(TEXT("No Reward Selected"));
 }
 
 FText SSlotManagerWidget::GetSelectedRewardDescription() const
 {
-	if (SelectedSlotIndex >= 0)
+	URewardDataAsset* Reward = GetDisplayedReward(SelectedSlotIndex);
+	if (Reward)
 	{
-		URewardDataAsset* Reward = GetRewardInSlot(SelectedSlotIndex);
-		if (Reward)
-		{
-			return Reward->Description;
-		}
+		return Reward->Description;
 	}
 	return FText::FromString(TEXT("Select a slot to view reward details."));
 }
 
 FText SSlotManagerWidget::GetSelectedRewardStats() const
 {
-	if (SelectedSlotIndex >= 0)
+	URewardDataAsset* Reward = GetDisplayedReward(SelectedSlotIndex);
+	if (Reward)
 	{
-		URewardDataAsset* Reward = GetRewardInSlot(SelectedSlotIndex);
-		if (Reward)
+		FString StatsString = FString::Printf(TEXT("Slot Cost: %d"), Reward->SlotCost);
+		if (Reward->MaxStackLevel > 1)
 		{
-			FString StatsString = FString::Printf(TEXT("Slot Cost: %d"), Reward->SlotCost);
-			if (Reward->MaxStackLevel > 1)
-			{
-				StatsString += FString::Printf(TEXT(" | Max Stack Level: %d"), Reward->MaxStackLevel);
-			}
-			return FText::FromString(StatsString);
+			StatsString += FString::Printf(TEXT(" | Max Stack Level: %d"), Reward->MaxStackLevel);
 		}
+		return FText::FromString(StatsString);
 	}
 	return FText::GetEmpty();
 }
 
-FSlateColor SSlotManagerWidget::GetSlotBorderColor(int32 SlotIndex) const
+FSlateColor SSlotManagerWidget::GetSlotBorderColor(const FRewardSlotItem& Item) const
 {
-	if (SlotIndex == SelectedSlotIndex)
+	if (Item.SlotIndex == SelectedSlotIndex)
 	{
 		return FSlateColor(FLinearColor(0.2f, 0.6f, 1.0f));
 	}
 	
-	URewardDataAsset* Reward = GetRewardInSlot(SlotIndex);
+	URewardDataAsset* Reward = Item.Reward;
 	if (Reward)
 	{
 		switch (Reward->Category)
@@ -359,27 +468,11 @@ FSlateColor SSlotManagerWidget::GetSlotBorderColor(int32 SlotIndex) const
 	return FSlateColor(FLinearColor(0.1f, 0.1f, 0.1f));
 }
 
-FSlateColor SSlotManagerWidget::GetSlotTextColor(int32 SlotIndex) const
+FSlateColor SSlotManagerWidget::GetSlotTextColor(URewardDataAsset* Reward) const
 {
-	URewardDataAsset* Reward = GetRewardInSlot(SlotIndex);
 	if (Reward)
 	{
 		return FSlateColor(FLinearColor::White);
 	}
 	return FSlateColor(FLinearColor(0.5f, 0.5f, 0.5f));
 }
-
-EVisibility SSlotManagerWidget::GetInfoPanelVisibility() const
-{
-	return SelectedSlotIndex >= 0 ? EVisibility::Visible : EVisibility::Collapsed;
-}
-
-EVisibility SSlotManagerWidget::GetSlotContentVisibility(int32 SlotIndex) const
-{
-	return GetRewardInSlot(SlotIndex) != nullptr ? EVisibility::Visible : EVisibility::Collapsed;
-}
-
-EVisibility SSlotManagerWidget::GetEmptySlotVisibility(int32 SlotIndex) const
-{
-	return GetRewardInSlot(SlotIndex) == nullptr ? EVisibility::Visible : EVisibility::Collapsed;
-}
\ No newline at end of file
@@ -3,12 +3,20 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/Views/STileView.h"
+#include "RewardSlotListModel.h"
 
 class USlotManagerComponent;
 class URewardDataAsset;
+class SBorder;
+class SButton;
+class STextBlock;
+class SSlotTile;
 
 /**
  * Slate widget for displaying and managing equipped rewards in slots
+ * Slots are a virtualized tile view with one tile per slot the slot manager has.
+ * RefreshSlots pulls the slot contents once and only touches tiles whose reward changed
  */
 class ATLAS_API SSlotManagerWidget : public SCompoundWidget
 {
@@ -30,27 +38,36 @@ public:
 	
 	int32 GetSelectedSlotIndex() const { return SelectedSlotIndex; }
 	URewardDataAsset* GetRewardInSlot(int32 SlotIndex) const;
+	
+	int32 GetNumSlots() const { return SlotModel.Num(); }
+	
+	/** Tiles built over the widget's lifetime, stays near the visible count however many slots there are */
+	int32 GetNumTilesCreated() const { return TilePool.GetNumCreated(); }
+	int32 GetNumTilesGenerated() const;
+	void ScrollToSlot(int32 SlotIndex);
 
 private:
 	TSharedRef<SWidget> CreateSlotGrid();
-	TSharedRef<SWidget> CreateSlotWidget(int32 SlotIndex);
 	TSharedRef<SWidget> CreateInfoPanel();
 	
-	FReply OnSlotClicked(int32 SlotIndex);
+	// Tile generation, tiles scrolled out of view are reused for the next slot
+	TSharedRef<ITableRow> OnGenerateSlotTile(TSharedPtr<FRewardSlotItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void RefreshSlotVisuals(int32 SlotIndex);
+	void RefreshSlotTile(SSlotTile& Tile) const;
+	void RefreshInfoPanel();
+	
+	void OnSlotClicked(int32 SlotIndex);
 	FReply OnClearSlotClicked();
 	FReply OnEquipRewardClicked();
 	
-	FText GetSlotText(int32 SlotIndex) const;
+	URewardDataAsset* GetDisplayedReward(int32 SlotIndex) const;
+	FText GetSlotText(URewardDataAsset* Reward) const;
 	FText GetSelectedRewardName() const;
 	FText GetSelectedRewardDescription() const;
 	FText GetSelectedRewardStats() const;
 	
-	FSlateColor GetSlotBorderColor(int32 SlotIndex) const;
-	FSlateColor GetSlotTextColor(int32 SlotIndex) const;
-	
-	EVisibility GetInfoPanelVisibility() const;
-	EVisibility GetSlotContentVisibility(int32 SlotIndex) const;
-	EVisibility GetEmptySlotVisibility(int32 SlotIndex) const;
+	FSlateColor GetSlotBorderColor(const FRewardSlotItem& Item) const;
+	FSlateColor GetSlotTextColor(URewardDataAsset* Reward) const;
 
 private:
 	USlotManagerComponent* SlotManagerRef;
@@ -61,8 +78,15 @@ private:
 	int32 SelectedSlotIndex;
 	URewardDataAsset* PendingReward;
 	
-	TArray<TSharedPtr<SWidget>> SlotWidgets;
+	/** Reward each slot showed at the last refresh */
+	FRewardSlotListModel SlotModel;
+	TSharedPtr<STileView<TSharedPtr<FRewardSlotItem>>> SlotTileView;
+	TRewardSlotRowPool<SSlotTile> TilePool;
 	
-	static constexpr int32 MaxSlots = 6;
-	static constexpr int32 GridColumns = 3;
+	TSharedPtr<SBorder> InfoPanel;
+	TSharedPtr<STextBlock> SelectedNameText;
+	TSharedPtr<STextBlock> SelectedDescriptionText;
+	TSharedPtr<STextBlock> SelectedStatsText;
+	TSharedPtr<SButton> ClearSlotButton;
+	TSharedPtr<SButton> EquipRewardButton;
 };
\ No newline at end of file